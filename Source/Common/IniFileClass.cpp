@@ -1,368 +1,347 @@
 #include "stdafx.h"
-#include <stdlib.h>
+#include "Util.h"
+#include <stdio.h>
+#include <algorithm>
+#ifdef _WIN32
+#include <Windows.h>
+#endif
 
 CIniFileBase::CIniFileBase(CFileBase & FileObject, const char * FileName) :
-    m_lastSectionSearch(0),
-    m_CurrentSectionFilePos(0),
-    m_LineFeed("\r\n"),
-    m_ReadOnly(true),
-    m_InstantFlush(true),
     m_File(FileObject),
     m_FileName(FileName),
-    m_CurrentSectionDirty(false)
+    m_Open(false),
+    m_Loaded(false),
+    m_ReadOnly(true),
+    m_InstantFlush(true),
+    m_LineFeed("\r\n"),
+    m_UseIndex(false),
+    m_EditCount(0),
+    m_SavedEditCount(0),
+    m_WriteThread(NULL),
+    m_WriteQuit(false),
+    m_WriteStopped(false)
 {
 }
 
 CIniFileBase::~CIniFileBase(void)
 {
-    SaveCurrentSection();
+    StopWriteThread();
+    WriteChanges();
 }
 
-void CIniFileBase::fInsertSpaces(int Pos, int NoOfSpaces)
+bool CIniFileBase::LoadFile(void)
 {
-    enum { fIS_MvSize = 0x2000 };
-
-    unsigned char Data[fIS_MvSize + 1];
-    int SizeToRead, result;
-    long end, WritePos;
-
-    m_File.Seek(0, CFileBase::end);
-    end = m_File.GetPosition();
-
-    if (NoOfSpaces > 0)
+    if (m_Loaded)
     {
-        stdstr_f SpaceBuffer("%*c", NoOfSpaces, ' ');
-
-        do
-        {
-            SizeToRead = end - Pos;
-            if (SizeToRead > fIS_MvSize) { SizeToRead = fIS_MvSize; }
-            if (SizeToRead > 0)
-            {
-                m_File.Seek(SizeToRead * -1, CFileBase::current);
-                WritePos = m_File.GetPosition();
-                memset(Data, 0, sizeof(Data));
-                result = m_File.Read(Data, SizeToRead);
-                m_File.Seek(WritePos, CFileBase::begin);
-                end = WritePos;
-
-                m_File.Write(SpaceBuffer.c_str(), (uint32_t)SpaceBuffer.length());
-                m_File.Write(Data, result);
-                m_File.Seek(WritePos, CFileBase::begin);
-            }
-        } while (SizeToRead > 0);
+        return true;
     }
-    if (NoOfSpaces < 0)
+    if (!m_Open)
     {
-        int ReadPos = Pos + (NoOfSpaces * -1);
-        int WritePos = Pos;
+        return false;
+    }
+    if (!m_File.IsOpen() && !m_File.Open(m_FileName.c_str(), CFileBase::modeRead))
+    {
+        return false;
+    }
 
-        do
-        {
-            SizeToRead = end - ReadPos;
-            if (SizeToRead > fIS_MvSize) { SizeToRead = fIS_MvSize; }
-            m_File.Seek(ReadPos, CFileBase::begin);
-            m_File.Read(Data, SizeToRead);
-            m_File.Seek(WritePos, CFileBase::begin);
-            m_File.Write(Data, SizeToRead);
-            ReadPos += SizeToRead;
-            WritePos += SizeToRead;
-        } while (SizeToRead > 0);
+    uint32_t DataSize = m_File.GetLength();
+    AUTO_PTR<char> Data(new char[DataSize + 1]);
+    m_File.Seek(0, CFileBase::begin);
+    DataSize = m_File.Read(Data.get(), DataSize);
+    Data.get()[DataSize] = 0;
 
-        m_File.Seek(WritePos, CFileBase::begin);
-        stdstr_f SpaceBuffer("%*c", (NoOfSpaces * -1), ' ');
-        m_File.Write(SpaceBuffer.c_str(), (uint32_t)SpaceBuffer.length());
+    //nothing is read from the handle again and the file gets replaced when it is written
+    m_File.Close();
 
-        m_File.Seek(WritePos, CFileBase::begin);
-        m_File.SetEndOfFile();
-        m_File.Seek(0, CFileBase::begin);
-    }
+    ParseFile(Data.get(), DataSize);
+    m_Loaded = true;
+    return true;
 }
 
-int CIniFileBase::GetStringFromFile(char * & String, AUTO_PTR<char> &Data, int & MaxDataSize, int & DataSize, int & ReadPos)
+void CIniFileBase::ParseFile(const char * Data, uint32_t DataSize)
 {
-    enum { BufferIncrease = 0x2000 };
-    if (MaxDataSize == 0)
-    {
-        ReadPos = 0;
-        MaxDataSize = BufferIncrease;
-        Data.reset(new char[MaxDataSize]);
-        DataSize = m_File.Read(&Data.get()[DataSize], MaxDataSize);
-    }
+    static const uint8_t pUTF8[3] = { 0xef, 0xbb, 0xbf };
 
-    for (;;)
-    {
-        int count;
+    m_Sections.clear();
+    m_SectionIndex.clear();
+    m_Sections.push_back(INI_SECTION());
+    INI_SECTION * Section = &m_Sections.back();
+    bool FoundSection = false;
 
-        for (count = ReadPos; count < DataSize; count++)
+    std::string Buffer;
+    for (uint32_t ReadPos = 0; ReadPos < DataSize; )
+    {
+        const char * LineStart = &Data[ReadPos];
+        const char * LineEnd = (const char *)memchr(LineStart, '\n', DataSize - ReadPos);
+        uint32_t LineLen = LineEnd != NULL ? (uint32_t)(LineEnd - LineStart) : DataSize - ReadPos;
+        ReadPos += LineEnd != NULL ? LineLen + 1 : LineLen;
+        if (LineLen > 0 && LineStart[LineLen - 1] == '\r')
         {
-            if (Data.get()[count] == '\n')
-            {
-                int len = (count - ReadPos) + 1;
-                String = &Data.get()[ReadPos];
-                String[len - 1] = 0;
-                ReadPos = count + 1;
-                return len;
-            }
+            LineLen -= 1;
         }
 
-        if (ReadPos != 0)
+        INI_LINE Line;
+        Line.Text.assign(LineStart, LineLen);
+        Line.IsKey = false;
+
+        Buffer = Line.Text;
+        char * Input = &Buffer[0];
+        if (LineLen > 1 && strlen(CleanLine(Input)) > 1)
         {
-            if ((DataSize - ReadPos) > 0)
+            if (!FoundSection && !memcmp(Input, pUTF8, 3))
             {
-                memmove(Data.get(), &Data.get()[ReadPos], DataSize - ReadPos);
+                Input += 3;
             }
-            DataSize -= ReadPos;
-            ReadPos = 0;
-        }
-        else
-        {
-            //Increase buffer size
-            int NewMaxDataSize = MaxDataSize + BufferIncrease;
-            char * NewBuffer = new char[NewMaxDataSize];
-            if (NewBuffer == NULL)
+            if (Input[0] == '[')
             {
-                return -1;
+                m_Sections.push_back(INI_SECTION());
+                Section = &m_Sections.back();
+                Section->Header = Line.Text;
+
+                int lineEndPos = (int)strlen(Input) - 1;
+                if (Input[lineEndPos] == ']')
+                {
+                    //take off the ']' from the end of the string
+                    Input[lineEndPos] = 0;
+                    Section->Name = &Input[1];
+                    FoundSection = true;
+
+                    //when a section is in the file more than once the first one is used
+                    m_SectionIndex.insert(SECTION_INDEX::value_type(Section->Name, Section));
+                }
+                continue;
             }
-            memcpy(NewBuffer, Data.get(), DataSize);
-            MaxDataSize = NewMaxDataSize;
-            Data.reset(NewBuffer);
-        }
 
-        int dwRead = m_File.Read(&Data.get()[DataSize], MaxDataSize - DataSize);
-        if (dwRead == 0)
-        {
-            if (DataSize > 0)
+            char * Pos = strchr(Input, '=');
+            if (Pos != NULL)
             {
-                int len = DataSize + 1;
-                String = &Data.get()[ReadPos];
-                String[len - 1] = 0;
-                DataSize = 0;
-                ReadPos = 0;
-                return len;
+                char * Pos1 = Pos - 1;
+                while ((Pos1 > Input) && ((*Pos1 == ' ') || (*Pos1 == '\t')))
+                {
+                    Pos1--;
+                }
+                Pos1[1] = 0;
+
+                Line.IsKey = true;
+                Line.Key = Input;
+                Line.Value = &Pos[1];
             }
-            return -1;
         }
-        DataSize += dwRead;
+
+        LINE_LIST::iterator itr = Section->Lines.insert(Section->Lines.end(), Line);
+        if (itr->IsKey)
+        {
+            Section->Keys.insert(KEY_INDEX::value_type(itr->Key, itr));
+        }
     }
 }
 
-void CIniFileBase::SaveCurrentSection(void)
+CIniFileBase::INI_SECTION * CIniFileBase::FindSection(const char * lpSectionName)
 {
-    if (!m_CurrentSectionDirty)
-    {
-        return;
-    }
-    m_CurrentSectionDirty = false;
-    if (m_CurrentSection.length() == 0)
+    SECTION_INDEX::iterator itr = m_SectionIndex.find(lpSectionName);
+    return itr != m_SectionIndex.end() ? itr->second : NULL;
+}
+
+CIniFileBase::INI_SECTION & CIniFileBase::AddSection(const char * lpSectionName)
+{
+    //keep a blank line between the end of the file and the new section
+    INI_SECTION & LastSection = m_Sections.back();
+    if (LastSection.Lines.empty() ? !LastSection.Header.empty() : !LastSection.Lines.back().Text.empty())
     {
-        m_CurrentSection = "default";
+        INI_LINE Line;
+        Line.IsKey = false;
+        LastSection.Lines.push_back(Line);
     }
 
-    int lineFeedLen = (int)strlen(m_LineFeed);
+    m_Sections.push_back(INI_SECTION());
+    INI_SECTION & Section = m_Sections.back();
+    Section.Name = lpSectionName;
+    Section.Header = stdstr_f("[%s]", lpSectionName);
+    m_SectionIndex.insert(SECTION_INDEX::value_type(Section.Name, &Section));
+    return Section;
+}
 
-    if (m_CurrentSectionFilePos == -1)
+const CIniFileBase::INI_LINE * CIniFileBase::FindKey(const char * lpSectionName, const char * lpKeyName)
+{
+    if (!LoadFile())
+    {
+        return NULL;
+    }
+    INI_SECTION * Section = FindSection(lpSectionName);
+    if (Section == NULL)
     {
-        //Section has not been added yet
-        m_File.Seek(0, CFileBase::end);
+        return NULL;
+    }
+    KEY_INDEX::iterator itr = Section->Keys.find(lpKeyName);
+    return itr != Section->Keys.end() ? &(*itr->second) : NULL;
+}
 
-        int len = (int)m_CurrentSection.length() + (lineFeedLen * 2) + 5;
-        AUTO_PTR<char> SectionName(new char[len]);
-        if (m_File.GetLength() < (int)strlen(m_LineFeed))
-        {
-            sprintf(SectionName.get(), "[%s]%s", m_CurrentSection.c_str(), m_LineFeed);
-        }
-        else
-        {
-            sprintf(SectionName.get(), "%s[%s]%s", m_LineFeed, m_CurrentSection.c_str(), m_LineFeed);
-        }
-        m_File.Write(SectionName.get(), (int)strlen(SectionName.get()));
-        m_CurrentSectionFilePos = m_File.GetPosition();
-        m_SectionsPos.insert(FILELOC::value_type(m_CurrentSection, m_CurrentSectionFilePos));
+void CIniFileBase::FileChanged(void)
+{
+    m_EditCount += 1;
+    if (m_Index.IsOpen())
+    {
+        //the text file is the only copy of the change
+        m_Index.Close();
     }
-    else
+    if (!m_InstantFlush || m_ReadOnly)
     {
-        //increase/decrease space needed
-        int NeededBufferLen = 0;
+        return;
+    }
+    if (m_WriteThread == NULL)
+    {
+        m_WriteThread = new CThread((CThread::CTHREAD_START_ROUTINE)WriteThreadProc);
+        if (!m_WriteThread->Start(this))
         {
-            AUTO_PTR<char> LineData(NULL);
-            int len = 0;
-
-            for (KeyValueList::iterator iter = m_CurrentSectionData.begin(); iter != m_CurrentSectionData.end(); iter++)
-            {
-                int newLen = (int)iter->first.length() + (int)iter->second.length() + lineFeedLen + 5;
-                if (newLen > len)
-                {
-                    LineData.reset(new char[newLen]);
-                    len = newLen;
-                }
-                sprintf(LineData.get(), "%s=%s%s", iter->first.c_str(), iter->second.c_str(), m_LineFeed);
-                NeededBufferLen += (int)strlen(LineData.get());
-            }
+            //the edits are written by the next flush or close
+            delete m_WriteThread;
+            m_WriteThread = NULL;
+            return;
         }
-        int currentLen = 0;
+    }
+    m_WriteRequest.Trigger();
+}
 
-        m_File.Seek(m_CurrentSectionFilePos, CFileBase::begin);
+uint32_t CIniFileBase::EditCount(void)
+{
+    CGuard Guard(m_CS);
+    return m_EditCount;
+}
 
-        int MaxDataSize = 0, DataSize = 0, ReadPos = 0, result;
-        AUTO_PTR<char> Data;
-        char *Input = NULL;
+bool CIniFileBase::WriteQuit(void)
+{
+    CGuard Guard(m_CS);
+    return m_WriteQuit;
+}
 
-        //Skip first line as it is the section name
-        int StartPos = m_CurrentSectionFilePos;
-        int EndPos = StartPos;
-        do
+void CIniFileBase::WriteThreadProc(CIniFileBase * _this)
+{
+    while (!_this->WriteQuit())
+    {
+        _this->m_WriteRequest.IsTriggered(SyncEvent::INFINITE_TIMEOUT);
+        if (_this->WriteQuit())
         {
-            result = GetStringFromFile(Input, Data, MaxDataSize, DataSize, ReadPos);
-            if (result <= 1) { continue; }
-            if (strlen(CleanLine(Input)) <= 1 || Input[0] != '[')
-            {
-                EndPos = ((m_File.GetPosition() - DataSize) + ReadPos);
-
-                continue;
-            }
-            if (Input[0] == '[')
-            {
-                NeededBufferLen += lineFeedLen;
-            }
             break;
-        } while (result >= 0);
-        currentLen = EndPos - StartPos;
-
-        if (NeededBufferLen != currentLen)
-        {
-            fInsertSpaces(StartPos, NeededBufferLen - currentLen);
-            m_File.Flush();
-            ClearSectionPosList(StartPos);
         }
-        //set pointer to beginning of the start pos
-        m_File.Seek(StartPos, CFileBase::begin);
-    }
 
-    {
-        AUTO_PTR<char> LineData(NULL);
-        int len = 0;
-
-        for (KeyValueList::iterator iter = m_CurrentSectionData.begin(); iter != m_CurrentSectionData.end(); iter++)
+        //wait for the edits to stop, a run of settings being saved is one write
+        uint32_t EditCount;
+        do
         {
-            int newLen = (int)iter->first.length() + (int)iter->second.length() + lineFeedLen + 5;
-            if (newLen > len)
+            EditCount = _this->EditCount();
+            for (uint32_t i = 0; i < WriteDelay / 10 && !_this->WriteQuit(); i++)
             {
-                LineData.reset(new char[newLen]);
-                len = newLen;
+                pjutil::Sleep(10);
             }
-            sprintf(LineData.get(), "%s=%s%s", iter->first.c_str(), iter->second.c_str(), m_LineFeed);
-            m_File.Write(LineData.get(), (int)strlen(LineData.get()));
-        }
+        } while (EditCount != _this->EditCount() && !_this->WriteQuit());
+
+        _this->m_WriteRequest.Reset();
+        _this->WriteChanges();
     }
-    m_File.Flush();
+    CGuard Guard(_this->m_CS);
+    _this->m_WriteStopped = true;
 }
 
-bool CIniFileBase::MoveToSectionNameData(const char * lpSectionName, bool ChangeCurrentSection)
+void CIniFileBase::StopWriteThread(void)
 {
-    if (strcmp(lpSectionName, m_CurrentSection.c_str()) == 0)
+    if (m_WriteThread == NULL)
     {
-        return true;
+        return;
     }
-    if (ChangeCurrentSection)
     {
-        SaveCurrentSection();
-        m_CurrentSection = "";
+        CGuard Guard(m_CS);
+        m_WriteQuit = true;
     }
+    m_WriteRequest.Trigger();
 
-    AUTO_PTR<char> Data;
-    char *Input = NULL;
-    int MaxDataSize = 0, DataSize = 0, ReadPos = 0, result;
-
-    FILELOC_ITR iter = m_SectionsPos.find(std::string(lpSectionName));
-    bool bFoundSection = false;
-    if (iter != m_SectionsPos.end())
+    //the thread checks for quit every 10ms and a write always finishes, deleting it while it
+    //runs would terminate it, possibly part way through a write with m_WriteCS held
+    for (;;)
     {
-        if (ChangeCurrentSection)
         {
-            m_CurrentSection = iter->first;
-            m_CurrentSectionFilePos = iter->second;
+            CGuard Guard(m_CS);
+            if (m_WriteStopped)
+            {
+                break;
+            }
         }
-        m_File.Seek(iter->second, CFileBase::begin);
-        bFoundSection = true;
+        pjutil::Sleep(10);
     }
-    else
+    while (m_WriteThread->isRunning())
     {
-        m_File.Seek(m_lastSectionSearch, CFileBase::begin);
+        pjutil::Sleep(10);
+    }
+    delete m_WriteThread;
+    m_WriteThread = NULL;
+}
 
-        //long Fpos;
-        uint8_t pUTF8[3];
-        pUTF8[0] = 0xef;
-        pUTF8[1] = 0xbb;
-        pUTF8[2] = 0xbf;
+bool CIniFileBase::WriteChanges(void)
+{
+    //only one writer at a time, m_CS is not held while the file is written so reads and edits carry on
+    CGuard WriteGuard(m_WriteCS);
 
-        do
+    std::string Text;
+    uint32_t EditCount;
+    {
+        CGuard Guard(m_CS);
+        if (!m_Loaded || m_ReadOnly || m_EditCount == m_SavedEditCount)
         {
-            result = GetStringFromFile(Input, Data, MaxDataSize, DataSize, ReadPos);
-            if (result <= 1) { continue; }
-            if (strlen(CleanLine(Input)) <= 1) { continue; }
-
-            //We Only care about sections
-            char * CurrentSection = Input;
-
-            if (m_lastSectionSearch == 0 && !memcmp(CurrentSection, pUTF8, 3))
-            {
-                CurrentSection += 3;
-            }
-
-            if (CurrentSection[0] != '[') { continue; }
-            int lineEndPos = (int)strlen(CurrentSection) - 1;
-            if (CurrentSection[lineEndPos] != ']') { continue; }
-            //take off the ']' from the end of the string
-            CurrentSection[lineEndPos] = 0;
-            CurrentSection += 1;
-            m_lastSectionSearch = (m_File.GetPosition() - DataSize) + ReadPos;
-            m_SectionsPos.insert(FILELOC::value_type(CurrentSection, m_lastSectionSearch));
-
-            if (_stricmp(lpSectionName, CurrentSection) != 0)
-            {
-                continue;
-            }
+            return true;
+        }
+        EditCount = m_EditCount;
 
-            if (ChangeCurrentSection)
+        for (SECTION_LIST::const_iterator Section = m_Sections.begin(); Section != m_Sections.end(); Section++)
+        {
+            if (!Section->Header.empty())
             {
-                m_CurrentSection = lpSectionName;
-                m_CurrentSectionFilePos = m_lastSectionSearch;
+                Text += Section->Header;
+                Text += m_LineFeed;
             }
-            else
+            for (LINE_LIST::const_iterator Line = Section->Lines.begin(); Line != Section->Lines.end(); Line++)
             {
-                m_File.Seek(m_lastSectionSearch, CFileBase::begin);
+                Text += Line->Text;
+                Text += m_LineFeed;
             }
-            bFoundSection = true;
-            break;
-        } while (result >= 0);
+        }
     }
 
-    if (bFoundSection && ChangeCurrentSection)
-    {
-        m_CurrentSectionData.clear();
-        do
-        {
-            result = GetStringFromFile(Input, Data, MaxDataSize, DataSize, ReadPos);
-            if (result <= 1) { continue; }
-            if (strlen(CleanLine(Input)) <= 1) { continue; }
-            if (Input[0] == '[') { break; }
-            char * Pos = strchr(Input, '=');
-            if (Pos == NULL) { continue; }
-            char * Value = &Pos[1];
+    //write the whole file next to the ini and swap it in, so the ini is always either the old or the new version
+    stdstr TempFileName = m_FileName + ".tmp";
+    CFile TempFile;
+    bool Written = TempFile.Open(TempFileName.c_str(), CFileBase::modeWrite | CFileBase::modeCreate) && TempFile.IsOpen() &&
+        TempFile.Write(Text.c_str(), (uint32_t)Text.length()) &&
+        TempFile.Flush();
+    TempFile.Close();
 
-            char * Pos1 = Pos - 1;
-            while (((*Pos1 == ' ') || (*Pos1 == '\t')) && (Pos1 > Input))
-            {
-                Pos1--;
-            }
-            Pos1[1] = 0;
+    if (Written)
+    {
+#ifdef _WIN32
+        Written = MoveFileExA(TempFileName.c_str(), m_FileName.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+        Written = rename(TempFileName.c_str(), m_FileName.c_str()) == 0;
+#endif
+    }
+    if (!Written)
+    {
+        remove(TempFileName.c_str());
 
-            m_CurrentSectionData.insert(KeyValueList::value_type(Input, Value));
-        } while (result >= 0);
+        //the ini can not be replaced while something else has it open without delete sharing,
+        //netplay keeps the .cht open, so write over it where it is instead
+        CFile File;
+        Written = File.Open(m_FileName.c_str(), CFileBase::modeWrite | CFileBase::modeCreate | CFileBase::modeNoTruncate) && File.IsOpen() &&
+            File.Write(Text.c_str(), (uint32_t)Text.length()) &&
+            File.SetEndOfFile() &&
+            File.Flush();
+        File.Close();
+        if (!Written)
+        {
+            return false;
+        }
     }
 
-    return bFoundSection;
+    CGuard Guard(m_CS);
+    m_SavedEditCount = EditCount;
+    return true;
 }
 
 const char * CIniFileBase::CleanLine(char * Line)
@@ -414,7 +393,7 @@ void CIniFileBase::OpenIniFileReadOnly()
     if (m_File.Open(m_FileName.c_str(), CFileBase::modeRead))
     {
         m_ReadOnly = true;
-        m_File.Seek(0, CFileBase::begin);
+        m_Open = true;
     }
 }
 
@@ -514,104 +493,64 @@ void CIniFileBase::OpenIniFile(bool bCreate)
             }
         }
     }
-    m_File.Seek(0, CFileBase::begin);
+    m_Open = m_File.IsOpen();
 }
 
 bool CIniFileBase::IsEmpty()
 {
-    if (m_File.GetLength() == 0)
+    CGuard Guard(m_CS);
+    if (!LoadFile())
+    {
         return true;
-    return false;
+    }
+    for (SECTION_LIST::const_iterator Section = m_Sections.begin(); Section != m_Sections.end(); Section++)
+    {
+        if (!Section->Header.empty() || !Section->Lines.empty())
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 bool CIniFileBase::IsFileOpen(void)
 {
-    return m_File.IsOpen();
+    return m_Open;
 }
 
 bool CIniFileBase::DeleteSection(const char * lpSectionName)
 {
-    SaveCurrentSection();
-    ClearSectionPosList(0);
-    m_CurrentSection = "";
-    m_CurrentSectionData.clear();
-    m_CurrentSectionFilePos = -1;
-
-    stdstr_f strSection("[%s]", lpSectionName);
-
-    if (!m_File.IsOpen())
-    {
-        return false;
-    }
-    m_CurrentSectionFilePos = 0;
-    m_File.Seek(m_CurrentSectionFilePos, CFileBase::begin);
-
-    size_t dwSize = m_File.GetLength();
-    if (dwSize == 0)
-    {
-        return false;
-    }
-
-    AUTO_PTR<char> pData(new char[dwSize + 1]);
-    if (pData.get() == NULL)
+    CGuard Guard(m_CS);
+    if (!LoadFile())
     {
         return false;
     }
-    uint32_t dwRet = m_File.Read(pData.get(), dwSize);
-    if (dwRet == 0 || dwRet < dwSize)
+    INI_SECTION * Section = FindSection(lpSectionName);
+    if (Section == NULL)
     {
         return false;
     }
-    pData.get()[dwRet] = 0;
 
-    char *pSection = strstr(pData.get(), strSection.c_str());
-    if (pSection == NULL)
+    m_SectionIndex.erase(Section->Name);
+    for (SECTION_LIST::iterator itr = m_Sections.begin(); itr != m_Sections.end(); itr++)
     {
-        return false;
+        if (&(*itr) == Section)
+        {
+            m_Sections.erase(itr);
+            break;
+        }
     }
-    char tmp = pSection[0];
-    pSection[0] = 0;
-
-    std::string strNewData = pData.get();
-    pSection[0] = tmp;
 
-    char *pEndSection = pSection + strlen(strSection.c_str()), *Data = pData.get();
-    char *pNextSection = NULL;
-    int result, ReadPos = pEndSection - pData.get();
-    do
+    //a later copy of the section is now the one that is read
+    for (SECTION_LIST::iterator itr = m_Sections.begin(); itr != m_Sections.end(); itr++)
     {
-        char * Input = NULL;
-        int MaxDataSize = dwSize + 1;
-        result = -1;
-        for (int count = ReadPos; count < MaxDataSize; count++)
+        if (!itr->Header.empty() && _stricmp(itr->Name.c_str(), lpSectionName) == 0)
         {
-            if (Data[count] != '\n')
-            {
-                continue;
-            }
-            int len = (count - ReadPos) + 1;
-            Input = &Data[ReadPos];
-            ReadPos = count + 1;
-            result = len;
+            m_SectionIndex.insert(SECTION_INDEX::value_type(itr->Name, &(*itr)));
             break;
         }
-        if (result <= 1) { continue; }
-        std::string line(Input, result);
-        if (strlen(CleanLine((char *)line.c_str())) <= 1) { continue; }
-        if (line[0] != '[') { continue; }
-        pNextSection = Input;
-        break;
-    } while (result >= 0);
-
-    if (pNextSection)
-    {
-        strNewData += pNextSection;
     }
-
-    m_File.Seek(m_CurrentSectionFilePos, CFileBase::begin);
-    m_File.Write(strNewData.c_str(), (uint32_t)strlen(strNewData.c_str()));
-    m_File.Flush();
-    m_File.SetEndOfFile();
+    FileChanged();
     return true;
 }
 
@@ -624,14 +563,17 @@ bool CIniFileBase::GetString(const char * lpSectionName, const char * lpKeyName,
         lpSectionName = "default";
     }
 
-    if (m_File.IsOpen() && MoveToSectionNameData(lpSectionName, true))
+    if (m_Index.IsOpen())
     {
-        KeyValueList::iterator iter = m_CurrentSectionData.find(lpKeyName);
-        if (iter != m_CurrentSectionData.end())
-        {
-            Value = iter->second.c_str();
-            return true;
-        }
+        const char * IndexValue = m_Index.GetValue(lpSectionName, lpKeyName);
+        Value = IndexValue != NULL ? IndexValue : lpDefault;
+        return IndexValue != NULL;
+    }
+    const INI_LINE * Line = FindKey(lpSectionName, lpKeyName);
+    if (Line != NULL)
+    {
+        Value = Line->Value;
+        return true;
     }
     Value = lpDefault;
     return false;
@@ -646,30 +588,10 @@ stdstr CIniFileBase::GetString(const char * lpSectionName, const char * lpKeyNam
 
 uint32_t CIniFileBase::GetString(const char * lpSectionName, const char * lpKeyName, const char * lpDefault, char * lpReturnedString, uint32_t nSize)
 {
-    CGuard Guard(m_CS);
-
-    std::string strSection;
-
-    if (lpSectionName == NULL || strlen(lpSectionName) == 0)
-    {
-        strSection = "default";
-    }
-    else
-    {
-        strSection = lpSectionName;
-    }
+    stdstr Value;
+    GetString(lpSectionName, lpKeyName, lpDefault, Value);
 
-    if (m_File.IsOpen() && MoveToSectionNameData(strSection.c_str(), true))
-    {
-        KeyValueList::iterator iter = m_CurrentSectionData.find(lpKeyName);
-        if (iter != m_CurrentSectionData.end())
-        {
-            strncpy(lpReturnedString, iter->second.c_str(), nSize - 1);
-            lpReturnedString[nSize - 1] = 0;
-            return (uint32_t)strlen(lpReturnedString);
-        }
-    }
-    strncpy(lpReturnedString, lpDefault, nSize - 1);
+    strncpy(lpReturnedString, Value.c_str(), nSize - 1);
     lpReturnedString[nSize - 1] = 0;
     return (uint32_t)strlen(lpReturnedString);
 }
@@ -690,15 +612,21 @@ bool CIniFileBase::GetNumber(const char * lpSectionName, const char * lpKeyName,
         lpSectionName = "default";
     }
 
-    if (m_File.IsOpen() && MoveToSectionNameData(lpSectionName, true))
+    const char * StrValue = NULL;
+    if (m_Index.IsOpen())
     {
-        KeyValueList::iterator iter = m_CurrentSectionData.find(lpKeyName);
-        if (iter != m_CurrentSectionData.end())
-        {
-            Value = 0;
-            sscanf(iter->second.c_str(), "%u", &Value);
-            return true;
-        }
+        StrValue = m_Index.GetValue(lpSectionName, lpKeyName);
+    }
+    else
+    {
+        const INI_LINE * Line = FindKey(lpSectionName, lpKeyName);
+        StrValue = Line != NULL ? Line->Value.c_str() : NULL;
+    }
+    if (StrValue != NULL)
+    {
+        Value = 0;
+        sscanf(StrValue, "%u", &Value);
+        return true;
     }
     Value = nDefault;
     return false;
@@ -707,17 +635,21 @@ bool CIniFileBase::GetNumber(const char * lpSectionName, const char * lpKeyName,
 void  CIniFileBase::SaveString(const char * lpSectionName, const char * lpKeyName, const char * lpString)
 {
     CGuard Guard(m_CS);
-    if (!m_File.IsOpen())
+    if (!m_Open)
     {
         if (lpString)
         {
             OpenIniFile();
         }
-        if (!m_File.IsOpen())
+        if (!m_Open)
         {
             return;
         }
     }
+    if (!LoadFile())
+    {
+        return;
+    }
     std::string strSection;
 
     if (lpSectionName == NULL || strlen(lpSectionName) == 0)
@@ -729,43 +661,74 @@ void  CIniFileBase::SaveString(const char * lpSectionName, const char * lpKeyNam
         strSection = lpSectionName;
     }
 
-    if (!MoveToSectionNameData(strSection.c_str(), true))
+    INI_SECTION * Section = FindSection(strSection.c_str());
+    if (Section == NULL)
     {
-        m_CurrentSection = strSection;
-        m_CurrentSectionData.clear();
-        m_CurrentSectionFilePos = -1;
+        if (lpString == NULL)
+        {
+            return;
+        }
+        Section = &AddSection(strSection.c_str());
     }
 
-    KeyValueList::iterator iter = m_CurrentSectionData.find(lpKeyName);
-    if (iter != m_CurrentSectionData.end())
+    KEY_INDEX::iterator iter = Section->Keys.find(lpKeyName);
+    if (iter != Section->Keys.end())
     {
+        INI_LINE & Line = *iter->second;
         if (lpString)
         {
-            if (iter->second != lpString)
+            if (Line.Value == lpString)
             {
-                iter->second = lpString;
-                m_CurrentSectionDirty = true;
+                return;
             }
+            //the line is rewritten in place, anything else on it (such as a comment) goes
+            Line.Value = lpString;
+            Line.Text = Line.Key + "=" + Line.Value;
         }
         else
         {
-            m_CurrentSectionData.erase(iter);
-            m_CurrentSectionDirty = true;
+            Section->Lines.erase(iter->second);
+            Section->Keys.erase(iter);
+
+            //a later line with the same key is now the one that is read
+            for (LINE_LIST::iterator itr = Section->Lines.begin(); itr != Section->Lines.end(); itr++)
+            {
+                if (itr->IsKey && _stricmp(itr->Key.c_str(), lpKeyName) == 0)
+                {
+                    Section->Keys.insert(KEY_INDEX::value_type(itr->Key, itr));
+                    break;
+                }
+            }
         }
     }
     else
     {
-        if (lpString)
+        if (lpString == NULL)
         {
-            m_CurrentSectionData.insert(KeyValueList::value_type(lpKeyName, lpString));
-            m_CurrentSectionDirty = true;
+            return;
         }
+        INI_LINE Line;
+        Line.IsKey = true;
+        Line.Key = lpKeyName;
+        Line.Value = lpString;
+        Line.Text = Line.Key + "=" + Line.Value;
+
+        //new keys go after the last line of the section, ahead of the blank lines before the next one
+        LINE_LIST::iterator InsertPos = Section->Lines.end();
+        while (InsertPos != Section->Lines.begin())
+        {
+            LINE_LIST::iterator Prev = InsertPos;
+            Prev--;
+            if (!Prev->Text.empty())
+            {
+                break;
+            }
+            InsertPos = Prev;
+        }
+        LINE_LIST::iterator itr = Section->Lines.insert(InsertPos, Line);
+        Section->Keys.insert(KEY_INDEX::value_type(itr->Key, itr));
     }
-
-    if (m_InstantFlush)
-    {
-        SaveCurrentSection();
-    }
+    FileChanged();
 }
 
 void CIniFileBase::SaveNumber(const char * lpSectionName, const char * lpKeyName, uint32_t Value)
@@ -783,21 +746,27 @@ bool CIniFileBase::EntryExists(const char * lpSectionName, const char * lpKeyNam
         lpSectionName = "default";
     }
 
-    if (m_File.IsOpen() && MoveToSectionNameData(lpSectionName, true))
+    if (m_Index.IsOpen())
     {
-        KeyValueList::iterator iter = m_CurrentSectionData.find(lpKeyName);
-        if (iter != m_CurrentSectionData.end())
-        {
-            return true;
-        }
+        return m_Index.GetValue(lpSectionName, lpKeyName) != NULL;
     }
-    return false;
+    return FindKey(lpSectionName, lpKeyName) != NULL;
 }
 
 void CIniFileBase::FlushChanges(void)
+{
+    WriteChanges();
+}
+
+void CIniFileBase::UseIndex(void)
 {
     CGuard Guard(m_CS);
-    SaveCurrentSection();
+    m_UseIndex = true;
+    if (m_Open && m_EditCount == m_SavedEditCount && m_Index.Open(m_FileName.c_str()) && m_File.IsOpen())
+    {
+        //the file is only read again if something gets written
+        m_File.Close();
+    }
 }
 
 void CIniFileBase::SetAutoFlush(bool AutoFlush)
@@ -814,32 +783,30 @@ void CIniFileBase::GetKeyList(const char * lpSectionName, strlist &List)
     List.clear();
 
     CGuard Guard(m_CS);
-    if (!m_File.IsOpen())
-    {
-        return;
-    }
-
     if (lpSectionName == NULL || strlen(lpSectionName) == 0)
     {
         lpSectionName = "default";
     }
 
-    if (MoveToSectionNameData(lpSectionName, true))
+    if (m_Index.IsOpen())
     {
-        for (KeyValueList::iterator iter = m_CurrentSectionData.begin(); iter != m_CurrentSectionData.end(); iter++)
-        {
-            List.push_back(iter->first);
-        }
+        m_Index.GetKeyList(lpSectionName, List);
+        return;
+    }
+    INI_SECTION * Section = LoadFile() ? FindSection(lpSectionName) : NULL;
+    if (Section == NULL)
+    {
+        return;
+    }
+    for (KEY_INDEX::const_iterator iter = Section->Keys.begin(); iter != Section->Keys.end(); iter++)
+    {
+        List.push_back(iter->first);
     }
 }
 
 void CIniFileBase::GetKeyValueData(const char * lpSectionName, KeyValueData & List)
 {
     CGuard Guard(m_CS);
-    if (!m_File.IsOpen())
-    {
-        return;
-    }
 
     std::string strSection;
 
@@ -852,46 +819,17 @@ void CIniFileBase::GetKeyValueData(const char * lpSectionName, KeyValueData & Li
         strSection = lpSectionName;
     }
 
-    if (!MoveToSectionNameData(strSection.c_str(), false)) { return; }
-
-    int MaxDataSize = 0, DataSize = 0, ReadPos = 0, result;
-    AUTO_PTR<char> Data;
-    char *Input = NULL;
-    do
+    INI_SECTION * Section = LoadFile() ? FindSection(strSection.c_str()) : NULL;
+    if (Section == NULL)
     {
-        result = GetStringFromFile(Input, Data, MaxDataSize, DataSize, ReadPos);
-        if (result <= 1) { continue; }
-        if (strlen(CleanLine(Input)) <= 1) { continue; }
-        if (Input[0] == '[') { break; }
-        char * Pos = strchr(Input, '=');
-        if (Pos == NULL) { continue; }
-        Pos[0] = 0;
-
-        List.insert(KeyValueData::value_type(Input, &Pos[1]));
-    } while (result >= 0);
-}
-
-void CIniFileBase::ClearSectionPosList(long FilePos)
-{
-    if (FilePos <= 0)
-    {
-        m_SectionsPos.clear();
-        m_lastSectionSearch = 0;
+        return;
     }
-    else
+    for (LINE_LIST::const_iterator Line = Section->Lines.begin(); Line != Section->Lines.end(); Line++)
     {
-        FILELOC::iterator iter = m_SectionsPos.begin();
-        while (iter != m_SectionsPos.end())
+        if (Line->IsKey)
         {
-            FILELOC::iterator CurrentIter = iter;
-            iter++;
-            long TestFilePos = CurrentIter->second;
-            if (TestFilePos > FilePos)
-            {
-                m_SectionsPos.erase(CurrentIter);
-            }
+            List.insert(KeyValueData::value_type(Line->Key, Line->Value));
         }
-        m_lastSectionSearch = FilePos;
     }
 }
 
@@ -900,85 +838,88 @@ void CIniFileBase::GetVectorOfSections(SectionList & sections)
     sections.clear();
 
     CGuard Guard(m_CS);
-    if (!m_File.IsOpen())
+    if (m_Index.IsOpen())
     {
+        m_Index.GetSections(sections);
         return;
     }
-
+    if (!LoadFile())
     {
-        stdstr_f DoesNotExist("DoesNotExist%d%d%d", rand(), rand(), rand());
-        MoveToSectionNameData(DoesNotExist.c_str(), false);
+        return;
     }
 
-    for (FILELOC::const_iterator iter = m_SectionsPos.begin(); iter != m_SectionsPos.end(); iter++)
+    for (SECTION_LIST::const_iterator Section = m_Sections.begin(); Section != m_Sections.end(); Section++)
     {
-        sections.push_back(iter->first);
+        if (!Section->Name.empty())
+        {
+            sections.push_back(Section->Name);
+        }
     }
+    std::sort(sections.begin(), sections.end());
+    sections.erase(std::unique(sections.begin(), sections.end()), sections.end());
 }
 
 void CIniFileBase::CloseFile(void)
 {
+    // Write out anything still pending, m_CS can not be held while writing
+    bool Written = WriteChanges();
+
     CGuard Guard(m_CS);
-    
-    // Save current section before closing
-    SaveCurrentSection();
-    
+
     // Close the file to release the handle
     if (m_File.IsOpen())
     {
         m_File.Close();
     }
-    
-    // Clear the section position cache and current section data
-    m_SectionsPos.clear();
-    m_lastSectionSearch = 0;
-    m_CurrentSection.clear();
-    m_CurrentSectionDirty = false;
-    m_CurrentSectionFilePos = 0;
-    m_CurrentSectionData.clear();
+    m_Index.Close();
+
+    if (!Written || m_EditCount != m_SavedEditCount)
+    {
+        // The in-memory copy is the only one with these edits, it is kept so the next
+        // flush or close can write them
+        return;
+    }
+
+    // Drop the in-memory copy, the next read loads the file again
+    m_Sections.clear();
+    m_SectionIndex.clear();
+    m_Loaded = false;
+    m_Open = false;
 }
 
 void CIniFileBase::ReloadFile(void)
 {
-    CGuard Guard(m_CS);
-    
     // Close the file first
     CloseFile();
-    
+
     // Small delay to ensure file handle is fully released
-    Sleep(50);
-    
+    pjutil::Sleep(50);
+
     // Reopen the file - this will read fresh from disk
     // Use OpenIniFile with bCreate=false since the file should exist
     // If it doesn't exist, OpenIniFile will handle it
+    CGuard Guard(m_CS);
     OpenIniFile(false);
+    if (m_UseIndex && m_Open && m_EditCount == m_SavedEditCount)
+    {
+        m_Index.Open(m_FileName.c_str());
+    }
 }
 
 void CIniFileBase::ForceReloadFile(void)
 {
-    CGuard Guard(m_CS);
-    
-    // Save current section before closing
-    SaveCurrentSection();
-    
-    // Close the file to release the handle
-    if (m_File.IsOpen())
-    {
-        m_File.Close();
-    }
-    
-    // Aggressively clear ALL caches - force complete re-scan
-    m_SectionsPos.clear();
-    m_lastSectionSearch = 0;
-    m_CurrentSection.clear();
-    m_CurrentSectionDirty = false;
-    m_CurrentSectionFilePos = 0;
-    m_CurrentSectionData.clear();
-    
+    // Drops the in-memory copy and any index as well as the handle
+    CloseFile();
+
     // Longer delay to ensure file handle is fully released and file system cache is cleared
-    Sleep(200);
-    
+    pjutil::Sleep(200);
+
     // Reopen the file - this will force a complete re-scan from the beginning
     // Use OpenIniFile with bCreate=false since the file should exist
+    CGuard Guard(m_CS);
     OpenIniFile(false);
+    if (m_UseIndex && m_Open && m_EditCount == m_SavedEditCount)
+    {
+        m_Index.Open(m_FileName.c_str());
+    }
 }
\ No newline at end of file
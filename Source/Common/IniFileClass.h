@@ -10,8 +10,20 @@
 #include "CriticalSection.h"
 #include "StdString.h"
 #include "SmartPointer.h"
+#include "SyncEvent.h"
+#include "Thread.h"
+#include "IniFileIndex.h"
 #include <map>
-
+#include <list>
+
+// The file is read once, on first use, into an in-memory copy that keeps every
+// line including comments, blank lines and sections or keys that are shadowed
+// by an earlier one of the same name. Lookups and edits work on that copy.
+// Edits are written back as a whole file to <file>.tmp which is then renamed
+// over the ini, either straight away from FlushChanges or, with auto flush on,
+// from a writer thread once the edits have been quiet for WriteDelay ms. When
+// the ini can not be replaced, because something else has it open, it is
+// written over in place, and edits that could not be written at all are kept.
 class CIniFileBase
 {
     struct insensitive_compare
@@ -23,48 +35,83 @@ class CIniFileBase
     };
 
     typedef std::string ansi_string;
-    typedef std::map<ansi_string, long> FILELOC;
-    typedef FILELOC::iterator FILELOC_ITR;
-    typedef std::map<ansi_string, ansi_string, insensitive_compare> KeyValueList;
+
+    struct INI_LINE
+    {
+        ansi_string Text;  // The line as it is in the file, without the line feed
+        ansi_string Key;
+        ansi_string Value;
+        bool        IsKey;
+    };
+    typedef std::list<INI_LINE> LINE_LIST;
+    typedef std::map<ansi_string, LINE_LIST::iterator, insensitive_compare> KEY_INDEX;
+
+    struct INI_SECTION
+    {
+        ansi_string Name;
+        ansi_string Header;    // Empty for the lines before the first section
+        LINE_LIST   Lines;
+        KEY_INDEX   Keys;      // The first line of each key
+    };
+    typedef std::list<INI_SECTION> SECTION_LIST;
+    typedef std::map<ansi_string, INI_SECTION *, insensitive_compare> SECTION_INDEX;
 
 public:
     typedef std::map<stdstr, stdstr>           KeyValueData;
     typedef std::vector<stdstr>               SectionList;
 
+    enum { WriteDelay = 250 };
+
 protected:
     CFileBase   & m_File;
     stdstr m_FileName;
 
 private:
-    ansi_string m_CurrentSection;
-    bool   m_CurrentSectionDirty;
-    int    m_CurrentSectionFilePos; // Where in the file is the current Section
-    KeyValueList m_CurrentSectionData;
-
-    long   m_lastSectionSearch; // When Scanning for a section, what was the last scanned pos
+    SECTION_LIST  m_Sections;
+    SECTION_INDEX m_SectionIndex;
+    bool   m_Open;      // The file could be opened (or created)
+    bool   m_Loaded;    // m_Sections holds the file
 
     bool   m_ReadOnly;
     bool   m_InstantFlush;
     const char * m_LineFeed;
 
     CriticalSection m_CS;
-    FILELOC m_SectionsPos;
-
-    void fInsertSpaces(int Pos, int NoOfSpaces);
-    int  GetStringFromFile(char * & String, AUTO_PTR<char> &Data, int & MaxDataSize, int & DataSize, int & ReadPos);
-    bool MoveToSectionNameData(const char * lpSectionName, bool ChangeCurrentSection);
-    const char * CleanLine(char * Line);
-    void ClearSectionPosList(long FilePos);
+    CIniFileIndex m_Index;
+    bool   m_UseIndex;
+
+    // Edits are counted, the file is written when the count moves on from the last write.
+    // The counts and the writer thread flags are only read or changed with m_CS held
+    uint32_t m_EditCount;
+    uint32_t m_SavedEditCount;
+    CriticalSection m_WriteCS;
+    CThread * m_WriteThread;
+    SyncEvent m_WriteRequest;
+    bool   m_WriteQuit;
+    bool   m_WriteStopped;
+
+    bool LoadFile(void);
+    void ParseFile(const char * Data, uint32_t DataSize);
+    INI_SECTION * FindSection(const char * lpSectionName);
+    INI_SECTION & AddSection(const char * lpSectionName);
+    const INI_LINE * FindKey(const char * lpSectionName, const char * lpKeyName);
+    void FileChanged(void);
+    bool WriteChanges(void);
+    void StopWriteThread(void);
+    uint32_t EditCount(void);
+    bool WriteQuit(void);
+    static void WriteThreadProc(CIniFileBase * _this);
 
 protected:
     void OpenIniFileReadOnly();
     void OpenIniFile(bool bCreate = true);
-    void SaveCurrentSection(void);
 
 public:
     CIniFileBase(CFileBase & FileObject, const char * FileName);
     virtual ~CIniFileBase(void);
 
+    static const char * CleanLine(char * Line);
+
     bool IsEmpty();
     bool IsFileOpen(void);
     bool DeleteSection(const char * lpSectionName);
@@ -77,6 +124,7 @@ public:
     virtual void SaveString(const char * lpSectionName, const char * lpKeyName, const char * lpString);
     virtual void SaveNumber(const char * lpSectionName, const char * lpKeyName, uint32_t Value);
     void SetAutoFlush(bool AutoFlush);
+    void UseIndex(void); // Read through a compiled index (see CIniFileIndex) until something is written
     void FlushChanges(void);
     bool EntryExists(const char * lpSectionName, const char * lpKeyName);
     void GetKeyList(const char * lpSectionName, strlist &List);
@@ -116,7 +164,6 @@ public:
     }
     virtual ~CIniFileT(void)
     {
-        SaveCurrentSection();
     }
 
 protected:
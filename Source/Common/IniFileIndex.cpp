@@ -0,0 +1,467 @@
+#include "stdafx.h"
+#include "IniFileIndex.h"
+#include <algorithm>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    struct insensitive_compare
+    {
+        bool operator() (const std::string & a, const std::string & b) const
+        {
+            return _stricmp(a.c_str(), b.c_str()) < 0;
+        }
+    };
+
+    typedef std::map<std::string, std::string, insensitive_compare> IndexKeys;
+    typedef std::map<std::string, IndexKeys, insensitive_compare> IndexSections;
+
+    class CStringPool
+    {
+    public:
+        uint32_t Add(const std::string & Value)
+        {
+            std::map<std::string, uint32_t>::const_iterator iter = m_Offsets.find(Value);
+            if (iter != m_Offsets.end())
+            {
+                return iter->second;
+            }
+            uint32_t Offset = (uint32_t)m_Strings.size();
+            m_Strings.append(Value.c_str(), Value.length() + 1);
+            m_Offsets.insert(std::map<std::string, uint32_t>::value_type(Value, Offset));
+            return Offset;
+        }
+        const std::string & Strings(void) const { return m_Strings; }
+
+    private:
+        std::map<std::string, uint32_t> m_Offsets;
+        std::string m_Strings;
+    };
+}
+
+CIniFileIndex::CIniFileIndex() :
+    m_Data(NULL),
+    m_Size(0),
+    m_Mapped(false)
+{
+}
+
+CIniFileIndex::~CIniFileIndex()
+{
+    Close();
+}
+
+stdstr CIniFileIndex::IndexFileName(const char * IniFile)
+{
+    return stdstr(IniFile) + ".idx";
+}
+
+bool CIniFileIndex::Open(const char * IniFile)
+{
+    Close();
+
+    struct stat Info;
+    if (stat(IniFile, &Info) != 0)
+    {
+        return false;
+    }
+    stdstr IndexFile = IndexFileName(IniFile);
+    if (Map(IndexFile) && Valid((uint32_t)Info.st_size, (uint64_t)Info.st_mtime, IniFile))
+    {
+        return true;
+    }
+    Unmap();
+
+    std::string Text, Index;
+    uint64_t Time;
+    if (!ReadSource(IniFile, Text, Time))
+    {
+        return false;
+    }
+    Build(Text, Time, Index);
+    if (WriteIndex(IndexFile, Index) && Map(IndexFile) && m_Size == Index.size())
+    {
+        return true;
+    }
+    Unmap();
+
+    //Could not be written (read only directory or another instance has it mapped), use it from memory
+    m_Memory.swap(Index);
+    m_Data = (const uint8_t *)m_Memory.data();
+    m_Size = m_Memory.size();
+    return true;
+}
+
+void CIniFileIndex::Close(void)
+{
+    Unmap();
+    m_Memory.clear();
+    m_Data = NULL;
+    m_Size = 0;
+}
+
+bool CIniFileIndex::SectionExists(const char * lpSectionName) const
+{
+    return FindSection(lpSectionName) != NULL;
+}
+
+const char * CIniFileIndex::GetValue(const char * lpSectionName, const char * lpKeyName) const
+{
+    const INDEX_SECTION * Section = FindSection(lpSectionName);
+    if (Section == NULL)
+    {
+        return NULL;
+    }
+
+    const INDEX_KEY * Key = Keys() + Section->FirstKey;
+    uint32_t Low = 0, High = Section->KeyCount;
+    while (Low < High)
+    {
+        uint32_t Mid = (Low + High) / 2;
+        int Result = _stricmp(lpKeyName, String(Key[Mid].Name));
+        if (Result == 0)
+        {
+            return String(Key[Mid].Value);
+        }
+        if (Result < 0)
+        {
+            High = Mid;
+        }
+        else
+        {
+            Low = Mid + 1;
+        }
+    }
+    return NULL;
+}
+
+void CIniFileIndex::GetKeyList(const char * lpSectionName, strlist & List) const
+{
+    const INDEX_SECTION * Section = FindSection(lpSectionName);
+    if (Section == NULL)
+    {
+        return;
+    }
+    const INDEX_KEY * Key = Keys() + Section->FirstKey;
+    for (uint32_t i = 0; i < Section->KeyCount; i++)
+    {
+        List.push_back(String(Key[i].Name));
+    }
+}
+
+void CIniFileIndex::GetSections(std::vector<stdstr> & SectionNames) const
+{
+    if (m_Data == NULL)
+    {
+        return;
+    }
+    const INDEX_SECTION * Section = Sections();
+    for (uint32_t i = 0; i < Header().SectionCount; i++)
+    {
+        SectionNames.push_back(String(Section[i].Name));
+    }
+    //same order as the section list built from the text file
+    std::sort(SectionNames.begin(), SectionNames.end());
+}
+
+const CIniFileIndex::INDEX_SECTION * CIniFileIndex::FindSection(const char * lpSectionName) const
+{
+    if (m_Data == NULL)
+    {
+        return NULL;
+    }
+
+    const INDEX_SECTION * Section = Sections();
+    uint32_t Low = 0, High = Header().SectionCount;
+    while (Low < High)
+    {
+        uint32_t Mid = (Low + High) / 2;
+        int Result = _stricmp(lpSectionName, String(Section[Mid].Name));
+        if (Result == 0)
+        {
+            return &Section[Mid];
+        }
+        if (Result < 0)
+        {
+            High = Mid;
+        }
+        else
+        {
+            Low = Mid + 1;
+        }
+    }
+    return NULL;
+}
+
+bool CIniFileIndex::ReadSource(const char * IniFile, std::string & Text, uint64_t & Time)
+{
+    FILE * File = fopen(IniFile, "rb");
+    if (File == NULL)
+    {
+        return false;
+    }
+
+    struct stat Info;
+    bool Success = fstat(fileno(File), &Info) == 0;
+    if (Success)
+    {
+        Time = (uint64_t)Info.st_mtime;
+        Text.resize((size_t)Info.st_size);
+        Success = Text.empty() || fread(&Text[0], 1, Text.size(), File) == Text.size();
+    }
+    fclose(File);
+    return Success;
+}
+
+uint32_t CIniFileIndex::Hash(const std::string & Text)
+{
+    //FNV-1a
+    uint32_t Hash = 0x811C9DC5;
+    for (size_t i = 0, n = Text.size(); i < n; i++)
+    {
+        Hash = (Hash ^ (uint8_t)Text[i]) * 0x01000193;
+    }
+    return Hash;
+}
+
+// Parses the text the same way CIniFileBase does: the first section of a name
+// and the first value of a key win, and a line starting with '[' ends a section
+void CIniFileIndex::Build(const std::string & Text, uint64_t Time, std::string & Index)
+{
+    static const uint8_t pUTF8[3] = { 0xef, 0xbb, 0xbf };
+
+    std::vector<char> Buffer(Text.begin(), Text.end());
+    Buffer.push_back(0);
+
+    IndexSections SectionList;
+    IndexKeys * CurrentKeys = NULL;
+    bool FoundSection = false;
+    for (size_t ReadPos = 0, DataSize = Text.size(); ReadPos < DataSize;)
+    {
+        char * Input = &Buffer[ReadPos];
+        char * LineEnd = strchr(Input, '\n');
+        if (LineEnd != NULL)
+        {
+            LineEnd[0] = 0;
+            ReadPos = (LineEnd - &Buffer[0]) + 1;
+        }
+        else
+        {
+            ReadPos = DataSize;
+        }
+        if (strlen(CIniFileBase::CleanLine(Input)) <= 1) { continue; }
+
+        if (!FoundSection && !memcmp(Input, pUTF8, 3))
+        {
+            Input += 3;
+        }
+        if (Input[0] == '[')
+        {
+            CurrentKeys = NULL;
+            int lineEndPos = (int)strlen(Input) - 1;
+            if (Input[lineEndPos] != ']') { continue; }
+            Input[lineEndPos] = 0;
+            FoundSection = true;
+
+            std::pair<IndexSections::iterator, bool> Result = SectionList.insert(IndexSections::value_type(&Input[1], IndexKeys()));
+            if (Result.second)
+            {
+                CurrentKeys = &Result.first->second;
+            }
+            continue;
+        }
+        if (CurrentKeys == NULL) { continue; }
+
+        char * Pos = strchr(Input, '=');
+        if (Pos == NULL) { continue; }
+        char * Value = &Pos[1];
+
+        char * Pos1 = Pos - 1;
+        while ((Pos1 > Input) && ((*Pos1 == ' ') || (*Pos1 == '\t')))
+        {
+            Pos1--;
+        }
+        Pos1[1] = 0;
+        CurrentKeys->insert(IndexKeys::value_type(Input, Value));
+    }
+
+    CStringPool Pool;
+    std::vector<INDEX_SECTION> SectionTable;
+    std::vector<INDEX_KEY> KeyTable;
+    SectionTable.reserve(SectionList.size());
+    for (IndexSections::const_iterator Section = SectionList.begin(); Section != SectionList.end(); Section++)
+    {
+        INDEX_SECTION Entry = { Pool.Add(Section->first), (uint32_t)KeyTable.size(), (uint32_t)Section->second.size() };
+        SectionTable.push_back(Entry);
+        for (IndexKeys::const_iterator Key = Section->second.begin(); Key != Section->second.end(); Key++)
+        {
+            INDEX_KEY KeyEntry = { Pool.Add(Key->first), Pool.Add(Key->second) };
+            KeyTable.push_back(KeyEntry);
+        }
+    }
+
+    INDEX_HEADER IndexHeader = { 0 };
+    IndexHeader.Magic = IndexMagic;
+    IndexHeader.Version = IndexVersion;
+    IndexHeader.SourceSize = (uint32_t)Text.size();
+    IndexHeader.SourceHash = Hash(Text);
+    IndexHeader.SourceTime = Time;
+    IndexHeader.SectionCount = (uint32_t)SectionTable.size();
+    IndexHeader.KeyCount = (uint32_t)KeyTable.size();
+    IndexHeader.StringSize = (uint32_t)Pool.Strings().size();
+
+    Index.clear();
+    Index.reserve(sizeof(IndexHeader) + SectionTable.size() * sizeof(INDEX_SECTION) + KeyTable.size() * sizeof(INDEX_KEY) + Pool.Strings().size());
+    Index.append((const char *)&IndexHeader, sizeof(IndexHeader));
+    if (!SectionTable.empty())
+    {
+        Index.append((const char *)&SectionTable[0], SectionTable.size() * sizeof(INDEX_SECTION));
+    }
+    if (!KeyTable.empty())
+    {
+        Index.append((const char *)&KeyTable[0], KeyTable.size() * sizeof(INDEX_KEY));
+    }
+    Index.append(Pool.Strings());
+}
+
+// Written to a temporary file and renamed so another instance never maps half an index
+bool CIniFileIndex::WriteIndex(const stdstr & IndexFile, const std::string & Index)
+{
+    stdstr TempFile = IndexFile + ".tmp";
+    FILE * File = fopen(TempFile.c_str(), "wb");
+    if (File == NULL)
+    {
+        return false;
+    }
+    bool Success = fwrite(Index.data(), 1, Index.size(), File) == Index.size();
+    if (fclose(File) != 0)
+    {
+        Success = false;
+    }
+    if (Success)
+    {
+        remove(IndexFile.c_str());
+        Success = rename(TempFile.c_str(), IndexFile.c_str()) == 0;
+    }
+    if (!Success)
+    {
+        remove(TempFile.c_str());
+    }
+    return Success;
+}
+
+bool CIniFileIndex::Map(const stdstr & IndexFile)
+{
+    Unmap();
+
+#ifdef _WIN32
+    HANDLE hFile = CreateFileA(IndexFile.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    DWORD FileSize = GetFileSize(hFile, NULL);
+    void * View = NULL;
+    if (FileSize != INVALID_FILE_SIZE && FileSize >= sizeof(INDEX_HEADER))
+    {
+        HANDLE hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (hMapping != NULL)
+        {
+            //the view keeps the mapping alive once the handles are closed
+            View = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(hMapping);
+        }
+    }
+    CloseHandle(hFile);
+#else
+    int fd = open(IndexFile.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat Info;
+    size_t FileSize = 0;
+    void * View = NULL;
+    if (fstat(fd, &Info) == 0 && (size_t)Info.st_size >= sizeof(INDEX_HEADER))
+    {
+        FileSize = (size_t)Info.st_size;
+        View = mmap(NULL, FileSize, PROT_READ, MAP_SHARED, fd, 0);
+        if (View == MAP_FAILED)
+        {
+            View = NULL;
+        }
+    }
+    close(fd);
+#endif
+    if (View == NULL)
+    {
+        return false;
+    }
+    m_Data = (const uint8_t *)View;
+    m_Size = FileSize;
+    m_Mapped = true;
+    return true;
+}
+
+void CIniFileIndex::Unmap(void)
+{
+    if (!m_Mapped)
+    {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(m_Data);
+#else
+    munmap((void *)m_Data, m_Size);
+#endif
+    m_Mapped = false;
+    m_Data = NULL;
+    m_Size = 0;
+}
+
+bool CIniFileIndex::Valid(uint32_t SourceSize, uint64_t SourceTime, const char * IniFile) const
+{
+    const INDEX_HEADER & IndexHeader = Header();
+    if (IndexHeader.Magic != IndexMagic || IndexHeader.Version != IndexVersion || IndexHeader.SourceSize != SourceSize)
+    {
+        return false;
+    }
+    uint64_t TableSize = sizeof(INDEX_HEADER) + (uint64_t)IndexHeader.SectionCount * sizeof(INDEX_SECTION) + (uint64_t)IndexHeader.KeyCount * sizeof(INDEX_KEY);
+    if (TableSize + IndexHeader.StringSize != m_Size || (IndexHeader.StringSize != 0 && m_Data[m_Size - 1] != 0))
+    {
+        return false;
+    }
+
+    const INDEX_SECTION * Section = Sections();
+    for (uint32_t i = 0; i < IndexHeader.SectionCount; i++)
+    {
+        if (Section[i].Name >= IndexHeader.StringSize || Section[i].FirstKey > IndexHeader.KeyCount || Section[i].KeyCount > IndexHeader.KeyCount - Section[i].FirstKey)
+        {
+            return false;
+        }
+    }
+    const INDEX_KEY * Key = Keys();
+    for (uint32_t i = 0; i < IndexHeader.KeyCount; i++)
+    {
+        if (Key[i].Name >= IndexHeader.StringSize || Key[i].Value >= IndexHeader.StringSize)
+        {
+            return false;
+        }
+    }
+
+    if (IndexHeader.SourceTime == SourceTime)
+    {
+        return true;
+    }
+    //the time changes when the file is copied or checked out again, the contents may not have
+    std::string Text;
+    uint64_t Time;
+    return ReadSource(IniFile, Text, Time) && Hash(Text) == IndexHeader.SourceHash;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "StdString.h"
+#include <vector>
+
+// Compiled index of an ini file, kept next to it as <file>.idx. The index
+// holds every section and key sorted without case and a pool of the
+// distinct strings, so a lookup is a binary search over the mapped file with
+// nothing parsed. It is rebuilt when the size or time of the ini file no
+// longer matches (a changed time with the same contents is accepted on the
+// content hash). Writes still go to the ini file, which drops the index.
+class CIniFileIndex
+{
+public:
+    CIniFileIndex();
+    ~CIniFileIndex();
+
+    // Maps the index for IniFile, building it first if it is missing or out of date
+    bool Open(const char * IniFile);
+    void Close(void);
+    bool IsOpen(void) const { return m_Data != NULL; }
+
+    bool SectionExists(const char * lpSectionName) const;
+    const char * GetValue(const char * lpSectionName, const char * lpKeyName) const; // NULL if the key is not set
+    void GetKeyList(const char * lpSectionName, strlist & List) const;
+    void GetSections(std::vector<stdstr> & Sections) const;
+
+    static stdstr IndexFileName(const char * IniFile);
+
+private:
+    CIniFileIndex(const CIniFileIndex&);            // Disable copy constructor
+    CIniFileIndex& operator=(const CIniFileIndex&); // Disable assignment
+
+    enum
+    {
+        IndexMagic = 0x58494A50, // "PJIX"
+        IndexVersion = 1,
+    };
+
+    struct INDEX_HEADER
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t SourceSize;
+        uint32_t SourceHash;
+        uint64_t SourceTime;
+        uint32_t SectionCount;
+        uint32_t KeyCount;
+        uint32_t StringSize;
+        uint32_t Reserved;
+    };
+
+    struct INDEX_SECTION
+    {
+        uint32_t Name;
+        uint32_t FirstKey;
+        uint32_t KeyCount;
+    };
+
+    struct INDEX_KEY
+    {
+        uint32_t Name;
+        uint32_t Value;
+    };
+
+    static bool ReadSource(const char * IniFile, std::string & Text, uint64_t & Time);
+    static uint32_t Hash(const std::string & Text);
+    static void Build(const std::string & Text, uint64_t Time, std::string & Index);
+    static bool WriteIndex(const stdstr & IndexFile, const std::string & Index);
+
+    bool Map(const stdstr & IndexFile);
+    void Unmap(void);
+    bool Valid(uint32_t SourceSize, uint64_t SourceTime, const char * IniFile) const;
+    const INDEX_SECTION * FindSection(const char * lpSectionName) const;
+
+    const INDEX_HEADER & Header(void) const { return *(const INDEX_HEADER *)m_Data; }
+    const INDEX_SECTION * Sections(void) const { return (const INDEX_SECTION *)(m_Data + sizeof(INDEX_HEADER)); }
+    const INDEX_KEY * Keys(void) const { return (const INDEX_KEY *)(Sections() + Header().SectionCount); }
+    const char * String(uint32_t Offset) const { return (const char *)(Keys() + Header().KeyCount) + Offset; }
+
+    const uint8_t * m_Data;
+    size_t m_Size;
+    bool m_Mapped;
+    std::string m_Memory; // Used when the index could not be written beside the ini file
+};
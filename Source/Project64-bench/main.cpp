@@ -0,0 +1,100 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+// Headless front end for benchmark runs, there is no window so the gfx,
+// audio and controller plugins are always the null ones in the core:
+//     project64-bench --benchmark <vi count> [--input <file>] [--null-rsp] [--async-dlist <cycles>] <rom>
+// The result is written to Benchmark.txt in the log directory.
+//
+// Script/Unix/project64-bench.sh is how this is meant to be built, but the
+// core does not build on Linux yet, so it has not been linked or run there.
+#include <Project64-core/AppInit.h>
+#include <Project64-core/Settings/SettingsClass.h>
+#include <Project64-core/N64System/SystemGlobals.h>
+#include <Project64-core/N64System/N64Class.h>
+#include <Project64-core/Multilanguage/LanguageClass.h>
+#include <Common/path.h>
+#include <Common/Util.h>
+#include <Common/Trace.h>
+#include <stdio.h>
+
+class CHeadlessNotification :
+    public CNotification
+{
+public:
+    void DisplayError(const char * Message) const { fprintf(stderr, "Error: %s\n", Message); }
+    void DisplayError(LanguageStringID StringID) const { DisplayError(GS(StringID)); }
+
+    void FatalError(const char * Message) const { fprintf(stderr, "Fatal error: %s\n", Message); exit(1); }
+    void FatalError(LanguageStringID StringID) const { FatalError(GS(StringID)); }
+
+    void DisplayMessage(int /*DisplayTime*/, const char * Message) const { fprintf(stderr, "%s\n", Message); }
+    void DisplayMessage(int DisplayTime, LanguageStringID StringID) const { DisplayMessage(DisplayTime, GS(StringID)); }
+    void DisplayMessage2(const char * /*Message*/) const { }
+
+    // There is no one to answer, take the default
+    bool AskYesNoQuestion(const char * /*Question*/) const { return false; }
+
+    void BreakPoint(const char * FileName, int32_t LineNumber) { fprintf(stderr, "Break point: %s (%d)\n", FileName, LineNumber); }
+
+    void AppInitDone(void) { }
+    bool ProcessGuiMessages(void) const { return false; }
+    void ChangeFullScreen(void) const { }
+};
+
+static bool WaitForCpuRunning(bool Running, uint32_t TimeOut)
+{
+    for (uint32_t Waited = 0; g_Settings->LoadBool(GameRunning_CPU_Running) != Running; Waited += 10)
+    {
+        if (TimeOut != 0 && Waited >= TimeOut)
+        {
+            return false;
+        }
+        pjutil::Sleep(10);
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    static CHeadlessNotification Notify;
+    int Result = 1;
+
+#ifdef _WIN32
+    AppInit(&Notify, CPath(CPath::MODULE_DIRECTORY), argc, argv);
+#else
+    AppInit(&Notify, CPath(CPath::CURRENT_DIRECTORY), argc, argv);
+#endif
+    if (g_Settings->LoadDword(Cmd_BenchmarkFrames) == 0 || g_Settings->LoadStringVal(Cmd_RomFile).empty())
+    {
+        fprintf(stderr, "usage: %s --benchmark <vi count> [--input <file>] [--null-rsp] [--async-dlist <cycles>] <rom>\n", argc > 0 ? argv[0] : "project64-bench");
+    }
+    else if (!CN64System::LoadFileImage(g_Settings->LoadStringVal(Cmd_RomFile).c_str()))
+    {
+        fprintf(stderr, "failed to load %s\n", g_Settings->LoadStringVal(Cmd_RomFile).c_str());
+    }
+    else
+    {
+        CN64System::RunLoadedImage();
+        if (!WaitForCpuRunning(true, 30000))
+        {
+            fprintf(stderr, "emulation did not start\n");
+        }
+        else
+        {
+            // The benchmark stops the cpu itself once the vi count is reached
+            WaitForCpuRunning(false, 0);
+            Result = 0;
+        }
+        CN64System::CloseSystem();
+    }
+    AppCleanup();
+    return Result;
+}
@@ -3,6 +3,8 @@
 #include <Common/path.h>
 #include <Common/Trace.h>
 #include <Common/Util.h>
+#include <Common/LogClass.h>
+#include <Common/HighResTimeStamp.h>
 
 #include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
 #include <Project64-core/N64System/SystemGlobals.h>
@@ -14,6 +16,8 @@
 #include <shellapi.h>
 
 static void FixDirectories(void);
+static void RomDatabaseBenchmark(void);
+static void IniWriteBenchmark(void);
 void SetTraceModuleNames(void);
 
 #ifdef _WIN32
@@ -190,6 +194,32 @@ static bool ParseCommand(int32_t argc, char **argv)
             g_Settings->SaveBool(Cmd_ShowHelp, true);
             return false;
         }
+        else if (strcmp(argv[i], "--benchmark") == 0 && ArgsLeft >= 1)
+        {
+            g_Settings->SaveDword(Cmd_BenchmarkFrames, strtoul(argv[++i], NULL, 10));
+        }
+        else if (strcmp(argv[i], "--input") == 0 && ArgsLeft >= 1)
+        {
+            g_Settings->SaveString(Cmd_BenchmarkInput, argv[++i]);
+        }
+        else if (strcmp(argv[i], "--null-rsp") == 0)
+        {
+            g_Settings->SaveBool(Cmd_BenchmarkNullRsp, true);
+        }
+        else if (strcmp(argv[i], "--async-dlist") == 0 && ArgsLeft >= 1)
+        {
+            g_Settings->SaveDword(Cmd_BenchmarkAsyncDlist, strtoul(argv[++i], NULL, 10));
+        }
+        else if (strcmp(argv[i], "--rdb-benchmark") == 0)
+        {
+            RomDatabaseBenchmark();
+            return false;
+        }
+        else if (strcmp(argv[i], "--ini-benchmark") == 0)
+        {
+            IniWriteBenchmark();
+            return false;
+        }
         else if (ArgsLeft == 0 && argv[i][0] != '-')
         {
             g_Settings->SaveString(Cmd_RomFile, &(argv[i][0]));
@@ -283,6 +313,132 @@ void AppCleanup(void)
     TraceDone();
 }
 
+// Times the rom database lookups done at startup and by the rom browser, read
+// from the text file, through a freshly built index and through the index
+// once it is on disk. The results go to RdbBenchmark.txt in the log directory.
+void RomDatabaseBenchmark(void)
+{
+    static const char * Keys[] =
+    {
+        "Good Name", "Internal Name", "Status", "Core Note", "Plugin Note",
+        "RDRAM Size", "Save Type", "CPU Type", "Counter Factor",
+    };
+    enum { Run_Text, Run_Build, Run_Mapped, Run_Count };
+    static const char * RunNames[Run_Count] = { "Text file", "Index (built)", "Index (mapped)" };
+
+    stdstr RdbFile = g_Settings->LoadStringVal(SupportFile_RomDatabase);
+    uint64_t TimeTaken[Run_Count] = { 0 };
+    uint32_t Sections[Run_Count] = { 0 }, Values[Run_Count] = { 0 };
+    for (int Run = 0; Run < Run_Count; Run++)
+    {
+        if (Run == Run_Build)
+        {
+            CPath(CIniFileIndex::IndexFileName(RdbFile.c_str())).Delete();
+        }
+
+        HighResTimeStamp StartTime;
+        StartTime.SetToNow();
+        CIniFile RdbIniFile(RdbFile.c_str());
+        if (Run != Run_Text)
+        {
+            RdbIniFile.UseIndex();
+        }
+        CIniFileBase::SectionList SectionList;
+        RdbIniFile.GetVectorOfSections(SectionList);
+        for (size_t i = 0; i < SectionList.size(); i++)
+        {
+            for (size_t Key = 0; Key < sizeof(Keys) / sizeof(Keys[0]); Key++)
+            {
+                stdstr Value;
+                if (RdbIniFile.GetString(SectionList[i].c_str(), Keys[Key], "", Value))
+                {
+                    Values[Run] += 1;
+                }
+            }
+        }
+        HighResTimeStamp EndTime;
+        EndTime.SetToNow();
+        TimeTaken[Run] = EndTime.GetMicroSeconds() - StartTime.GetMicroSeconds();
+        Sections[Run] = (uint32_t)SectionList.size();
+    }
+
+    CPath ReportFile(g_Settings->LoadStringVal(Directory_Log).c_str(), "RdbBenchmark.txt");
+    if (!ReportFile.DirectoryExists())
+    {
+        ReportFile.DirectoryCreate();
+    }
+    CLog Report;
+    if (!Report.Open(ReportFile))
+    {
+        return;
+    }
+    Report.LogF("Rom database: %s\n\n", RdbFile.c_str());
+    Report.LogF("Read from          Time (ms)  Sections   Values\n");
+    for (int Run = 0; Run < Run_Count; Run++)
+    {
+        Report.LogF("%-16s %11.2f %9u %8u\n", RunNames[Run], TimeTaken[Run] / 1000.0, Sections[Run], Values[Run]);
+    }
+    WriteTrace(TraceAppInit, TraceInfo, "Rom database: text %.2f ms, index built %.2f ms, index mapped %.2f ms", TimeTaken[Run_Text] / 1000.0, TimeTaken[Run_Build] / 1000.0, TimeTaken[Run_Mapped] / 1000.0);
+}
+
+// Times 10,000 setting writes to a scratch ini with auto flush on, as the
+// settings are saved while running, then the flush that puts them on disk and
+// a read back of the final values. The results go to IniBenchmark.txt in the
+// log directory.
+void IniWriteBenchmark(void)
+{
+    enum { WriteCount = 10000, SectionCount = 50, KeyCount = 400 };
+
+    CPath IniFile(g_Settings->LoadStringVal(Directory_Log).c_str(), "IniBenchmark.ini");
+    if (!IniFile.DirectoryExists())
+    {
+        IniFile.DirectoryCreate();
+    }
+    IniFile.Delete();
+
+    HighResTimeStamp StartTime, WrittenTime, FlushedTime;
+    StartTime.SetToNow();
+    {
+        CIniFile BenchmarkIni(IniFile);
+        for (uint32_t i = 0; i < WriteCount; i++)
+        {
+            BenchmarkIni.SaveNumber(stdstr_f("Section%d", i % SectionCount).c_str(), stdstr_f("Key%d", i % KeyCount).c_str(), i);
+        }
+        WrittenTime.SetToNow();
+        BenchmarkIni.FlushChanges();
+        FlushedTime.SetToNow();
+    }
+
+    //each key was last written in the final pass over the keys
+    uint32_t Verified = 0;
+    {
+        CIniFile BenchmarkIni(IniFile);
+        for (uint32_t Key = 0; Key < KeyCount; Key++)
+        {
+            if (BenchmarkIni.GetNumber(stdstr_f("Section%d", Key % SectionCount).c_str(), stdstr_f("Key%d", Key).c_str(), 0) == WriteCount - KeyCount + Key)
+            {
+                Verified += 1;
+            }
+        }
+    }
+    IniFile.Delete();
+
+    double WriteTime = (WrittenTime.GetMicroSeconds() - StartTime.GetMicroSeconds()) / 1000.0;
+    double FlushTime = (FlushedTime.GetMicroSeconds() - WrittenTime.GetMicroSeconds()) / 1000.0;
+
+    CPath ReportFile(g_Settings->LoadStringVal(Directory_Log).c_str(), "IniBenchmark.txt");
+    CLog Report;
+    if (!Report.Open(ReportFile))
+    {
+        return;
+    }
+    Report.LogF("%u writes to %u keys in %u sections\n\n", WriteCount, KeyCount, SectionCount);
+    Report.LogF("Writes:      %9.2f ms (%.2f us each)\n", WriteTime, WriteTime * 1000.0 / WriteCount);
+    Report.LogF("Flush:       %9.2f ms\n", FlushTime);
+    Report.LogF("Read back:   %u/%u values\n", Verified, KeyCount);
+    WriteTrace(TraceAppInit, TraceInfo, "Ini writes: %u in %.2f ms, flush %.2f ms, %u/%u values read back", WriteCount, WriteTime, FlushTime, Verified, KeyCount);
+}
+
 void FixDirectories(void)
 {
     WriteTrace(TraceAppInit, TraceDebug, "Starting");
@@ -813,6 +813,10 @@ void CMipsMemoryVM::segv_handler(int signal, siginfo_t *siginfo, void *sigcontex
 
     uint32_t MemAddress = (char *)siginfo->si_addr - (char *)g_MMU->Rdram();
     WriteTrace(TraceExceptionHandler, TraceNotice, "MemAddress = %X", MemAddress);
+    if (g_System != NULL && g_System->RspTaskWriteFault(MemAddress))
+    {
+        return;
+    }
 #ifdef __i386__
     for (int i = 0; i < NGREG; i++)
     {
@@ -857,6 +861,16 @@ void CMipsMemoryVM::segv_handler(int signal, siginfo_t *siginfo, void *sigcontex
 #else
 int32_t CMipsMemoryVM::MemoryFilter(uint32_t dwExptCode, void * lpExceptionPointer)
 {
+    if (dwExptCode == EXCEPTION_ACCESS_VIOLATION && g_MMU != NULL && g_System != NULL)
+    {
+        //A write to rdram the display list task is reading, the task is collected and the write retried
+        LPEXCEPTION_POINTERS lpEP = (LPEXCEPTION_POINTERS)lpExceptionPointer;
+        if (lpEP->ExceptionRecord->ExceptionInformation[0] == 1 &&
+            g_System->RspTaskWriteFault((uint32_t)((char *)lpEP->ExceptionRecord->ExceptionInformation[1] - (char *)g_MMU->Rdram())))
+        {
+            return EXCEPTION_CONTINUE_EXECUTION;
+        }
+    }
 #if defined(_M_IX86) && defined(_WIN32)
     if (dwExptCode != EXCEPTION_ACCESS_VIOLATION || g_MMU == NULL)
     {
@@ -0,0 +1,825 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#include "stdafx.h"
+#include <Project64-core/N64System/AudioHle.h>
+#include <string.h>
+
+#if defined(__i386) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#include <emmintrin.h>
+#define AUDIOHLE_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define AUDIOHLE_NEON
+#endif
+
+enum
+{
+    A_INIT = 0x01,
+    A_LOOP = 0x02,
+    A_LEFT = 0x02,
+    A_VOL = 0x04,
+    A_AUX = 0x08,
+};
+
+// Task header fields in DMEM
+enum
+{
+    TASK_UCODE_DATA = 0xFD8,
+    TASK_DATA_PTR = 0xFF0,
+    TASK_DATA_SIZE = 0xFF4,
+};
+
+// Four tap interpolation filter, indexed by the top six bits of the pitch accumulator
+static const int16_t ResampleLut[64 * 4] =
+{
+    (int16_t)0x0c39, (int16_t)0x66ad, (int16_t)0x0d46, (int16_t)0xffdf,
+    (int16_t)0x0b39, (int16_t)0x6696, (int16_t)0x0e5f, (int16_t)0xffd8,
+    (int16_t)0x0a44, (int16_t)0x6669, (int16_t)0x0f83, (int16_t)0xffd0,
+    (int16_t)0x095a, (int16_t)0x6626, (int16_t)0x10b4, (int16_t)0xffc8,
+    (int16_t)0x087d, (int16_t)0x65cd, (int16_t)0x11f0, (int16_t)0xffbf,
+    (int16_t)0x07ab, (int16_t)0x655e, (int16_t)0x1338, (int16_t)0xffb6,
+    (int16_t)0x06e4, (int16_t)0x64d9, (int16_t)0x148c, (int16_t)0xffac,
+    (int16_t)0x0628, (int16_t)0x643f, (int16_t)0x15eb, (int16_t)0xffa1,
+    (int16_t)0x0577, (int16_t)0x638f, (int16_t)0x1756, (int16_t)0xff96,
+    (int16_t)0x04d1, (int16_t)0x62cb, (int16_t)0x18cb, (int16_t)0xff8a,
+    (int16_t)0x0435, (int16_t)0x61f3, (int16_t)0x1a4c, (int16_t)0xff7e,
+    (int16_t)0x03a4, (int16_t)0x6106, (int16_t)0x1bd7, (int16_t)0xff71,
+    (int16_t)0x031c, (int16_t)0x6007, (int16_t)0x1d6c, (int16_t)0xff64,
+    (int16_t)0x029f, (int16_t)0x5ef5, (int16_t)0x1f0b, (int16_t)0xff56,
+    (int16_t)0x022a, (int16_t)0x5dd0, (int16_t)0x20b3, (int16_t)0xff48,
+    (int16_t)0x01be, (int16_t)0x5c9a, (int16_t)0x2264, (int16_t)0xff3a,
+    (int16_t)0x015b, (int16_t)0x5b53, (int16_t)0x241e, (int16_t)0xff2c,
+    (int16_t)0x0101, (int16_t)0x59fc, (int16_t)0x25e0, (int16_t)0xff1e,
+    (int16_t)0x00ae, (int16_t)0x5896, (int16_t)0x27a9, (int16_t)0xff10,
+    (int16_t)0x0063, (int16_t)0x5720, (int16_t)0x297a, (int16_t)0xff02,
+    (int16_t)0x001f, (int16_t)0x559d, (int16_t)0x2b50, (int16_t)0xfef4,
+    (int16_t)0xffe2, (int16_t)0x540d, (int16_t)0x2d2c, (int16_t)0xfee8,
+    (int16_t)0xffac, (int16_t)0x5270, (int16_t)0x2f0d, (int16_t)0xfedb,
+    (int16_t)0xff7c, (int16_t)0x50c7, (int16_t)0x30f3, (int16_t)0xfed0,
+    (int16_t)0xff53, (int16_t)0x4f14, (int16_t)0x32dc, (int16_t)0xfec6,
+    (int16_t)0xff2e, (int16_t)0x4d57, (int16_t)0x34c8, (int16_t)0xfebd,
+    (int16_t)0xff0f, (int16_t)0x4b91, (int16_t)0x36b6, (int16_t)0xfeb6,
+    (int16_t)0xfef5, (int16_t)0x49c2, (int16_t)0x38a5, (int16_t)0xfeb0,
+    (int16_t)0xfedf, (int16_t)0x47ed, (int16_t)0x3a95, (int16_t)0xfeac,
+    (int16_t)0xfece, (int16_t)0x4611, (int16_t)0x3c85, (int16_t)0xfeab,
+    (int16_t)0xfec0, (int16_t)0x4430, (int16_t)0x3e74, (int16_t)0xfeac,
+    (int16_t)0xfeb6, (int16_t)0x424a, (int16_t)0x4060, (int16_t)0xfeaf,
+    (int16_t)0xfeaf, (int16_t)0x4060, (int16_t)0x424a, (int16_t)0xfeb6,
+    (int16_t)0xfeac, (int16_t)0x3e74, (int16_t)0x4430, (int16_t)0xfec0,
+    (int16_t)0xfeab, (int16_t)0x3c85, (int16_t)0x4611, (int16_t)0xfece,
+    (int16_t)0xfeac, (int16_t)0x3a95, (int16_t)0x47ed, (int16_t)0xfedf,
+    (int16_t)0xfeb0, (int16_t)0x38a5, (int16_t)0x49c2, (int16_t)0xfef5,
+    (int16_t)0xfeb6, (int16_t)0x36b6, (int16_t)0x4b91, (int16_t)0xff0f,
+    (int16_t)0xfebd, (int16_t)0x34c8, (int16_t)0x4d57, (int16_t)0xff2e,
+    (int16_t)0xfec6, (int16_t)0x32dc, (int16_t)0x4f14, (int16_t)0xff53,
+    (int16_t)0xfed0, (int16_t)0x30f3, (int16_t)0x50c7, (int16_t)0xff7c,
+    (int16_t)0xfedb, (int16_t)0x2f0d, (int16_t)0x5270, (int16_t)0xffac,
+    (int16_t)0xfee8, (int16_t)0x2d2c, (int16_t)0x540d, (int16_t)0xffe2,
+    (int16_t)0xfef4, (int16_t)0x2b50, (int16_t)0x559d, (int16_t)0x001f,
+    (int16_t)0xff02, (int16_t)0x297a, (int16_t)0x5720, (int16_t)0x0063,
+    (int16_t)0xff10, (int16_t)0x27a9, (int16_t)0x5896, (int16_t)0x00ae,
+    (int16_t)0xff1e, (int16_t)0x25e0, (int16_t)0x59fc, (int16_t)0x0101,
+    (int16_t)0xff2c, (int16_t)0x241e, (int16_t)0x5b53, (int16_t)0x015b,
+    (int16_t)0xff3a, (int16_t)0x2264, (int16_t)0x5c9a, (int16_t)0x01be,
+    (int16_t)0xff48, (int16_t)0x20b3, (int16_t)0x5dd0, (int16_t)0x022a,
+    (int16_t)0xff56, (int16_t)0x1f0b, (int16_t)0x5ef5, (int16_t)0x029f,
+    (int16_t)0xff64, (int16_t)0x1d6c, (int16_t)0x6007, (int16_t)0x031c,
+    (int16_t)0xff71, (int16_t)0x1bd7, (int16_t)0x6106, (int16_t)0x03a4,
+    (int16_t)0xff7e, (int16_t)0x1a4c, (int16_t)0x61f3, (int16_t)0x0435,
+    (int16_t)0xff8a, (int16_t)0x18cb, (int16_t)0x62cb, (int16_t)0x04d1,
+    (int16_t)0xff96, (int16_t)0x1756, (int16_t)0x638f, (int16_t)0x0577,
+    (int16_t)0xffa1, (int16_t)0x15eb, (int16_t)0x643f, (int16_t)0x0628,
+    (int16_t)0xffac, (int16_t)0x148c, (int16_t)0x64d9, (int16_t)0x06e4,
+    (int16_t)0xffb6, (int16_t)0x1338, (int16_t)0x655e, (int16_t)0x07ab,
+    (int16_t)0xffbf, (int16_t)0x11f0, (int16_t)0x65cd, (int16_t)0x087d,
+    (int16_t)0xffc8, (int16_t)0x10b4, (int16_t)0x6626, (int16_t)0x095a,
+    (int16_t)0xffd0, (int16_t)0x0f83, (int16_t)0x6669, (int16_t)0x0a44,
+    (int16_t)0xffd8, (int16_t)0x0e5f, (int16_t)0x6696, (int16_t)0x0b39,
+    (int16_t)0xffdf, (int16_t)0x0d46, (int16_t)0x66ad, (int16_t)0x0c39,
+};
+
+static inline int16_t ClampS16(int32_t Value)
+{
+    return (int16_t)(Value < -32768 ? -32768 : (Value > 32767 ? 32767 : Value));
+}
+
+static inline uint32_t Align(uint32_t Value, uint32_t Amount)
+{
+    return (Value + Amount - 1) & ~(Amount - 1);
+}
+
+// Whether two ranges of samples share any memory
+static inline bool Overlaps(const void * a, uint32_t aLen, const void * b, uint32_t bLen)
+{
+    return (const uint8_t *)a < (const uint8_t *)b + bLen && (const uint8_t *)b < (const uint8_t *)a + aLen;
+}
+
+// Dst[i] = clamp(Dst[i] + ((Src[i] * Gain[i]) >> 15)). Buffers that sit less
+// than a vector apart see each other's writes sample by sample, so they take
+// the scalar loop.
+static void MixSamples(int16_t * Dst, const int16_t * Src, const int16_t * Gain, uint32_t Count)
+{
+    uint32_t i = 0;
+    bool Vector = Dst == Src || !Overlaps(Dst, 16, Src, 16);
+#if defined(AUDIOHLE_SSE2)
+    for (; Vector && i + 8 <= Count; i += 8)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(Src + i));
+        __m128i g = _mm_loadu_si128((const __m128i *)(Gain + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(Dst + i));
+        __m128i Lo = _mm_mullo_epi16(s, g), Hi = _mm_mulhi_epi16(s, g);
+        __m128i p0 = _mm_srai_epi32(_mm_unpacklo_epi16(Lo, Hi), 15);
+        __m128i p1 = _mm_srai_epi32(_mm_unpackhi_epi16(Lo, Hi), 15);
+        p0 = _mm_add_epi32(p0, _mm_srai_epi32(_mm_unpacklo_epi16(d, d), 16));
+        p1 = _mm_add_epi32(p1, _mm_srai_epi32(_mm_unpackhi_epi16(d, d), 16));
+        _mm_storeu_si128((__m128i *)(Dst + i), _mm_packs_epi32(p0, p1));
+    }
+#elif defined(AUDIOHLE_NEON)
+    for (; Vector && i + 8 <= Count; i += 8)
+    {
+        int16x8_t s = vld1q_s16(Src + i);
+        int16x8_t g = vld1q_s16(Gain + i);
+        int16x8_t d = vld1q_s16(Dst + i);
+        int32x4_t p0 = vshrq_n_s32(vmull_s16(vget_low_s16(s), vget_low_s16(g)), 15);
+        int32x4_t p1 = vshrq_n_s32(vmull_s16(vget_high_s16(s), vget_high_s16(g)), 15);
+        p0 = vaddw_s16(p0, vget_low_s16(d));
+        p1 = vaddw_s16(p1, vget_high_s16(d));
+        vst1q_s16(Dst + i, vcombine_s16(vqmovn_s32(p0), vqmovn_s32(p1)));
+    }
+#endif
+    (void)Vector;
+    for (; i < Count; i++)
+    {
+        Dst[i] = ClampS16(Dst[i] + ((Src[i] * Gain[i]) >> 15));
+    }
+}
+
+static void MixSamples(int16_t * Dst, const int16_t * Src, int16_t Gain, uint32_t Count)
+{
+    int16_t Gains[8] = { Gain, Gain, Gain, Gain, Gain, Gain, Gain, Gain };
+    uint32_t i = 0;
+    for (; i + 8 <= Count; i += 8)
+    {
+        MixSamples(Dst + i, Src + i, Gains, 8);
+    }
+    for (; i < Count; i++)
+    {
+        Dst[i] = ClampS16(Dst[i] + ((Src[i] * Gain) >> 15));
+    }
+}
+
+// Pairs of 16 bit samples from each side make two interleaved words. Samples
+// sit in their word swapped, so the output words are built from the halves of
+// the input words in the order r[1], l[1], r[0], l[0]. An output that runs
+// over either input is left to the scalar loop.
+static void InterleaveSamples(uint16_t * Dst, const uint16_t * Left, const uint16_t * Right, uint32_t Pairs)
+{
+    uint32_t i = 0;
+    bool Vector = !Overlaps(Dst, Pairs * 8, Left, Pairs * 4) && !Overlaps(Dst, Pairs * 8, Right, Pairs * 4);
+#if defined(AUDIOHLE_SSE2)
+    for (; Vector && i + 4 <= Pairs; i += 4)
+    {
+        __m128i l = _mm_loadu_si128((const __m128i *)(Left + i * 2));
+        __m128i r = _mm_loadu_si128((const __m128i *)(Right + i * 2));
+        _mm_storeu_si128((__m128i *)(Dst + i * 4), _mm_shuffle_epi32(_mm_unpacklo_epi16(r, l), 0xB1));
+        _mm_storeu_si128((__m128i *)(Dst + i * 4 + 8), _mm_shuffle_epi32(_mm_unpackhi_epi16(r, l), 0xB1));
+    }
+#elif defined(AUDIOHLE_NEON)
+    for (; Vector && i + 4 <= Pairs; i += 4)
+    {
+        uint16x8x2_t z = vzipq_u16(vld1q_u16(Right + i * 2), vld1q_u16(Left + i * 2));
+        vst1q_u16(Dst + i * 4, vreinterpretq_u16_u32(vrev64q_u32(vreinterpretq_u32_u16(z.val[0]))));
+        vst1q_u16(Dst + i * 4 + 8, vreinterpretq_u16_u32(vrev64q_u32(vreinterpretq_u32_u16(z.val[1]))));
+    }
+#endif
+    (void)Vector;
+    for (; i < Pairs; i++)
+    {
+        uint16_t l1 = Left[i * 2], l2 = Left[i * 2 + 1];
+        uint16_t r1 = Right[i * 2], r2 = Right[i * 2 + 1];
+        Dst[i * 4 + 0] = r2;
+        Dst[i * 4 + 1] = l2;
+        Dst[i * 4 + 2] = r1;
+        Dst[i * 4 + 3] = l1;
+    }
+}
+
+// Rebuilds eight samples of an ADPCM frame from the predictor codebook entry,
+// the two samples before them and the eight scaled residuals:
+//     out[i] = clamp((in[i] << 11 + book1[i] * l1 + book2[i] * l2 + sum(book2[k] * in[i - 1 - k])) >> 11)
+static void AdpcmSamples(int16_t * Out, const int16_t * In, const int16_t * Book, const int16_t Coefs[2][5][8], int16_t l1, int16_t l2)
+{
+#if defined(AUDIOHLE_SSE2)
+    __m128i Inputs[5] =
+    {
+        _mm_set1_epi32((uint16_t)l1 | ((uint32_t)(uint16_t)l2 << 16)),
+        _mm_set1_epi32((uint16_t)In[0] | ((uint32_t)(uint16_t)In[1] << 16)),
+        _mm_set1_epi32((uint16_t)In[2] | ((uint32_t)(uint16_t)In[3] << 16)),
+        _mm_set1_epi32((uint16_t)In[4] | ((uint32_t)(uint16_t)In[5] << 16)),
+        _mm_set1_epi32((uint16_t)In[6] | ((uint32_t)(uint16_t)In[7] << 16)),
+    };
+    __m128i Accu[2];
+    for (int Half = 0; Half < 2; Half++)
+    {
+        Accu[Half] = _mm_setzero_si128();
+        for (int Pair = 0; Pair < 5; Pair++)
+        {
+            __m128i c = _mm_loadu_si128((const __m128i *)Coefs[Half][Pair]);
+            Accu[Half] = _mm_add_epi32(Accu[Half], _mm_madd_epi16(c, Inputs[Pair]));
+        }
+        Accu[Half] = _mm_srai_epi32(Accu[Half], 11);
+    }
+    _mm_storeu_si128((__m128i *)Out, _mm_packs_epi32(Accu[0], Accu[1]));
+    (void)Book;
+#else
+    const int16_t * Book1 = Book;
+    const int16_t * Book2 = Book + 8;
+    for (int i = 0; i < 8; i++)
+    {
+        int32_t Accu = ((int32_t)In[i] << 11) + Book1[i] * l1 + Book2[i] * l2;
+        for (int k = 0; k < i; k++)
+        {
+            Accu += Book2[k] * In[i - 1 - k];
+        }
+        Out[i] = ClampS16(Accu >> 11);
+    }
+    (void)Coefs;
+#endif
+}
+
+CAudioHle::CAudioHle() :
+    m_Rdram(NULL),
+    m_RdramMask(0),
+    m_In(0),
+    m_Out(0),
+    m_Count(0),
+    m_DryRight(0),
+    m_WetLeft(0),
+    m_WetRight(0),
+    m_Dry(0),
+    m_Wet(0),
+    m_Loop(0)
+{
+    memset(m_Segments, 0, sizeof(m_Segments));
+    memset(m_Vol, 0, sizeof(m_Vol));
+    memset(m_Target, 0, sizeof(m_Target));
+    memset(m_Rate, 0, sizeof(m_Rate));
+    memset(m_Table, 0, sizeof(m_Table));
+    memset(m_Buffer, 0, sizeof(m_Buffer));
+    BuildAdpcmCoefs();
+}
+
+bool CAudioHle::Supported(const uint8_t * Dmem, const uint8_t * Rdram, uint32_t RdramSize)
+{
+    // The microcode is told apart by the start of its data segment
+    uint32_t UcodeData = *(const uint32_t *)(Dmem + TASK_UCODE_DATA) & (RdramSize - 1) & ~3;
+    if (UcodeData + 0x34 > RdramSize)
+    {
+        return false;
+    }
+    const uint32_t * Data = (const uint32_t *)(Rdram + UcodeData);
+    return Data[0x00 / 4] == 0x00000001 && Data[0x30 / 4] == 0xF0000F00 && Data[0x28 / 4] == 0x1E24138C;
+}
+
+void CAudioHle::ProcessTask(const uint8_t * Dmem, uint8_t * Rdram, uint32_t RdramSize)
+{
+    static const AudioCommand Commands[0x10] =
+    {
+        &CAudioHle::SpNoop, &CAudioHle::Adpcm, &CAudioHle::ClearBuff, &CAudioHle::EnvMixer,
+        &CAudioHle::LoadBuff, &CAudioHle::Resample, &CAudioHle::SaveBuff, &CAudioHle::Segment,
+        &CAudioHle::SetBuff, &CAudioHle::SetVol, &CAudioHle::DmemMove, &CAudioHle::LoadAdpcm,
+        &CAudioHle::Mixer, &CAudioHle::Interleave, &CAudioHle::Polef, &CAudioHle::SetLoop,
+    };
+
+    m_Rdram = Rdram;
+    m_RdramMask = RdramSize - 1;
+    memset(m_Segments, 0, sizeof(m_Segments));
+
+    uint32_t List = *(const uint32_t *)(Dmem + TASK_DATA_PTR);
+    uint32_t Size = *(const uint32_t *)(Dmem + TASK_DATA_SIZE);
+    for (uint32_t i = 0; i + 8 <= Size; i += 8)
+    {
+        uint32_t w1 = DramU32(List + i);
+        uint32_t w2 = DramU32(List + i + 4);
+        uint32_t Command = (w1 >> 24) & 0x7F;
+        if (Command >= sizeof(Commands) / sizeof(Commands[0]))
+        {
+            WriteTrace(TraceAudio, TraceWarning, "Unknown audio command %02X (%08X %08X)", Command, w1, w2);
+            continue;
+        }
+        (this->*Commands[Command])(w1, w2);
+    }
+}
+
+uint32_t CAudioHle::SegmentAddress(uint32_t SegOffset) const
+{
+    uint32_t Segment = (SegOffset >> 24) & 0x3F;
+    uint32_t Offset = SegOffset & 0xFFFFFF;
+    return Segment < SegmentCount ? m_Segments[Segment] + Offset : Offset;
+}
+
+uint8_t * CAudioHle::DramPtr(uint32_t Address, uint32_t Len)
+{
+    Address &= m_RdramMask;
+    if (Address + Len > m_RdramMask + 1)
+    {
+        WriteTrace(TraceAudio, TraceWarning, "Access outside of rdram (%08X, %d bytes)", Address, Len);
+        return NULL;
+    }
+    return m_Rdram + Address;
+}
+
+// How much of Len bytes from Offset falls inside the work area
+uint32_t CAudioHle::BufferLen(uint32_t Offset, uint32_t Len) const
+{
+    if (Offset >= BufferSize)
+    {
+        return 0;
+    }
+    return Len < BufferSize - Offset ? Len : BufferSize - Offset;
+}
+
+void CAudioHle::BuildAdpcmCoefs(void)
+{
+    for (uint32_t Entry = 0; Entry < CodebookEntries; Entry++)
+    {
+        const int16_t * Book1 = m_Table + Entry * 16;
+        const int16_t * Book2 = Book1 + 8;
+        for (uint32_t i = 0; i < 8; i++)
+        {
+            int16_t Row[10];
+            Row[0] = Book1[i];
+            Row[1] = Book2[i];
+            for (uint32_t j = 0; j < 8; j++)
+            {
+                Row[2 + j] = j < i ? Book2[i - 1 - j] : (j == i ? 2048 : 0);
+            }
+            for (uint32_t Pair = 0; Pair < 5; Pair++)
+            {
+                m_AdpcmCoefs[Entry][i / 4][Pair][(i % 4) * 2] = Row[Pair * 2];
+                m_AdpcmCoefs[Entry][i / 4][Pair][(i % 4) * 2 + 1] = Row[Pair * 2 + 1];
+            }
+        }
+    }
+}
+
+void CAudioHle::SpNoop(uint32_t /*w1*/, uint32_t /*w2*/)
+{
+}
+
+void CAudioHle::Adpcm(uint32_t w1, uint32_t w2)
+{
+    uint8_t Flags = (uint8_t)(w1 >> 16);
+    uint32_t Address = SegmentAddress(w2);
+    uint16_t DmemIn = m_In, DmemOut = m_Out;
+    uint32_t Count = (uint16_t)Align(m_Count, 32);
+
+    int16_t LastFrame[16];
+    if ((Flags & A_INIT) != 0)
+    {
+        memset(LastFrame, 0, sizeof(LastFrame));
+    }
+    else
+    {
+        uint32_t From = (Flags & A_LOOP) != 0 ? m_Loop : Address;
+        for (uint32_t i = 0; i < 16; i++)
+        {
+            LastFrame[i] = (int16_t)DramU16(From + i * 2);
+        }
+    }
+
+    for (uint32_t i = 0; i < 16; i++, DmemOut += 2)
+    {
+        BufferS16(DmemOut) = LastFrame[i];
+    }
+
+    for (; Count != 0; Count -= 32)
+    {
+        uint8_t Code = BufferU8(DmemIn++);
+        uint32_t Scale = (Code & 0xF0) >> 4;
+        uint32_t Entry = Code & 0xF;
+        uint32_t RightShift = Scale < 12 ? 12 - Scale : 0;
+
+        int16_t Frame[16];
+        for (uint32_t i = 0; i < 8; i++)
+        {
+            uint8_t Byte = BufferU8(DmemIn++);
+            Frame[i * 2] = (int16_t)((uint16_t)(Byte & 0xF0) << 8) >> RightShift;
+            Frame[i * 2 + 1] = (int16_t)((uint16_t)(Byte & 0x0F) << 12) >> RightShift;
+        }
+
+        const int16_t * Book = m_Table + Entry * 16;
+        AdpcmSamples(LastFrame, Frame, Book, m_AdpcmCoefs[Entry], LastFrame[14], LastFrame[15]);
+        AdpcmSamples(LastFrame + 8, Frame + 8, Book, m_AdpcmCoefs[Entry], LastFrame[6], LastFrame[7]);
+
+        for (uint32_t i = 0; i < 16; i++, DmemOut += 2)
+        {
+            BufferS16(DmemOut) = LastFrame[i];
+        }
+    }
+
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        DramU16(Address + i * 2) = (uint16_t)LastFrame[i];
+    }
+}
+
+void CAudioHle::ClearBuff(uint32_t w1, uint32_t w2)
+{
+    uint16_t Dmem = (uint16_t)(w1 + BufferBase);
+    uint32_t Count = Align(w2 & 0xFFF, 16);
+    if ((Dmem & 3) == 0 && BufferLen(Dmem, Count) == Count)
+    {
+        memset(m_Buffer + Dmem, 0, Count);
+        return;
+    }
+    for (uint32_t i = 0; i < Count; i++)
+    {
+        BufferU8(Dmem + i) = 0;
+    }
+}
+
+void CAudioHle::EnvMixer(uint32_t w1, uint32_t w2)
+{
+    struct RAMP
+    {
+        int64_t Value;
+        int64_t Step;
+        int64_t Target;
+    };
+
+    uint8_t Flags = (uint8_t)(w1 >> 16);
+    uint8_t * Save = DramPtr(SegmentAddress(w2), 80);
+    if (Save == NULL)
+    {
+        return;
+    }
+
+    int16_t Dry = m_Dry, Wet = m_Wet;
+    RAMP Ramps[2];
+    int32_t ExpSeq[2], ExpRates[2];
+    if ((Flags & A_INIT) != 0)
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            Ramps[i].Value = (int32_t)m_Vol[i] << 16;
+            Ramps[i].Target = (int32_t)m_Target[i] << 16;
+            ExpRates[i] = m_Rate[i];
+            ExpSeq[i] = m_Vol[i] * m_Rate[i];
+        }
+    }
+    else
+    {
+        int32_t Fields[8];
+        memcpy(&Wet, Save + 0, sizeof(Wet));
+        memcpy(&Dry, Save + 4, sizeof(Dry));
+        memcpy(Fields, Save + 8, sizeof(Fields));
+        Ramps[0].Target = Fields[0];
+        Ramps[1].Target = Fields[1];
+        ExpRates[0] = Fields[2];
+        ExpRates[1] = Fields[3];
+        ExpSeq[0] = Fields[4];
+        ExpSeq[1] = Fields[5];
+        Ramps[0].Value = Fields[6];
+        Ramps[1].Value = Fields[7];
+    }
+    Ramps[0].Step = Ramps[0].Target - Ramps[0].Value;
+    Ramps[1].Step = Ramps[1].Target - Ramps[1].Value;
+
+    uint32_t Outputs = (Flags & A_AUX) != 0 ? 4 : 2;
+    uint16_t Dmem[5] = { m_In, m_Out, m_DryRight, m_WetLeft, m_WetRight };
+    uint32_t Count = m_Count;
+    for (uint32_t i = 0; i <= Outputs; i++)
+    {
+        Count = BufferLen(Dmem[i], Align(Count, 16)) & ~15;
+    }
+    const int16_t * In = (const int16_t *)(m_Buffer + Dmem[0]);
+
+    for (uint32_t Pos = 0; Pos < Count / 2; Pos += 8)
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            if (Ramps[i].Step != 0)
+            {
+                ExpSeq[i] = (int32_t)(((int64_t)ExpSeq[i] * (int64_t)ExpRates[i]) >> 16);
+                Ramps[i].Step = (ExpSeq[i] - Ramps[i].Value) >> 3;
+            }
+        }
+
+        // The volume ramps step once a sample, work out the gains for the
+        // eight samples first (in the word swapped order the samples are held)
+        // and then mix them in one go
+        int16_t Gains[4][8];
+        for (uint32_t x = 0; x < 8; x++)
+        {
+            int16_t Vol[2];
+            for (int i = 0; i < 2; i++)
+            {
+                Ramps[i].Value += Ramps[i].Step;
+                bool Reached = Ramps[i].Step <= 0 ? Ramps[i].Value <= Ramps[i].Target : Ramps[i].Value >= Ramps[i].Target;
+                if (Reached)
+                {
+                    Ramps[i].Value = Ramps[i].Target;
+                    Ramps[i].Step = 0;
+                }
+                Vol[i] = (int16_t)(Ramps[i].Value >> 16);
+            }
+            Gains[0][x ^ 1] = ClampS16((Vol[0] * Dry + 0x4000) >> 15);
+            Gains[1][x ^ 1] = ClampS16((Vol[1] * Dry + 0x4000) >> 15);
+            Gains[2][x ^ 1] = ClampS16((Vol[0] * Wet + 0x4000) >> 15);
+            Gains[3][x ^ 1] = ClampS16((Vol[1] * Wet + 0x4000) >> 15);
+        }
+        // The microcode loads the input and every output for the eight samples
+        // before it stores any of them, so when outputs share a buffer with
+        // each other or with the input the last store wins rather than the sum
+        int16_t Input[8], Mixed[4][8];
+        memcpy(Input, In + Pos, sizeof(Input));
+        for (uint32_t i = 0; i < Outputs; i++)
+        {
+            memcpy(Mixed[i], (int16_t *)(m_Buffer + Dmem[i + 1]) + Pos, sizeof(Mixed[i]));
+            MixSamples(Mixed[i], Input, Gains[i], 8);
+        }
+        for (uint32_t i = 0; i < Outputs; i++)
+        {
+            memcpy((int16_t *)(m_Buffer + Dmem[i + 1]) + Pos, Mixed[i], sizeof(Mixed[i]));
+        }
+    }
+
+    int32_t Fields[8] =
+    {
+        (int32_t)Ramps[0].Target, (int32_t)Ramps[1].Target,
+        ExpRates[0], ExpRates[1],
+        ExpSeq[0], ExpSeq[1],
+        (int32_t)Ramps[0].Value, (int32_t)Ramps[1].Value,
+    };
+    memcpy(Save + 0, &Wet, sizeof(Wet));
+    memcpy(Save + 4, &Dry, sizeof(Dry));
+    memcpy(Save + 8, Fields, sizeof(Fields));
+}
+
+void CAudioHle::LoadBuff(uint32_t /*w1*/, uint32_t w2)
+{
+    if (m_Count == 0)
+    {
+        return;
+    }
+    uint32_t Dmem = m_In & ~3;
+    uint32_t Count = BufferLen(Dmem, Align(m_Count, 8));
+    uint8_t * Src = DramPtr(SegmentAddress(w2) & ~7, Count);
+    if (Src != NULL)
+    {
+        memcpy(m_Buffer + Dmem, Src, Count);
+    }
+}
+
+void CAudioHle::Resample(uint32_t w1, uint32_t w2)
+{
+    uint8_t Flags = (uint8_t)(w1 >> 16);
+    uint32_t Pitch = (w1 & 0xFFFF) << 1;
+    uint32_t Address = SegmentAddress(w2);
+    uint32_t InPos = (m_In >> 1) - 4;
+    uint32_t OutPos = m_Out >> 1;
+    uint32_t Count = (uint16_t)Align(m_Count, 16) >> 1;
+
+    uint32_t PitchAccu;
+    if ((Flags & A_INIT) != 0)
+    {
+        for (uint32_t k = 0; k < 4; k++)
+        {
+            Sample(InPos + k) = 0;
+        }
+        PitchAccu = 0;
+    }
+    else
+    {
+        for (uint32_t k = 0; k < 4; k++)
+        {
+            Sample(InPos + k) = (int16_t)DramU16(Address + k * 2);
+        }
+        PitchAccu = DramU16(Address + 8);
+    }
+
+    // Each output picks its taps from where the pitch accumulator has moved
+    // the input position to, so this stays one sample at a time
+    for (; Count != 0; Count--)
+    {
+        const int16_t * Lut = ResampleLut + ((PitchAccu & 0xFC00) >> 8);
+        int32_t Accu = Sample(InPos) * Lut[0] + Sample(InPos + 1) * Lut[1] + Sample(InPos + 2) * Lut[2] + Sample(InPos + 3) * Lut[3];
+        Sample(OutPos++) = ClampS16(Accu >> 15);
+
+        PitchAccu += Pitch;
+        InPos += PitchAccu >> 16;
+        PitchAccu &= 0xFFFF;
+    }
+
+    for (uint32_t k = 0; k < 4; k++)
+    {
+        DramU16(Address + k * 2) = (uint16_t)Sample(InPos + k);
+    }
+    DramU16(Address + 8) = (uint16_t)PitchAccu;
+}
+
+void CAudioHle::SaveBuff(uint32_t /*w1*/, uint32_t w2)
+{
+    if (m_Count == 0)
+    {
+        return;
+    }
+    uint32_t Dmem = m_Out & ~3;
+    uint32_t Count = BufferLen(Dmem, Align(m_Count, 8));
+    uint8_t * Dst = DramPtr(SegmentAddress(w2) & ~7, Count);
+    if (Dst != NULL)
+    {
+        memcpy(Dst, m_Buffer + Dmem, Count);
+    }
+}
+
+void CAudioHle::Segment(uint32_t /*w1*/, uint32_t w2)
+{
+    uint32_t Segment = (w2 >> 24) & 0x3F;
+    if (Segment < SegmentCount)
+    {
+        m_Segments[Segment] = w2 & 0xFFFFFF;
+    }
+}
+
+void CAudioHle::SetBuff(uint32_t w1, uint32_t w2)
+{
+    uint8_t Flags = (uint8_t)(w1 >> 16);
+    if ((Flags & A_AUX) != 0)
+    {
+        m_DryRight = (uint16_t)(w1 + BufferBase);
+        m_WetLeft = (uint16_t)((w2 >> 16) + BufferBase);
+        m_WetRight = (uint16_t)(w2 + BufferBase);
+    }
+    else
+    {
+        m_In = (uint16_t)(w1 + BufferBase);
+        m_Out = (uint16_t)((w2 >> 16) + BufferBase);
+        m_Count = (uint16_t)w2;
+    }
+}
+
+void CAudioHle::SetVol(uint32_t w1, uint32_t w2)
+{
+    uint8_t Flags = (uint8_t)(w1 >> 16);
+    if ((Flags & A_AUX) != 0)
+    {
+        m_Dry = (int16_t)w1;
+        m_Wet = (int16_t)w2;
+        return;
+    }
+
+    uint32_t Side = (Flags & A_LEFT) != 0 ? 0 : 1;
+    if ((Flags & A_VOL) != 0)
+    {
+        m_Vol[Side] = (int16_t)w1;
+    }
+    else
+    {
+        m_Target[Side] = (int16_t)w1;
+        m_Rate[Side] = (int32_t)w2;
+    }
+}
+
+void CAudioHle::DmemMove(uint32_t w1, uint32_t w2)
+{
+    uint16_t DmemIn = (uint16_t)(w1 + BufferBase);
+    uint16_t DmemOut = (uint16_t)((w2 >> 16) + BufferBase);
+    uint32_t Count = (uint16_t)Align(w2 & 0xFFFF, 16);
+    if (Count == 0)
+    {
+        return;
+    }
+
+    // Word aligned moves that do not overlap copy whole words unchanged, anything
+    // else goes a byte at a time the way the microcode does it
+    bool Overlap = DmemIn < DmemOut + Count && DmemOut < DmemIn + Count;
+    if (((DmemIn | DmemOut) & 3) == 0 && !Overlap && BufferLen(DmemIn, Count) == Count && BufferLen(DmemOut, Count) == Count)
+    {
+        memcpy(m_Buffer + DmemOut, m_Buffer + DmemIn, Count);
+        return;
+    }
+    for (uint32_t i = 0; i < Count; i++)
+    {
+        BufferU8(DmemOut + i) = BufferU8(DmemIn + i);
+    }
+}
+
+void CAudioHle::LoadAdpcm(uint32_t w1, uint32_t w2)
+{
+    uint32_t Address = SegmentAddress(w2);
+    uint32_t Count = Align(w1 & 0xFFFF, 8) >> 1;
+    if (Count > TableSize)
+    {
+        Count = TableSize;
+    }
+    for (uint32_t i = 0; i < Count; i++)
+    {
+        m_Table[i] = (int16_t)DramU16(Address + i * 2);
+    }
+    BuildAdpcmCoefs();
+}
+
+void CAudioHle::Mixer(uint32_t w1, uint32_t w2)
+{
+    if (m_Count == 0)
+    {
+        return;
+    }
+    int16_t Gain = (int16_t)w1;
+    uint16_t DmemIn = (uint16_t)((w2 >> 16) + BufferBase);
+    uint16_t DmemOut = (uint16_t)(w2 + BufferBase);
+    uint32_t Count = (uint16_t)Align(m_Count, 32);
+    Count = BufferLen(DmemOut, BufferLen(DmemIn, Count));
+    MixSamples((int16_t *)(m_Buffer + DmemOut), (const int16_t *)(m_Buffer + DmemIn), Gain, Count >> 1);
+}
+
+void CAudioHle::Interleave(uint32_t /*w1*/, uint32_t w2)
+{
+    if (m_Count == 0)
+    {
+        return;
+    }
+    uint16_t Left = (uint16_t)((w2 >> 16) + BufferBase);
+    uint16_t Right = (uint16_t)(w2 + BufferBase);
+    uint32_t Count = (uint16_t)Align(m_Count, 16);
+    Count = BufferLen(Left, BufferLen(Right, Count));
+    Count = BufferLen(m_Out, Count * 2) / 2;
+    InterleaveSamples((uint16_t *)(m_Buffer + m_Out), (const uint16_t *)(m_Buffer + Left), (const uint16_t *)(m_Buffer + Right), Count >> 2);
+}
+
+void CAudioHle::Polef(uint32_t w1, uint32_t w2)
+{
+    if (m_Count == 0)
+    {
+        return;
+    }
+    uint8_t Flags = (uint8_t)(w1 >> 16);
+    uint16_t Gain = (uint16_t)w1;
+    uint32_t Address = SegmentAddress(w2);
+    uint16_t DmemIn = m_In;
+    uint32_t DstPos = m_Out >> 1;
+    uint32_t Count = (uint16_t)Align(m_Count, 16);
+
+    int16_t * Dst = (int16_t *)m_Buffer;
+    const int16_t * h1 = m_Table;
+    int16_t * h2 = m_Table + 8;
+    int16_t l1 = 0, l2 = 0;
+    if ((Flags & A_INIT) == 0)
+    {
+        l1 = (int16_t)DramU16(Address + 4);
+        l2 = (int16_t)DramU16(Address + 6);
+    }
+
+    // The scaled taps stay in the table, as they do in DMEM
+    int16_t h2Before[8];
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        h2Before[i] = h2[i];
+        h2[i] = (int16_t)(((int32_t)h2[i] * Gain) >> 14);
+    }
+    BuildAdpcmCoefs();
+
+    for (; Count != 0; Count -= 16, DstPos += 8)
+    {
+        int16_t Frame[8];
+        for (uint32_t i = 0; i < 8; i++, DmemIn += 2)
+        {
+            Frame[i] = BufferS16(DmemIn);
+        }
+        for (uint32_t i = 0; i < 8; i++)
+        {
+            int32_t Accu = Frame[i] * Gain + h1[i] * l1 + h2Before[i] * l2;
+            for (uint32_t k = 0; k < i; k++)
+            {
+                Accu += h2[k] * Frame[i - 1 - k];
+            }
+            Dst[(DstPos + (i ^ 1)) & (BufferSize / 2 - 1)] = ClampS16(Accu >> 14);
+        }
+        l1 = Dst[(DstPos + (6 ^ 1)) & (BufferSize / 2 - 1)];
+        l2 = Dst[(DstPos + (7 ^ 1)) & (BufferSize / 2 - 1)];
+    }
+
+    // The last two words of output are written back as they sit in the buffer,
+    // so l1 and l2 read back from their swapped places on the next call
+    uint32_t From = ((DstPos - 4) * 2) & (BufferSize - 1);
+    uint8_t * Save = DramPtr(Address, 8);
+    if (Save != NULL && From + 8 <= BufferSize)
+    {
+        memcpy(Save, m_Buffer + From, 8);
+    }
+}
+
+void CAudioHle::SetLoop(uint32_t /*w1*/, uint32_t w2)
+{
+    m_Loop = SegmentAddress(w2);
+}
@@ -0,0 +1,96 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#pragma once
+#include <stdint.h>
+
+// High level version of the standard audio microcode, the ABI used by most
+// first party titles including Mario Party 1-3. The audio list is read from
+// RDRAM and run against a private copy of the microcode's DMEM work area, with
+// each command following what the microcode does so the samples and state
+// written back to RDRAM match a run on the RSP.
+class CAudioHle
+{
+public:
+    CAudioHle();
+
+    // True when the audio task in DMEM was built for this microcode
+    static bool Supported(const uint8_t * Dmem, const uint8_t * Rdram, uint32_t RdramSize);
+
+    // Runs the audio list of the task in DMEM
+    void ProcessTask(const uint8_t * Dmem, uint8_t * Rdram, uint32_t RdramSize);
+
+private:
+    CAudioHle(const CAudioHle&);            // Disable copy constructor
+    CAudioHle& operator=(const CAudioHle&); // Disable assignment
+
+    enum
+    {
+        BufferSize = 0x1000,
+        BufferBase = 0x5C0,
+        SegmentCount = 16,
+        TableSize = 0x100,
+        CodebookEntries = 16,
+    };
+
+    typedef void (CAudioHle::*AudioCommand)(uint32_t w1, uint32_t w2);
+
+    // Audio list commands, in ABI order
+    void SpNoop(uint32_t w1, uint32_t w2);
+    void Adpcm(uint32_t w1, uint32_t w2);
+    void ClearBuff(uint32_t w1, uint32_t w2);
+    void EnvMixer(uint32_t w1, uint32_t w2);
+    void LoadBuff(uint32_t w1, uint32_t w2);
+    void Resample(uint32_t w1, uint32_t w2);
+    void SaveBuff(uint32_t w1, uint32_t w2);
+    void Segment(uint32_t w1, uint32_t w2);
+    void SetBuff(uint32_t w1, uint32_t w2);
+    void SetVol(uint32_t w1, uint32_t w2);
+    void DmemMove(uint32_t w1, uint32_t w2);
+    void LoadAdpcm(uint32_t w1, uint32_t w2);
+    void Mixer(uint32_t w1, uint32_t w2);
+    void Interleave(uint32_t w1, uint32_t w2);
+    void Polef(uint32_t w1, uint32_t w2);
+    void SetLoop(uint32_t w1, uint32_t w2);
+
+    uint32_t SegmentAddress(uint32_t SegOffset) const;
+    uint8_t * DramPtr(uint32_t Address, uint32_t Len);
+    uint32_t BufferLen(uint32_t Offset, uint32_t Len) const;
+    void BuildAdpcmCoefs(void);
+
+    // The work area and RDRAM are both held as native 32 bit words
+    uint8_t & BufferU8(uint32_t Address) { return m_Buffer[(Address ^ 3) & (BufferSize - 1)]; }
+    int16_t & BufferS16(uint32_t Address) { return *(int16_t *)(m_Buffer + ((Address ^ 2) & (BufferSize - 1))); }
+    int16_t & Sample(uint32_t Pos) { return ((int16_t *)m_Buffer)[(Pos ^ 1) & (BufferSize / 2 - 1)]; }
+    uint16_t & DramU16(uint32_t Address) { return *(uint16_t *)(m_Rdram + ((Address ^ 2) & m_RdramMask & ~1)); }
+    uint32_t DramU32(uint32_t Address) const { return *(const uint32_t *)(m_Rdram + (Address & m_RdramMask & ~3)); }
+
+    uint8_t * m_Rdram;
+    uint32_t m_RdramMask;
+    uint32_t m_Segments[SegmentCount];
+    uint16_t m_In;
+    uint16_t m_Out;
+    uint16_t m_Count;
+    uint16_t m_DryRight;
+    uint16_t m_WetLeft;
+    uint16_t m_WetRight;
+    int16_t m_Dry;
+    int16_t m_Wet;
+    int16_t m_Vol[2];
+    int16_t m_Target[2];
+    int32_t m_Rate[2];
+    uint32_t m_Loop;
+    int16_t m_Table[TableSize];
+
+    // Each codebook entry as an 8x10 matrix over (l1, l2, frame[0..7]), the
+    // coefficients for four outputs interleaved in pairs per input pair
+    int16_t m_AdpcmCoefs[CodebookEntries][2][5][8];
+    uint8_t m_Buffer[BufferSize];
+};
@@ -0,0 +1,297 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#include "stdafx.h"
+#include "Benchmark.h"
+#include <Project64-core/N64System/ProfilingClass.h>
+#include <Project64-core/N64System/Mips/RegisterClass.h>
+#include <Project64-core/N64System/Mips/SystemTiming.h>
+#include <Project64-core/N64System/SystemGlobals.h>
+#include <Project64-core/Plugins/PluginClass.h>
+#include <Project64-core/Plugins/RSPPlugin.h>
+#include <Common/LogClass.h>
+#include <Common/path.h>
+#include <stdio.h>
+#include <algorithm>
+
+CBenchmark::CBenchmark(CRegisters & Reg, CProfiling & CPU_Usage) :
+    m_Reg(Reg),
+    m_CPU_Usage(CPU_Usage),
+    m_ViLimit(0),
+    m_ViCount(0),
+    m_FrameCount(0),
+    m_LastOrigin(0),
+    m_HleAudioLists(0),
+    m_RspAudioLists(0),
+    m_RspSlices(0),
+    m_RspResumes(0),
+    m_RspUnfinished(0),
+    m_AsyncDlists(0),
+    m_AsyncWriteSyncs(0),
+    m_AsyncMaxWait(0),
+    m_AsyncWaitTime(0),
+    m_Controllers(1),
+    m_InputPos(0)
+{
+    // Loaded up front, the controller plugin asks which controllers are present before the cpu starts
+    if (g_Settings->LoadDword(Cmd_BenchmarkFrames) != 0)
+    {
+        LoadInputScript(g_Settings->LoadStringVal(Cmd_BenchmarkInput).c_str());
+    }
+}
+
+void CBenchmark::Start(void)
+{
+    m_ViLimit = g_Settings->LoadDword(Cmd_BenchmarkFrames);
+    if (m_ViLimit == 0)
+    {
+        return;
+    }
+    WriteTrace(TraceN64System, TraceInfo, "Benchmarking %d vi", m_ViLimit);
+    g_Settings->SaveBool(GameRunning_LimitFPS, false);
+
+    m_ViCount = 0;
+    m_FrameCount = 0;
+    m_LastOrigin = m_Reg.VI_ORIGIN_REG;
+    m_HleAudioLists = 0;
+    m_RspAudioLists = 0;
+    m_RspSlices = 0;
+    m_RspResumes = 0;
+    m_RspUnfinished = 0;
+    m_AsyncDlists = 0;
+    m_AsyncWriteSyncs = 0;
+    m_AsyncMaxWait = 0;
+    m_AsyncWaitTime = 0;
+    m_InputPos = 0;
+    m_ViTimes.clear();
+    m_ViTimes.reserve(m_ViLimit);
+    m_CPU_Usage.ResetTimers();
+    m_StartTime.SetToNow();
+    m_LastVi = m_StartTime;
+}
+
+bool CBenchmark::ControllerPresent(int32_t Control) const
+{
+    return Control < m_Controllers;
+}
+
+uint32_t CBenchmark::Buttons(int32_t Control) const
+{
+    if (m_InputPos >= m_Input.size() || m_Input[m_InputPos].Vi > m_ViCount)
+    {
+        return 0;
+    }
+    return m_Input[m_InputPos].Buttons[Control & 3];
+}
+
+void CBenchmark::CountAudioList(bool Hle)
+{
+    if (Hle)
+    {
+        m_HleAudioLists += 1;
+    }
+    else
+    {
+        m_RspAudioLists += 1;
+    }
+}
+
+void CBenchmark::CountRspSlice(bool Resume, bool Unfinished)
+{
+    m_RspSlices += 1;
+    if (Resume)
+    {
+        m_RspResumes += 1;
+    }
+    if (Unfinished)
+    {
+        m_RspUnfinished += 1;
+    }
+}
+
+void CBenchmark::CountAsyncDlist(uint32_t WaitTime, bool WriteSync)
+{
+    m_AsyncDlists += 1;
+    m_AsyncWaitTime += WaitTime;
+    if (WaitTime > m_AsyncMaxWait)
+    {
+        m_AsyncMaxWait = WaitTime;
+    }
+    if (WriteSync)
+    {
+        m_AsyncWriteSyncs += 1;
+    }
+}
+
+bool CBenchmark::ViRefresh(void)
+{
+    if (m_ViLimit != 0)
+    {
+        HighResTimeStamp Now;
+        Now.SetToNow();
+        m_ViTimes.push_back((uint32_t)(Now.GetMicroSeconds() - m_LastVi.GetMicroSeconds()));
+        m_LastVi = Now;
+    }
+    if (m_Reg.VI_ORIGIN_REG != m_LastOrigin)
+    {
+        m_LastOrigin = m_Reg.VI_ORIGIN_REG;
+        m_FrameCount += 1;
+    }
+    m_ViCount += 1;
+    while (m_InputPos + 1 < m_Input.size() && m_Input[m_InputPos + 1].Vi <= m_ViCount)
+    {
+        m_InputPos += 1;
+    }
+    if (m_ViCount < m_ViLimit)
+    {
+        return false;
+    }
+
+    HighResTimeStamp EndTime;
+    EndTime.SetToNow();
+    m_CPU_Usage.StopTimer();
+    WriteReport(EndTime.GetMicroSeconds() - m_StartTime.GetMicroSeconds());
+    m_ViLimit = 0;
+    return true;
+}
+
+void CBenchmark::LoadInputScript(const char * FileName)
+{
+    m_Input.clear();
+    if (FileName == NULL || FileName[0] == '\0')
+    {
+        return;
+    }
+
+    FILE * Script = fopen(FileName, "r");
+    if (Script == NULL)
+    {
+        WriteTrace(TraceN64System, TraceError, "Failed to open input script %s", FileName);
+        return;
+    }
+
+    char Line[256];
+    while (fgets(Line, sizeof(Line), Script) != NULL)
+    {
+        if (Line[0] == '#')
+        {
+            continue;
+        }
+        INPUT_STEP Step = { 0 };
+        int Fields = sscanf(Line, "%u %x %x %x %x", &Step.Vi, &Step.Buttons[0], &Step.Buttons[1], &Step.Buttons[2], &Step.Buttons[3]);
+        if (Fields < 2)
+        {
+            continue;
+        }
+        if (Fields - 1 > m_Controllers)
+        {
+            m_Controllers = Fields - 1;
+        }
+        if (!m_Input.empty() && m_Input.back().Vi >= Step.Vi)
+        {
+            WriteTrace(TraceN64System, TraceError, "Input script lines must be in vi order (vi %d)", Step.Vi);
+            continue;
+        }
+        m_Input.push_back(Step);
+    }
+    fclose(Script);
+    WriteTrace(TraceN64System, TraceInfo, "Loaded %d input steps for %d controllers from %s", (uint32_t)m_Input.size(), m_Controllers, FileName);
+}
+
+void CBenchmark::WriteReport(uint64_t TimeTaken)
+{
+    static const struct
+    {
+        PROFILE_TIMERS Timer;
+        const char * Name;
+    } Timers[] =
+    {
+        { Timer_R4300, "r4300i" },
+        { Timer_RSP_Dlist, "RSP display lists" },
+        { Timer_RSP_Alist, "RSP audio lists" },
+        { Timer_RSP_Unknown, "RSP other tasks" },
+        { Timer_RefreshScreen, "Refresh screen" },
+        { Timer_UpdateScreen, "Update screen" },
+        { Timer_UpdateFPS, "Update fps" },
+        { Timer_Idel, "Idle" },
+    };
+
+    double Seconds = TimeTaken / 1000000.0;
+    if (Seconds <= 0)
+    {
+        Seconds = 0.000001;
+    }
+    uint64_t Profiled = 0;
+    for (size_t i = 0; i < sizeof(Timers) / sizeof(Timers[0]); i++)
+    {
+        Profiled += m_CPU_Usage.TimeTaken(Timers[i].Timer);
+    }
+
+    stdstr_f Summary("%d vi, %d frames in %.3f s: %.2f vi/s, %.2f fps", m_ViCount, m_FrameCount, Seconds, m_ViCount / Seconds, m_FrameCount / Seconds);
+    WriteTrace(TraceN64System, TraceInfo, "%s", Summary.c_str());
+    g_Notify->DisplayMessage(0, Summary.c_str());
+
+    CLog Report;
+    if (!Report.Open(CPath(g_Settings->LoadStringVal(Directory_Log).c_str(), "Benchmark.txt")))
+    {
+        return;
+    }
+    Report.LogF("Rom: %s\n", g_Settings->LoadStringVal(Game_GoodName).c_str());
+    Report.LogF("RSP: %s\n", g_Plugins != NULL && g_Plugins->RSP() != NULL ? g_Plugins->RSP()->PluginName() : "none");
+    Report.LogF("Async display list cycles: %u\n", g_Settings->LoadDword(Cmd_BenchmarkAsyncDlist));
+    Report.LogF("%s\n\n", Summary.c_str());
+    Report.LogF("Subsystem              Time (ms)  Percent\n");
+    for (size_t i = 0; i < sizeof(Timers) / sizeof(Timers[0]); i++)
+    {
+        uint64_t Time = m_CPU_Usage.TimeTaken(Timers[i].Timer);
+        Report.LogF("%-20s %11.1f  %6.2f%%\n", Timers[i].Name, Time / 1000.0, Profiled != 0 ? (Time * 100.0) / Profiled : 0.0);
+    }
+    uint32_t AudioLists = m_HleAudioLists + m_RspAudioLists;
+    if (AudioLists != 0)
+    {
+        Report.LogF("\nAudio lists: %u by hle, %u on the RSP, %.1f us per list\n", m_HleAudioLists, m_RspAudioLists, (double)m_CPU_Usage.TimeTaken(Timer_RSP_Alist) / AudioLists);
+    }
+    if (m_RspSlices != 0)
+    {
+        Report.LogF("\nRSP runs: %u, %u resumed a task, %u left the task unfinished\n", m_RspSlices, m_RspResumes, m_RspUnfinished);
+    }
+    if (m_AsyncDlists != 0)
+    {
+        Report.LogF("\nAsync display lists: %u, cpu held up %.1f ms (max %u us), %u collected by an rdram write\n", m_AsyncDlists, m_AsyncWaitTime / 1000.0, m_AsyncMaxWait, m_AsyncWriteSyncs);
+    }
+    if (!m_ViTimes.empty())
+    {
+        std::vector<uint32_t> Sorted(m_ViTimes);
+        std::sort(Sorted.begin(), Sorted.end());
+        size_t Last = Sorted.size() - 1;
+        Report.LogF("\nTime per vi (us): p50 %u, p90 %u, p99 %u, max %u\n", Sorted[Last / 2], Sorted[(Last * 90) / 100], Sorted[(Last * 99) / 100], Sorted[Last]);
+    }
+
+    if (g_SystemTimer == NULL)
+    {
+        return;
+    }
+    static const char * TimerNames[CSystemTimer::MaxTimer] =
+    {
+        "Unknown", "Compare", "Soft reset", "VI", "AI interrupt", "AI busy",
+        "AI DMA", "SI", "PI", "RSP", "RSP dlist", "64DD PI",
+    };
+    Report.LogF("\nReschedules: %u, deferred: %u\n", g_SystemTimer->Reschedules(), g_SystemTimer->DeferredReschedules());
+    Report.LogF("Timer event           Fired   Avg late   Max late\n");
+    for (int i = CSystemTimer::CompareTimer; i < CSystemTimer::MaxTimer; i++)
+    {
+        const CSystemTimer::TIMER_STATS & Stats = g_SystemTimer->Stats((CSystemTimer::TimerType)i);
+        if (Stats.Fired == 0)
+        {
+            continue;
+        }
+        Report.LogF("%-20s %7u %10.1f %10u\n", TimerNames[i], Stats.Fired, (double)Stats.TotalLate / Stats.Fired, Stats.MaxLate);
+    }
+}
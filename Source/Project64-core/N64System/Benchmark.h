@@ -0,0 +1,91 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#pragma once
+#include <Common/HighResTimeStamp.h>
+#include <vector>
+
+class CRegisters;
+class CProfiling;
+
+// Runs a fixed number of vertical interrupts as fast as possible (started with
+// --benchmark <count>) and writes the speed and where the time went to
+// Benchmark.txt in the log directory. Input comes from an optional script
+// (--input <file>) so runs are repeatable, each line is
+//     <vi> <controller 1 buttons> [<controller 2> <controller 3> <controller 4>]
+// with the buttons in hex, held from that vi until the next line.
+// The gfx, audio and controller plugins are replaced by the null ones in the
+// core, the configured rsp plugin still runs the microcode unless --null-rsp
+// is also given. --async-dlist <cycles> runs display lists on the task thread
+// for that many cycles (0 runs them inline), the saved setting is not used so
+// runs with and without it can be compared on the same input script.
+class CBenchmark
+{
+public:
+    CBenchmark(CRegisters & Reg, CProfiling & CPU_Usage);
+
+    void Start(void);
+    bool Running(void) const { return m_ViLimit != 0; }
+
+    bool ControllerPresent(int32_t Control) const;
+    uint32_t Buttons(int32_t Control) const;
+
+    // Called on every vertical interrupt, returns true once the run is complete
+    bool ViRefresh(void);
+
+    // Called for each audio list, Hle when it was run by the built in audio hle
+    void CountAudioList(bool Hle);
+
+    // Called each time the RSP runs, Resume when it carried on a task that had
+    // given up the RSP and Unfinished when the task gave it up again
+    void CountRspSlice(bool Resume, bool Unfinished);
+
+    // Called when a display list run on the task thread is collected, WaitTime
+    // is how long the cpu was held up and WriteSync when a cpu write to rdram
+    // the task was reading is what collected it
+    void CountAsyncDlist(uint32_t WaitTime, bool WriteSync);
+
+private:
+    CBenchmark();                             // Disable default constructor
+    CBenchmark(const CBenchmark&);            // Disable copy constructor
+    CBenchmark& operator=(const CBenchmark&); // Disable assignment
+
+    struct INPUT_STEP
+    {
+        uint32_t Vi;
+        uint32_t Buttons[4];
+    };
+    typedef std::vector<INPUT_STEP> INPUT_SCRIPT;
+
+    void LoadInputScript(const char * FileName);
+    void WriteReport(uint64_t TimeTaken);
+
+    CRegisters & m_Reg;
+    CProfiling & m_CPU_Usage;
+    uint32_t m_ViLimit;
+    uint32_t m_ViCount;
+    uint32_t m_FrameCount;
+    uint32_t m_LastOrigin;
+    uint32_t m_HleAudioLists;
+    uint32_t m_RspAudioLists;
+    uint32_t m_RspSlices;
+    uint32_t m_RspResumes;
+    uint32_t m_RspUnfinished;
+    uint32_t m_AsyncDlists;
+    uint32_t m_AsyncWriteSyncs;
+    uint32_t m_AsyncMaxWait;
+    uint64_t m_AsyncWaitTime;
+    int32_t m_Controllers;
+    INPUT_SCRIPT m_Input;
+    size_t m_InputPos;
+    HighResTimeStamp m_StartTime;
+    HighResTimeStamp m_LastVi;
+    std::vector<uint32_t> m_ViTimes;
+};
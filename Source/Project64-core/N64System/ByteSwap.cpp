@@ -0,0 +1,155 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#include "stdafx.h"
+#include <Project64-core/N64System/ByteSwap.h>
+#include <string.h>
+
+#if defined(__i386) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#include <emmintrin.h>
+#define BYTESWAP_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define BYTESWAP_NEON
+#endif
+
+static inline uint32_t SwapWord(uint32_t Value)
+{
+#ifdef _MSC_VER
+    return _byteswap_ulong(Value);
+#else
+    return __builtin_bswap32(Value);
+#endif
+}
+
+static inline uint32_t SwapHalfWord(uint32_t Value)
+{
+    return (Value >> 16) | (Value << 16);
+}
+
+void CByteSwap::SwapWords(uint8_t * Dst, const uint8_t * Src, size_t Len)
+{
+    size_t i = 0;
+#if defined(BYTESWAP_SSE2)
+    for (; i + 32 <= Len; i += 32)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)(Src + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(Src + i + 16));
+        a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(a, 0xB1), 0xB1);
+        b = _mm_shufflehi_epi16(_mm_shufflelo_epi16(b, 0xB1), 0xB1);
+        a = _mm_or_si128(_mm_slli_epi16(a, 8), _mm_srli_epi16(a, 8));
+        b = _mm_or_si128(_mm_slli_epi16(b, 8), _mm_srli_epi16(b, 8));
+        _mm_storeu_si128((__m128i *)(Dst + i), a);
+        _mm_storeu_si128((__m128i *)(Dst + i + 16), b);
+    }
+#elif defined(BYTESWAP_NEON)
+    for (; i + 32 <= Len; i += 32)
+    {
+        uint8x16_t a = vld1q_u8(Src + i);
+        uint8x16_t b = vld1q_u8(Src + i + 16);
+        vst1q_u8(Dst + i, vrev32q_u8(a));
+        vst1q_u8(Dst + i + 16, vrev32q_u8(b));
+    }
+#endif
+    for (; i + 4 <= Len; i += 4)
+    {
+        uint32_t Value;
+        memcpy(&Value, Src + i, sizeof(Value));
+        Value = SwapWord(Value);
+        memcpy(Dst + i, &Value, sizeof(Value));
+    }
+    if (Dst != Src && i < Len)
+    {
+        memcpy(Dst + i, Src + i, Len - i);
+    }
+}
+
+void CByteSwap::SwapHalfWords(uint8_t * Dst, const uint8_t * Src, size_t Len)
+{
+    size_t i = 0;
+#if defined(BYTESWAP_SSE2)
+    for (; i + 32 <= Len; i += 32)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)(Src + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(Src + i + 16));
+        _mm_storeu_si128((__m128i *)(Dst + i), _mm_shufflehi_epi16(_mm_shufflelo_epi16(a, 0xB1), 0xB1));
+        _mm_storeu_si128((__m128i *)(Dst + i + 16), _mm_shufflehi_epi16(_mm_shufflelo_epi16(b, 0xB1), 0xB1));
+    }
+#elif defined(BYTESWAP_NEON)
+    for (; i + 32 <= Len; i += 32)
+    {
+        uint16x8_t a = vld1q_u16((const uint16_t *)(Src + i));
+        uint16x8_t b = vld1q_u16((const uint16_t *)(Src + i + 16));
+        vst1q_u16((uint16_t *)(Dst + i), vrev32q_u16(a));
+        vst1q_u16((uint16_t *)(Dst + i + 16), vrev32q_u16(b));
+    }
+#endif
+    for (; i + 4 <= Len; i += 4)
+    {
+        uint32_t Value;
+        memcpy(&Value, Src + i, sizeof(Value));
+        Value = SwapHalfWord(Value);
+        memcpy(Dst + i, &Value, sizeof(Value));
+    }
+    if (Dst != Src && i < Len)
+    {
+        memcpy(Dst + i, Src + i, Len - i);
+    }
+}
+
+void CByteSwap::CopySwizzled(uint8_t * Dst, uint32_t DstAddr, const uint8_t * Src, uint32_t SrcAddr, uint32_t Len)
+{
+    uint32_t i = 0;
+    if (((DstAddr ^ SrcAddr) & 3) != 0)
+    {
+        // The two sides do not share a word alignment, every byte moves lane
+        for (; i < Len; i++)
+        {
+            Dst[(DstAddr + i) ^ 3] = Src[(SrcAddr + i) ^ 3];
+        }
+        return;
+    }
+
+    // Both sides are swizzled the same way, so whole words copy unchanged and
+    // only the unaligned head and tail need the byte lane fix up
+    for (; i < Len && ((DstAddr + i) & 3) != 0; i++)
+    {
+        Dst[(DstAddr + i) ^ 3] = Src[(SrcAddr + i) ^ 3];
+    }
+    uint32_t Words = (Len - i) & ~3u;
+    if (Words != 0)
+    {
+        memcpy(Dst + DstAddr + i, Src + SrcAddr + i, Words);
+        i += Words;
+    }
+    for (; i < Len; i++)
+    {
+        Dst[(DstAddr + i) ^ 3] = Src[(SrcAddr + i) ^ 3];
+    }
+}
+
+void CByteSwap::ClearSwizzled(uint8_t * Dst, uint32_t DstAddr, uint32_t Len)
+{
+    uint32_t i = 0;
+    for (; i < Len && ((DstAddr + i) & 3) != 0; i++)
+    {
+        Dst[(DstAddr + i) ^ 3] = 0;
+    }
+    uint32_t Words = (Len - i) & ~3u;
+    if (Words != 0)
+    {
+        memset(Dst + DstAddr + i, 0, Words);
+        i += Words;
+    }
+    for (; i < Len; i++)
+    {
+        Dst[(DstAddr + i) ^ 3] = 0;
+    }
+}
@@ -0,0 +1,37 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// N64 memory is held as native 32 bit words, so on a little endian host byte
+// N of the N64 address space lives at (N ^ 3). These helpers convert images
+// into that layout and copy between two buffers that both use it.
+class CByteSwap
+{
+public:
+    // Reverse the bytes of every 32 bit word (n64 <-> z64 order). Dst may equal Src.
+    static void SwapWords(uint8_t * Dst, const uint8_t * Src, size_t Len);
+
+    // Swap the 16 bit halves of every 32 bit word (v64 order). Dst may equal Src.
+    static void SwapHalfWords(uint8_t * Dst, const uint8_t * Src, size_t Len);
+
+    // Dst[(DstAddr + i) ^ 3] = Src[(SrcAddr + i) ^ 3] for i < Len
+    static void CopySwizzled(uint8_t * Dst, uint32_t DstAddr, const uint8_t * Src, uint32_t SrcAddr, uint32_t Len);
+
+    // Dst[(DstAddr + i) ^ 3] = 0 for i < Len
+    static void ClearSwizzled(uint8_t * Dst, uint32_t DstAddr, uint32_t Len);
+
+private:
+    CByteSwap();                            // Disable default constructor
+    CByteSwap(const CByteSwap&);            // Disable copy constructor
+    CByteSwap& operator=(const CByteSwap&); // Disable assignment
+};
@@ -14,12 +14,15 @@
 #include <Project64-core/N64System/N64Class.h>
 #include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
 #include <Project64-core/N64System/Mips/OpcodeName.h>
-#include <Project64-core/N64System/Interpreter/InterpreterOps32.h>
 #include <Project64-core/Plugins/PluginClass.h>
 #include <Project64-core/Plugins/GFXPlugin.h>
 #include <Project64-core/ExceptionHandler.h>
+#include <Common/HighResTimeStamp.h>
 
 R4300iOp::Func * CInterpreterCPU::m_R4300i_Opcode = NULL;
+CInterpreterCPU::DECODED_OP * CInterpreterCPU::m_DecodedPages[CInterpreterCPU::DecodedPageCount] = { 0 };
+uint32_t CInterpreterCPU::m_PagesDecoded = 0;
+uint32_t CInterpreterCPU::m_OpsRedecoded = 0;
 
 void ExecuteInterpreterOps(uint32_t /*Cycles*/)
 {
@@ -228,11 +231,11 @@ void CInterpreterCPU::BuildCPU()
 
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        m_R4300i_Opcode = R4300iOp32::BuildInterpreter();
+        m_R4300i_Opcode = R4300iOp::BuildInterpreter<true>();
     }
     else
     {
-        m_R4300i_Opcode = R4300iOp::BuildInterpreter();
+        m_R4300i_Opcode = R4300iOp::BuildInterpreter<false>();
     }
 }
 
@@ -270,7 +273,8 @@ void CInterpreterCPU::InPermLoop()
     }
 }
 
-void CInterpreterCPU::ExecuteCPU()
+template <bool bRecordStats>
+void CInterpreterCPU::ExecuteCPULoop()
 {
     WriteTrace(TraceN64System, TraceDebug, "Start");
 
@@ -283,6 +287,12 @@ void CInterpreterCPU::ExecuteCPU()
     uint32_t CountPerOp = g_System->CountPerOp();
     int32_t & NextTimer = *g_NextTimer;
     bool CheckTimer = false;
+    uint64_t OpsExecuted = 0;
+    HighResTimeStamp StartTime, EndTime;
+    if (bRecordStats)
+    {
+        StartTime.SetToNow();
+    }
 
     __except_try()
     {
@@ -303,6 +313,10 @@ void CInterpreterCPU::ExecuteCPU()
             } */
             m_R4300i_Opcode[Opcode.op]();
             NextTimer -= CountPerOp;
+            if (bRecordStats)
+            {
+                OpsExecuted += 1;
+            }
 
             PROGRAM_COUNTER += 4;
             switch (R4300iOp::m_NextInstruction)
@@ -351,7 +365,255 @@ void CInterpreterCPU::ExecuteCPU()
     {
         g_Notify->FatalError(GS(MSG_UNKNOWN_MEM_ACTION));
     }
-    WriteTrace(TraceN64System, TraceDebug, "Done");
+    if (bRecordStats)
+    {
+        EndTime.SetToNow();
+        uint64_t TimeTaken = EndTime.GetMicroSeconds() - StartTime.GetMicroSeconds();
+        WriteTrace(TraceN64System, TraceInfo, "Done (ops: %llu, ops per ms: %llu)", (unsigned long long)OpsExecuted, (unsigned long long)(TimeTaken != 0 ? (OpsExecuted * 1000) / TimeTaken : 0));
+    }
+    else
+    {
+        WriteTrace(TraceN64System, TraceDebug, "Done");
+    }
+}
+
+void CInterpreterCPU::ExecuteCPU()
+{
+    //The op count costs an add on every op, only keep it when it is going to be logged
+    if (g_ModuleLogLevel[TraceN64System] >= TraceInfo)
+    {
+        ExecuteCPULoop<true>();
+    }
+    else
+    {
+        ExecuteCPULoop<false>();
+    }
+}
+
+template <bool bRecordStats>
+void CInterpreterCPU::ExecuteCachedCPULoop()
+{
+    WriteTrace(TraceN64System, TraceDebug, "Start");
+
+    bool & Done = g_System->m_EndEmulation;
+    uint32_t & PROGRAM_COUNTER = *_PROGRAM_COUNTER;
+    OPCODE & Opcode = R4300iOp::m_Opcode;
+    uint32_t & JumpToLocation = R4300iOp::m_JumpToLocation;
+    bool & TestTimer = R4300iOp::m_TestTimer;
+    const int32_t & bDoSomething = g_SystemEvents->DoSomething();
+    uint32_t CountPerOp = g_System->CountPerOp();
+    int32_t & NextTimer = *g_NextTimer;
+    bool CheckTimer = false;
+    uint64_t OpsExecuted = 0;
+    HighResTimeStamp StartTime, EndTime;
+    if (bRecordStats)
+    {
+        StartTime.SetToNow();
+    }
+
+    //The page of code currently being executed, only looked up again when the PC leaves it
+    uint32_t PageVAddr = (uint32_t)-1;
+    DECODED_OP * Page = NULL;
+    const uint32_t * PageCode = NULL;
+
+    m_PagesDecoded = 0;
+    m_OpsRedecoded = 0;
+
+    __except_try()
+    {
+        while (!Done)
+        {
+            R4300iOp::Func Function;
+            if ((PROGRAM_COUNTER & ~0xFFF) == PageVAddr)
+            {
+                uint32_t Index = (PROGRAM_COUNTER & 0xFFF) >> 2;
+                DECODED_OP & Op = Page[Index];
+                if (Op.Opcode.Hex != PageCode[Index])
+                {
+                    //Code has been written since the page was decoded
+                    Op.Opcode.Hex = PageCode[Index];
+                    Op.Function = DecodeOpcode(Op.Opcode);
+                    m_OpsRedecoded += 1;
+                }
+                Opcode.Hex = Op.Opcode.Hex;
+                Function = Op.Function;
+            }
+            else
+            {
+                uint32_t PAddr;
+                if (g_TransVaddr->TranslateVaddr(PROGRAM_COUNTER, PAddr) && PAddr < g_MMU->RdramSize())
+                {
+                    PageVAddr = PROGRAM_COUNTER & ~0xFFF;
+                    Page = DecodePage(PAddr);
+                    PageCode = (const uint32_t *)(g_MMU->Rdram() + (PAddr & ~0xFFF));
+                    continue;
+                }
+
+                //Not running from RDRAM, fetch it the same way as the interpreter
+                if (!g_MMU->LW_VAddr(PROGRAM_COUNTER, Opcode.Hex))
+                {
+                    g_Reg->DoTLBReadMiss(R4300iOp::m_NextInstruction == JUMP, PROGRAM_COUNTER);
+                    R4300iOp::m_NextInstruction = NORMAL;
+                    continue;
+                }
+                Function = m_R4300i_Opcode[Opcode.op];
+            }
+
+            Function();
+            NextTimer -= CountPerOp;
+            if (bRecordStats)
+            {
+                OpsExecuted += 1;
+            }
+
+            //TLB changes only come from COP0, look the page up again after them
+            if (Opcode.op == R4300i_CP0)
+            {
+                PageVAddr = (uint32_t)-1;
+            }
+
+            PROGRAM_COUNTER += 4;
+            switch (R4300iOp::m_NextInstruction)
+            {
+            case NORMAL:
+                break;
+            case DELAY_SLOT:
+                R4300iOp::m_NextInstruction = JUMP;
+                break;
+            case PERMLOOP_DO_DELAY:
+                R4300iOp::m_NextInstruction = PERMLOOP_DELAY_DONE;
+                break;
+            case JUMP:
+                CheckTimer = (JumpToLocation < PROGRAM_COUNTER - 4 || TestTimer);
+                PROGRAM_COUNTER = JumpToLocation;
+                R4300iOp::m_NextInstruction = NORMAL;
+                if (CheckTimer)
+                {
+                    TestTimer = false;
+                    if (NextTimer < 0)
+                    {
+                        g_SystemTimer->TimerDone();
+                    }
+                    if (bDoSomething)
+                    {
+                        g_SystemEvents->ExecuteEvents();
+                    }
+                }
+                break;
+            case PERMLOOP_DELAY_DONE:
+                PROGRAM_COUNTER = JumpToLocation;
+                R4300iOp::m_NextInstruction = NORMAL;
+                CInterpreterCPU::InPermLoop();
+                g_SystemTimer->TimerDone();
+                if (bDoSomething)
+                {
+                    g_SystemEvents->ExecuteEvents();
+                }
+                break;
+            default:
+                g_Notify->BreakPoint(__FILE__, __LINE__);
+            }
+        }
+    }
+    __except_catch()
+    {
+        g_Notify->FatalError(GS(MSG_UNKNOWN_MEM_ACTION));
+    }
+    if (bRecordStats)
+    {
+        EndTime.SetToNow();
+        uint64_t TimeTaken = EndTime.GetMicroSeconds() - StartTime.GetMicroSeconds();
+        WriteTrace(TraceN64System, TraceInfo, "Done (ops: %llu, ops per ms: %llu, pages decoded: %d, ops redecoded: %d)", (unsigned long long)OpsExecuted, (unsigned long long)(TimeTaken != 0 ? (OpsExecuted * 1000) / TimeTaken : 0), m_PagesDecoded, m_OpsRedecoded);
+    }
+    else
+    {
+        WriteTrace(TraceN64System, TraceDebug, "Done (pages decoded: %d, ops redecoded: %d)", m_PagesDecoded, m_OpsRedecoded);
+    }
+    FreeDecodedCode();
+}
+
+void CInterpreterCPU::ExecuteCachedCPU()
+{
+    if (g_ModuleLogLevel[TraceN64System] >= TraceInfo)
+    {
+        ExecuteCachedCPULoop<true>();
+    }
+    else
+    {
+        ExecuteCachedCPULoop<false>();
+    }
+}
+
+R4300iOp::Func CInterpreterCPU::DecodeOpcode(const OPCODE & Opcode)
+{
+    //Resolve the nested opcode tables once so executing the op is a single call
+    R4300iOp::Func Function = m_R4300i_Opcode[Opcode.op];
+    if (Function == SPECIAL)
+    {
+        return Jump_Special[Opcode.funct];
+    }
+    if (Function == REGIMM)
+    {
+        return Jump_Regimm[Opcode.rt];
+    }
+    if (Function == COP0)
+    {
+        Function = Jump_CoP0[Opcode.rs];
+        return Function == COP0_CO ? Jump_CoP0_Function[Opcode.funct] : Function;
+    }
+    if (Function == COP1)
+    {
+        //COP1_S and COP1_D are kept since they set the rounding mode before the op
+        Function = Jump_CoP1[Opcode.fmt];
+        if (Function == COP1_BC) { return Jump_CoP1_BC[Opcode.ft]; }
+        if (Function == COP1_W) { return Jump_CoP1_W[Opcode.funct]; }
+        if (Function == COP1_L) { return Jump_CoP1_L[Opcode.funct]; }
+    }
+    return Function;
+}
+
+CInterpreterCPU::DECODED_OP * CInterpreterCPU::DecodePage(uint32_t PAddr)
+{
+    DECODED_OP *& Page = m_DecodedPages[PAddr >> 12];
+    if (Page != NULL)
+    {
+        return Page;
+    }
+
+    Page = new DECODED_OP[DecodedPageOps];
+    DecodeOps(Page, (const uint32_t *)(g_MMU->Rdram() + (PAddr & ~0xFFF)));
+    m_PagesDecoded += 1;
+    return Page;
+}
+
+void CInterpreterCPU::DecodeOps(DECODED_OP * Page, const uint32_t * PageCode)
+{
+    for (uint32_t i = 0; i < DecodedPageOps; i++)
+    {
+        Page[i].Opcode.Hex = PageCode[i];
+        Page[i].Function = DecodeOpcode(Page[i].Opcode);
+    }
+}
+
+void CInterpreterCPU::ClearDecodedCode(uint32_t PAddr, uint32_t Length)
+{
+    //Decode the pages again in place, the page being executed may be one of them
+    for (uint32_t Page = PAddr >> 12, EndPage = (PAddr + Length - 1) >> 12; Page <= EndPage && Page < DecodedPageCount; Page++)
+    {
+        if (m_DecodedPages[Page] != NULL)
+        {
+            DecodeOps(m_DecodedPages[Page], (const uint32_t *)(g_MMU->Rdram() + (Page << 12)));
+        }
+    }
+}
+
+void CInterpreterCPU::FreeDecodedCode()
+{
+    for (uint32_t Page = 0; Page < DecodedPageCount; Page++)
+    {
+        delete[] m_DecodedPages[Page];
+        m_DecodedPages[Page] = NULL;
+    }
 }
 
 void CInterpreterCPU::ExecuteOps(int32_t Cycles)
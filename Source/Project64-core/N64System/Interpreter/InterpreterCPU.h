@@ -18,13 +18,38 @@ class CInterpreterCPU :
 public:
     static void BuildCPU();
     static void ExecuteCPU();
+    static void ExecuteCachedCPU();
     static void ExecuteOps(int32_t Cycles);
     static void InPermLoop();
+    static void ClearDecodedCode(uint32_t PAddr, uint32_t Length);
 
 private:
     CInterpreterCPU();                                  // Disable default constructor
     CInterpreterCPU(const CInterpreterCPU&);            // Disable copy constructor
     CInterpreterCPU& operator=(const CInterpreterCPU&); // Disable assignment
 
+    typedef struct
+    {
+        R4300iOp::Func Function;
+        OPCODE Opcode;
+    } DECODED_OP;
+
+    enum
+    {
+        DecodedPageOps = 0x1000 / sizeof(uint32_t),
+        DecodedPageCount = 0x800000 / 0x1000,
+    };
+
+    template <bool bRecordStats> static void ExecuteCPULoop();
+    template <bool bRecordStats> static void ExecuteCachedCPULoop();
+
+    static R4300iOp::Func DecodeOpcode(const OPCODE & Opcode);
+    static DECODED_OP * DecodePage(uint32_t PAddr);
+    static void DecodeOps(DECODED_OP * Page, const uint32_t * PageCode);
+    static void FreeDecodedCode();
+
     static R4300iOp::Func * m_R4300i_Opcode;
+    static DECODED_OP * m_DecodedPages[DecodedPageCount];
+    static uint32_t m_PagesDecoded;
+    static uint32_t m_OpsRedecoded;
 };
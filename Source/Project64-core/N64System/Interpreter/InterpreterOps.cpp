@@ -144,32 +144,33 @@ void R4300iOp::COP1_L()
     Jump_CoP1_L[m_Opcode.funct]();
 }
 
+template <bool b32BitCore>
 R4300iOp::Func * R4300iOp::BuildInterpreter()
 {
     Jump_Opcode[0] = SPECIAL;
     Jump_Opcode[1] = REGIMM;
     Jump_Opcode[2] = J;
-    Jump_Opcode[3] = JAL;
-    Jump_Opcode[4] = BEQ;
-    Jump_Opcode[5] = BNE;
-    Jump_Opcode[6] = BLEZ;
-    Jump_Opcode[7] = BGTZ;
-    Jump_Opcode[8] = ADDI;
-    Jump_Opcode[9] = ADDIU;
-    Jump_Opcode[10] = SLTI;
-    Jump_Opcode[11] = SLTIU;
-    Jump_Opcode[12] = ANDI;
-    Jump_Opcode[13] = ORI;
-    Jump_Opcode[14] = XORI;
-    Jump_Opcode[15] = LUI;
+    Jump_Opcode[3] = JAL<b32BitCore>;
+    Jump_Opcode[4] = BEQ<b32BitCore>;
+    Jump_Opcode[5] = BNE<b32BitCore>;
+    Jump_Opcode[6] = BLEZ<b32BitCore>;
+    Jump_Opcode[7] = BGTZ<b32BitCore>;
+    Jump_Opcode[8] = ADDI<b32BitCore>;
+    Jump_Opcode[9] = ADDIU<b32BitCore>;
+    Jump_Opcode[10] = SLTI<b32BitCore>;
+    Jump_Opcode[11] = SLTIU<b32BitCore>;
+    Jump_Opcode[12] = ANDI<b32BitCore>;
+    Jump_Opcode[13] = ORI<b32BitCore>;
+    Jump_Opcode[14] = XORI<b32BitCore>;
+    Jump_Opcode[15] = LUI<b32BitCore>;
     Jump_Opcode[16] = COP0;
     Jump_Opcode[17] = COP1;
     Jump_Opcode[18] = UnknownOpcode;
     Jump_Opcode[19] = UnknownOpcode;
-    Jump_Opcode[20] = BEQL;
-    Jump_Opcode[21] = BNEL;
-    Jump_Opcode[22] = BLEZL;
-    Jump_Opcode[23] = BGTZL;
+    Jump_Opcode[20] = BEQL<b32BitCore>;
+    Jump_Opcode[21] = BNEL<b32BitCore>;
+    Jump_Opcode[22] = BLEZL<b32BitCore>;
+    Jump_Opcode[23] = BGTZL<b32BitCore>;
     Jump_Opcode[24] = UnknownOpcode;
     Jump_Opcode[25] = DADDIU;
     Jump_Opcode[26] = LDL;
@@ -178,14 +179,14 @@ R4300iOp::Func * R4300iOp::BuildInterpreter()
     Jump_Opcode[29] = UnknownOpcode;
     Jump_Opcode[30] = UnknownOpcode;
     Jump_Opcode[31] = UnknownOpcode;
-    Jump_Opcode[32] = LB;
-    Jump_Opcode[33] = LH;
-    Jump_Opcode[34] = LWL;
-    Jump_Opcode[35] = LW;
-    Jump_Opcode[36] = LBU;
-    Jump_Opcode[37] = LHU;
-    Jump_Opcode[38] = LWR;
-    Jump_Opcode[39] = LWU;
+    Jump_Opcode[32] = LB<b32BitCore>;
+    Jump_Opcode[33] = LH<b32BitCore>;
+    Jump_Opcode[34] = LWL<b32BitCore>;
+    Jump_Opcode[35] = LW<b32BitCore>;
+    Jump_Opcode[36] = LBU<b32BitCore>;
+    Jump_Opcode[37] = LHU<b32BitCore>;
+    Jump_Opcode[38] = LWR<b32BitCore>;
+    Jump_Opcode[39] = LWU<b32BitCore>;
     Jump_Opcode[40] = SB;
     Jump_Opcode[41] = SH;
     Jump_Opcode[42] = SWL;
@@ -194,7 +195,7 @@ R4300iOp::Func * R4300iOp::BuildInterpreter()
     Jump_Opcode[45] = SDR;
     Jump_Opcode[46] = SWR;
     Jump_Opcode[47] = CACHE;
-    Jump_Opcode[48] = LL;
+    Jump_Opcode[48] = LL<b32BitCore>;
     Jump_Opcode[49] = LWC1;
     Jump_Opcode[50] = UnknownOpcode;
     Jump_Opcode[51] = UnknownOpcode;
@@ -211,16 +212,16 @@ R4300iOp::Func * R4300iOp::BuildInterpreter()
     Jump_Opcode[62] = UnknownOpcode;
     Jump_Opcode[63] = SD;
 
-    Jump_Special[0] = SPECIAL_SLL;
+    Jump_Special[0] = SPECIAL_SLL<b32BitCore>;
     Jump_Special[1] = UnknownOpcode;
-    Jump_Special[2] = SPECIAL_SRL;
-    Jump_Special[3] = SPECIAL_SRA;
-    Jump_Special[4] = SPECIAL_SLLV;
+    Jump_Special[2] = SPECIAL_SRL<b32BitCore>;
+    Jump_Special[3] = SPECIAL_SRA<b32BitCore>;
+    Jump_Special[4] = SPECIAL_SLLV<b32BitCore>;
     Jump_Special[5] = UnknownOpcode;
-    Jump_Special[6] = SPECIAL_SRLV;
-    Jump_Special[7] = SPECIAL_SRAV;
+    Jump_Special[6] = SPECIAL_SRLV<b32BitCore>;
+    Jump_Special[7] = SPECIAL_SRAV<b32BitCore>;
     Jump_Special[8] = SPECIAL_JR;
-    Jump_Special[9] = SPECIAL_JALR;
+    Jump_Special[9] = SPECIAL_JALR<b32BitCore>;
     Jump_Special[10] = UnknownOpcode;
     Jump_Special[11] = UnknownOpcode;
     Jump_Special[12] = SPECIAL_SYSCALL;
@@ -243,18 +244,18 @@ R4300iOp::Func * R4300iOp::BuildInterpreter()
     Jump_Special[29] = SPECIAL_DMULTU;
     Jump_Special[30] = SPECIAL_DDIV;
     Jump_Special[31] = SPECIAL_DDIVU;
-    Jump_Special[32] = SPECIAL_ADD;
-    Jump_Special[33] = SPECIAL_ADDU;
-    Jump_Special[34] = SPECIAL_SUB;
-    Jump_Special[35] = SPECIAL_SUBU;
-    Jump_Special[36] = SPECIAL_AND;
-    Jump_Special[37] = SPECIAL_OR;
+    Jump_Special[32] = SPECIAL_ADD<b32BitCore>;
+    Jump_Special[33] = SPECIAL_ADDU<b32BitCore>;
+    Jump_Special[34] = SPECIAL_SUB<b32BitCore>;
+    Jump_Special[35] = SPECIAL_SUBU<b32BitCore>;
+    Jump_Special[36] = SPECIAL_AND<b32BitCore>;
+    Jump_Special[37] = SPECIAL_OR<b32BitCore>;
     Jump_Special[38] = SPECIAL_XOR;
-    Jump_Special[39] = SPECIAL_NOR;
+    Jump_Special[39] = SPECIAL_NOR<b32BitCore>;
     Jump_Special[40] = UnknownOpcode;
     Jump_Special[41] = UnknownOpcode;
-    Jump_Special[42] = SPECIAL_SLT;
-    Jump_Special[43] = SPECIAL_SLTU;
+    Jump_Special[42] = SPECIAL_SLT<b32BitCore>;
+    Jump_Special[43] = SPECIAL_SLTU<b32BitCore>;
     Jump_Special[44] = SPECIAL_DADD;
     Jump_Special[45] = SPECIAL_DADDU;
     Jump_Special[46] = SPECIAL_DSUB;
@@ -263,7 +264,7 @@ R4300iOp::Func * R4300iOp::BuildInterpreter()
     Jump_Special[49] = UnknownOpcode;
     Jump_Special[50] = UnknownOpcode;
     Jump_Special[51] = UnknownOpcode;
-    Jump_Special[52] = SPECIAL_TEQ;
+    Jump_Special[52] = SPECIAL_TEQ<b32BitCore>;
     Jump_Special[53] = UnknownOpcode;
     Jump_Special[54] = UnknownOpcode;
     Jump_Special[55] = UnknownOpcode;
@@ -276,10 +277,10 @@ R4300iOp::Func * R4300iOp::BuildInterpreter()
     Jump_Special[62] = SPECIAL_DSRL32;
     Jump_Special[63] = SPECIAL_DSRA32;
 
-    Jump_Regimm[0] = REGIMM_BLTZ;
-    Jump_Regimm[1] = REGIMM_BGEZ;
-    Jump_Regimm[2] = REGIMM_BLTZL;
-    Jump_Regimm[3] = REGIMM_BGEZL;
+    Jump_Regimm[0] = REGIMM_BLTZ<b32BitCore>;
+    Jump_Regimm[1] = REGIMM_BGEZ<b32BitCore>;
+    Jump_Regimm[2] = REGIMM_BLTZL<b32BitCore>;
+    Jump_Regimm[3] = REGIMM_BGEZL<b32BitCore>;
     Jump_Regimm[4] = UnknownOpcode;
     Jump_Regimm[5] = UnknownOpcode;
     Jump_Regimm[6] = UnknownOpcode;
@@ -292,8 +293,8 @@ R4300iOp::Func * R4300iOp::BuildInterpreter()
     Jump_Regimm[13] = UnknownOpcode;
     Jump_Regimm[14] = UnknownOpcode;
     Jump_Regimm[15] = UnknownOpcode;
-    Jump_Regimm[16] = REGIMM_BLTZAL;
-    Jump_Regimm[17] = REGIMM_BGEZAL;
+    Jump_Regimm[16] = REGIMM_BLTZAL<b32BitCore>;
+    Jump_Regimm[17] = REGIMM_BGEZAL<b32BitCore>;
     Jump_Regimm[18] = UnknownOpcode;
     Jump_Regimm[19] = UnknownOpcode;
     Jump_Regimm[20] = UnknownOpcode;
@@ -309,7 +310,7 @@ R4300iOp::Func * R4300iOp::BuildInterpreter()
     Jump_Regimm[30] = UnknownOpcode;
     Jump_Regimm[31] = UnknownOpcode;
 
-    Jump_CoP0[0] = COP0_MF;
+    Jump_CoP0[0] = COP0_MF<b32BitCore>;
     Jump_CoP0[1] = UnknownOpcode;
     Jump_CoP0[2] = UnknownOpcode;
     Jump_CoP0[3] = UnknownOpcode;
@@ -407,12 +408,12 @@ R4300iOp::Func * R4300iOp::BuildInterpreter()
     Jump_CoP0_Function[62] = UnknownOpcode;
     Jump_CoP0_Function[63] = UnknownOpcode;
 
-    Jump_CoP1[0] = COP1_MF;
+    Jump_CoP1[0] = COP1_MF<b32BitCore>;
     Jump_CoP1[1] = COP1_DMF;
-    Jump_CoP1[2] = COP1_CF;
+    Jump_CoP1[2] = COP1_CF<b32BitCore>;
     Jump_CoP1[3] = UnknownOpcode;
     Jump_CoP1[4] = COP1_MT;
-    Jump_CoP1[5] = COP1_DMT;
+    Jump_CoP1[5] = COP1_DMT<b32BitCore>;
     Jump_CoP1[6] = COP1_CT;
     Jump_CoP1[7] = UnknownOpcode;
     Jump_CoP1[8] = COP1_BC;
@@ -763,11 +764,12 @@ void R4300iOp::J()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::JAL()
 {
     m_NextInstruction = DELAY_SLOT;
     m_JumpToLocation = ((*_PROGRAM_COUNTER) & 0xF0000000) + (m_Opcode.target << 2);
-    _GPR[31].DW = (int32_t)((*_PROGRAM_COUNTER) + 8);
+    SetGPR_DW<b32BitCore>(31, (int32_t)((*_PROGRAM_COUNTER) + 8));
 
     if ((*_PROGRAM_COUNTER) == m_JumpToLocation)
     {
@@ -775,10 +777,11 @@ void R4300iOp::JAL()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::BEQ()
 {
     m_NextInstruction = DELAY_SLOT;
-    if (_GPR[m_Opcode.rs].DW == _GPR[m_Opcode.rt].DW)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) == GPR_DW<b32BitCore>(m_Opcode.rt))
     {
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
         if ((*_PROGRAM_COUNTER) == m_JumpToLocation)
@@ -795,10 +798,11 @@ void R4300iOp::BEQ()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::BNE()
 {
     m_NextInstruction = DELAY_SLOT;
-    if (_GPR[m_Opcode.rs].DW != _GPR[m_Opcode.rt].DW)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) != GPR_DW<b32BitCore>(m_Opcode.rt))
     {
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
         if ((*_PROGRAM_COUNTER) == m_JumpToLocation)
@@ -815,10 +819,11 @@ void R4300iOp::BNE()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::BLEZ()
 {
     m_NextInstruction = DELAY_SLOT;
-    if (_GPR[m_Opcode.rs].DW <= 0)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) <= 0)
     {
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
         if ((*_PROGRAM_COUNTER) == m_JumpToLocation)
@@ -835,10 +840,11 @@ void R4300iOp::BLEZ()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::BGTZ()
 {
     m_NextInstruction = DELAY_SLOT;
-    if (_GPR[m_Opcode.rs].DW > 0)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) > 0)
     {
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
         if ((*_PROGRAM_COUNTER) == m_JumpToLocation)
@@ -855,6 +861,7 @@ void R4300iOp::BGTZ()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::ADDI()
 {
 #ifdef Interpreter_StackTest
@@ -863,7 +870,7 @@ void R4300iOp::ADDI()
         StackValue += (int16_t)m_Opcode.immediate;
     }
 #endif
-    _GPR[m_Opcode.rt].DW = (_GPR[m_Opcode.rs].W[0] + ((int16_t)m_Opcode.immediate));
+    SetGPR_DW<b32BitCore>(m_Opcode.rt, (_GPR[m_Opcode.rs].W[0] + ((int16_t)m_Opcode.immediate)));
 #ifdef Interpreter_StackTest
     if (m_Opcode.rt == 29 && m_Opcode.rs != 29)
     {
@@ -872,6 +879,7 @@ void R4300iOp::ADDI()
 #endif
 }
 
+template <bool b32BitCore>
 void R4300iOp::ADDIU()
 {
 #ifdef Interpreter_StackTest
@@ -880,7 +888,7 @@ void R4300iOp::ADDIU()
         StackValue += (int16_t)m_Opcode.immediate;
     }
 #endif
-    _GPR[m_Opcode.rt].DW = (_GPR[m_Opcode.rs].W[0] + ((int16_t)m_Opcode.immediate));
+    SetGPR_DW<b32BitCore>(m_Opcode.rt, (_GPR[m_Opcode.rs].W[0] + ((int16_t)m_Opcode.immediate)));
 #ifdef Interpreter_StackTest
     if (m_Opcode.rt == 29 && m_Opcode.rs != 29)
     {
@@ -889,45 +897,51 @@ void R4300iOp::ADDIU()
 #endif
 }
 
+template <bool b32BitCore>
 void R4300iOp::SLTI()
 {
-    if (_GPR[m_Opcode.rs].DW < (int64_t)((int16_t)m_Opcode.immediate))
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) < (int64_t)((int16_t)m_Opcode.immediate))
     {
-        _GPR[m_Opcode.rt].DW = 1;
+        SetGPR_DW<b32BitCore>(m_Opcode.rt, 1);
     }
     else
     {
-        _GPR[m_Opcode.rt].DW = 0;
+        SetGPR_DW<b32BitCore>(m_Opcode.rt, 0);
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::SLTIU()
 {
     int32_t imm32 = (int16_t)m_Opcode.immediate;
     int64_t imm64;
 
     imm64 = imm32;
-    _GPR[m_Opcode.rt].DW = _GPR[m_Opcode.rs].UDW < (uint64_t)imm64 ? 1 : 0;
+    SetGPR_DW<b32BitCore>(m_Opcode.rt, GPR_UDW<b32BitCore>(m_Opcode.rs) < (uint64_t)imm64 ? 1 : 0);
 }
 
+template <bool b32BitCore>
 void R4300iOp::ANDI()
 {
-    _GPR[m_Opcode.rt].DW = _GPR[m_Opcode.rs].DW & m_Opcode.immediate;
+    SetGPR_DW<b32BitCore>(m_Opcode.rt, GPR_DW<b32BitCore>(m_Opcode.rs) & m_Opcode.immediate);
 }
 
+template <bool b32BitCore>
 void R4300iOp::ORI()
 {
-    _GPR[m_Opcode.rt].DW = _GPR[m_Opcode.rs].DW | m_Opcode.immediate;
+    SetGPR_DW<b32BitCore>(m_Opcode.rt, GPR_DW<b32BitCore>(m_Opcode.rs) | m_Opcode.immediate);
 }
 
+template <bool b32BitCore>
 void R4300iOp::XORI()
 {
-    _GPR[m_Opcode.rt].DW = _GPR[m_Opcode.rs].DW ^ m_Opcode.immediate;
+    SetGPR_DW<b32BitCore>(m_Opcode.rt, GPR_DW<b32BitCore>(m_Opcode.rs) ^ m_Opcode.immediate);
 }
 
+template <bool b32BitCore>
 void R4300iOp::LUI()
 {
-    _GPR[m_Opcode.rt].DW = (int32_t)((int16_t)m_Opcode.offset << 16);
+    SetGPR_DW<b32BitCore>(m_Opcode.rt, (int32_t)((int16_t)m_Opcode.offset << 16));
 #ifdef Interpreter_StackTest
     if (m_Opcode.rt == 29)
     {
@@ -936,9 +950,10 @@ void R4300iOp::LUI()
 #endif
 }
 
+template <bool b32BitCore>
 void R4300iOp::BEQL()
 {
-    if (_GPR[m_Opcode.rs].DW == _GPR[m_Opcode.rt].DW)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) == GPR_DW<b32BitCore>(m_Opcode.rt))
     {
         m_NextInstruction = DELAY_SLOT;
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
@@ -957,9 +972,10 @@ void R4300iOp::BEQL()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::BNEL()
 {
-    if (_GPR[m_Opcode.rs].DW != _GPR[m_Opcode.rt].DW)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) != GPR_DW<b32BitCore>(m_Opcode.rt))
     {
         m_NextInstruction = DELAY_SLOT;
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
@@ -978,9 +994,10 @@ void R4300iOp::BNEL()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::BLEZL()
 {
-    if (_GPR[m_Opcode.rs].DW <= 0)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) <= 0)
     {
         m_NextInstruction = DELAY_SLOT;
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
@@ -999,9 +1016,10 @@ void R4300iOp::BLEZL()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::BGTZL()
 {
-    if (_GPR[m_Opcode.rs].DW > 0)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) > 0)
     {
         m_NextInstruction = DELAY_SLOT;
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
@@ -1077,6 +1095,7 @@ void R4300iOp::LDR()
     _GPR[m_Opcode.rt].DW += Value >> LDR_SHIFT[Offset];
 }
 
+template <bool b32BitCore>
 void R4300iOp::LB()
 {
     uint32_t Address = _GPR[m_Opcode.base].UW[0] + (int16_t)m_Opcode.offset;
@@ -1090,10 +1109,11 @@ void R4300iOp::LB()
     }
     else
     {
-        _GPR[m_Opcode.rt].DW = _GPR[m_Opcode.rt].B[0];
+        SetGPR_DW<b32BitCore>(m_Opcode.rt, _GPR[m_Opcode.rt].B[0]);
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::LH()
 {
     uint32_t Address = _GPR[m_Opcode.base].UW[0] + (int16_t)m_Opcode.offset;
@@ -1111,10 +1131,11 @@ void R4300iOp::LH()
     }
     else
     {
-        _GPR[m_Opcode.rt].DW = _GPR[m_Opcode.rt].HW[0];
+        SetGPR_DW<b32BitCore>(m_Opcode.rt, _GPR[m_Opcode.rt].HW[0]);
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::LWL()
 {
     uint32_t Offset, Address, Value;
@@ -1124,18 +1145,19 @@ void R4300iOp::LWL()
 
     if (!g_MMU->LW_VAddr((Address & ~3), Value))
     {
-        g_Notify->BreakPoint(__FILE__, __LINE__);
         if (bShowTLBMisses())
         {
             g_Notify->DisplayError(stdstr_f("%s TLB: %X", __FUNCTION__, Address).c_str());
         }
-        return;
+        TLB_READ_EXCEPTION(Address);
     }
 
-    _GPR[m_Opcode.rt].DW = (int32_t)(_GPR[m_Opcode.rt].W[0] & LWL_MASK[Offset]);
-    _GPR[m_Opcode.rt].DW += (int32_t)(Value << LWL_SHIFT[Offset]);
+    int64_t Result = (int32_t)(_GPR[m_Opcode.rt].W[0] & LWL_MASK[Offset]);
+    Result += (int32_t)(Value << LWL_SHIFT[Offset]);
+    SetGPR_DW<b32BitCore>(m_Opcode.rt, Result);
 }
 
+template <bool b32BitCore>
 void R4300iOp::LW()
 {
     uint32_t Address = _GPR[m_Opcode.base].UW[0] + (int16_t)m_Opcode.offset;
@@ -1159,10 +1181,11 @@ void R4300iOp::LW()
     }
     else
     {
-        _GPR[m_Opcode.rt].DW = _GPR[m_Opcode.rt].W[0];
+        SetGPR_DW<b32BitCore>(m_Opcode.rt, _GPR[m_Opcode.rt].W[0]);
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::LBU()
 {
     uint32_t Address = _GPR[m_Opcode.base].UW[0] + (int16_t)m_Opcode.offset;
@@ -1176,10 +1199,11 @@ void R4300iOp::LBU()
     }
     else
     {
-        _GPR[m_Opcode.rt].UDW = _GPR[m_Opcode.rt].UB[0];
+        SetGPR_DW<b32BitCore>(m_Opcode.rt, _GPR[m_Opcode.rt].UB[0]);
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::LHU()
 {
     uint32_t Address = _GPR[m_Opcode.base].UW[0] + (int16_t)m_Opcode.offset;
@@ -1197,10 +1221,11 @@ void R4300iOp::LHU()
     }
     else
     {
-        _GPR[m_Opcode.rt].UDW = _GPR[m_Opcode.rt].UHW[0];
+        SetGPR_DW<b32BitCore>(m_Opcode.rt, _GPR[m_Opcode.rt].UHW[0]);
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::LWR()
 {
     uint32_t Offset, Address, Value;
@@ -1218,10 +1243,12 @@ void R4300iOp::LWR()
         return;
     }
 
-    _GPR[m_Opcode.rt].DW = (int32_t)(_GPR[m_Opcode.rt].W[0] & LWR_MASK[Offset]);
-    _GPR[m_Opcode.rt].DW += (int32_t)(Value >> LWR_SHIFT[Offset]);
+    int64_t Result = (int32_t)(_GPR[m_Opcode.rt].W[0] & LWR_MASK[Offset]);
+    Result += (int32_t)(Value >> LWR_SHIFT[Offset]);
+    SetGPR_DW<b32BitCore>(m_Opcode.rt, Result);
 }
 
+template <bool b32BitCore>
 void R4300iOp::LWU()
 {
     uint32_t Address = _GPR[m_Opcode.base].UW[0] + (int16_t)m_Opcode.offset;
@@ -1240,7 +1267,7 @@ void R4300iOp::LWU()
     }
     else
     {
-        _GPR[m_Opcode.rt].UDW = _GPR[m_Opcode.rt].UW[0];
+        SetGPR_DW<b32BitCore>(m_Opcode.rt, _GPR[m_Opcode.rt].UW[0]);
     }
 }
 
@@ -1480,6 +1507,7 @@ void R4300iOp::CACHE()
     LogMessage("%08X: Cache operation %d, 0x%08X", (*_PROGRAM_COUNTER), m_Opcode.rt, _GPR[m_Opcode.base].UW[0] + (int16_t)m_Opcode.offset);
 }
 
+template <bool b32BitCore>
 void R4300iOp::LL()
 {
     uint32_t Address = _GPR[m_Opcode.base].UW[0] + (int16_t)m_Opcode.offset;
@@ -1498,7 +1526,7 @@ void R4300iOp::LL()
     }
     else
     {
-        _GPR[m_Opcode.rt].DW = _GPR[m_Opcode.rt].W[0];
+        SetGPR_DW<b32BitCore>(m_Opcode.rt, _GPR[m_Opcode.rt].W[0]);
         (*_LLBit) = 1;
     }
 }
@@ -1656,34 +1684,40 @@ void R4300iOp::SD()
     }
 }
 /********************** R4300i OpCodes: Special **********************/
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_SLL()
 {
-    _GPR[m_Opcode.rd].DW = (_GPR[m_Opcode.rt].W[0] << m_Opcode.sa);
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, (_GPR[m_Opcode.rt].W[0] << m_Opcode.sa));
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_SRL()
 {
-    _GPR[m_Opcode.rd].DW = (int32_t)(_GPR[m_Opcode.rt].UW[0] >> m_Opcode.sa);
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, (int32_t)(_GPR[m_Opcode.rt].UW[0] >> m_Opcode.sa));
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_SRA()
 {
-    _GPR[m_Opcode.rd].DW = (_GPR[m_Opcode.rt].W[0] >> m_Opcode.sa);
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, (_GPR[m_Opcode.rt].W[0] >> m_Opcode.sa));
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_SLLV()
 {
-    _GPR[m_Opcode.rd].DW = (_GPR[m_Opcode.rt].W[0] << (_GPR[m_Opcode.rs].UW[0] & 0x1F));
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, (_GPR[m_Opcode.rt].W[0] << (_GPR[m_Opcode.rs].UW[0] & 0x1F)));
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_SRLV()
 {
-    _GPR[m_Opcode.rd].DW = (int32_t)(_GPR[m_Opcode.rt].UW[0] >> (_GPR[m_Opcode.rs].UW[0] & 0x1F));
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, (int32_t)(_GPR[m_Opcode.rt].UW[0] >> (_GPR[m_Opcode.rs].UW[0] & 0x1F)));
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_SRAV()
 {
-    _GPR[m_Opcode.rd].DW = (_GPR[m_Opcode.rt].W[0] >> (_GPR[m_Opcode.rs].UW[0] & 0x1F));
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, (_GPR[m_Opcode.rt].W[0] >> (_GPR[m_Opcode.rs].UW[0] & 0x1F)));
 }
 
 void R4300iOp::SPECIAL_JR()
@@ -1693,11 +1727,12 @@ void R4300iOp::SPECIAL_JR()
     m_TestTimer = true;
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_JALR()
 {
     m_NextInstruction = DELAY_SLOT;
     m_JumpToLocation = _GPR[m_Opcode.rs].UW[0];
-    _GPR[m_Opcode.rd].DW = (int32_t)((*_PROGRAM_COUNTER) + 8);
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, (int32_t)((*_PROGRAM_COUNTER) + 8));
     m_TestTimer = true;
 }
 
@@ -1864,34 +1899,40 @@ void R4300iOp::SPECIAL_DDIVU()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_ADD()
 {
-    _GPR[m_Opcode.rd].DW = _GPR[m_Opcode.rs].W[0] + _GPR[m_Opcode.rt].W[0];
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, _GPR[m_Opcode.rs].W[0] + _GPR[m_Opcode.rt].W[0]);
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_ADDU()
 {
-    _GPR[m_Opcode.rd].DW = _GPR[m_Opcode.rs].W[0] + _GPR[m_Opcode.rt].W[0];
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, _GPR[m_Opcode.rs].W[0] + _GPR[m_Opcode.rt].W[0]);
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_SUB()
 {
-    _GPR[m_Opcode.rd].DW = _GPR[m_Opcode.rs].W[0] - _GPR[m_Opcode.rt].W[0];
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, _GPR[m_Opcode.rs].W[0] - _GPR[m_Opcode.rt].W[0]);
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_SUBU()
 {
-    _GPR[m_Opcode.rd].DW = _GPR[m_Opcode.rs].W[0] - _GPR[m_Opcode.rt].W[0];
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, _GPR[m_Opcode.rs].W[0] - _GPR[m_Opcode.rt].W[0]);
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_AND()
 {
-    _GPR[m_Opcode.rd].DW = _GPR[m_Opcode.rs].DW & _GPR[m_Opcode.rt].DW;
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, GPR_DW<b32BitCore>(m_Opcode.rs) & GPR_DW<b32BitCore>(m_Opcode.rt));
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_OR()
 {
-    _GPR[m_Opcode.rd].DW = _GPR[m_Opcode.rs].DW | _GPR[m_Opcode.rt].DW;
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, GPR_DW<b32BitCore>(m_Opcode.rs) | GPR_DW<b32BitCore>(m_Opcode.rt));
 #ifdef Interpreter_StackTest
     if (m_Opcode.rd == 29)
     {
@@ -1905,32 +1946,35 @@ void R4300iOp::SPECIAL_XOR()
     _GPR[m_Opcode.rd].DW = _GPR[m_Opcode.rs].DW ^ _GPR[m_Opcode.rt].DW;
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_NOR()
 {
-    _GPR[m_Opcode.rd].DW = ~(_GPR[m_Opcode.rs].DW | _GPR[m_Opcode.rt].DW);
+    SetGPR_DW<b32BitCore>(m_Opcode.rd, ~(GPR_DW<b32BitCore>(m_Opcode.rs) | GPR_DW<b32BitCore>(m_Opcode.rt)));
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_SLT()
 {
-    if (_GPR[m_Opcode.rs].DW < _GPR[m_Opcode.rt].DW)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) < GPR_DW<b32BitCore>(m_Opcode.rt))
     {
-        _GPR[m_Opcode.rd].DW = 1;
+        SetGPR_DW<b32BitCore>(m_Opcode.rd, 1);
     }
     else
     {
-        _GPR[m_Opcode.rd].DW = 0;
+        SetGPR_DW<b32BitCore>(m_Opcode.rd, 0);
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_SLTU()
 {
-    if (_GPR[m_Opcode.rs].UDW < _GPR[m_Opcode.rt].UDW)
+    if (GPR_UDW<b32BitCore>(m_Opcode.rs) < GPR_UDW<b32BitCore>(m_Opcode.rt))
     {
-        _GPR[m_Opcode.rd].DW = 1;
+        SetGPR_DW<b32BitCore>(m_Opcode.rd, 1);
     }
     else
     {
-        _GPR[m_Opcode.rd].DW = 0;
+        SetGPR_DW<b32BitCore>(m_Opcode.rd, 0);
     }
 }
 
@@ -1954,9 +1998,10 @@ void R4300iOp::SPECIAL_DSUBU()
     _GPR[m_Opcode.rd].DW = _GPR[m_Opcode.rs].DW - _GPR[m_Opcode.rt].DW;
 }
 
+template <bool b32BitCore>
 void R4300iOp::SPECIAL_TEQ()
 {
-    if (_GPR[m_Opcode.rs].DW == _GPR[m_Opcode.rt].DW && bHaveDebugger())
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) == GPR_DW<b32BitCore>(m_Opcode.rt) && bHaveDebugger())
     {
         g_Notify->DisplayError("Should trap this ???");
     }
@@ -1993,10 +2038,11 @@ void R4300iOp::SPECIAL_DSRA32()
 }
 
 /********************** R4300i OpCodes: RegImm **********************/
+template <bool b32BitCore>
 void R4300iOp::REGIMM_BLTZ()
 {
     m_NextInstruction = DELAY_SLOT;
-    if (_GPR[m_Opcode.rs].DW < 0)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) < 0)
     {
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
         if ((*_PROGRAM_COUNTER) == m_JumpToLocation)
@@ -2013,10 +2059,11 @@ void R4300iOp::REGIMM_BLTZ()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::REGIMM_BGEZ()
 {
     m_NextInstruction = DELAY_SLOT;
-    if (_GPR[m_Opcode.rs].DW >= 0)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) >= 0)
     {
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
         if ((*_PROGRAM_COUNTER) == m_JumpToLocation)
@@ -2033,9 +2080,10 @@ void R4300iOp::REGIMM_BGEZ()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::REGIMM_BLTZL()
 {
-    if (_GPR[m_Opcode.rs].DW < 0)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) < 0)
     {
         m_NextInstruction = DELAY_SLOT;
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
@@ -2054,9 +2102,10 @@ void R4300iOp::REGIMM_BLTZL()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::REGIMM_BGEZL()
 {
-    if (_GPR[m_Opcode.rs].DW >= 0)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) >= 0)
     {
         m_NextInstruction = DELAY_SLOT;
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
@@ -2075,10 +2124,11 @@ void R4300iOp::REGIMM_BGEZL()
     }
 }
 
+template <bool b32BitCore>
 void R4300iOp::REGIMM_BLTZAL()
 {
     m_NextInstruction = DELAY_SLOT;
-    if (_GPR[m_Opcode.rs].DW < 0)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) < 0)
     {
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
         if ((*_PROGRAM_COUNTER) == m_JumpToLocation)
@@ -2093,13 +2143,14 @@ void R4300iOp::REGIMM_BLTZAL()
     {
         m_JumpToLocation = (*_PROGRAM_COUNTER) + 8;
     }
-    _GPR[31].DW = (int32_t)((*_PROGRAM_COUNTER) + 8);
+    SetGPR_DW<b32BitCore>(31, (int32_t)((*_PROGRAM_COUNTER) + 8));
 }
 
+template <bool b32BitCore>
 void R4300iOp::REGIMM_BGEZAL()
 {
     m_NextInstruction = DELAY_SLOT;
-    if (_GPR[m_Opcode.rs].DW >= 0)
+    if (GPR_DW<b32BitCore>(m_Opcode.rs) >= 0)
     {
         m_JumpToLocation = (*_PROGRAM_COUNTER) + ((int16_t)m_Opcode.offset << 2) + 4;
         if ((*_PROGRAM_COUNTER) == m_JumpToLocation)
@@ -2114,9 +2165,10 @@ void R4300iOp::REGIMM_BGEZAL()
     {
         m_JumpToLocation = (*_PROGRAM_COUNTER) + 8;
     }
-    _GPR[31].DW = (int32_t)((*_PROGRAM_COUNTER) + 8);
+    SetGPR_DW<b32BitCore>(31, (int32_t)((*_PROGRAM_COUNTER) + 8));
 }
 /************************** COP0 functions **************************/
+template <bool b32BitCore>
 void R4300iOp::COP0_MF()
 {
     if (LogCP0reads())
@@ -2128,7 +2180,7 @@ void R4300iOp::COP0_MF()
     {
         g_SystemTimer->UpdateTimers();
     }
-    _GPR[m_Opcode.rt].DW = (int32_t)_CP0[m_Opcode.rd];
+    SetGPR_DW<b32BitCore>(m_Opcode.rt, (int32_t)_CP0[m_Opcode.rd]);
 }
 
 void R4300iOp::COP0_MT()
@@ -2260,10 +2312,11 @@ void R4300iOp::COP0_CO_ERET()
 }
 
 /************************** COP1 functions **************************/
+template <bool b32BitCore>
 void R4300iOp::COP1_MF()
 {
     TEST_COP1_USABLE_EXCEPTION();
-    _GPR[m_Opcode.rt].DW = *(int32_t *)_FPR_S[m_Opcode.fs];
+    SetGPR_DW<b32BitCore>(m_Opcode.rt, *(int32_t *)_FPR_S[m_Opcode.fs]);
 }
 
 void R4300iOp::COP1_DMF()
@@ -2272,6 +2325,7 @@ void R4300iOp::COP1_DMF()
     _GPR[m_Opcode.rt].DW = *(int64_t *)_FPR_D[m_Opcode.fs];
 }
 
+template <bool b32BitCore>
 void R4300iOp::COP1_CF()
 {
     TEST_COP1_USABLE_EXCEPTION();
@@ -2283,7 +2337,7 @@ void R4300iOp::COP1_CF()
         }
         return;
     }
-    _GPR[m_Opcode.rt].DW = (int32_t)_FPCR[m_Opcode.fs];
+    SetGPR_DW<b32BitCore>(m_Opcode.rt, (int32_t)_FPCR[m_Opcode.fs]);
 }
 
 void R4300iOp::COP1_MT()
@@ -2292,10 +2346,11 @@ void R4300iOp::COP1_MT()
     *(int32_t *)_FPR_S[m_Opcode.fs] = _GPR[m_Opcode.rt].W[0];
 }
 
+template <bool b32BitCore>
 void R4300iOp::COP1_DMT()
 {
     TEST_COP1_USABLE_EXCEPTION();
-    *(int64_t *)_FPR_D[m_Opcode.fs] = _GPR[m_Opcode.rt].DW;
+    *(int64_t *)_FPR_D[m_Opcode.fs] = GPR_DW<b32BitCore>(m_Opcode.rt);
 }
 
 void R4300iOp::COP1_CT()
@@ -2834,4 +2889,66 @@ void R4300iOp::UnknownOpcode()
         ExitThread(0);
     }
 #endif
-}
\ No newline at end of file
+}
+
+//Generate the 64-bit and 32-bit cores from the same op handlers
+template R4300iOp::Func * R4300iOp::BuildInterpreter<false>();
+template R4300iOp::Func * R4300iOp::BuildInterpreter<true>();
+
+//The ARM recompiler calls these handlers directly, instantiate both cores so they link
+template void R4300iOp::ANDI<false>();
+template void R4300iOp::COP0_MF<false>();
+template void R4300iOp::COP1_CF<false>();
+template void R4300iOp::COP1_DMT<false>();
+template void R4300iOp::COP1_MF<false>();
+template void R4300iOp::LBU<false>();
+template void R4300iOp::LH<false>();
+template void R4300iOp::LHU<false>();
+template void R4300iOp::LL<false>();
+template void R4300iOp::LWL<false>();
+template void R4300iOp::LWR<false>();
+template void R4300iOp::LWU<false>();
+template void R4300iOp::SLTI<false>();
+template void R4300iOp::SLTIU<false>();
+template void R4300iOp::SPECIAL_ADD<false>();
+template void R4300iOp::SPECIAL_ADDU<false>();
+template void R4300iOp::SPECIAL_AND<false>();
+template void R4300iOp::SPECIAL_NOR<false>();
+template void R4300iOp::SPECIAL_OR<false>();
+template void R4300iOp::SPECIAL_SLL<false>();
+template void R4300iOp::SPECIAL_SLLV<false>();
+template void R4300iOp::SPECIAL_SLT<false>();
+template void R4300iOp::SPECIAL_SLTU<false>();
+template void R4300iOp::SPECIAL_SRA<false>();
+template void R4300iOp::SPECIAL_SRAV<false>();
+template void R4300iOp::SPECIAL_SRL<false>();
+template void R4300iOp::SPECIAL_SRLV<false>();
+template void R4300iOp::XORI<false>();
+template void R4300iOp::ANDI<true>();
+template void R4300iOp::COP0_MF<true>();
+template void R4300iOp::COP1_CF<true>();
+template void R4300iOp::COP1_DMT<true>();
+template void R4300iOp::COP1_MF<true>();
+template void R4300iOp::LBU<true>();
+template void R4300iOp::LH<true>();
+template void R4300iOp::LHU<true>();
+template void R4300iOp::LL<true>();
+template void R4300iOp::LWL<true>();
+template void R4300iOp::LWR<true>();
+template void R4300iOp::LWU<true>();
+template void R4300iOp::SLTI<true>();
+template void R4300iOp::SLTIU<true>();
+template void R4300iOp::SPECIAL_ADD<true>();
+template void R4300iOp::SPECIAL_ADDU<true>();
+template void R4300iOp::SPECIAL_AND<true>();
+template void R4300iOp::SPECIAL_NOR<true>();
+template void R4300iOp::SPECIAL_OR<true>();
+template void R4300iOp::SPECIAL_SLL<true>();
+template void R4300iOp::SPECIAL_SLLV<true>();
+template void R4300iOp::SPECIAL_SLT<true>();
+template void R4300iOp::SPECIAL_SLTU<true>();
+template void R4300iOp::SPECIAL_SRA<true>();
+template void R4300iOp::SPECIAL_SRAV<true>();
+template void R4300iOp::SPECIAL_SRL<true>();
+template void R4300iOp::SPECIAL_SRLV<true>();
+template void R4300iOp::XORI<true>();
@@ -24,34 +24,34 @@ public:
 
     /************************* OpCode functions *************************/
     static void  J();
-    static void  JAL();
-    static void  BNE();
-    static void  BEQ();
-    static void  BLEZ();
-    static void  BGTZ();
-    static void  ADDI();
-    static void  ADDIU();
-    static void  SLTI();
-    static void  SLTIU();
-    static void  ANDI();
-    static void  ORI();
-    static void  XORI();
-    static void  LUI();
-    static void  BEQL();
-    static void  BNEL();
-    static void  BLEZL();
-    static void  BGTZL();
+    template <bool b32BitCore> static void  JAL();
+    template <bool b32BitCore> static void  BNE();
+    template <bool b32BitCore> static void  BEQ();
+    template <bool b32BitCore> static void  BLEZ();
+    template <bool b32BitCore> static void  BGTZ();
+    template <bool b32BitCore> static void  ADDI();
+    template <bool b32BitCore> static void  ADDIU();
+    template <bool b32BitCore> static void  SLTI();
+    template <bool b32BitCore> static void  SLTIU();
+    template <bool b32BitCore> static void  ANDI();
+    template <bool b32BitCore> static void  ORI();
+    template <bool b32BitCore> static void  XORI();
+    template <bool b32BitCore> static void  LUI();
+    template <bool b32BitCore> static void  BEQL();
+    template <bool b32BitCore> static void  BNEL();
+    template <bool b32BitCore> static void  BLEZL();
+    template <bool b32BitCore> static void  BGTZL();
     static void  DADDIU();
     static void  LDL();
     static void  LDR();
-    static void  LB();
-    static void  LH();
-    static void  LWL();
-    static void  LW();
-    static void  LBU();
-    static void  LHU();
-    static void  LWR();
-    static void  LWU();
+    template <bool b32BitCore> static void  LB();
+    template <bool b32BitCore> static void  LH();
+    template <bool b32BitCore> static void  LWL();
+    template <bool b32BitCore> static void  LW();
+    template <bool b32BitCore> static void  LBU();
+    template <bool b32BitCore> static void  LHU();
+    template <bool b32BitCore> static void  LWR();
+    template <bool b32BitCore> static void  LWU();
     static void  SB();
     static void  SH();
     static void  SWL();
@@ -60,7 +60,7 @@ public:
     static void  SDR();
     static void  SWR();
     static void  CACHE();
-    static void  LL();
+    template <bool b32BitCore> static void  LL();
     static void  LWC1();
     static void  LDC1();
     static void  LD();
@@ -70,14 +70,14 @@ public:
     static void  SD();
 
     /********************** R4300i OpCodes: Special **********************/
-    static void  SPECIAL_SLL();
-    static void  SPECIAL_SRL();
-    static void  SPECIAL_SRA();
-    static void  SPECIAL_SLLV();
-    static void  SPECIAL_SRLV();
-    static void  SPECIAL_SRAV();
+    template <bool b32BitCore> static void  SPECIAL_SLL();
+    template <bool b32BitCore> static void  SPECIAL_SRL();
+    template <bool b32BitCore> static void  SPECIAL_SRA();
+    template <bool b32BitCore> static void  SPECIAL_SLLV();
+    template <bool b32BitCore> static void  SPECIAL_SRLV();
+    template <bool b32BitCore> static void  SPECIAL_SRAV();
     static void  SPECIAL_JR();
-    static void  SPECIAL_JALR();
+    template <bool b32BitCore> static void  SPECIAL_JALR();
     static void  SPECIAL_SYSCALL();
     static void  SPECIAL_BREAK();
     static void  SPECIAL_SYNC();
@@ -96,21 +96,21 @@ public:
     static void  SPECIAL_DMULTU();
     static void  SPECIAL_DDIV();
     static void  SPECIAL_DDIVU();
-    static void  SPECIAL_ADD();
-    static void  SPECIAL_ADDU();
-    static void  SPECIAL_SUB();
-    static void  SPECIAL_SUBU();
-    static void  SPECIAL_AND();
-    static void  SPECIAL_OR();
+    template <bool b32BitCore> static void  SPECIAL_ADD();
+    template <bool b32BitCore> static void  SPECIAL_ADDU();
+    template <bool b32BitCore> static void  SPECIAL_SUB();
+    template <bool b32BitCore> static void  SPECIAL_SUBU();
+    template <bool b32BitCore> static void  SPECIAL_AND();
+    template <bool b32BitCore> static void  SPECIAL_OR();
     static void  SPECIAL_XOR();
-    static void  SPECIAL_NOR();
-    static void  SPECIAL_SLT();
-    static void  SPECIAL_SLTU();
+    template <bool b32BitCore> static void  SPECIAL_NOR();
+    template <bool b32BitCore> static void  SPECIAL_SLT();
+    template <bool b32BitCore> static void  SPECIAL_SLTU();
     static void  SPECIAL_DADD();
     static void  SPECIAL_DADDU();
     static void  SPECIAL_DSUB();
     static void  SPECIAL_DSUBU();
-    static void  SPECIAL_TEQ();
+    template <bool b32BitCore> static void  SPECIAL_TEQ();
     static void  SPECIAL_DSLL();
     static void  SPECIAL_DSRL();
     static void  SPECIAL_DSRA();
@@ -119,15 +119,15 @@ public:
     static void  SPECIAL_DSRA32();
 
     /********************** R4300i OpCodes: RegImm **********************/
-    static void  REGIMM_BLTZ();
-    static void  REGIMM_BGEZ();
-    static void  REGIMM_BLTZL();
-    static void  REGIMM_BGEZL();
-    static void  REGIMM_BLTZAL();
-    static void  REGIMM_BGEZAL();
+    template <bool b32BitCore> static void  REGIMM_BLTZ();
+    template <bool b32BitCore> static void  REGIMM_BGEZ();
+    template <bool b32BitCore> static void  REGIMM_BLTZL();
+    template <bool b32BitCore> static void  REGIMM_BGEZL();
+    template <bool b32BitCore> static void  REGIMM_BLTZAL();
+    template <bool b32BitCore> static void  REGIMM_BGEZAL();
 
     /************************** COP0 functions **************************/
-    static void  COP0_MF();
+    template <bool b32BitCore> static void  COP0_MF();
     static void  COP0_MT();
 
     /************************** COP0 CO functions ***********************/
@@ -138,11 +138,11 @@ public:
     static void  COP0_CO_ERET();
 
     /************************** COP1 functions **************************/
-    static void  COP1_MF();
+    template <bool b32BitCore> static void  COP1_MF();
     static void  COP1_DMF();
-    static void  COP1_CF();
+    template <bool b32BitCore> static void  COP1_CF();
     static void  COP1_MT();
-    static void  COP1_DMT();
+    template <bool b32BitCore> static void  COP1_DMT();
     static void  COP1_CT();
 
     /************************* COP1: BC1 functions ***********************/
@@ -206,7 +206,7 @@ public:
     /************************** Other functions **************************/
     static void  UnknownOpcode();
 
-    static Func* BuildInterpreter();
+    template <bool b32BitCore> static Func* BuildInterpreter();
 
     static bool        m_TestTimer;
     static uint32_t    m_NextInstruction;
@@ -214,6 +214,15 @@ public:
     static uint32_t    m_JumpToLocation;
 
 protected:
+    //In the 32-bit core only the low word of a GPR is used and written
+    template <bool b32BitCore> static inline int64_t GPR_DW(uint32_t Reg) { return b32BitCore ? (int64_t)_GPR[Reg].W[0] : _GPR[Reg].DW; }
+    template <bool b32BitCore> static inline uint64_t GPR_UDW(uint32_t Reg) { return b32BitCore ? (uint64_t)_GPR[Reg].UW[0] : _GPR[Reg].UDW; }
+    template <bool b32BitCore> static inline void SetGPR_DW(uint32_t Reg, int64_t Value)
+    {
+        if (b32BitCore) { _GPR[Reg].W[0] = (int32_t)Value; }
+        else { _GPR[Reg].DW = Value; }
+    }
+
     static void  SPECIAL();
     static void  REGIMM();
     static void  COP0();
@@ -19,6 +19,8 @@
 #include <Project64-core/N64System/Mips/Disk.h>
 #include <Project64-core/N64System/N64DiskClass.h>
 #include <Project64-core/N64System/N64Class.h>
+#include <Project64-core/N64System/ByteSwap.h>
+#include <Project64-core/N64System/Interpreter/InterpreterCPU.h>
 
 CDMA::CDMA(CFlashram & FlashRam, CSram & Sram) :
     m_FlashRam(FlashRam),
@@ -83,13 +85,9 @@ void CDMA::PI_DMA_READ()
     if (g_Reg->PI_CART_ADDR_REG >= 0x05000400 && g_Reg->PI_CART_ADDR_REG <= 0x050004FF)
     {
         //64DD User Sector
-        uint32_t i;
         uint8_t * RDRAM = g_MMU->Rdram();
         uint8_t * DISK = g_Disk->GetDiskAddressBuffer();
-        for (i = 0; i < PI_RD_LEN_REG; i++)
-        {
-            *(DISK + (i ^ 3)) = *(RDRAM + ((g_Reg->PI_DRAM_ADDR_REG + i) ^ 3));
-        }
+        CByteSwap::CopySwizzled(DISK, 0, RDRAM, g_Reg->PI_DRAM_ADDR_REG, PI_RD_LEN_REG);
         g_SystemTimer->SetTimer(g_SystemTimer->DDPiTimer, (PI_RD_LEN_REG * 63) / 25, false);
         return;
     }
@@ -106,7 +104,6 @@ void CDMA::PI_DMA_READ()
     //Write ROM Area (for 64DD Convert)
     if (g_Reg->PI_CART_ADDR_REG >= 0x10000000 && g_Reg->PI_CART_ADDR_REG <= 0x1FBFFFFF && g_Settings->LoadBool(Game_AllowROMWrites))
     {
-        uint32_t i;
         uint8_t * ROM = g_Rom->GetRomAddress();
         uint8_t * RDRAM = g_MMU->Rdram();
 
@@ -114,19 +111,13 @@ void CDMA::PI_DMA_READ()
         g_Reg->PI_CART_ADDR_REG -= 0x10000000;
         if (g_Reg->PI_CART_ADDR_REG + PI_RD_LEN_REG < g_Rom->GetRomSize())
         {
-            for (i = 0; i < PI_RD_LEN_REG; i++)
-            {
-                *(ROM + ((g_Reg->PI_CART_ADDR_REG + i) ^ 3)) = *(RDRAM + ((g_Reg->PI_DRAM_ADDR_REG + i) ^ 3));
-            }
+            CByteSwap::CopySwizzled(ROM, g_Reg->PI_CART_ADDR_REG, RDRAM, g_Reg->PI_DRAM_ADDR_REG, PI_RD_LEN_REG);
         }
         else
         {
             uint32_t Len;
             Len = g_Rom->GetRomSize() - g_Reg->PI_CART_ADDR_REG;
-            for (i = 0; i < Len; i++)
-            {
-                *(ROM + ((g_Reg->PI_CART_ADDR_REG + i) ^ 3)) = *(RDRAM + ((g_Reg->PI_DRAM_ADDR_REG + i) ^ 3));
-            }
+            CByteSwap::CopySwizzled(ROM, g_Reg->PI_CART_ADDR_REG, RDRAM, g_Reg->PI_DRAM_ADDR_REG, Len);
         }
         g_Reg->PI_CART_ADDR_REG += 0x10000000;
 
@@ -139,6 +130,7 @@ void CDMA::PI_DMA_READ()
         {
             g_Recompiler->ClearRecompCode_Phys(g_Reg->PI_DRAM_ADDR_REG, g_Reg->PI_WR_LEN_REG, CRecompiler::Remove_DMA);
         }
+        CInterpreterCPU::ClearDecodedCode(g_Reg->PI_DRAM_ADDR_REG, g_Reg->PI_WR_LEN_REG + 1);
 
         ProtectMemory(ROM, g_Rom->GetRomSize(), MEM_READONLY);
 
@@ -216,12 +208,8 @@ void CDMA::PI_DMA_WRITE()
     if (g_Reg->PI_CART_ADDR_REG >= 0x05000000 && g_Reg->PI_CART_ADDR_REG <= 0x050003FF)
     {
         //64DD C2 Sectors (just read 0)
-        uint32_t i;
         uint8_t * RDRAM = g_MMU->Rdram();
-        for (i = 0; i < PI_WR_LEN_REG; i++)
-        {
-            *(RDRAM + ((g_Reg->PI_DRAM_ADDR_REG + i) ^ 3)) = 0;
-        }
+        CByteSwap::ClearSwizzled(RDRAM, g_Reg->PI_DRAM_ADDR_REG, PI_WR_LEN_REG);
 
         //Timer is needed for Track Read
         g_SystemTimer->SetTimer(g_SystemTimer->DDPiTimer, (PI_WR_LEN_REG * 63) / 25, false);
@@ -231,13 +219,9 @@ void CDMA::PI_DMA_WRITE()
     if (g_Reg->PI_CART_ADDR_REG >= 0x05000400 && g_Reg->PI_CART_ADDR_REG <= 0x050004FF)
     {
         //64DD User Sector
-        uint32_t i;
         uint8_t * RDRAM = g_MMU->Rdram();
         uint8_t * DISK = g_Disk->GetDiskAddressBuffer();
-        for (i = 0; i < PI_WR_LEN_REG; i++)
-        {
-            *(RDRAM + ((g_Reg->PI_DRAM_ADDR_REG + i) ^ 3)) = *(DISK + (i ^ 3));
-        }
+        CByteSwap::CopySwizzled(RDRAM, g_Reg->PI_DRAM_ADDR_REG, DISK, 0, PI_WR_LEN_REG);
 
         //Timer is needed for Track Read
         g_SystemTimer->SetTimer(g_SystemTimer->DDPiTimer, (PI_WR_LEN_REG * 63) / 25, false);
@@ -263,10 +247,7 @@ void CDMA::PI_DMA_WRITE()
         g_Reg->PI_CART_ADDR_REG -= 0x06000000;
         if (g_Reg->PI_CART_ADDR_REG + PI_WR_LEN_REG < g_DDRom->GetRomSize())
         {
-            for (i = 0; i < PI_WR_LEN_REG; i++)
-            {
-                *(RDRAM + ((g_Reg->PI_DRAM_ADDR_REG + i) ^ 3)) = *(ROM + ((g_Reg->PI_CART_ADDR_REG + i) ^ 3));
-            }
+            CByteSwap::CopySwizzled(RDRAM, g_Reg->PI_DRAM_ADDR_REG, ROM, g_Reg->PI_CART_ADDR_REG, PI_WR_LEN_REG);
         }
         else if (g_Reg->PI_CART_ADDR_REG >= g_DDRom->GetRomSize())
         {
@@ -275,19 +256,13 @@ void CDMA::PI_DMA_WRITE()
             {
                 cart -= g_DDRom->GetRomSize();
             }
-            for (i = 0; i < PI_WR_LEN_REG; i++)
-            {
-                *(RDRAM + ((g_Reg->PI_DRAM_ADDR_REG + i) ^ 3)) = *(ROM + ((cart + i) ^ 3));
-            }
+            CByteSwap::CopySwizzled(RDRAM, g_Reg->PI_DRAM_ADDR_REG, ROM, cart, PI_WR_LEN_REG);
         }
         else
         {
             uint32_t Len;
             Len = g_DDRom->GetRomSize() - g_Reg->PI_CART_ADDR_REG;
-            for (i = 0; i < Len; i++)
-            {
-                *(RDRAM + ((g_Reg->PI_DRAM_ADDR_REG + i) ^ 3)) = *(ROM + ((g_Reg->PI_CART_ADDR_REG + i) ^ 3));
-            }
+            CByteSwap::CopySwizzled(RDRAM, g_Reg->PI_DRAM_ADDR_REG, ROM, g_Reg->PI_CART_ADDR_REG, Len);
             for (i = Len; i < PI_WR_LEN_REG - Len; i++)
             {
                 *(RDRAM + ((g_Reg->PI_DRAM_ADDR_REG + i) ^ 3)) = 0;
@@ -304,6 +279,7 @@ void CDMA::PI_DMA_WRITE()
         {
             g_Recompiler->ClearRecompCode_Phys(g_Reg->PI_DRAM_ADDR_REG, g_Reg->PI_WR_LEN_REG, CRecompiler::Remove_DMA);
         }
+        CInterpreterCPU::ClearDecodedCode(g_Reg->PI_DRAM_ADDR_REG, g_Reg->PI_WR_LEN_REG + 1);
         g_Reg->PI_STATUS_REG &= ~PI_STATUS_DMA_BUSY;
         g_Reg->MI_INTR_REG |= MI_INTR_PI;
         g_Reg->CheckInterrupts();
@@ -429,19 +405,13 @@ void CDMA::PI_DMA_WRITE()
             {
                 cart -= g_Rom->GetRomSize();
             }
-            for (i = 0; i < PI_WR_LEN_REG; i++)
-            {
-                *(RDRAM + ((g_Reg->PI_DRAM_ADDR_REG + i) ^ 3)) = *(ROM + ((cart + i) ^ 3));
-            }
+            CByteSwap::CopySwizzled(RDRAM, g_Reg->PI_DRAM_ADDR_REG, ROM, cart, PI_WR_LEN_REG);
         }
         else
         {
             uint32_t Len;
             Len = g_Rom->GetRomSize() - g_Reg->PI_CART_ADDR_REG;
-            for (i = 0; i < Len; i++)
-            {
-                *(RDRAM + ((g_Reg->PI_DRAM_ADDR_REG + i) ^ 3)) = *(ROM + ((g_Reg->PI_CART_ADDR_REG + i) ^ 3));
-            }
+            CByteSwap::CopySwizzled(RDRAM, g_Reg->PI_DRAM_ADDR_REG, ROM, g_Reg->PI_CART_ADDR_REG, Len);
             for (i = Len; i < PI_WR_LEN_REG - Len; i++)
             {
                 *(RDRAM + ((g_Reg->PI_DRAM_ADDR_REG + i) ^ 3)) = 0;
@@ -458,6 +428,7 @@ void CDMA::PI_DMA_WRITE()
         {
             g_Recompiler->ClearRecompCode_Phys(g_Reg->PI_DRAM_ADDR_REG, g_Reg->PI_WR_LEN_REG, CRecompiler::Remove_DMA);
         }
+        CInterpreterCPU::ClearDecodedCode(g_Reg->PI_DRAM_ADDR_REG, g_Reg->PI_WR_LEN_REG + 1);
         g_Reg->PI_STATUS_REG &= ~PI_STATUS_DMA_BUSY;
         g_Reg->MI_INTR_REG |= MI_INTR_PI;
         g_Reg->CheckInterrupts();
@@ -477,6 +448,7 @@ void CDMA::PI_DMA_WRITE()
 
 void CDMA::SP_DMA_READ()
 {
+    g_System->SyncRSP();
     g_Reg->SP_DRAM_ADDR_REG &= 0x1FFFFFFF;
 
     if (g_Reg->SP_DRAM_ADDR_REG > g_MMU->RdramSize())
@@ -521,6 +493,7 @@ void CDMA::SP_DMA_READ()
 
 void CDMA::SP_DMA_WRITE()
 {
+    g_System->SyncRSP();
     if (g_Reg->SP_DRAM_ADDR_REG > g_MMU->RdramSize())
     {
         if (bHaveDebugger())
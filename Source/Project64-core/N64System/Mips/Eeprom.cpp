@@ -158,7 +158,7 @@ void CEeprom::LoadEeprom()
         FileName.DirectoryCreate();
     }
 
-    if (!m_File.Open(FileName, (m_ReadOnly ? CFileBase::modeRead : CFileBase::modeReadWrite) | CFileBase::modeNoTruncate | CFileBase::modeCreate))
+    if (!m_File.Open(FileName, m_ReadOnly))
     {
 #ifdef _WIN32
         WriteTrace(TraceN64System, TraceError, "Failed to open (%s), ReadOnly = %d, LastError = %X", (const char *)FileName, m_ReadOnly, GetLastError());
@@ -168,8 +168,7 @@ void CEeprom::LoadEeprom()
         g_Notify->DisplayError(GS(MSG_FAIL_OPEN_EEPROM));
         return;
     }
-    m_File.SeekToBegin();
-    m_File.Read(m_EEPROM, sizeof(m_EEPROM));
+    m_File.Read(0, m_EEPROM, sizeof(m_EEPROM));
 }
 
 void CEeprom::ReadFrom(uint8_t * Buffer, int32_t line)
@@ -201,7 +200,6 @@ void CEeprom::WriteTo(uint8_t * Buffer, int32_t line)
     }
     if (!m_ReadOnly)
     {
-        m_File.Seek(line * 8, CFile::begin);
-        m_File.Write(Buffer, 8);
+        m_File.Write(line * 8, Buffer, 8);
     }
 }
\ No newline at end of file
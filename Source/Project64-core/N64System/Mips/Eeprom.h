@@ -10,6 +10,7 @@
 ****************************************************************************/
 #pragma once
 #include <Project64-core/Settings/DebugSettings.h>
+#include <Project64-core/N64System/Mips/SaveMedia.h>
 
 class CEeprom :
     private CDebugSettings
@@ -31,5 +32,5 @@ private:
 
     uint8_t m_EEPROM[0x800];
     bool    m_ReadOnly;
-    CFile   m_File;
+    CSaveMedia m_File;
 };
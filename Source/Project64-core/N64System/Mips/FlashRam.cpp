@@ -56,8 +56,7 @@ void CFlashram::DmaFromFlashram(uint8_t * dest, int32_t StartOffset, int32_t len
         }
         memset(FlipBuffer, 0, sizeof(FlipBuffer));
         StartOffset = StartOffset << 1;
-        m_File.Seek(StartOffset, CFile::begin);
-        m_File.Read(FlipBuffer, len);
+        m_File.Read(StartOffset, FlipBuffer, len);
 
         for (int32_t count = m_File.GetLength(); count < len; count++)
         {
@@ -131,7 +130,7 @@ bool CFlashram::LoadFlashram()
         FileName.DirectoryCreate();
     }
 
-    if (!m_File.Open(FileName, (m_ReadOnly ? CFileBase::modeRead : CFileBase::modeReadWrite) | CFileBase::modeNoTruncate | CFileBase::modeCreate))
+    if (!m_File.Open(FileName, m_ReadOnly))
     {
 #ifdef _WIN32
         WriteTrace(TraceN64System, TraceError, "Failed to open (%s), ReadOnly = %d, LastError = %X", (const char *)FileName, m_ReadOnly, GetLastError());
@@ -141,7 +140,6 @@ bool CFlashram::LoadFlashram()
         g_Notify->DisplayError(GS(MSG_FAIL_OPEN_FLASH));
         return false;
     }
-    m_File.SeekToBegin();
     return true;
 }
 
@@ -165,8 +163,7 @@ void CFlashram::WriteToFlashCommand(uint32_t FlashRAM_Command)
             }
             if (!m_ReadOnly)
             {
-                m_File.Seek(m_FlashRAM_Offset, CFile::begin);
-                m_File.Write(EmptyBlock, sizeof(EmptyBlock));
+                m_File.Write(m_FlashRAM_Offset, EmptyBlock, sizeof(EmptyBlock));
             }
             break;
         case FLASHRAM_MODE_WRITE:
@@ -183,8 +180,7 @@ void CFlashram::WriteToFlashCommand(uint32_t FlashRAM_Command)
 
                 if (!m_ReadOnly)
                 {
-                    m_File.Seek(m_FlashRAM_Offset, CFile::begin);
-                    m_File.Write(FlipBuffer, sizeof(EmptyBlock));
+                    m_File.Write(m_FlashRAM_Offset, FlipBuffer, sizeof(EmptyBlock));
                 }
             }
             break;
@@ -10,6 +10,7 @@
 ****************************************************************************/
 #pragma once
 #include <Project64-core/Settings/DebugSettings.h>
+#include <Project64-core/N64System/Mips/SaveMedia.h>
 
 class CFlashram :
     private CDebugSettings
@@ -44,5 +45,5 @@ private:
     uint64_t  m_FlashStatus;
     uint32_t  m_FlashRAM_Offset;
     bool      m_ReadOnly;
-    CFile     m_File;
+    CSaveMedia m_File;
 };
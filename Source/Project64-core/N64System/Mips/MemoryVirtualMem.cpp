@@ -44,8 +44,10 @@ CMipsMemoryVM::CMipsMemoryVM(bool SavesReadOnly) :
     m_HalfLine(0),
     m_HalfLineCheck(false),
     m_FieldSerration(0),
+#if defined(__i386__) || defined(_M_IX86) || defined(__arm__) || defined(_M_ARM)
     m_TLB_ReadMap(NULL),
     m_TLB_WriteMap(NULL),
+#endif
     m_RDRAM(NULL),
     m_DMEM(NULL),
     m_IMEM(NULL),
@@ -81,29 +83,29 @@ CMipsMemoryVM::~CMipsMemoryVM()
 
 void CMipsMemoryVM::Reset(bool /*EraseMemory*/)
 {
-    if (m_TLB_ReadMap)
+    if (m_RDRAM)
     {
+#if defined(__i386__) || defined(_M_IX86) || defined(__arm__) || defined(_M_ARM)
         size_t address;
 
-        memset(m_TLB_ReadMap, 0, 0xFFFFF * sizeof(size_t));
-        memset(m_TLB_WriteMap, 0, 0xFFFFF * sizeof(size_t));
+        memset(m_TLB_ReadMap, 0, 0x100000 * sizeof(size_t));
+        memset(m_TLB_WriteMap, 0, 0x100000 * sizeof(size_t));
         for (address = 0x80000000; address < 0xC0000000; address += 0x1000)
         {
             m_TLB_ReadMap[address >> 12] = ((size_t)m_RDRAM + (address & 0x1FFFFFFF)) - address;
             m_TLB_WriteMap[address >> 12] = ((size_t)m_RDRAM + (address & 0x1FFFFFFF)) - address;
         }
+#else
+        m_TLB_ReadPages.Reset(m_RDRAM);
+        m_TLB_WritePages.Reset(m_RDRAM);
+#endif
 
         if (g_Settings->LoadDword(Rdb_TLB_VAddrStart) != 0)
         {
             size_t Start = g_Settings->LoadDword(Rdb_TLB_VAddrStart); //0x7F000000;
             size_t Len = g_Settings->LoadDword(Rdb_TLB_VAddrLen);   //0x01000000;
             size_t PAddr = g_Settings->LoadDword(Rdb_TLB_PAddrStart); //0x10034b30;
-            size_t End = Start + Len;
-            for (address = Start; address < End; address += 0x1000)
-            {
-                m_TLB_ReadMap[address >> 12] = ((size_t)m_RDRAM + (address - Start + PAddr)) - address;
-                m_TLB_WriteMap[address >> 12] = ((size_t)m_RDRAM + (address - Start + PAddr)) - address;
-            }
+            TLB_Mapped((uint32_t)Start, (uint32_t)Len, (uint32_t)PAddr, false);
         }
     }
 }
@@ -227,6 +229,7 @@ bool CMipsMemoryVM::Initialize()
 
     CPifRam::Reset();
 
+#if defined(__i386__) || defined(_M_IX86) || defined(__arm__) || defined(_M_ARM)
     m_TLB_ReadMap = new size_t[0x100000];
     if (m_TLB_ReadMap == NULL)
     {
@@ -242,6 +245,7 @@ bool CMipsMemoryVM::Initialize()
         FreeMemory();
         return false;
     }
+#endif
     Reset(false);
     return true;
 }
@@ -273,6 +277,7 @@ void CMipsMemoryVM::FreeMemory()
         m_IMEM = NULL;
         m_DMEM = NULL;
     }
+#if defined(__i386__) || defined(_M_IX86) || defined(__arm__) || defined(_M_ARM)
     if (m_TLB_ReadMap)
     {
         delete[] m_TLB_ReadMap;
@@ -283,6 +288,10 @@ void CMipsMemoryVM::FreeMemory()
         delete[] m_TLB_WriteMap;
         m_TLB_WriteMap = NULL;
     }
+#else
+    m_TLB_ReadPages.Reset(NULL);
+    m_TLB_WritePages.Reset(NULL);
+#endif
     CPifRam::Reset();
 }
 
@@ -313,23 +322,25 @@ uint8_t * CMipsMemoryVM::PifRam()
 
 bool CMipsMemoryVM::LB_VAddr(uint32_t VAddr, uint8_t& Value)
 {
-    if (m_TLB_ReadMap[VAddr >> 12] == 0)
+    size_t Page = TLBReadPage(VAddr);
+    if (Page == 0)
     {
         return false;
     }
 
-    Value = *(uint8_t*)(m_TLB_ReadMap[VAddr >> 12] + (VAddr ^ 3));
+    Value = *(uint8_t*)(Page + (VAddr ^ 3));
     return true;
 }
 
 bool CMipsMemoryVM::LH_VAddr(uint32_t VAddr, uint16_t& Value)
 {
-    if (m_TLB_ReadMap[VAddr >> 12] == 0)
+    size_t Page = TLBReadPage(VAddr);
+    if (Page == 0)
     {
         return false;
     }
 
-    Value = *(uint16_t*)(m_TLB_ReadMap[VAddr >> 12] + (VAddr ^ 2));
+    Value = *(uint16_t*)(Page + (VAddr ^ 2));
     return true;
 }
 
@@ -345,7 +356,7 @@ bool CMipsMemoryVM::LW_VAddr(uint32_t VAddr, uint32_t& Value)
         }
     }
 
-    uint8_t* BaseAddress = (uint8_t*)m_TLB_ReadMap[VAddr >> 12];
+    uint8_t* BaseAddress = (uint8_t*)TLBReadPage(VAddr);
     if (BaseAddress == NULL)
     {
         return false;
@@ -366,13 +377,14 @@ bool CMipsMemoryVM::LW_VAddr(uint32_t VAddr, uint32_t& Value)
 
 bool CMipsMemoryVM::LD_VAddr(uint32_t VAddr, uint64_t& Value)
 {
-    if (m_TLB_ReadMap[VAddr >> 12] == 0)
+    size_t Page = TLBReadPage(VAddr);
+    if (Page == 0)
     {
         return false;
     }
 
-    *((uint32_t*)(&Value) + 1) = *(uint32_t*)(m_TLB_ReadMap[VAddr >> 12] + VAddr);
-    *((uint32_t*)(&Value) + 0) = *(uint32_t*)(m_TLB_ReadMap[VAddr >> 12] + VAddr + 4);
+    *((uint32_t*)(&Value) + 1) = *(uint32_t*)(Page + VAddr);
+    *((uint32_t*)(&Value) + 0) = *(uint32_t*)(Page + VAddr + 4);
     return true;
 }
 
@@ -447,23 +459,25 @@ bool CMipsMemoryVM::LD_PAddr(uint32_t PAddr, uint64_t& Value)
 
 bool CMipsMemoryVM::SB_VAddr(uint32_t VAddr, uint8_t Value)
 {
-    if (m_TLB_WriteMap[VAddr >> 12] == 0)
+    size_t Page = TLBWritePage(VAddr);
+    if (Page == 0)
     {
         return false;
     }
 
-    *(uint8_t*)(m_TLB_WriteMap[VAddr >> 12] + (VAddr ^ 3)) = Value;
+    *(uint8_t*)(Page + (VAddr ^ 3)) = Value;
     return true;
 }
 
 bool CMipsMemoryVM::SH_VAddr(uint32_t VAddr, uint16_t Value)
 {
-    if (m_TLB_WriteMap[VAddr >> 12] == 0)
+    size_t Page = TLBWritePage(VAddr);
+    if (Page == 0)
     {
         return false;
     }
 
-    *(uint16_t*)(m_TLB_WriteMap[VAddr >> 12] + (VAddr ^ 2)) = Value;
+    *(uint16_t*)(Page + (VAddr ^ 2)) = Value;
     return true;
 }
 
@@ -479,24 +493,26 @@ bool CMipsMemoryVM::SW_VAddr(uint32_t VAddr, uint32_t Value)
         }
     }
 
-    if (m_TLB_WriteMap[VAddr >> 12] == 0)
+    size_t Page = TLBWritePage(VAddr);
+    if (Page == 0)
     {
         return false;
     }
 
-    *(uint32_t*)(m_TLB_WriteMap[VAddr >> 12] + VAddr) = Value;
+    *(uint32_t*)(Page + VAddr) = Value;
     return true;
 }
 
 bool CMipsMemoryVM::SD_VAddr(uint32_t VAddr, uint64_t Value)
 {
-    if (m_TLB_WriteMap[VAddr >> 12] == 0)
+    size_t Page = TLBWritePage(VAddr);
+    if (Page == 0)
     {
         return false;
     }
 
-    *(uint32_t*)(m_TLB_WriteMap[VAddr >> 12] + VAddr + 0) = *((uint32_t*)(&Value) + 1);
-    *(uint32_t*)(m_TLB_WriteMap[VAddr >> 12] + VAddr + 4) = *((uint32_t*)(&Value));
+    *(uint32_t*)(Page + VAddr + 0) = *((uint32_t*)(&Value) + 1);
+    *(uint32_t*)(Page + VAddr + 4) = *((uint32_t*)(&Value));
     return true;
 }
 
@@ -571,27 +587,29 @@ bool CMipsMemoryVM::SD_PAddr(uint32_t PAddr, uint64_t Value)
 
 bool CMipsMemoryVM::ValidVaddr(uint32_t VAddr) const
 {
-    return m_TLB_ReadMap[VAddr >> 12] != 0;
+    return TLBReadPage(VAddr) != 0;
 }
 
 bool CMipsMemoryVM::VAddrToRealAddr(uint32_t VAddr, void * &RealAddress) const
 {
-    if (m_TLB_ReadMap[VAddr >> 12] == 0)
+    size_t Page = TLBReadPage(VAddr);
+    if (Page == 0)
     {
         return false;
     }
-    RealAddress = (uint8_t *)(m_TLB_ReadMap[VAddr >> 12] + VAddr);
+    RealAddress = (uint8_t *)(Page + VAddr);
     return true;
 }
 
 bool CMipsMemoryVM::TranslateVaddr(uint32_t VAddr, uint32_t &PAddr) const
 {
     //Change the Virtual address to a Physical Address
-    if (m_TLB_ReadMap[VAddr >> 12] == 0)
+    size_t Page = TLBReadPage(VAddr);
+    if (Page == 0)
     {
         return false;
     }
-    PAddr = (uint32_t)((uint8_t *)(m_TLB_ReadMap[VAddr >> 12] + VAddr) - m_RDRAM);
+    PAddr = (uint32_t)((uint8_t *)(Page + VAddr) - m_RDRAM);
     return true;
 }
 
@@ -991,12 +1009,21 @@ void CMipsMemoryVM::TLB_Mapped(uint32_t VAddr, uint32_t Len, uint32_t PAddr, boo
     VEnd = VAddr + Len;
     for (count = VAddr; count < VEnd; count += 0x1000)
     {
+        size_t Value = ((size_t)m_RDRAM + (count - VAddr + PAddr)) - count;
+#if defined(__i386__) || defined(_M_IX86) || defined(__arm__) || defined(_M_ARM)
         size_t Index = count >> 12;
-        m_TLB_ReadMap[Index] = ((size_t)m_RDRAM + (count - VAddr + PAddr)) - count;
+        m_TLB_ReadMap[Index] = Value;
+        if (!bReadOnly)
+        {
+            m_TLB_WriteMap[Index] = Value;
+        }
+#else
+        m_TLB_ReadPages.Set((uint32_t)count, Value);
         if (!bReadOnly)
         {
-            m_TLB_WriteMap[Index] = ((size_t)m_RDRAM + (count - VAddr + PAddr)) - count;
+            m_TLB_WritePages.Set((uint32_t)count, Value);
         }
+#endif
     }
 }
 
@@ -1007,9 +1034,14 @@ void CMipsMemoryVM::TLB_Unmaped(uint32_t Vaddr, uint32_t Len)
     End = Vaddr + Len;
     for (count = Vaddr; count < End; count += 0x1000)
     {
+#if defined(__i386__) || defined(_M_IX86) || defined(__arm__) || defined(_M_ARM)
         size_t Index = count >> 12;
         m_TLB_ReadMap[Index] = 0;
         m_TLB_WriteMap[Index] = 0;
+#else
+        m_TLB_ReadPages.Set((uint32_t)count, 0);
+        m_TLB_WritePages.Set((uint32_t)count, 0);
+#endif
     }
 }
 
@@ -1045,6 +1077,7 @@ void CMipsMemoryVM::RdramChanged(CMipsMemoryVM * _this)
 
 void CMipsMemoryVM::ChangeSpStatus()
 {
+    g_System->SyncRSP();
     if ((RegModValue & SP_CLR_HALT) != 0)
     {
         g_Reg->SP_STATUS_REG &= ~SP_STATUS_HALT;
@@ -1248,6 +1281,7 @@ void CMipsMemoryVM::Load32RDRAMRegisters(void)
 
 void CMipsMemoryVM::Load32SPRegisters(void)
 {
+    g_System->SyncRSP();
     switch (m_MemLookupAddress & 0x1FFFFFFF)
     {
     case 0x04040010: m_MemLookupValue.UW[0] = g_Reg->SP_STATUS_REG; break;
@@ -1269,6 +1303,7 @@ void CMipsMemoryVM::Load32SPRegisters(void)
 
 void CMipsMemoryVM::Load32DPCommand(void)
 {
+    g_System->SyncRSP();
     switch (m_MemLookupAddress & 0x1FFFFFFF)
     {
     case 0x0410000C: m_MemLookupValue.UW[0] = g_Reg->DPC_STATUS_REG; break;
@@ -1287,6 +1322,7 @@ void CMipsMemoryVM::Load32DPCommand(void)
 
 void CMipsMemoryVM::Load32MIPSInterface(void)
 {
+    g_System->SyncRSP();
     switch (m_MemLookupAddress & 0x1FFFFFFF)
     {
     case 0x04300000: m_MemLookupValue.UW[0] = g_Reg->MI_MODE_REG; break;
@@ -1608,6 +1644,7 @@ void CMipsMemoryVM::Write32RDRAMRegisters(void)
 
 void CMipsMemoryVM::Write32SPRegisters(void)
 {
+    g_System->SyncRSP();
     switch ((m_MemLookupAddress & 0xFFFFFFF))
     {
     case 0x04040000: g_Reg->SP_MEM_ADDR_REG = m_MemLookupValue.UW[0]; break;
@@ -1756,6 +1793,7 @@ void CMipsMemoryVM::Write32SPRegisters(void)
 
 void CMipsMemoryVM::Write32DPCommandRegisters(void)
 {
+    g_System->SyncRSP();
     switch ((m_MemLookupAddress & 0xFFFFFFF))
     {
     case 0x04100000:
@@ -1844,6 +1882,7 @@ void CMipsMemoryVM::Write32DPCommandRegisters(void)
 
 void CMipsMemoryVM::Write32MIPSInterface(void)
 {
+    g_System->SyncRSP();
     switch ((m_MemLookupAddress & 0xFFFFFFF))
     {
     case 0x04300000:
@@ -1940,6 +1979,7 @@ void CMipsMemoryVM::Write32MIPSInterface(void)
 
 void CMipsMemoryVM::Write32VideoInterface(void)
 {
+    g_System->SyncRSP();
     switch ((m_MemLookupAddress & 0xFFFFFFF))
     {
     case 0x04400000:
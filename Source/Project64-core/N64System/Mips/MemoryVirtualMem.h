@@ -17,6 +17,7 @@
 #include <Project64-core/N64System/Mips/FlashRam.h>
 #include <Project64-core/N64System/Mips/Sram.h>
 #include <Project64-core/N64System/Mips/Dma.h>
+#include <Project64-core/N64System/Mips/TLBPageMap.h>
 
 #ifdef __arm__
 #include <sys/ucontext.h>
@@ -213,10 +214,23 @@ private:
 
     mutable char m_strLabelName[100];
 
-    //BIG look up table to quickly translate the tlb to real mem address
+    //Translate the tlb to real mem address
+#if defined(__i386__) || defined(_M_IX86) || defined(__arm__) || defined(_M_ARM)
+    //Recompiled code indexes these tables directly, at 4MB each they are
+    //cheap enough to keep flat on 32 bit targets
     size_t * m_TLB_ReadMap;
     size_t * m_TLB_WriteMap;
 
+    inline size_t TLBReadPage(uint32_t VAddr) const { return m_TLB_ReadMap[VAddr >> 12]; }
+    inline size_t TLBWritePage(uint32_t VAddr) const { return m_TLB_WriteMap[VAddr >> 12]; }
+#else
+    CTLBPageMap m_TLB_ReadPages;
+    CTLBPageMap m_TLB_WritePages;
+
+    inline size_t TLBReadPage(uint32_t VAddr) const { return m_TLB_ReadPages.Lookup(VAddr); }
+    inline size_t TLBWritePage(uint32_t VAddr) const { return m_TLB_WritePages.Lookup(VAddr); }
+#endif
+
     static uint32_t m_MemLookupAddress;
     static MIPS_DWORD m_MemLookupValue;
     static bool m_MemLookupValid;
@@ -53,8 +53,7 @@ void CMempak::LoadMempak(int32_t Control, bool Create)
 
     bool formatMempak = !MempakPath.Exists();
 
-    m_MempakHandle[Control].Open(MempakPath, CFileBase::modeReadWrite | CFileBase::modeNoTruncate | CFileBase::modeCreate);
-    m_MempakHandle[Control].SeekToBegin();
+    m_MempakHandle[Control].Open(MempakPath, false);
 
     if (formatMempak)
     {
@@ -63,11 +62,11 @@ void CMempak::LoadMempak(int32_t Control, bool Create)
             CMempak::Format(Control);
             m_Formatted[Control] = true;
         }
-        m_MempakHandle[Control].Write(m_Mempaks[Control], 0x8000);
+        m_MempakHandle[Control].Write(0, m_Mempaks[Control], 0x8000);
     }
     else
     {
-        m_MempakHandle[Control].Read(m_Mempaks[Control], 0x8000);
+        m_MempakHandle[Control].Read(0, m_Mempaks[Control], 0x8000);
         m_Formatted[Control] = true;
     }
 }
@@ -171,8 +170,7 @@ void CMempak::WriteTo(int32_t Control, uint32_t address, uint8_t * data)
             }
             memcpy(&m_Mempaks[Control][address], data, 0x20);
 
-            m_MempakHandle[Control].Seek(address, CFile::begin);
-            m_MempakHandle[Control].Write(data, 0x20);
+            m_MempakHandle[Control].Write(address, data, 0x20);
         }
     }
     else
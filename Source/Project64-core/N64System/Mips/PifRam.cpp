@@ -17,6 +17,7 @@
 #include <Project64-core/N64System/Mips/RegisterClass.h>
 #include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
 #include <Project64-core/N64System/N64Class.h>
+#include <Project64-core/N64System/ByteSwap.h>
 #include <Project64-core/N64System/Mips/Transferpak.h>
 #include <Project64-core/N64System/Mips/Rumblepak.h>
 #include <Project64-core/N64System/Mips/Mempak.H>
@@ -314,10 +315,7 @@ void CPifRam::SI_DMA_READ()
     }
     else
     {
-        for (size_t i = 0; i < 64; i++)
-        {
-            RDRAM[(SI_DRAM_ADDR_REG + i) ^ 3] = PifRamPos[i];
-        }
+        CByteSwap::SwapWords(RDRAM + SI_DRAM_ADDR_REG, PifRamPos, 64);
     }
 
     if (LogPRDMAMemStores())
@@ -400,10 +398,7 @@ void CPifRam::SI_DMA_WRITE()
     }
     else
     {
-        for (size_t i = 0; i < 64; i++)
-        {
-            PifRamPos[i] = RDRAM[(SI_DRAM_ADDR_REG + i) ^ 3];
-        }
+        CByteSwap::SwapWords(PifRamPos, RDRAM + SI_DRAM_ADDR_REG, 64);
     }
 
     if (LogPRDMAMemLoads())
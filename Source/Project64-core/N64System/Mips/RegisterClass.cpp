@@ -313,8 +313,12 @@ void CRegisters::CheckInterrupts()
         mi_intr_reg &= ~MI_INTR_AI;
         mi_intr_reg |= (m_AudioIntrReg & MI_INTR_AI);
     }
-    mi_intr_reg |= (m_RspIntrReg & MI_INTR_SP);
-    mi_intr_reg |= (m_GfxIntrReg & MI_INTR_DP);
+    if (!m_System->RspTaskBusy())
+    {
+        // The task thread owns these until the cpu syncs with it
+        mi_intr_reg |= (m_RspIntrReg & MI_INTR_SP);
+        mi_intr_reg |= (m_GfxIntrReg & MI_INTR_DP);
+    }
     if ((MI_INTR_MASK_REG & mi_intr_reg) != 0)
     {
         FAKE_CAUSE_REGISTER |= CAUSE_IP2;
@@ -0,0 +1,289 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#include "stdafx.h"
+#include <Project64-core/N64System/Mips/SaveMedia.h>
+#include <Project64-core/N64System/ByteSwap.h>
+#include <Common/HighResTimeStamp.h>
+#include <Common/path.h>
+#include <Common/Util.h>
+#include <stdio.h>
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+enum
+{
+    FLUSH_POLL_MS = 100,
+    FLUSH_IDLE_US = 500 * 1000, // write back once the game has not saved for this long
+};
+
+CSaveMedia::MEDIA_LIST CSaveMedia::m_OpenMedia;
+CriticalSection CSaveMedia::m_OpenMediaCS;
+CThread * CSaveMedia::m_FlushThread = NULL;
+volatile bool CSaveMedia::m_FlushThreadStop = false;
+
+CSaveMedia::CSaveMedia() :
+m_Open(false),
+m_ReadOnly(false),
+m_Dirty(false),
+m_LastWrite(0)
+{
+}
+
+CSaveMedia::~CSaveMedia()
+{
+    Close();
+}
+
+bool CSaveMedia::Open(const char * FileName, bool ReadOnly)
+{
+    Close();
+
+    m_Image.clear();
+    CPath SaveFile(FileName);
+    if (SaveFile.Exists())
+    {
+        CFile File;
+        if (!File.Open(FileName, CFileBase::modeRead))
+        {
+            return false;
+        }
+        m_Image.resize(File.GetLength());
+        if (!m_Image.empty() && File.Read(&m_Image[0], (uint32_t)m_Image.size()) != m_Image.size())
+        {
+            m_Image.clear();
+            return false;
+        }
+    }
+    m_FileName = FileName;
+    m_ReadOnly = ReadOnly;
+    m_Dirty = false;
+    m_Open = true;
+
+    if (!m_ReadOnly)
+    {
+        CGuard Guard(m_OpenMediaCS);
+        m_OpenMedia.insert(this);
+        StartFlushThread();
+    }
+    WriteTrace(TraceN64System, TraceDebug, "%s loaded (size: 0x%X)", FileName, (uint32_t)m_Image.size());
+    return true;
+}
+
+void CSaveMedia::Close(void)
+{
+    if (!m_Open)
+    {
+        return;
+    }
+
+    bool StopThread = false;
+    {
+        CGuard Guard(m_OpenMediaCS);
+        if (m_OpenMedia.erase(this) != 0)
+        {
+            StopThread = m_OpenMedia.empty();
+        }
+    }
+    if (StopThread)
+    {
+        StopFlushThread();
+    }
+    Flush();
+    m_Open = false;
+}
+
+uint32_t CSaveMedia::Read(uint32_t Offset, uint8_t * Buffer, uint32_t Len) const
+{
+    if (Offset >= m_Image.size())
+    {
+        return 0;
+    }
+    if (Len > m_Image.size() - Offset)
+    {
+        Len = (uint32_t)m_Image.size() - Offset;
+    }
+    memcpy(Buffer, &m_Image[Offset], Len);
+    return Len;
+}
+
+void CSaveMedia::Write(uint32_t Offset, const uint8_t * Buffer, uint32_t Len)
+{
+    if (m_ReadOnly || Len == 0)
+    {
+        return;
+    }
+    CGuard Guard(m_CS);
+    Grow(Offset + Len);
+    memcpy(&m_Image[Offset], Buffer, Len);
+    Changed();
+}
+
+void CSaveMedia::ReadSwizzled(uint32_t Offset, uint8_t * Buffer, uint32_t BufferAddr, uint32_t Len) const
+{
+    if (Len == 0)
+    {
+        return;
+    }
+    if (((Offset + Len - 1) | 3) < m_Image.size())
+    {
+        CByteSwap::CopySwizzled(Buffer, BufferAddr, &m_Image[0], Offset, Len);
+        return;
+    }
+    for (uint32_t i = 0; i < Len; i++)
+    {
+        uint32_t Pos = (Offset + i) ^ 3;
+        if (Pos < m_Image.size())
+        {
+            Buffer[(BufferAddr + i) ^ 3] = m_Image[Pos];
+        }
+    }
+}
+
+void CSaveMedia::WriteSwizzled(uint32_t Offset, const uint8_t * Buffer, uint32_t BufferAddr, uint32_t Len)
+{
+    if (m_ReadOnly || Len == 0)
+    {
+        return;
+    }
+
+    // the highest byte touched is in the last word written, same size a
+    // byte at a time seek and write to the file would have left
+    uint32_t End = 0;
+    for (uint32_t i = Len > 4 ? Len - 4 : 0; i < Len; i++)
+    {
+        uint32_t Pos = ((Offset + i) ^ 3) + 1;
+        if (Pos > End) { End = Pos; }
+    }
+
+    CGuard Guard(m_CS);
+    Grow(End);
+    CByteSwap::CopySwizzled(&m_Image[0], Offset, Buffer, BufferAddr, Len);
+    Changed();
+}
+
+void CSaveMedia::Grow(uint32_t Length)
+{
+    if (m_Image.size() < Length)
+    {
+        m_Image.resize(Length, 0);
+    }
+}
+
+void CSaveMedia::Changed(void)
+{
+    HighResTimeStamp Now;
+    Now.SetToNow();
+    m_LastWrite = Now.GetMicroSeconds();
+    m_Dirty = true;
+}
+
+void CSaveMedia::Flush(void)
+{
+    CGuard FlushGuard(m_FlushCS);
+
+    std::vector<uint8_t> Image;
+    {
+        CGuard Guard(m_CS);
+        if (!m_Dirty)
+        {
+            return;
+        }
+        Image = m_Image;
+        m_Dirty = false;
+    }
+
+    stdstr TempFile = m_FileName + ".tmp";
+    CFile File;
+    bool Saved = File.Open(TempFile.c_str(), CFileBase::modeWrite | CFileBase::modeCreate);
+    if (Saved && !Image.empty())
+    {
+        Saved = File.Write(&Image[0], (uint32_t)Image.size());
+    }
+    if (Saved)
+    {
+        Saved = File.Flush();
+    }
+    File.Close();
+
+    if (Saved)
+    {
+#ifdef _WIN32
+        Saved = MoveFileExA(TempFile.c_str(), m_FileName.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+        Saved = rename(TempFile.c_str(), m_FileName.c_str()) == 0;
+#endif
+    }
+
+    if (!Saved)
+    {
+        WriteTrace(TraceN64System, TraceError, "Failed to write %s", m_FileName.c_str());
+        CGuard Guard(m_CS);
+        m_Dirty = true;
+        return;
+    }
+    WriteTrace(TraceN64System, TraceDebug, "%s written (size: 0x%X)", m_FileName.c_str(), (uint32_t)Image.size());
+}
+
+void CSaveMedia::FlushIfIdle(uint64_t Now)
+{
+    {
+        CGuard Guard(m_CS);
+        if (!m_Dirty || Now - m_LastWrite < FLUSH_IDLE_US)
+        {
+            return;
+        }
+    }
+    Flush();
+}
+
+void CSaveMedia::StartFlushThread(void)
+{
+    if (m_FlushThread != NULL)
+    {
+        return;
+    }
+    m_FlushThreadStop = false;
+    m_FlushThread = new CThread((CThread::CTHREAD_START_ROUTINE)FlushThreadProc);
+    m_FlushThread->Start(NULL);
+}
+
+void CSaveMedia::StopFlushThread(void)
+{
+    if (m_FlushThread == NULL)
+    {
+        return;
+    }
+    m_FlushThreadStop = true;
+    for (int i = 0; i < 500 && m_FlushThread->isRunning(); i++)
+    {
+        pjutil::Sleep(10);
+    }
+    delete m_FlushThread;
+    m_FlushThread = NULL;
+}
+
+void CSaveMedia::FlushThreadProc(void * /*Param*/)
+{
+    while (!m_FlushThreadStop)
+    {
+        pjutil::Sleep(FLUSH_POLL_MS);
+
+        HighResTimeStamp Now;
+        Now.SetToNow();
+
+        CGuard Guard(m_OpenMediaCS);
+        for (MEDIA_LIST::iterator itr = m_OpenMedia.begin(); itr != m_OpenMedia.end(); itr++)
+        {
+            (*itr)->FlushIfIdle(Now.GetMicroSeconds());
+        }
+    }
+}
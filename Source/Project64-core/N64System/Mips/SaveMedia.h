@@ -0,0 +1,70 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#pragma once
+#include <Common/CriticalSection.h>
+#include <Common/Thread.h>
+#include <set>
+#include <vector>
+
+// In memory image of a native save file (sram, flash ram, eeprom, mempak).
+// The emulation thread only touches memory, changes are written back to disk
+// by a background thread once the game stops writing for a moment, through a
+// temporary file that is renamed over the save so it is never left half written.
+class CSaveMedia
+{
+public:
+    CSaveMedia();
+    ~CSaveMedia();
+
+    bool Open(const char * FileName, bool ReadOnly);
+    void Close(void);
+    void Flush(void);
+
+    bool IsOpen(void) const { return m_Open; }
+    uint32_t GetLength(void) const { return (uint32_t)m_Image.size(); }
+
+    // Behave like a seek and read/write on the file, reads stop at the end of
+    // the image and writes past the end grow it
+    uint32_t Read(uint32_t Offset, uint8_t * Buffer, uint32_t Len) const;
+    void Write(uint32_t Offset, const uint8_t * Buffer, uint32_t Len);
+
+    // Byte i moves between image[(Offset + i) ^ 3] and Buffer[(BufferAddr + i) ^ 3]
+    void ReadSwizzled(uint32_t Offset, uint8_t * Buffer, uint32_t BufferAddr, uint32_t Len) const;
+    void WriteSwizzled(uint32_t Offset, const uint8_t * Buffer, uint32_t BufferAddr, uint32_t Len);
+
+private:
+    CSaveMedia(const CSaveMedia&);            // Disable copy constructor
+    CSaveMedia& operator=(const CSaveMedia&); // Disable assignment
+
+    typedef std::set<CSaveMedia *> MEDIA_LIST;
+
+    void Grow(uint32_t Length);
+    void Changed(void);
+    void FlushIfIdle(uint64_t Now);
+
+    static void StartFlushThread(void);
+    static void StopFlushThread(void);
+    static void FlushThreadProc(void * Param);
+
+    std::vector<uint8_t> m_Image;
+    stdstr m_FileName;
+    bool m_Open;
+    bool m_ReadOnly;
+    bool m_Dirty;
+    uint64_t m_LastWrite;
+    CriticalSection m_CS;
+    CriticalSection m_FlushCS;
+
+    static MEDIA_LIST m_OpenMedia;
+    static CriticalSection m_OpenMediaCS;
+    static CThread * m_FlushThread;
+    static volatile bool m_FlushThreadStop;
+};
@@ -34,7 +34,7 @@ bool CSram::LoadSram()
         FileName.DirectoryCreate();
     }
 
-    if (!m_File.Open(FileName, (m_ReadOnly ? CFileBase::modeRead : CFileBase::modeReadWrite) | CFileBase::modeNoTruncate | CFileBase::modeCreate))
+    if (!m_File.Open(FileName, m_ReadOnly))
     {
 #ifdef _WIN32
         WriteTrace(TraceN64System, TraceError, "Failed to open (%s), ReadOnly = %d, LastError = %X", (const char *)FileName, m_ReadOnly, GetLastError());
@@ -43,14 +43,11 @@ bool CSram::LoadSram()
 #endif
         return false;
     }
-    m_File.SeekToBegin();
     return true;
 }
 
 void CSram::DmaFromSram(uint8_t * dest, int32_t StartOffset, int32_t len)
 {
-    uint32_t i;
-
     if (!m_File.IsOpen())
     {
         if (!LoadSram())
@@ -62,25 +59,18 @@ void CSram::DmaFromSram(uint8_t * dest, int32_t StartOffset, int32_t len)
     // Fix Dezaemon 3D saves
     StartOffset = ((StartOffset >> 3) & 0xFFFF8000) | (StartOffset & 0x7FFF);
 
-    if (((StartOffset & 3) == 0) && ((((uint32_t)dest) & 3) == 0))
+    if (((StartOffset & 3) == 0) && ((((size_t)dest) & 3) == 0))
     {
-        m_File.Seek(StartOffset, CFile::begin);
-        m_File.Read(dest, len);
+        m_File.Read(StartOffset, dest, len);
     }
     else
     {
-        for (i = 0; i < len; i++)
-        {
-            m_File.Seek((StartOffset + i) ^ 3, CFile::begin);
-            m_File.Read((uint8_t*)(((uint32_t)dest + i) ^ 3), 1);
-        }
+        m_File.ReadSwizzled(StartOffset, dest - ((size_t)dest & 3), (uint32_t)((size_t)dest & 3), len);
     }
 }
 
 void CSram::DmaToSram(uint8_t * Source, int32_t StartOffset, int32_t len)
 {
-    uint32_t i;
-
     if (m_ReadOnly)
     {
         return;
@@ -97,17 +87,5 @@ void CSram::DmaToSram(uint8_t * Source, int32_t StartOffset, int32_t len)
     // Fix Dezaemon 3D saves
     StartOffset = ((StartOffset >> 3) & 0xFFFF8000) | (StartOffset & 0x7FFF);
 
-    if (((StartOffset & 3) == 0) && ((((uint32_t)Source) & 3) == 0) && NULL != NULL)
-    {
-        m_File.Seek(StartOffset, CFile::begin);
-        m_File.Write(Source, len);
-    }
-    else
-    {
-        for (i = 0; i < len; i++)
-        {
-            m_File.Seek((StartOffset + i) ^ 3, CFile::begin);
-            m_File.Write((uint8_t*)(((uint32_t)Source + i) ^ 3), 1);
-        }
-    }
+    m_File.WriteSwizzled(StartOffset, Source - ((size_t)Source & 3), (uint32_t)((size_t)Source & 3), len);
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 *                                                                           *
 ****************************************************************************/
 #pragma once
+#include <Project64-core/N64System/Mips/SaveMedia.h>
 
 class CSram
 {
@@ -27,5 +28,5 @@ private:
     bool LoadSram();
 
     bool m_ReadOnly;
-    CFile m_File;
+    CSaveMedia m_File;
 };
@@ -14,25 +14,19 @@
 #include <Project64-core/N64System/Mips/RegisterClass.h>
 #include <Project64-core/N64System/Mips/Disk.h>
 #include <Project64-core/N64System/N64Class.h>
+#include <Project64-core/N64System/SaveStateWriter.h>
 #include <Project64-core/3rdParty/zip.h>
 
 CSystemTimer::CSystemTimer(int32_t & NextTimer) :
-m_NextTimer(NextTimer),
-m_inFixTimer(false)
+CTimerSchedule(NextTimer)
 {
+    memset(m_Stats, 0, sizeof(m_Stats));
 }
 
 void CSystemTimer::Reset()
 {
-    //initialise Structure
-    for (int i = 0; i < MaxTimer; i++)
-    {
-        m_TimerDetatils[i].Active = false;
-        m_TimerDetatils[i].CyclesToTimer = 0;
-    }
-    m_Current = UnknownTimer;
-    m_LastUpdate = 0;
-    m_NextTimer = 0;
+    ResetTimers();
+    memset(m_Stats, 0, sizeof(m_Stats));
 
     SetTimer(ViTimer, 50000, false);
     SetCompareTimer();
@@ -45,25 +39,7 @@ void CSystemTimer::SetTimer(TimerType Type, uint32_t Cycles, bool bRelative)
         g_Notify->BreakPoint(__FILE__, __LINE__);
         return;
     }
-    UpdateTimers();
-
-    m_TimerDetatils[Type].Active = true;
-    if (bRelative)
-    {
-        if (m_TimerDetatils[Type].Active)
-        {
-            m_TimerDetatils[Type].CyclesToTimer += Cycles; //Add to the timer
-        }
-        else
-        {
-            m_TimerDetatils[Type].CyclesToTimer = (int64_t)Cycles - (int64_t)m_NextTimer;  //replace the new cycles
-        }
-    }
-    else
-    {
-        m_TimerDetatils[Type].CyclesToTimer = (int64_t)Cycles - (int64_t)m_NextTimer;  //replace the new cycles
-    }
-    FixTimers();
+    CTimerSchedule::SetTimer(Type, Cycles, bRelative);
 }
 
 uint32_t CSystemTimer::GetTimer(TimerType Type)
@@ -73,20 +49,7 @@ uint32_t CSystemTimer::GetTimer(TimerType Type)
         g_Notify->BreakPoint(__FILE__, __LINE__);
         return 0;
     }
-    if (!m_TimerDetatils[Type].Active)
-    {
-        return 0;
-    }
-    int64_t CyclesToTimer = m_TimerDetatils[Type].CyclesToTimer + m_NextTimer;
-    if (CyclesToTimer < 0)
-    {
-        return 0;
-    }
-    if (CyclesToTimer > 0x7FFFFFFF)
-    {
-        return 0x7FFFFFFF;
-    }
-    return (uint32_t)CyclesToTimer;
+    return CTimerSchedule::GetTimer(Type);
 }
 
 void CSystemTimer::StopTimer(TimerType Type)
@@ -96,94 +59,43 @@ void CSystemTimer::StopTimer(TimerType Type)
         g_Notify->BreakPoint(__FILE__, __LINE__);
         return;
     }
-    m_TimerDetatils[Type].Active = false;
-    FixTimers();
+    CTimerSchedule::StopTimer(Type);
 }
 
-void CSystemTimer::FixTimers()
+void CSystemTimer::CyclesTaken(int32_t TimeTaken)
 {
-    if (m_inFixTimer)
-    {
-        return;
-    }
-    m_inFixTimer = true;
-
-    UpdateTimers();
-    if (GetTimer(CompareTimer) > 0x60000000)
-    {
-        SetCompareTimer();
-    }
-
-    //Update the cycles for the remaining number of cycles to timer
-    int count;
-    for (count = 0; count < MaxTimer; count++)
+    int32_t random, wired;
+    g_Reg->COUNT_REGISTER += TimeTaken;
+    random = g_Reg->RANDOM_REGISTER - (TimeTaken / g_System->CountPerOp());
+    wired = g_Reg->WIRED_REGISTER;
+    if (random < wired)
     {
-        if (!m_TimerDetatils[count].Active)
+        if (wired == 0)
         {
-            continue;
-        }
-        m_TimerDetatils[count].CyclesToTimer += m_NextTimer;
-    }
-
-    //Set Max timer
-    m_NextTimer = 0x7FFFFFFF;
-
-    //Find the smallest timer left to go
-    for (count = 0; count < MaxTimer; count++)
-    {
-        if (!m_TimerDetatils[count].Active)
-        {
-            continue;
+            random &= 31;
         }
-        if (m_TimerDetatils[count].CyclesToTimer >= m_NextTimer)
-        {
-            continue;
-        }
-        m_NextTimer = (int)m_TimerDetatils[count].CyclesToTimer;
-        m_Current = (TimerType)count;
-    }
-
-    //Move the timer back this value
-    for (count = 0; count < MaxTimer; count++)
-    {
-        if (!m_TimerDetatils[count].Active)
+        else
         {
-            continue;
+            uint32_t increment = 32 - wired;
+            random += ((wired - random + increment - 1) / increment) * increment;
         }
-        m_TimerDetatils[count].CyclesToTimer -= m_NextTimer;
     }
-    m_LastUpdate = m_NextTimer;
-    m_inFixTimer = false;
+    g_Reg->RANDOM_REGISTER = random;
 }
 
-void CSystemTimer::UpdateTimers()
+void CSystemTimer::TimerDone()
 {
-    int TimeTaken = m_LastUpdate - m_NextTimer;
-    if (TimeTaken != 0)
+    if (m_Current > UnknownTimer && m_Current < MaxTimer)
     {
-        int32_t random, wired;
-        m_LastUpdate = m_NextTimer;
-        g_Reg->COUNT_REGISTER += TimeTaken;
-        random = g_Reg->RANDOM_REGISTER - (TimeTaken / g_System->CountPerOp());
-        wired = g_Reg->WIRED_REGISTER;
-        if (random < wired)
+        TIMER_STATS & Stats = m_Stats[m_Current];
+        uint32_t Late = m_NextTimer < 0 ? (uint32_t)(-m_NextTimer) : 0;
+        Stats.Fired += 1;
+        Stats.TotalLate += Late;
+        if (Late > Stats.MaxLate)
         {
-            if (wired == 0)
-            {
-                random &= 31;
-            }
-            else
-            {
-                uint32_t increment = 32 - wired;
-                random += ((wired - random + increment - 1) / increment) * increment;
-            }
+            Stats.MaxLate = Late;
         }
-        g_Reg->RANDOM_REGISTER = random;
     }
-}
-
-void CSystemTimer::TimerDone()
-{
     UpdateTimers();
 
     switch (m_Current)
@@ -241,6 +153,11 @@ void CSystemTimer::TimerDone()
         break;
     case CSystemTimer::RSPTimerDlist:
         g_SystemTimer->StopTimer(CSystemTimer::RSPTimerDlist);
+        if (g_System->RspTaskBusy())
+        {
+            g_System->SyncRSP();
+            break;
+        }
         g_Reg->m_GfxIntrReg |= MI_INTR_DP;
         g_Reg->CheckInterrupts();
         break;
@@ -262,18 +179,13 @@ void CSystemTimer::TimerDone()
     }*/
 }
 
-void CSystemTimer::SetCompareTimer()
+uint32_t CSystemTimer::CyclesToCompare()
 {
-    uint32_t NextCompare = 0x7FFFFFFF;
-    if (g_Reg)
+    if (g_Reg == NULL)
     {
-        NextCompare = g_Reg->COMPARE_REGISTER - g_Reg->COUNT_REGISTER;
-        if ((NextCompare & 0x80000000) != 0)
-        {
-            NextCompare = 0x7FFFFFFF;
-        }
+        return 0x7FFFFFFF;
     }
-    SetTimer(CompareTimer, NextCompare, false);
+    return g_Reg->COMPARE_REGISTER - g_Reg->COUNT_REGISTER;
 }
 
 void CSystemTimer::UpdateCompareTimer(void)
@@ -330,6 +242,19 @@ void CSystemTimer::SaveData(CFile & file) const
     file.Write((void *)&m_Current, sizeof(m_Current));
 }
 
+void CSystemTimer::SaveData(std::vector<uint8_t> & Data) const
+{
+    uint32_t TimerDetailsSize = sizeof(TIMER_DETAILS);
+    uint32_t Entries = sizeof(m_TimerDetatils) / sizeof(m_TimerDetatils[0]);
+
+    CSaveStateWriter::Append(Data, &TimerDetailsSize, sizeof(TimerDetailsSize));
+    CSaveStateWriter::Append(Data, &Entries, sizeof(Entries));
+    CSaveStateWriter::Append(Data, &m_TimerDetatils, sizeof(m_TimerDetatils));
+    CSaveStateWriter::Append(Data, &m_LastUpdate, sizeof(m_LastUpdate));
+    CSaveStateWriter::Append(Data, &m_NextTimer, sizeof(m_NextTimer));
+    CSaveStateWriter::Append(Data, &m_Current, sizeof(m_Current));
+}
+
 void CSystemTimer::LoadData(zipFile & file)
 {
     uint32_t TimerDetailsSize, Entries;
@@ -362,6 +287,7 @@ void CSystemTimer::LoadData(zipFile & file)
     unzReadCurrentFile(file, (void *)&m_LastUpdate, sizeof(m_LastUpdate));
     unzReadCurrentFile(file, &m_NextTimer, sizeof(m_NextTimer));
     unzReadCurrentFile(file, (void *)&m_Current, sizeof(m_Current));
+    m_CurrentIsNext = false;
 }
 
 void CSystemTimer::LoadData(CFile & file)
@@ -386,6 +312,7 @@ void CSystemTimer::LoadData(CFile & file)
     file.Read((void *)&m_LastUpdate, sizeof(m_LastUpdate));
     file.Read(&m_NextTimer, sizeof(m_NextTimer));
     file.Read((void *)&m_Current, sizeof(m_Current));
+    m_CurrentIsNext = false;
 }
 
 void CSystemTimer::RecordDifference(CLog &LogFile, const CSystemTimer& rSystemTimer)
@@ -12,36 +12,19 @@
 
 #include <Common/LogClass.h>
 #include <Project64-core/N64System/N64Types.h>
+#include <Project64-core/N64System/Mips/TimerSchedule.h>
 #include <Project64-core/3rdParty/zip.h>
+#include <vector>
 
-class CSystemTimer
+class CSystemTimer :
+    public CTimerSchedule
 {
 public:
-    enum TimerType
+    struct TIMER_STATS
     {
-        UnknownTimer,
-        CompareTimer,
-        SoftResetTimer,
-        ViTimer,
-        AiTimerInterrupt,
-        AiTimerBusy,
-        AiTimerDMA,
-        SiTimer,
-        PiTimer,
-        RspTimer,
-        RSPTimerDlist,
-        DDPiTimer,
-        MaxTimer
-    };
-
-    struct TIMER_DETAILS
-    {
-        union 
-        {
-            int64_t reserved;
-            bool Active;
-        };
-        int64_t CyclesToTimer;
+        uint32_t Fired;
+        uint32_t MaxLate;     //Most cycles the event was handled after it was due
+        uint64_t TotalLate;
     };
 
 public:
@@ -49,7 +32,6 @@ public:
     void      SetTimer(TimerType Type, uint32_t Cycles, bool bRelative);
     uint32_t  GetTimer(TimerType Type);
     void      StopTimer(TimerType Type);
-    void      UpdateTimers();
     void      TimerDone();
     void      Reset();
     void      UpdateCompareTimer();
@@ -57,12 +39,13 @@ public:
 
     void      SaveData(zipFile & file) const;
     void      SaveData(CFile & file) const;
+    void      SaveData(std::vector<uint8_t> & Data) const;
     void      LoadData(zipFile & file);
     void      LoadData(CFile & file);
 
     void RecordDifference(CLog &LogFile, const CSystemTimer& rSystemTimer);
 
-    TimerType CurrentType() const { return m_Current; }
+    const TIMER_STATS & Stats(TimerType Type) const { return m_Stats[Type]; }
 
     bool operator == (const CSystemTimer& rSystemTimer) const;
     bool operator != (const CSystemTimer& rSystemTimer) const;
@@ -72,12 +55,8 @@ private:
     CSystemTimer(const CSystemTimer&);            // Disable copy constructor
     CSystemTimer& operator=(const CSystemTimer&); // Disable assignment
 
-    TIMER_DETAILS m_TimerDetatils[MaxTimer];
-    int32_t       m_LastUpdate; //Timer at last update
-    int32_t     & m_NextTimer;
-    TimerType     m_Current;
-    bool          m_inFixTimer;
+    TIMER_STATS   m_Stats[MaxTimer];
 
-    void SetCompareTimer();
-    void FixTimers();
+    void     CyclesTaken(int32_t Cycles);
+    uint32_t CyclesToCompare();
 };
@@ -0,0 +1,71 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#include "stdafx.h"
+#include "TLBPageMap.h"
+
+CTLBPageMap::CTLBPageMap() :
+    m_KsegBase(0),
+    m_SectionsAllocated(0)
+{
+    memset(m_Empty, 0, sizeof(m_Empty));
+    for (uint32_t i = 0; i < SectionCount; i++)
+    {
+        m_Section[i] = m_Empty;
+    }
+}
+
+CTLBPageMap::~CTLBPageMap()
+{
+    FreeSections();
+}
+
+void CTLBPageMap::Reset(uint8_t * Rdram)
+{
+    FreeSections();
+    m_KsegBase = (size_t)Rdram;
+}
+
+void CTLBPageMap::Set(uint32_t VAddr, size_t Value)
+{
+    if ((VAddr & 0xC0000000) == 0x80000000)
+    {
+        // KSEG0/KSEG1 are never translated by the TLB
+        return;
+    }
+
+    size_t *& Section = m_Section[VAddr >> 20];
+    if (Section == m_Empty)
+    {
+        if (Value == 0)
+        {
+            return;
+        }
+        Section = new size_t[PagesPerSection];
+        memset(Section, 0, sizeof(size_t) * PagesPerSection);
+        m_SectionsAllocated += 1;
+    }
+    Section[(VAddr >> 12) & (PagesPerSection - 1)] = Value;
+}
+
+void CTLBPageMap::FreeSections(void)
+{
+    // Sections are kept once allocated since games tend to map the same
+    // ranges over and over, they are only released on reset
+    for (uint32_t i = 0; i < SectionCount && m_SectionsAllocated > 0; i++)
+    {
+        if (m_Section[i] != m_Empty)
+        {
+            delete[] m_Section[i];
+            m_Section[i] = m_Empty;
+            m_SectionsAllocated -= 1;
+        }
+    }
+}
@@ -0,0 +1,54 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#pragma once
+
+// Translates a virtual address to the value that has to be added to it to get
+// the host address in RDRAM, 0 when the page is not mapped.
+//
+// KSEG0 and KSEG1 are direct mapped so they are worked out from the address
+// without a table. The rest of the address space is split in to 1MB sections
+// of 256 pages, sections with nothing mapped in them all share one empty table
+// so only the sections the TLB actually uses take up memory.
+class CTLBPageMap
+{
+public:
+    CTLBPageMap();
+    ~CTLBPageMap();
+
+    void Reset(uint8_t * Rdram);
+    void Set(uint32_t VAddr, size_t Value);
+
+    inline size_t Lookup(uint32_t VAddr) const
+    {
+        if ((VAddr & 0xC0000000) == 0x80000000)
+        {
+            return m_KsegBase - (VAddr & 0xE0000000);
+        }
+        return m_Section[VAddr >> 20][(VAddr >> 12) & (PagesPerSection - 1)];
+    }
+
+private:
+    CTLBPageMap(const CTLBPageMap&);            // Disable copy constructor
+    CTLBPageMap& operator=(const CTLBPageMap&); // Disable assignment
+
+    enum
+    {
+        SectionCount = 0x1000,
+        PagesPerSection = 0x100,
+    };
+
+    void FreeSections(void);
+
+    size_t * m_Section[SectionCount];
+    size_t m_Empty[PagesPerSection];
+    size_t m_KsegBase;
+    uint32_t m_SectionsAllocated;
+};
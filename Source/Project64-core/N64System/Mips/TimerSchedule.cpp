@@ -0,0 +1,191 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#include "stdafx.h"
+#include "TimerSchedule.h"
+
+CTimerSchedule::CTimerSchedule(int32_t & NextTimer) :
+m_LastUpdate(0),
+m_NextTimer(NextTimer),
+m_Current(UnknownTimer),
+m_inFixTimer(false),
+m_CurrentIsNext(false),
+m_Reschedules(0),
+m_DeferredReschedules(0)
+{
+    memset(m_TimerDetatils, 0, sizeof(m_TimerDetatils));
+}
+
+void CTimerSchedule::ResetTimers()
+{
+    //initialise Structure
+    for (int i = 0; i < MaxTimer; i++)
+    {
+        m_TimerDetatils[i].Active = false;
+        m_TimerDetatils[i].CyclesToTimer = 0;
+    }
+    m_Current = UnknownTimer;
+    m_CurrentIsNext = false;
+    m_LastUpdate = 0;
+    m_NextTimer = 0;
+    m_Reschedules = 0;
+    m_DeferredReschedules = 0;
+}
+
+void CTimerSchedule::SetTimer(TimerType Type, uint32_t Cycles, bool bRelative)
+{
+    UpdateTimers();
+
+    m_TimerDetatils[Type].Active = true;
+    if (bRelative)
+    {
+        if (m_TimerDetatils[Type].Active)
+        {
+            m_TimerDetatils[Type].CyclesToTimer += Cycles; //Add to the timer
+        }
+        else
+        {
+            m_TimerDetatils[Type].CyclesToTimer = (int64_t)Cycles - (int64_t)m_NextTimer;  //replace the new cycles
+        }
+    }
+    else
+    {
+        m_TimerDetatils[Type].CyclesToTimer = (int64_t)Cycles - (int64_t)m_NextTimer;  //replace the new cycles
+    }
+    if (CanDeferFix(Type) && m_TimerDetatils[Type].CyclesToTimer > 0)
+    {
+        m_DeferredReschedules += 1;
+        return;
+    }
+    FixTimers();
+}
+
+uint32_t CTimerSchedule::GetTimer(TimerType Type) const
+{
+    if (!m_TimerDetatils[Type].Active)
+    {
+        return 0;
+    }
+    int64_t CyclesToTimer = m_TimerDetatils[Type].CyclesToTimer + m_NextTimer;
+    if (CyclesToTimer < 0)
+    {
+        return 0;
+    }
+    if (CyclesToTimer > 0x7FFFFFFF)
+    {
+        return 0x7FFFFFFF;
+    }
+    return (uint32_t)CyclesToTimer;
+}
+
+void CTimerSchedule::StopTimer(TimerType Type)
+{
+    m_TimerDetatils[Type].Active = false;
+    if (CanDeferFix(Type))
+    {
+        UpdateTimers();
+        m_DeferredReschedules += 1;
+        return;
+    }
+    FixTimers();
+}
+
+void CTimerSchedule::UpdateTimers()
+{
+    int TimeTaken = m_LastUpdate - m_NextTimer;
+    if (TimeTaken != 0)
+    {
+        m_LastUpdate = m_NextTimer;
+        CyclesTaken(TimeTaken);
+    }
+}
+
+void CTimerSchedule::SetCompareTimer()
+{
+    uint32_t NextCompare = CyclesToCompare();
+    if ((NextCompare & 0x80000000) != 0)
+    {
+        NextCompare = 0x7FFFFFFF;
+    }
+    SetTimer(CompareTimer, NextCompare, false);
+}
+
+// When the timer being changed is not the one m_NextTimer is counting down to,
+// and the change leaves it due after that one, FixTimers would add and then
+// remove the same amount from every timer and pick the same next timer. Skip
+// the rebase in that case, it gets done when the next timer fires.
+bool CTimerSchedule::CanDeferFix(TimerType Type) const
+{
+    if (m_inFixTimer || !m_CurrentIsNext || Type == m_Current)
+    {
+        return false;
+    }
+    //FixTimers also re-arms the compare timer when it gets too far away
+    return GetTimer(CompareTimer) <= 0x60000000;
+}
+
+void CTimerSchedule::FixTimers()
+{
+    if (m_inFixTimer)
+    {
+        return;
+    }
+    m_inFixTimer = true;
+    m_Reschedules += 1;
+
+    UpdateTimers();
+    if (GetTimer(CompareTimer) > 0x60000000)
+    {
+        SetCompareTimer();
+    }
+
+    //Update the cycles for the remaining number of cycles to timer
+    int count;
+    for (count = 0; count < MaxTimer; count++)
+    {
+        if (!m_TimerDetatils[count].Active)
+        {
+            continue;
+        }
+        m_TimerDetatils[count].CyclesToTimer += m_NextTimer;
+    }
+
+    //Set Max timer
+    m_NextTimer = 0x7FFFFFFF;
+    m_CurrentIsNext = false;
+
+    //Find the smallest timer left to go
+    for (count = 0; count < MaxTimer; count++)
+    {
+        if (!m_TimerDetatils[count].Active)
+        {
+            continue;
+        }
+        if (m_TimerDetatils[count].CyclesToTimer >= m_NextTimer)
+        {
+            continue;
+        }
+        m_NextTimer = (int)m_TimerDetatils[count].CyclesToTimer;
+        m_Current = (TimerType)count;
+        m_CurrentIsNext = true;
+    }
+
+    //Move the timer back this value
+    for (count = 0; count < MaxTimer; count++)
+    {
+        if (!m_TimerDetatils[count].Active)
+        {
+            continue;
+        }
+        m_TimerDetatils[count].CyclesToTimer -= m_NextTimer;
+    }
+    m_LastUpdate = m_NextTimer;
+    m_inFixTimer = false;
+}
@@ -0,0 +1,88 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#pragma once
+
+// Cycle arithmetic for the system timers. Each active timer holds the cycles
+// left to it less NextTimer, which the cpu counts down to the earliest timer.
+// What happens when a timer fires, and the count and compare registers, are
+// left to the class deriving from this one.
+class CTimerSchedule
+{
+public:
+    enum TimerType
+    {
+        UnknownTimer,
+        CompareTimer,
+        SoftResetTimer,
+        ViTimer,
+        AiTimerInterrupt,
+        AiTimerBusy,
+        AiTimerDMA,
+        SiTimer,
+        PiTimer,
+        RspTimer,
+        RSPTimerDlist,
+        DDPiTimer,
+        MaxTimer
+    };
+
+    struct TIMER_DETAILS
+    {
+        union 
+        {
+            int64_t reserved;
+            bool Active;
+        };
+        int64_t CyclesToTimer;
+    };
+
+public:
+    CTimerSchedule(int32_t & NextTimer);
+    virtual ~CTimerSchedule() {}
+
+    void      SetTimer(TimerType Type, uint32_t Cycles, bool bRelative);
+    uint32_t  GetTimer(TimerType Type) const;
+    void      StopTimer(TimerType Type);
+    void      UpdateTimers();
+
+    TimerType CurrentType() const { return m_Current; }
+    int32_t   LastUpdate() const { return m_LastUpdate; }
+    const TIMER_DETAILS & Details(TimerType Type) const { return m_TimerDetatils[Type]; }
+    uint32_t  Reschedules() const { return m_Reschedules; }
+    uint32_t  DeferredReschedules() const { return m_DeferredReschedules; }
+
+protected:
+    //Cycles that have gone by since the timers were last updated
+    virtual void     CyclesTaken(int32_t Cycles) = 0;
+    //Cycles until count reaches compare
+    virtual uint32_t CyclesToCompare() = 0;
+
+    void ResetTimers();
+    void SetCompareTimer();
+
+    TIMER_DETAILS m_TimerDetatils[MaxTimer];
+    int32_t       m_LastUpdate; //Timer at last update
+    int32_t     & m_NextTimer;
+    TimerType     m_Current;
+    bool          m_inFixTimer;
+    bool          m_CurrentIsNext; //m_Current is the earliest timer and m_NextTimer counts down to it
+
+    uint32_t      m_Reschedules;
+    uint32_t      m_DeferredReschedules;
+
+private:
+    CTimerSchedule(void);                             // Disable default constructor
+    CTimerSchedule(const CTimerSchedule&);            // Disable copy constructor
+    CTimerSchedule& operator=(const CTimerSchedule&); // Disable assignment
+
+    void FixTimers();
+    bool CanDeferFix(TimerType Type) const;
+};
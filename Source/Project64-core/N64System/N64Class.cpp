@@ -53,6 +53,8 @@ m_SyncPlugins(NULL),
 m_MMU_VM(SavesReadOnly),
 m_TLB(this),
 m_Reg(this, this),
+m_SamplingProfiler(m_Reg, m_MMU_VM),
+m_Benchmark(m_Reg, m_CPU_Usage),
 m_Recomp(NULL),
 m_InReset(false),
 m_NextTimer(0),
@@ -60,6 +62,10 @@ m_SystemTimer(m_NextTimer),
 m_bCleanFrameBox(true),
 m_bInitialized(false),
 m_RspBroke(true),
+m_AsyncDlistCycles(0),
+m_RspCycleSlice(0),
+m_RspTask(0),
+m_UseAudioHle(false),
 m_DMAUsed(false),
 m_TestTimer(false),
 m_NextInstruction(0),
@@ -632,6 +638,7 @@ void CN64System::Pause()
 
 void CN64System::GameReset()
 {
+    SyncRSP();
     m_SystemTimer.SetTimer(CSystemTimer::SoftResetTimer, 0x3000000, false);
     m_Plugins->Gfx()->ShowCFB();
     m_Reg.FAKE_CAUSE_REGISTER |= CAUSE_IP4;
@@ -644,6 +651,7 @@ void CN64System::GameReset()
 
 void CN64System::PluginReset()
 {
+    SyncRSP();
     if (!m_Plugins->ResetInUiThread(this))
     {
         g_Notify->DisplayMessage(5, MSG_PLUGIN_NOT_INIT);
@@ -681,6 +689,7 @@ void CN64System::Reset(bool bInitReg, bool ClearMenory)
 {
     WriteTrace(TraceN64System, TraceDebug, "Start (bInitReg: %s, ClearMenory: %s)", bInitReg ? "true" : "false", ClearMenory ? "true" : "false");
     g_Settings->SaveBool(GameRunning_InReset, true);
+    SyncRSP();
     RefreshGameSettings();
     m_Audio.Reset();
     m_MMU_VM.Reset(ClearMenory);
@@ -1056,12 +1065,25 @@ void CN64System::ExecuteCPU()
     _controlfp(_PC_53, _MCW_PC);
 #endif
 
-    switch ((CPU_TYPE)g_Settings->LoadDword(Game_CpuType))
+    CPU_TYPE CpuType = (CPU_TYPE)g_Settings->LoadDword(Game_CpuType);
+    if (g_Settings->LoadBool(Setting_SamplingProfiler))
+    {
+        m_SamplingProfiler.Start(CpuType != CPU_Interpreter);
+    }
+    m_Benchmark.Start();
+    //Sync cores compares two systems cycle by cycle, graphics tasks have to finish where they start
+    //Benchmark runs take it from the command line so the same build can be timed with and without it
+    m_AsyncDlistCycles = CpuType != CPU_SyncCores ? g_Settings->LoadDword(m_Benchmark.Running() ? Cmd_BenchmarkAsyncDlist : Setting_AsyncDlistCycles) : 0;
+    m_UseAudioHle = CpuType != CPU_SyncCores && g_Settings->LoadBool(Setting_BuiltInAudioHle);
+    m_RspCycleSlice = CpuType != CPU_SyncCores ? g_Settings->LoadDword(Setting_RspCycleSlice) : 0;
+    switch (CpuType)
     {
     case CPU_Recompiler: ExecuteRecompiler(); break;
     case CPU_SyncCores:  ExecuteSyncCPU();    break;
     default:             ExecuteInterpret();  break;
     }
+    SyncRSP();
+    m_SamplingProfiler.Stop();
     WriteTrace(TraceN64System, TraceDebug, "CPU finished executing");
     CpuStopped();
     WriteTrace(TraceN64System, TraceDebug, "Notifing plugins rom is done");
@@ -1076,7 +1098,14 @@ void CN64System::ExecuteCPU()
 void CN64System::ExecuteInterpret()
 {
     SetActiveSystem();
-    CInterpreterCPU::ExecuteCPU();
+    if (g_Settings->LoadBool(Setting_CachedInterpreter))
+    {
+        CInterpreterCPU::ExecuteCachedCPU();
+    }
+    else
+    {
+        CInterpreterCPU::ExecuteCPU();
+    }
 }
 
 void CN64System::ExecuteRecompiler()
@@ -1564,9 +1593,6 @@ bool CN64System::SaveState()
         SaveFile.SetNameExtension(stdstr_f("%s.%s", SaveFile.GetNameExtension().c_str(), target_ext.c_str()).c_str());
     }
 
-    CPath ExtraInfo(SaveFile);
-    ExtraInfo.SetExtension(".dat");
-
     CPath ZipFile(SaveFile);
     ZipFile.SetNameExtension(stdstr_f("%s.zip", ZipFile.GetNameExtension().c_str()).c_str());
 
@@ -1585,101 +1611,12 @@ bool CN64System::SaveState()
         }
     }
 
-    uint32_t SaveID_0 = 0x23D8A6C8, SaveID_1 = 0x56D2CD23;
-    uint32_t RdramSize = g_Settings->LoadDword(Game_RDRamSize);
     uint32_t MiInterReg = g_Reg->MI_INTR_REG;
-    uint32_t NextViTimer = m_SystemTimer.GetTimer(CSystemTimer::ViTimer);
-    if (g_Settings->LoadDword(Setting_AutoZipInstantSave))
-    {
-        ZipFile.Delete();
-        zipFile file = zipOpen(ZipFile, 0);
-        zipOpenNewFileInZip(file, SaveFile.GetNameExtension().c_str(), NULL, NULL, 0, NULL, 0, NULL, Z_DEFLATED, Z_DEFAULT_COMPRESSION);
-        zipWriteInFileInZip(file, &SaveID_0, sizeof(SaveID_0));
-        zipWriteInFileInZip(file, &RdramSize, sizeof(uint32_t));
-        zipWriteInFileInZip(file, g_Rom->GetRomAddress(), 0x40);
-        zipWriteInFileInZip(file, &NextViTimer, sizeof(uint32_t));
-        zipWriteInFileInZip(file, &m_Reg.m_PROGRAM_COUNTER, sizeof(m_Reg.m_PROGRAM_COUNTER));
-        zipWriteInFileInZip(file, m_Reg.m_GPR, sizeof(int64_t)* 32);
-        zipWriteInFileInZip(file, m_Reg.m_FPR, sizeof(int64_t)* 32);
-        zipWriteInFileInZip(file, m_Reg.m_CP0, sizeof(uint32_t)* 32);
-        zipWriteInFileInZip(file, m_Reg.m_FPCR, sizeof(uint32_t)* 32);
-        zipWriteInFileInZip(file, &m_Reg.m_HI, sizeof(int64_t));
-        zipWriteInFileInZip(file, &m_Reg.m_LO, sizeof(int64_t));
-        zipWriteInFileInZip(file, m_Reg.m_RDRAM_Registers, sizeof(uint32_t)* 10);
-        zipWriteInFileInZip(file, m_Reg.m_SigProcessor_Interface, sizeof(uint32_t)* 10);
-        zipWriteInFileInZip(file, m_Reg.m_Display_ControlReg, sizeof(uint32_t)* 10);
-        zipWriteInFileInZip(file, m_Reg.m_Mips_Interface, sizeof(uint32_t)* 4);
-        zipWriteInFileInZip(file, m_Reg.m_Video_Interface, sizeof(uint32_t)* 14);
-        zipWriteInFileInZip(file, m_Reg.m_Audio_Interface, sizeof(uint32_t)* 6);
-        zipWriteInFileInZip(file, m_Reg.m_Peripheral_Interface, sizeof(uint32_t)* 13);
-        zipWriteInFileInZip(file, m_Reg.m_RDRAM_Interface, sizeof(uint32_t)* 8);
-        zipWriteInFileInZip(file, m_Reg.m_SerialInterface, sizeof(uint32_t)* 4);
-        zipWriteInFileInZip(file, (void *const)&m_TLB.TlbEntry(0), sizeof(CTLB::TLB_ENTRY) * 32);
-        zipWriteInFileInZip(file, m_MMU_VM.PifRam(), 0x40);
-        zipWriteInFileInZip(file, m_MMU_VM.Rdram(), RdramSize);
-        zipWriteInFileInZip(file, m_MMU_VM.Dmem(), 0x1000);
-        zipWriteInFileInZip(file, m_MMU_VM.Imem(), 0x1000);
-        zipCloseFileInZip(file);
-
-        zipOpenNewFileInZip(file, ExtraInfo.GetNameExtension().c_str(), NULL, NULL, 0, NULL, 0, NULL, Z_DEFLATED, Z_DEFAULT_COMPRESSION);
-        zipWriteInFileInZip(file, &SaveID_1, sizeof(SaveID_1));
-        m_SystemTimer.SaveData(file);
-        zipCloseFileInZip(file);
-
-        zipClose(file, "");
-#if defined(ANDROID)
-        utimes((const char *)ZipFile, NULL);
-#endif
-    }
-    else
-    {
-        ExtraInfo.Delete();
-        SaveFile.Delete();
-        CFile hSaveFile(SaveFile, CFileBase::modeWrite | CFileBase::modeCreate);
-        if (!hSaveFile.IsOpen())
-        {
-            g_Notify->DisplayError(GS(MSG_FAIL_OPEN_SAVE));
-            m_Reg.MI_INTR_REG = MiInterReg;
-            WriteTrace(TraceN64System, TraceDebug, "Done - Failed to open");
-            return true;
-        }
+    std::vector<uint8_t> Image, ExtraInfoData;
+    SnapshotState(Image, ExtraInfoData);
 
-        //Write info to file
-        hSaveFile.SeekToBegin();
-        hSaveFile.Write(&SaveID_0, sizeof(uint32_t));
-        hSaveFile.Write(&RdramSize, sizeof(uint32_t));
-        hSaveFile.Write(g_Rom->GetRomAddress(), 0x40);
-        hSaveFile.Write(&NextViTimer, sizeof(uint32_t));
-        hSaveFile.Write(&m_Reg.m_PROGRAM_COUNTER, sizeof(m_Reg.m_PROGRAM_COUNTER));
-        hSaveFile.Write(m_Reg.m_GPR, sizeof(int64_t)* 32);
-        hSaveFile.Write(m_Reg.m_FPR, sizeof(int64_t)* 32);
-        hSaveFile.Write(m_Reg.m_CP0, sizeof(uint32_t)* 32);
-        hSaveFile.Write(m_Reg.m_FPCR, sizeof(uint32_t)* 32);
-        hSaveFile.Write(&m_Reg.m_HI, sizeof(int64_t));
-        hSaveFile.Write(&m_Reg.m_LO, sizeof(int64_t));
-        hSaveFile.Write(m_Reg.m_RDRAM_Registers, sizeof(uint32_t)* 10);
-        hSaveFile.Write(m_Reg.m_SigProcessor_Interface, sizeof(uint32_t)* 10);
-        hSaveFile.Write(m_Reg.m_Display_ControlReg, sizeof(uint32_t)* 10);
-        hSaveFile.Write(m_Reg.m_Mips_Interface, sizeof(uint32_t)* 4);
-        hSaveFile.Write(m_Reg.m_Video_Interface, sizeof(uint32_t)* 14);
-        hSaveFile.Write(m_Reg.m_Audio_Interface, sizeof(uint32_t)* 6);
-        hSaveFile.Write(m_Reg.m_Peripheral_Interface, sizeof(uint32_t)* 13);
-        hSaveFile.Write(m_Reg.m_RDRAM_Interface, sizeof(uint32_t)* 8);
-        hSaveFile.Write(m_Reg.m_SerialInterface, sizeof(uint32_t)* 4);
-        hSaveFile.Write(&g_TLB->TlbEntry(0), sizeof(CTLB::TLB_ENTRY) * 32);
-        hSaveFile.Write(g_MMU->PifRam(), 0x40);
-        hSaveFile.Write(g_MMU->Rdram(), RdramSize);
-        hSaveFile.Write(g_MMU->Dmem(), 0x1000);
-        hSaveFile.Write(g_MMU->Imem(), 0x1000);
-        hSaveFile.Close();
-
-        CFile hExtraInfo(ExtraInfo, CFileBase::modeWrite | CFileBase::modeCreate);
-        if (hExtraInfo.IsOpen())
-        {
-            m_SystemTimer.SaveData(hExtraInfo);
-            hExtraInfo.Close();
-        }
-    }
+    //Compress and write the copy on the save state thread
+    m_SaveStateWriter.Queue(SaveFile, g_Settings->LoadDword(Setting_AutoZipInstantSave) != 0, Image, ExtraInfoData);
     m_Reg.MI_INTR_REG = MiInterReg;
     g_Settings->SaveString(GameRunning_InstantSaveFile, "");
     g_Settings->SaveDword(Game_LastSaveTime, (uint32_t)time(NULL));
@@ -1709,12 +1646,6 @@ bool CN64System::SaveStateToFile(const char * FilePath)
     }
 
     CPath SaveFile(FilePath);
-    CPath ExtraInfo(SaveFile);
-    ExtraInfo.SetExtension(".dat");
-
-    CPath ZipFile(SaveFile);
-    ZipFile.SetNameExtension(stdstr_f("%s.zip", ZipFile.GetNameExtension().c_str()).c_str());
-
     //Make sure the target dir exists
     if (!SaveFile.DirectoryExists())
     {
@@ -1730,113 +1661,71 @@ bool CN64System::SaveStateToFile(const char * FilePath)
         }
     }
 
-    uint32_t SaveID_0 = 0x23D8A6C8, SaveID_1 = 0x56D2CD23;
-    uint32_t RdramSize = g_Settings->LoadDword(Game_RDRamSize);
     uint32_t MiInterReg = g_Reg->MI_INTR_REG;
-    uint32_t NextViTimer = m_SystemTimer.GetTimer(CSystemTimer::ViTimer);
-    
-    bool useZip = g_Settings->LoadDword(Setting_AutoZipInstantSave);
-    
-    if (useZip)
+    std::vector<uint8_t> Image, ExtraInfoData;
+    SnapshotState(Image, ExtraInfoData);
+
+    //Callers read the file straight back, so this is written before returning
+    if (!CSaveStateWriter::Write(SaveFile, g_Settings->LoadDword(Setting_AutoZipInstantSave) != 0, Image, ExtraInfoData))
     {
-        ZipFile.Delete();
-        zipFile file = zipOpen(ZipFile, 0);
-        if (!file)
-        {
-            m_Reg.MI_INTR_REG = MiInterReg;
-            WriteTrace(TraceN64System, TraceDebug, "Done - Failed to open zip file");
-            return false;
-        }
-        
-        zipOpenNewFileInZip(file, SaveFile.GetNameExtension().c_str(), NULL, NULL, 0, NULL, 0, NULL, Z_DEFLATED, Z_DEFAULT_COMPRESSION);
-        zipWriteInFileInZip(file, &SaveID_0, sizeof(SaveID_0));
-        zipWriteInFileInZip(file, &RdramSize, sizeof(uint32_t));
-        zipWriteInFileInZip(file, g_Rom->GetRomAddress(), 0x40);
-        zipWriteInFileInZip(file, &NextViTimer, sizeof(uint32_t));
-        zipWriteInFileInZip(file, &m_Reg.m_PROGRAM_COUNTER, sizeof(m_Reg.m_PROGRAM_COUNTER));
-        zipWriteInFileInZip(file, m_Reg.m_GPR, sizeof(int64_t)* 32);
-        zipWriteInFileInZip(file, m_Reg.m_FPR, sizeof(int64_t)* 32);
-        zipWriteInFileInZip(file, m_Reg.m_CP0, sizeof(uint32_t)* 32);
-        zipWriteInFileInZip(file, m_Reg.m_FPCR, sizeof(uint32_t)* 32);
-        zipWriteInFileInZip(file, &m_Reg.m_HI, sizeof(int64_t));
-        zipWriteInFileInZip(file, &m_Reg.m_LO, sizeof(int64_t));
-        zipWriteInFileInZip(file, m_Reg.m_RDRAM_Registers, sizeof(uint32_t)* 10);
-        zipWriteInFileInZip(file, m_Reg.m_SigProcessor_Interface, sizeof(uint32_t)* 10);
-        zipWriteInFileInZip(file, m_Reg.m_Display_ControlReg, sizeof(uint32_t)* 10);
-        zipWriteInFileInZip(file, m_Reg.m_Mips_Interface, sizeof(uint32_t)* 4);
-        zipWriteInFileInZip(file, m_Reg.m_Video_Interface, sizeof(uint32_t)* 14);
-        zipWriteInFileInZip(file, m_Reg.m_Audio_Interface, sizeof(uint32_t)* 6);
-        zipWriteInFileInZip(file, m_Reg.m_Peripheral_Interface, sizeof(uint32_t)* 13);
-        zipWriteInFileInZip(file, m_Reg.m_RDRAM_Interface, sizeof(uint32_t)* 8);
-        zipWriteInFileInZip(file, m_Reg.m_SerialInterface, sizeof(uint32_t)* 4);
-        zipWriteInFileInZip(file, (void *const)&m_TLB.TlbEntry(0), sizeof(CTLB::TLB_ENTRY) * 32);
-        zipWriteInFileInZip(file, m_MMU_VM.PifRam(), 0x40);
-        zipWriteInFileInZip(file, m_MMU_VM.Rdram(), RdramSize);
-        zipWriteInFileInZip(file, m_MMU_VM.Dmem(), 0x1000);
-        zipWriteInFileInZip(file, m_MMU_VM.Imem(), 0x1000);
-        zipCloseFileInZip(file);
-
-        zipOpenNewFileInZip(file, ExtraInfo.GetNameExtension().c_str(), NULL, NULL, 0, NULL, 0, NULL, Z_DEFLATED, Z_DEFAULT_COMPRESSION);
-        zipWriteInFileInZip(file, &SaveID_1, sizeof(SaveID_1));
-        m_SystemTimer.SaveData(file);
-        zipCloseFileInZip(file);
-
-        zipClose(file, "");
+        m_Reg.MI_INTR_REG = MiInterReg;
+        WriteTrace(TraceN64System, TraceDebug, "Done - Failed to open save file");
+        return false;
     }
-    else
-    {
-        ExtraInfo.Delete();
-        SaveFile.Delete();
-        CFile hSaveFile(SaveFile, CFileBase::modeWrite | CFileBase::modeCreate);
-        if (!hSaveFile.IsOpen())
-        {
-            m_Reg.MI_INTR_REG = MiInterReg;
-            WriteTrace(TraceN64System, TraceDebug, "Done - Failed to open save file");
-            return false;
-        }
 
-        //Write info to file
-        hSaveFile.SeekToBegin();
-        hSaveFile.Write(&SaveID_0, sizeof(uint32_t));
-        hSaveFile.Write(&RdramSize, sizeof(uint32_t));
-        hSaveFile.Write(g_Rom->GetRomAddress(), 0x40);
-        hSaveFile.Write(&NextViTimer, sizeof(uint32_t));
-        hSaveFile.Write(&m_Reg.m_PROGRAM_COUNTER, sizeof(m_Reg.m_PROGRAM_COUNTER));
-        hSaveFile.Write(m_Reg.m_GPR, sizeof(int64_t)* 32);
-        hSaveFile.Write(m_Reg.m_FPR, sizeof(int64_t)* 32);
-        hSaveFile.Write(m_Reg.m_CP0, sizeof(uint32_t)* 32);
-        hSaveFile.Write(m_Reg.m_FPCR, sizeof(uint32_t)* 32);
-        hSaveFile.Write(&m_Reg.m_HI, sizeof(int64_t));
-        hSaveFile.Write(&m_Reg.m_LO, sizeof(int64_t));
-        hSaveFile.Write(m_Reg.m_RDRAM_Registers, sizeof(uint32_t)* 10);
-        hSaveFile.Write(m_Reg.m_SigProcessor_Interface, sizeof(uint32_t)* 10);
-        hSaveFile.Write(m_Reg.m_Display_ControlReg, sizeof(uint32_t)* 10);
-        hSaveFile.Write(m_Reg.m_Mips_Interface, sizeof(uint32_t)* 4);
-        hSaveFile.Write(m_Reg.m_Video_Interface, sizeof(uint32_t)* 14);
-        hSaveFile.Write(m_Reg.m_Audio_Interface, sizeof(uint32_t)* 6);
-        hSaveFile.Write(m_Reg.m_Peripheral_Interface, sizeof(uint32_t)* 13);
-        hSaveFile.Write(m_Reg.m_RDRAM_Interface, sizeof(uint32_t)* 8);
-        hSaveFile.Write(m_Reg.m_SerialInterface, sizeof(uint32_t)* 4);
-        hSaveFile.Write(&g_TLB->TlbEntry(0), sizeof(CTLB::TLB_ENTRY) * 32);
-        hSaveFile.Write(g_MMU->PifRam(), 0x40);
-        hSaveFile.Write(g_MMU->Rdram(), RdramSize);
-        hSaveFile.Write(g_MMU->Dmem(), 0x1000);
-        hSaveFile.Write(g_MMU->Imem(), 0x1000);
-        hSaveFile.Close();
-
-        CFile hExtraInfo(ExtraInfo, CFileBase::modeWrite | CFileBase::modeCreate);
-        if (hExtraInfo.IsOpen())
-        {
-            m_SystemTimer.SaveData(hExtraInfo);
-            hExtraInfo.Close();
-        }
-    }
-    
     m_Reg.MI_INTR_REG = MiInterReg;
     WriteTrace(TraceN64System, TraceDebug, "Done - SaveStateToFile");
     return true;
 }
 
+void CN64System::SnapshotState(std::vector<uint8_t> & Image, std::vector<uint8_t> & ExtraInfo)
+{
+    SyncRSP();
+    FinishRspTask();
+
+    HighResTimeStamp StartTime;
+    StartTime.SetToNow();
+
+    uint32_t SaveID_0 = 0x23D8A6C8;
+    uint32_t RdramSize = g_Settings->LoadDword(Game_RDRamSize);
+    uint32_t NextViTimer = m_SystemTimer.GetTimer(CSystemTimer::ViTimer);
+
+    Image.clear();
+    Image.reserve(RdramSize + 0x3000);
+    CSaveStateWriter::Append(Image, &SaveID_0, sizeof(SaveID_0));
+    CSaveStateWriter::Append(Image, &RdramSize, sizeof(uint32_t));
+    CSaveStateWriter::Append(Image, g_Rom->GetRomAddress(), 0x40);
+    CSaveStateWriter::Append(Image, &NextViTimer, sizeof(uint32_t));
+    CSaveStateWriter::Append(Image, &m_Reg.m_PROGRAM_COUNTER, sizeof(m_Reg.m_PROGRAM_COUNTER));
+    CSaveStateWriter::Append(Image, m_Reg.m_GPR, sizeof(int64_t)* 32);
+    CSaveStateWriter::Append(Image, m_Reg.m_FPR, sizeof(int64_t)* 32);
+    CSaveStateWriter::Append(Image, m_Reg.m_CP0, sizeof(uint32_t)* 32);
+    CSaveStateWriter::Append(Image, m_Reg.m_FPCR, sizeof(uint32_t)* 32);
+    CSaveStateWriter::Append(Image, &m_Reg.m_HI, sizeof(int64_t));
+    CSaveStateWriter::Append(Image, &m_Reg.m_LO, sizeof(int64_t));
+    CSaveStateWriter::Append(Image, m_Reg.m_RDRAM_Registers, sizeof(uint32_t)* 10);
+    CSaveStateWriter::Append(Image, m_Reg.m_SigProcessor_Interface, sizeof(uint32_t)* 10);
+    CSaveStateWriter::Append(Image, m_Reg.m_Display_ControlReg, sizeof(uint32_t)* 10);
+    CSaveStateWriter::Append(Image, m_Reg.m_Mips_Interface, sizeof(uint32_t)* 4);
+    CSaveStateWriter::Append(Image, m_Reg.m_Video_Interface, sizeof(uint32_t)* 14);
+    CSaveStateWriter::Append(Image, m_Reg.m_Audio_Interface, sizeof(uint32_t)* 6);
+    CSaveStateWriter::Append(Image, m_Reg.m_Peripheral_Interface, sizeof(uint32_t)* 13);
+    CSaveStateWriter::Append(Image, m_Reg.m_RDRAM_Interface, sizeof(uint32_t)* 8);
+    CSaveStateWriter::Append(Image, m_Reg.m_SerialInterface, sizeof(uint32_t)* 4);
+    CSaveStateWriter::Append(Image, &m_TLB.TlbEntry(0), sizeof(CTLB::TLB_ENTRY) * 32);
+    CSaveStateWriter::Append(Image, m_MMU_VM.PifRam(), 0x40);
+    CSaveStateWriter::Append(Image, m_MMU_VM.Rdram(), RdramSize);
+    CSaveStateWriter::Append(Image, m_MMU_VM.Dmem(), 0x1000);
+    CSaveStateWriter::Append(Image, m_MMU_VM.Imem(), 0x1000);
+
+    ExtraInfo.clear();
+    m_SystemTimer.SaveData(ExtraInfo);
+
+    HighResTimeStamp EndTime;
+    EndTime.SetToNow();
+    WriteTrace(TraceN64System, TraceInfo, "Copied state (%d bytes) in %d us", (uint32_t)Image.size(), (uint32_t)(EndTime.GetMicroSeconds() - StartTime.GetMicroSeconds()));
+}
+
 bool CN64System::LoadState()
 {
     WriteTrace(TraceN64System, TraceDebug, "Start");
@@ -1908,6 +1797,13 @@ bool CN64System::LoadState(const char * FileName)
 {
     WriteTrace(TraceN64System, TraceDebug, "(%s): Start", FileName);
 
+    //A save of this slot may still be on its way to disk
+    m_SaveStateWriter.WaitForPending();
+    SyncRSP();
+
+    HighResTimeStamp StartTime;
+    StartTime.SetToNow();
+
     uint32_t Value, SaveRDRAMSize, NextVITimer = 0, old_status, old_width, old_dacrate;
     bool LoadedZipFile = false, AudioResetOnLoad;
     old_status = g_Reg->VI_STATUS_REG;
@@ -2072,6 +1968,10 @@ bool CN64System::LoadState(const char * FileName)
         }
     }
 
+    HighResTimeStamp EndTime;
+    EndTime.SetToNow();
+    WriteTrace(TraceN64System, TraceInfo, "Read %s (zip: %s) in %d us", FileName, LoadedZipFile ? "true" : "false", (uint32_t)(EndTime.GetMicroSeconds() - StartTime.GetMicroSeconds()));
+
     //Fix losing audio in certain games with certain plugins
     AudioResetOnLoad = g_Settings->LoadBool(Game_AudioResetOnLoad);
     if (AudioResetOnLoad)
@@ -2107,6 +2007,8 @@ bool CN64System::LoadState(const char * FileName)
     m_SystemTimer.SetTimer(CSystemTimer::CompareTimer, m_Reg.COMPARE_REGISTER - m_Reg.COUNT_REGISTER, false);
     m_SystemTimer.SetTimer(CSystemTimer::ViTimer, NextVITimer, false);
     m_Reg.FixFpuLocations();
+    //The plugin's part of a task left part way through is not in the save, the next task it runs is new to it
+    m_RspBroke = true;
     WriteTrace(TraceN64System, TraceDebug, "5");
     m_TLB.Reset(false);
     WriteTrace(TraceN64System, TraceDebug, "6");
@@ -2160,6 +2062,7 @@ void CN64System::RunRSP()
 {
     WriteTrace(TraceRSP, TraceDebug, "Start (SP Status %X)", m_Reg.SP_STATUS_REG);
 
+    SyncRSP();
     PROFILE_TIMERS CPU_UsageAddr = m_CPU_Usage.StopTimer();
 
     if ((m_Reg.SP_STATUS_REG & SP_STATUS_HALT) == 0)
@@ -2168,10 +2071,13 @@ void CN64System::RunRSP()
         {
             HighResTimeStamp StartTime;
 
-            uint32_t Task = 0;
+            //A task that gave up the RSP part way through carries on from SP_PC, it is not started again
+            uint32_t Task = m_RspTask;
+            bool Resume = !m_RspBroke;
             if (m_RspBroke)
             {
                 g_MMU->LW_VAddr(0xA4000FC0, Task);
+                m_RspTask = Task;
                 if (Task == 1 && (m_Reg.DPC_STATUS_REG & DPC_STATUS_FREEZE) != 0)
                 {
                     WriteTrace(TraceRSP, TraceDebug, "Dlist that is frozen");
@@ -2205,50 +2111,70 @@ void CN64System::RunRSP()
                 }
             }
 
-            __except_try()
-            {
-                WriteTrace(TraceRSP, TraceDebug, "do cycles - starting");
-                g_Plugins->RSP()->DoRspCycles(100);
-                WriteTrace(TraceRSP, TraceDebug, "do cycles - Done");
-            }
-            __except_catch()
-            {
-                WriteTrace(TraceRSP, TraceError, "exception generated");
-                g_Notify->FatalError("CN64System::RunRSP()\nUnknown memory action\n\nEmulation stop");
-            }
-
-            if (Task == 1 && bDelayDP() && ((m_Reg.m_GfxIntrReg & MI_INTR_DP) != 0))
+            if (!Resume && Task == 1 && m_AsyncDlistCycles != 0)
             {
-                g_SystemTimer->SetTimer(CSystemTimer::RSPTimerDlist, 0x1000, false);
-                m_Reg.m_GfxIntrReg &= ~MI_INTR_DP;
+                //The cpu carries on, the task is collected when the timer fires or something touches the RSP/RDP.
+                //The microcode, its data and the display list are write protected so a cpu store to them
+                //collects the task first. The buffers the task writes are left alone, the task thread
+                //faulting on them would only unprotect the page, and dmem is not tracked as the game has
+                //to read SP_STATUS, which collects the task, before it can know dmem is free.
+                const uint32_t * OsTask = (const uint32_t *)(g_MMU->Dmem() + 0xFC0);
+                m_RspTaskThread.TrackRdram(OsTask[4], OsTask[5]);
+                m_RspTaskThread.TrackRdram(OsTask[6], OsTask[7]);
+                m_RspTaskThread.TrackRdram(OsTask[12], OsTask[13]);
+                WriteTrace(TraceRSP, TraceDebug, "do cycles - started on task thread");
+                m_RspTaskThread.Start();
+                g_SystemTimer->SetTimer(CSystemTimer::RSPTimerDlist, m_AsyncDlistCycles, false);
             }
-            if (bRecordExecutionTimes() || bShowCPUPer())
+            else
             {
-                HighResTimeStamp EndTime;
-                EndTime.SetToNow();
-                uint32_t TimeTaken = (uint32_t)(EndTime.GetMicroSeconds() - StartTime.GetMicroSeconds());
-
-                switch (Task)
+                if (!Resume && Task == 2 && m_UseAudioHle && CAudioHle::Supported(g_MMU->Dmem(), g_MMU->Rdram(), g_MMU->RdramSize()))
                 {
-                case 1: m_CPU_Usage.RecordTime(Timer_RSP_Dlist, TimeTaken); break;
-                case 2: m_CPU_Usage.RecordTime(Timer_RSP_Alist, TimeTaken); break;
-                default: m_CPU_Usage.RecordTime(Timer_RSP_Unknown, TimeTaken); break;
+                    //Finish the task the way the microcode does, signal the task is done and break
+                    WriteTrace(TraceRSP, TraceDebug, "audio list - built in hle");
+                    m_AudioHle.ProcessTask(g_MMU->Dmem(), g_MMU->Rdram(), g_MMU->RdramSize());
+                    m_Reg.SP_STATUS_REG |= SP_STATUS_SIG2 | SP_STATUS_BROKE | SP_STATUS_HALT;
+                    if ((m_Reg.SP_STATUS_REG & SP_STATUS_INTR_BREAK) != 0)
+                    {
+                        m_Reg.m_RspIntrReg |= MI_INTR_SP;
+                    }
+                    m_Benchmark.CountAudioList(true);
+                }
+                else
+                {
+                    //A plugin that can not be told a task is new would carry on the last one after a reset or load
+                    CRSP_Plugin * RspPlugin = g_Plugins->RSP();
+                    if (!Resume && RspPlugin->StartTask != NULL)
+                    {
+                        RspPlugin->StartTask();
+                    }
+                    __except_try()
+                    {
+                        WriteTrace(TraceRSP, TraceDebug, "do cycles - starting");
+                        RspPlugin->DoRspCycles(m_RspCycleSlice != 0 && RspPlugin->StartTask != NULL ? m_RspCycleSlice : CRSP_Plugin::UnlimitedCycles);
+                        WriteTrace(TraceRSP, TraceDebug, "do cycles - Done");
+                    }
+                    __except_catch()
+                    {
+                        WriteTrace(TraceRSP, TraceError, "exception generated");
+                        g_Notify->FatalError("CN64System::RunRSP()\nUnknown memory action\n\nEmulation stop");
+                    }
+                    if (Task == 2 && !Resume)
+                    {
+                        m_Benchmark.CountAudioList(false);
+                    }
+                    m_Benchmark.CountRspSlice(Resume, (m_Reg.SP_STATUS_REG & (SP_STATUS_HALT | SP_STATUS_BROKE)) == 0);
                 }
-            }
 
-            if ((m_Reg.SP_STATUS_REG & SP_STATUS_HALT) == 0 &&
-                (m_Reg.SP_STATUS_REG & SP_STATUS_BROKE) == 0 &&
-                m_Reg.m_RspIntrReg == 0)
-            {
-                g_SystemTimer->SetTimer(CSystemTimer::RspTimer, 0x200, false);
-                m_RspBroke = false;
-            }
-            else
-            {
-                m_RspBroke = true;
+                uint32_t TimeTaken = 0;
+                if (bRecordExecutionTimes() || bShowCPUPer())
+                {
+                    HighResTimeStamp EndTime;
+                    EndTime.SetToNow();
+                    TimeTaken = (uint32_t)(EndTime.GetMicroSeconds() - StartTime.GetMicroSeconds());
+                }
+                RspTaskDone(Task, TimeTaken);
             }
-            WriteTrace(TraceRSP, TraceDebug, "check interrupts");
-            g_Reg->CheckInterrupts();
         }
     }
     if (bShowCPUPer())
@@ -2259,6 +2185,112 @@ void CN64System::RunRSP()
     WriteTrace(TraceRSP, TraceDebug, "Done (SP Status %X)", m_Reg.SP_STATUS_REG);
 }
 
+void CN64System::SyncRSP(bool WriteSync)
+{
+    if (!m_RspTaskThread.Busy() || m_RspTaskThread.OnTaskThread())
+    {
+        return;
+    }
+
+    HighResTimeStamp StartTime;
+    if (bRecordExecutionTimes() || bShowCPUPer())
+    {
+        StartTime.SetToNow();
+    }
+    m_RspTaskThread.Wait();
+    WriteTrace(TraceRSP, TraceDebug, "task thread finished (SP Status %X)", m_Reg.SP_STATUS_REG);
+
+    //Only the time the cpu was held up is recorded, the rest overlapped with emulation
+    uint32_t TimeTaken = 0;
+    if (bRecordExecutionTimes() || bShowCPUPer())
+    {
+        HighResTimeStamp EndTime;
+        EndTime.SetToNow();
+        TimeTaken = (uint32_t)(EndTime.GetMicroSeconds() - StartTime.GetMicroSeconds());
+    }
+    g_SystemTimer->StopTimer(CSystemTimer::RSPTimerDlist);
+    m_Benchmark.CountAsyncDlist(TimeTaken, WriteSync);
+    RspTaskDone(1, TimeTaken);
+}
+
+bool CN64System::RspTaskWriteFault(uint32_t MemAddress)
+{
+    //Called from the memory filter, the store that faulted is retried once this returns true
+    if (!m_RspTaskThread.WriteFault(MemAddress))
+    {
+        return false;
+    }
+    if (!m_RspTaskThread.OnTaskThread())
+    {
+        WriteTrace(TraceRSP, TraceDebug, "cpu write to %X while the task is reading it", MemAddress);
+        SyncRSP(true);
+    }
+    return true;
+}
+
+void CN64System::WaitForRspTask(void)
+{
+    if (g_System != NULL)
+    {
+        g_System->SyncRSP();
+    }
+}
+
+void CN64System::RspTaskDone(uint32_t Task, uint32_t TimeTaken)
+{
+    if (Task == 1 && bDelayDP() && ((m_Reg.m_GfxIntrReg & MI_INTR_DP) != 0))
+    {
+        g_SystemTimer->SetTimer(CSystemTimer::RSPTimerDlist, 0x1000, false);
+        m_Reg.m_GfxIntrReg &= ~MI_INTR_DP;
+    }
+    if (bRecordExecutionTimes() || bShowCPUPer())
+    {
+        switch (Task)
+        {
+        case 1: m_CPU_Usage.RecordTime(Timer_RSP_Dlist, TimeTaken); break;
+        case 2: m_CPU_Usage.RecordTime(Timer_RSP_Alist, TimeTaken); break;
+        default: m_CPU_Usage.RecordTime(Timer_RSP_Unknown, TimeTaken); break;
+        }
+    }
+
+    if ((m_Reg.SP_STATUS_REG & SP_STATUS_HALT) == 0 &&
+        (m_Reg.SP_STATUS_REG & SP_STATUS_BROKE) == 0 &&
+        m_Reg.m_RspIntrReg == 0)
+    {
+        //The task is still running, with a cycle slice the cpu gets a slice before the rsp carries on
+        g_SystemTimer->SetTimer(CSystemTimer::RspTimer, m_RspCycleSlice != 0 ? m_RspCycleSlice : 0x200, false);
+        m_RspBroke = false;
+    }
+    else
+    {
+        m_RspBroke = true;
+    }
+    WriteTrace(TraceRSP, TraceDebug, "check interrupts");
+    g_Reg->CheckInterrupts();
+}
+
+void CN64System::FinishRspTask()
+{
+    //The plugin holds the state of a task that ran out of its cycle slice, that is not
+    //in a save state so the task is run to the end before one is taken
+    if (m_RspBroke || (m_Reg.SP_STATUS_REG & (SP_STATUS_HALT | SP_STATUS_BROKE)) != 0)
+    {
+        return;
+    }
+    WriteTrace(TraceRSP, TraceDebug, "finishing task %d before saving", m_RspTask);
+    __except_try()
+    {
+        g_Plugins->RSP()->DoRspCycles(CRSP_Plugin::UnlimitedCycles);
+    }
+    __except_catch()
+    {
+        WriteTrace(TraceRSP, TraceError, "exception generated");
+        g_Notify->FatalError("CN64System::FinishRspTask()\nUnknown memory action\n\nEmulation stop");
+    }
+    m_Benchmark.CountRspSlice(true, (m_Reg.SP_STATUS_REG & (SP_STATUS_HALT | SP_STATUS_BROKE)) == 0);
+    RspTaskDone(m_RspTask, 0);
+}
+
 void CN64System::SyncToAudio()
 {
     if (!bSyncToAudio() || !bLimitFPS())
@@ -2325,6 +2357,8 @@ void CN64System::RefreshScreen()
         }
     }
 
+    //The graphics plugin may still be drawing the last display list
+    SyncRSP();
     if (bShowCPUPer()) { m_CPU_Usage.StartTimer(Timer_UpdateScreen); }
 
     __except_try()
@@ -2339,7 +2373,7 @@ void CN64System::RefreshScreen()
     }
     g_MMU->UpdateFieldSerration((m_Reg.VI_STATUS_REG & 0x40) != 0);
 
-    if ((bBasicMode() || bLimitFPS()) && !bSyncToAudio())
+    if ((bBasicMode() || bLimitFPS()) && !bSyncToAudio() && !m_Benchmark.Running())
     {
         if (bShowCPUPer()) { m_CPU_Usage.StartTimer(Timer_Idel); }
         uint32_t FrameRate;
@@ -2363,9 +2397,16 @@ void CN64System::RefreshScreen()
         m_bCleanFrameBox = false;
     }
 
+    if (m_Benchmark.Running() && m_Benchmark.ViRefresh())
+    {
+        CloseCpu();
+    }
     if (bShowCPUPer())
     {
-        m_CPU_Usage.ShowCPU_Usage();
+        if (!m_Benchmark.Running())
+        {
+            m_CPU_Usage.ShowCPU_Usage();
+        }
         m_CPU_Usage.StartTimer(CPU_UsageAddr != Timer_None ? CPU_UsageAddr : Timer_R4300);
     }
 
@@ -14,6 +14,11 @@
 #include <Common/Thread.h>
 #include <Project64-core/Settings/N64SystemSettings.h>
 #include <Project64-core/N64System/ProfilingClass.h>
+#include <Project64-core/N64System/Benchmark.h>
+#include <Project64-core/N64System/SamplingProfiler.h>
+#include <Project64-core/N64System/SaveStateWriter.h>
+#include <Project64-core/N64System/RspTaskThread.h>
+#include <Project64-core/N64System/AudioHle.h>
 #include <Project64-core/N64System/Recompiler/RecompilerClass.h>
 #include <Project64-core/N64System/Mips/Audio.h>
 #include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
@@ -79,6 +84,11 @@ public:
 
     void   Pause();
     void   RunRSP();
+    void   SyncRSP(bool WriteSync = false);
+    bool   RspTaskBusy() const { return m_RspTaskThread.Busy(); }
+    bool   AsyncDlist() const { return m_AsyncDlistCycles != 0; }
+    static void WaitForRspTask(void);
+    bool   RspTaskWriteFault(uint32_t MemAddress);
     bool   SaveState();
     bool   SaveStateToFile(const char * FilePath);
     bool   LoadState(const char * FileName);
@@ -128,10 +138,13 @@ private:
     void   DumpSyncErrors(CN64System * SecondCPU);
     void   StartEmulation2(bool NewThread);
     void   HandleDesyncDetection();
+    void   SnapshotState(std::vector<uint8_t> & Image, std::vector<uint8_t> & ExtraInfo);
     std::string GenerateDesyncSaveStateHash();
     bool   SetActiveSystem(bool bActive = true);
     void   InitRegisters(bool bPostPif, CMipsMemoryVM & MMU);
     void   DisplayRSPListCount();
+    void   RspTaskDone(uint32_t Task, uint32_t TimeTaken);
+    void   FinishRspTask();
 
     //CPU Methods
     void   ExecuteRecompiler();
@@ -154,6 +167,11 @@ private:
     CMempak         m_Mempak;
     CFramePerSecond m_FPS;
     CProfiling      m_CPU_Usage; //used to track the cpu usage
+    CSamplingProfiler m_SamplingProfiler;
+    CBenchmark      m_Benchmark;
+    CSaveStateWriter m_SaveStateWriter;
+    CRspTaskThread  m_RspTaskThread;
+    CAudioHle       m_AudioHle;
     CRecompiler   * m_Recomp;
     CAudio          m_Audio;
     CSpeedLimiter   m_Limiter;
@@ -163,6 +181,10 @@ private:
     bool            m_bCleanFrameBox;
     bool            m_bInitialized;
     bool            m_RspBroke;
+    uint32_t        m_AsyncDlistCycles;
+    uint32_t        m_RspCycleSlice;
+    uint32_t        m_RspTask;
+    bool            m_UseAudioHle;
     bool            m_DMAUsed;
     uint32_t        m_Buttons[4];
     bool            m_TestTimer;
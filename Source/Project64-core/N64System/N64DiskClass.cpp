@@ -11,6 +11,7 @@
 #include "stdafx.h"
 #include "N64DiskClass.h"
 #include "SystemGlobals.h"
+#include "ByteSwap.h"
 #include <Common/Platform.h>
 #include <Common/SmartPointer.h>
 #include <Common/MemoryManagement.h>
@@ -245,21 +246,11 @@ bool CN64Disk::AllocateAndLoadDiskImage(const char * FileLoc)
 
 void CN64Disk::ByteSwapDisk()
 {
-    uint32_t count;
-
     switch (*((uint32_t *)&m_DiskImage[0]))
     {
     case 0x16D348E8:
     case 0x56EE6322:
-        for (count = 0; count < m_DiskFileSize; count += 4)
-        {
-            m_DiskImage[count] ^= m_DiskImage[count + 3];
-            m_DiskImage[count + 3] ^= m_DiskImage[count];
-            m_DiskImage[count] ^= m_DiskImage[count + 3];
-            m_DiskImage[count + 1] ^= m_DiskImage[count + 2];
-            m_DiskImage[count + 2] ^= m_DiskImage[count + 1];
-            m_DiskImage[count + 1] ^= m_DiskImage[count + 2];
-        }
+        CByteSwap::SwapWords(m_DiskImage, m_DiskImage, m_DiskFileSize);
         break;
     case 0xE848D316: break;
     case 0x2263EE56: break;
@@ -270,17 +261,7 @@ void CN64Disk::ByteSwapDisk()
 
 void CN64Disk::ForceByteSwapDisk()
 {
-    uint32_t count;
-
-    for (count = 0; count < m_DiskFileSize; count += 4)
-    {
-        m_DiskImage[count] ^= m_DiskImage[count + 3];
-        m_DiskImage[count + 3] ^= m_DiskImage[count];
-        m_DiskImage[count] ^= m_DiskImage[count + 3];
-        m_DiskImage[count + 1] ^= m_DiskImage[count + 2];
-        m_DiskImage[count + 2] ^= m_DiskImage[count + 1];
-        m_DiskImage[count + 1] ^= m_DiskImage[count + 2];
-    }
+    CByteSwap::SwapWords(m_DiskImage, m_DiskImage, m_DiskFileSize);
 }
 
 void CN64Disk::SetError(LanguageStringID ErrorMsg)
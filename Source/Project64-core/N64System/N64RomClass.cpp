@@ -11,8 +11,10 @@
 #include "stdafx.h"
 #include "N64RomClass.h"
 #include "SystemGlobals.h"
+#include "ByteSwap.h"
 #include <Project64-core/3rdParty/zip.h>
 #include <Common/md5.h>
+#include <Common/HighResTimeStamp.h>
 #include <Common/Platform.h>
 #include <Common/MemoryManagement.h>
 #include <Common/SmartPointer.h>
@@ -96,10 +98,13 @@ bool CN64Rom::AllocateAndLoadN64Image(const char * FileLoc, bool LoadBootCodeOnl
         return false;
     }
 
-    //Load the n64 rom to the allocated memory
+    //Load the n64 rom to the allocated memory, each section is converted to
+    //native order and hashed as soon as it is read so the image is only walked once
     g_Notify->DisplayMessage(5, MSG_LOADING);
     m_RomFile.SeekToBegin();
 
+    uint32_t Ident = *((uint32_t *)&Test[0]);
+    MD5 RomHash;
     uint32_t count, TotalRead = 0;
     for (count = 0; count < (int)RomFileSize; count += ReadFromRomSection)
     {
@@ -114,6 +119,11 @@ bool CN64Rom::AllocateAndLoadN64Image(const char * FileLoc, bool LoadBootCodeOnl
             return false;
         }
         TotalRead += dwToRead;
+        ByteSwapRomSection(Ident, &m_ROMImage[count], dwToRead);
+        if (!LoadBootCodeOnly)
+        {
+            RomHash.update(&m_ROMImage[count], dwToRead);
+        }
 
         //Show Message of how much % wise of the rom has been loaded
         g_Notify->DisplayMessage(0, stdstr_f("%s: %.2f%c", GS(MSG_LOADED), ((float)TotalRead / (float)RomFileSize) * 100.0f, '%').c_str());
@@ -127,8 +137,11 @@ bool CN64Rom::AllocateAndLoadN64Image(const char * FileLoc, bool LoadBootCodeOnl
         return false;
     }
 
-    g_Notify->DisplayMessage(5, MSG_BYTESWAP);
-    ByteSwapRom();
+    if (!LoadBootCodeOnly)
+    {
+        RomHash.finalize();
+        m_MD5 = RomHash.hex_digest();
+    }
 
     //Protect the memory so that it can not be written to.
     ProtectMemory(m_ROMImage, m_RomFileSize, MEM_READONLY);
@@ -182,10 +195,14 @@ bool CN64Rom::AllocateAndLoadZipImage(const char * FileLoc, bool LoadBootCodeOnl
                 return false;
             }
 
-            //Load the n64 rom to the allocated memory
+            //Load the n64 rom to the allocated memory, converting and hashing
+            //every whole word as soon as it has been decompressed
             g_Notify->DisplayMessage(5, MSG_LOADING);
             memcpy(m_ROMImage, Test, 4);
 
+            uint32_t Ident = *((uint32_t *)&Test[0]);
+            MD5 RomHash;
+            uint32_t Converted = 0;
             uint32_t dwRead, count, TotalRead = 0;
             for (count = 4; count < (int)RomFileSize; count += ReadFromRomSection)
             {
@@ -201,6 +218,14 @@ bool CN64Rom::AllocateAndLoadZipImage(const char * FileLoc, bool LoadBootCodeOnl
                 }
                 TotalRead += dwRead;
 
+                uint32_t Ready = (count + dwRead) & ~3;
+                ByteSwapRomSection(Ident, &m_ROMImage[Converted], Ready - Converted);
+                if (!LoadBootCodeOnly)
+                {
+                    RomHash.update(&m_ROMImage[Converted], Ready - Converted);
+                }
+                Converted = Ready;
+
                 //Show Message of how much % wise of the rom has been loaded
                 g_Notify->DisplayMessage(5, stdstr_f("%s: %.2f%c", GS(MSG_LOADED), ((float)TotalRead / (float)RomFileSize) * 100.0f, '%').c_str());
             }
@@ -215,8 +240,12 @@ bool CN64Rom::AllocateAndLoadZipImage(const char * FileLoc, bool LoadBootCodeOnl
             }
             FoundRom = true;
 
-            g_Notify->DisplayMessage(5, MSG_BYTESWAP);
-            ByteSwapRom();
+            if (!LoadBootCodeOnly)
+            {
+                RomHash.update(&m_ROMImage[Converted], RomFileSize - Converted);
+                RomHash.finalize();
+                m_MD5 = RomHash.hex_digest();
+            }
 
             //Protect the memory so that it can not be written to.
             ProtectMemory(m_ROMImage, m_RomFileSize, MEM_READONLY);
@@ -235,37 +264,28 @@ bool CN64Rom::AllocateAndLoadZipImage(const char * FileLoc, bool LoadBootCodeOnl
 
 void CN64Rom::ByteSwapRom()
 {
-    uint32_t count;
+    if (!ByteSwapRomSection(*((uint32_t *)&m_ROMImage[0]), m_ROMImage, m_RomFileSize))
+    {
+        g_Notify->DisplayError(stdstr_f("ByteSwapRom: %X", m_ROMImage[0]).c_str());
+    }
+}
 
-    switch (*((uint32_t *)&m_ROMImage[0]))
+bool CN64Rom::ByteSwapRomSection(uint32_t Ident, uint8_t * Section, uint32_t Len)
+{
+    switch (Ident)
     {
     case 0x12408037:
-        for (count = 0; count < m_RomFileSize; count += 4)
-        {
-            m_ROMImage[count] ^= m_ROMImage[count + 2];
-            m_ROMImage[count + 2] ^= m_ROMImage[count];
-            m_ROMImage[count] ^= m_ROMImage[count + 2];
-            m_ROMImage[count + 1] ^= m_ROMImage[count + 3];
-            m_ROMImage[count + 3] ^= m_ROMImage[count + 1];
-            m_ROMImage[count + 1] ^= m_ROMImage[count + 3];
-        }
+        CByteSwap::SwapHalfWords(Section, Section, Len);
         break;
     case 0x40072780: //64DD IPL
     case 0x40123780:
-        for (count = 0; count < m_RomFileSize; count += 4)
-        {
-            m_ROMImage[count] ^= m_ROMImage[count + 3];
-            m_ROMImage[count + 3] ^= m_ROMImage[count];
-            m_ROMImage[count] ^= m_ROMImage[count + 3];
-            m_ROMImage[count + 1] ^= m_ROMImage[count + 2];
-            m_ROMImage[count + 2] ^= m_ROMImage[count + 1];
-            m_ROMImage[count + 1] ^= m_ROMImage[count + 2];
-        }
+        CByteSwap::SwapWords(Section, Section, Len);
         break;
     case 0x80371240: break;
     default:
-        g_Notify->DisplayError(stdstr_f("ByteSwapRom: %X", m_ROMImage[0]).c_str());
+        return false;
     }
+    return true;
 }
 
 CICChip CN64Rom::GetCicChipID(uint8_t * RomData, uint64_t * CRC)
@@ -467,9 +487,12 @@ void CN64Rom::NotificationCB(const char * Status, CN64Rom * /*_this*/)
 bool CN64Rom::LoadN64Image(const char * FileLoc, bool LoadBootCodeOnly)
 {
     WriteTrace(TraceN64System, TraceDebug, "Start (FileLoc: \"%s\" LoadBootCodeOnly: %s)", FileLoc, LoadBootCodeOnly ? "true" : "false");
+    HighResTimeStamp StartTime;
+    StartTime.SetToNow();
 
     UnallocateRomImage();
     m_ErrorMsg = EMPTY_STRING;
+    m_MD5 = "";
 
     stdstr ext = CPath(FileLoc).GetExtension();
     bool Loaded7zFile = false;
@@ -590,9 +613,8 @@ bool CN64Rom::LoadN64Image(const char * FileLoc, bool LoadBootCodeOnly)
 
     m_RomName = RomName;
     m_FileName = FileLoc;
-    m_MD5 = "";
 
-    if (!LoadBootCodeOnly)
+    if (!LoadBootCodeOnly && m_MD5.empty())
     {
         //Calculate files MD5
         m_MD5 = MD5((const unsigned char *)m_ROMImage, m_RomFileSize).hex_digest();
@@ -616,6 +638,9 @@ bool CN64Rom::LoadN64Image(const char * FileLoc, bool LoadBootCodeOnly)
         CalculateRomCrc();
     }
 
+    HighResTimeStamp EndTime;
+    EndTime.SetToNow();
+    WriteTrace(TraceN64System, TraceInfo, "Rom loaded in %d ms (size: 0x%X)", (uint32_t)((EndTime.GetMicroSeconds() - StartTime.GetMicroSeconds()) / 1000), m_RomFileSize);
     WriteTrace(TraceN64System, TraceDebug, "Done (res: true)");
     return true;
 }
@@ -624,6 +649,7 @@ bool CN64Rom::LoadN64ImageIPL(const char * FileLoc, bool LoadBootCodeOnly)
 {
     UnallocateRomImage();
     m_ErrorMsg = EMPTY_STRING;
+    m_MD5 = "";
 
     stdstr ext = CPath(FileLoc).GetExtension();
     bool Loaded7zFile = false;
@@ -734,9 +760,8 @@ bool CN64Rom::LoadN64ImageIPL(const char * FileLoc, bool LoadBootCodeOnly)
 
     m_RomName = RomName;
     m_FileName = FileLoc;
-    m_MD5 = "";
 
-    if (!LoadBootCodeOnly)
+    if (!LoadBootCodeOnly && m_MD5.empty())
     {
         //Calculate files MD5
         m_MD5 = MD5((const unsigned char *)m_ROMImage, m_RomFileSize).hex_digest();
@@ -45,6 +45,7 @@ private:
     bool   AllocateAndLoadN64Image(const char * FileLoc, bool LoadBootCodeOnly);
     bool   AllocateAndLoadZipImage(const char * FileLoc, bool LoadBootCodeOnly);
     void   ByteSwapRom();
+    static bool ByteSwapRomSection(uint32_t Ident, uint8_t * Section, uint32_t Len);
     void   SetError(LanguageStringID ErrorMsg);
     static void NotificationCB(const char * Status, CN64Rom * _this);
     void   CalculateCicChip();
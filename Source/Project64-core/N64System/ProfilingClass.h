@@ -19,6 +19,7 @@ public:
 
     void RecordTime(PROFILE_TIMERS timer, uint32_t time);
     uint64_t NonCPUTime(void);
+    uint64_t TimeTaken(PROFILE_TIMERS timer) const { return m_Timers[timer]; }
 
     //recording timing against current timer, returns the address of the timer stopped
     PROFILE_TIMERS StartTimer(PROFILE_TIMERS TimerType);
@@ -15,7 +15,7 @@
 #include <Project64-core/N64System/Mips/Disk.h>
 #include <Project64-core/N64System/Mips/OpcodeName.h>
 #include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
-#include <Project64-core/N64System/Interpreter/InterpreterOps32.h>
+#include <Project64-core/N64System/Interpreter/InterpreterOps.h>
 #include <Project64-core/N64System/Interpreter/InterpreterCPU.h>
 #include <Project64-core/N64System/Recompiler/RecompilerCodeLog.h>
 #include <Project64-core/N64System/Recompiler/SectionInfo.h>
@@ -148,7 +148,7 @@ void CArmRecompilerOps::Compile_Branch(BRANCH_COMPARE CompareType, BRANCH_TYPE B
             case BranchTypeRsRt: EffectDelaySlot = DelaySlotEffectsCompare(m_CompilePC, m_Opcode.rs, m_Opcode.rt); break;
             case BranchTypeCop1:
 
-                if (!g_MMU->LW_VAddr(m_CompilePC + 4, Command.Hex))
+                if (!CRecompiler::LoadCodeWord(m_CompilePC + 4, Command.Hex))
                 {
                     g_Notify->FatalError(GS(MSG_FAIL_LOAD_WORD));
                 }
@@ -1925,11 +1925,11 @@ void CArmRecompilerOps::SLTI()
     if (m_Opcode.rs != 0) { WriteBack_GPR(m_Opcode.rs, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SLTI, "R4300iOp32::SLTI");
+        CompileInterpterCall((void *)R4300iOp::SLTI<true>, "R4300iOp::SLTI");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SLTI, "R4300iOp::SLTI");
+        CompileInterpterCall((void *)R4300iOp::SLTI<false>, "R4300iOp::SLTI");
     }
 }
 
@@ -1939,11 +1939,11 @@ void CArmRecompilerOps::SLTIU()
     if (m_Opcode.rs != 0) { WriteBack_GPR(m_Opcode.rs, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SLTIU, "R4300iOp32::SLTIU");
+        CompileInterpterCall((void *)R4300iOp::SLTIU<true>, "R4300iOp::SLTIU");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SLTIU, "R4300iOp::SLTIU");
+        CompileInterpterCall((void *)R4300iOp::SLTIU<false>, "R4300iOp::SLTIU");
     }
 }
 
@@ -1953,11 +1953,11 @@ void CArmRecompilerOps::ANDI()
     if (m_Opcode.rs != 0) { WriteBack_GPR(m_Opcode.rs, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::ANDI, "R4300iOp32::ANDI");
+        CompileInterpterCall((void *)R4300iOp::ANDI<true>, "R4300iOp::ANDI");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::ANDI, "R4300iOp::ANDI");
+        CompileInterpterCall((void *)R4300iOp::ANDI<false>, "R4300iOp::ANDI");
     }
 }
 
@@ -2032,11 +2032,11 @@ void CArmRecompilerOps::XORI()
     if (m_Opcode.rs != 0) { WriteBack_GPR(m_Opcode.rs, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::XORI, "R4300iOp32::XORI");
+        CompileInterpterCall((void *)R4300iOp::XORI<true>, "R4300iOp::XORI");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::XORI, "R4300iOp::XORI");
+        CompileInterpterCall((void *)R4300iOp::XORI<false>, "R4300iOp::XORI");
     }
 }
 
@@ -2063,7 +2063,7 @@ void CArmRecompilerOps::DADDIU()
     if (m_Opcode.rt != 0) { UnMap_GPR(m_Opcode.rt, true); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::DADDIU, "R4300iOp32::DADDIU");
+        CompileInterpterCall((void *)R4300iOp::DADDIU, "R4300iOp::DADDIU");
     }
     else
     {
@@ -2077,7 +2077,7 @@ void CArmRecompilerOps::LDL()
     UnMap_GPR(m_Opcode.rt, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::LDL, "R4300iOp32::LDL");
+        CompileInterpterCall((void *)R4300iOp::LDL, "R4300iOp::LDL");
     }
     else
     {
@@ -2091,7 +2091,7 @@ void CArmRecompilerOps::LDR()
     UnMap_GPR(m_Opcode.rt, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::LDR, "R4300iOp32::LDR");
+        CompileInterpterCall((void *)R4300iOp::LDR, "R4300iOp::LDR");
     }
     else
     {
@@ -2154,11 +2154,11 @@ void CArmRecompilerOps::LH()
     UnMap_GPR(m_Opcode.rt, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::LH, "R4300iOp32::LH");
+        CompileInterpterCall((void *)R4300iOp::LH<true>, "R4300iOp::LH");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::LH, "R4300iOp::LH");
+        CompileInterpterCall((void *)R4300iOp::LH<false>, "R4300iOp::LH");
     }
 }
 
@@ -2168,11 +2168,11 @@ void CArmRecompilerOps::LWL()
     UnMap_GPR(m_Opcode.rt, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::LWL, "R4300iOp32::LWL");
+        CompileInterpterCall((void *)R4300iOp::LWL<true>, "R4300iOp::LWL");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::LWL, "R4300iOp::LWL");
+        CompileInterpterCall((void *)R4300iOp::LWL<false>, "R4300iOp::LWL");
     }
 }
 
@@ -2285,11 +2285,11 @@ void CArmRecompilerOps::LBU()
     UnMap_GPR(m_Opcode.rt, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::LBU, "R4300iOp32::LBU");
+        CompileInterpterCall((void *)R4300iOp::LBU<true>, "R4300iOp::LBU");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::LBU, "R4300iOp::LBU");
+        CompileInterpterCall((void *)R4300iOp::LBU<false>, "R4300iOp::LBU");
     }
 }
 
@@ -2299,11 +2299,11 @@ void CArmRecompilerOps::LHU()
     UnMap_GPR(m_Opcode.rt, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::LHU, "R4300iOp32::LHU");
+        CompileInterpterCall((void *)R4300iOp::LHU<true>, "R4300iOp::LHU");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::LHU, "R4300iOp::LHU");
+        CompileInterpterCall((void *)R4300iOp::LHU<false>, "R4300iOp::LHU");
     }
 }
 
@@ -2313,11 +2313,11 @@ void CArmRecompilerOps::LWR()
     UnMap_GPR(m_Opcode.rt, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::LWR, "R4300iOp32::LWR");
+        CompileInterpterCall((void *)R4300iOp::LWR<true>, "R4300iOp::LWR");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::LWR, "R4300iOp::LWR");
+        CompileInterpterCall((void *)R4300iOp::LWR<false>, "R4300iOp::LWR");
     }
 }
 
@@ -2327,11 +2327,11 @@ void CArmRecompilerOps::LWU()
     UnMap_GPR(m_Opcode.rt, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::LWU, "R4300iOp32::LWU");
+        CompileInterpterCall((void *)R4300iOp::LWU<true>, "R4300iOp::LWU");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::LWU, "R4300iOp::LWU");
+        CompileInterpterCall((void *)R4300iOp::LWU<false>, "R4300iOp::LWU");
     }
 }
 
@@ -2341,7 +2341,7 @@ void CArmRecompilerOps::SB()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SB, "R4300iOp32::SB");
+        CompileInterpterCall((void *)R4300iOp::SB, "R4300iOp::SB");
     }
     else
     {
@@ -2355,7 +2355,7 @@ void CArmRecompilerOps::SH()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SH, "R4300iOp32::SH");
+        CompileInterpterCall((void *)R4300iOp::SH, "R4300iOp::SH");
     }
     else
     {
@@ -2369,7 +2369,7 @@ void CArmRecompilerOps::SWL()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SWL, "R4300iOp32::SWL");
+        CompileInterpterCall((void *)R4300iOp::SWL, "R4300iOp::SWL");
     }
     else
     {
@@ -2472,7 +2472,7 @@ void CArmRecompilerOps::SW(bool bCheckLLbit)
         if (m_Opcode.rt != 0) { UnMap_GPR(m_Opcode.rt, true); }
         if (g_Settings->LoadBool(Game_32Bit))
         {
-            CompileInterpterCall((void *)R4300iOp32::SW, "R4300iOp32::SW");
+            CompileInterpterCall((void *)R4300iOp::SW, "R4300iOp::SW");
         }
         else
         {
@@ -2487,7 +2487,7 @@ void CArmRecompilerOps::SWR()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SWR, "R4300iOp32::SWR");
+        CompileInterpterCall((void *)R4300iOp::SWR, "R4300iOp::SWR");
     }
     else
     {
@@ -2501,7 +2501,7 @@ void CArmRecompilerOps::SDL()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SDL, "R4300iOp32::SDL");
+        CompileInterpterCall((void *)R4300iOp::SDL, "R4300iOp::SDL");
     }
     else
     {
@@ -2515,7 +2515,7 @@ void CArmRecompilerOps::SDR()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SDR, "R4300iOp32::SDR");
+        CompileInterpterCall((void *)R4300iOp::SDR, "R4300iOp::SDR");
     }
     else
     {
@@ -2569,11 +2569,11 @@ void CArmRecompilerOps::LL()
     UnMap_GPR(m_Opcode.rt, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::LL, "R4300iOp32::LL");
+        CompileInterpterCall((void *)R4300iOp::LL<true>, "R4300iOp::LL");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::LL, "R4300iOp::LL");
+        CompileInterpterCall((void *)R4300iOp::LL<false>, "R4300iOp::LL");
     }
 }
 
@@ -2641,7 +2641,7 @@ void CArmRecompilerOps::LDC1()
     if (m_Opcode.base != 0) { WriteBack_GPR(m_Opcode.base, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::LDC1, "R4300iOp32::LDC1");
+        CompileInterpterCall((void *)R4300iOp::LDC1, "R4300iOp::LDC1");
     }
     else
     {
@@ -2655,7 +2655,7 @@ void CArmRecompilerOps::LD()
     UnMap_GPR(m_Opcode.rt, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::LD, "R4300iOp32::LD");
+        CompileInterpterCall((void *)R4300iOp::LD, "R4300iOp::LD");
     }
     else
     {
@@ -2669,7 +2669,7 @@ void CArmRecompilerOps::SC()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SC, "R4300iOp32::SC");
+        CompileInterpterCall((void *)R4300iOp::SC, "R4300iOp::SC");
     }
     else
     {
@@ -2683,7 +2683,7 @@ void CArmRecompilerOps::SWC1()
     if (m_Opcode.base != 0) { WriteBack_GPR(m_Opcode.base, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SWC1, "R4300iOp32::SWC1");
+        CompileInterpterCall((void *)R4300iOp::SWC1, "R4300iOp::SWC1");
     }
     else
     {
@@ -2697,7 +2697,7 @@ void CArmRecompilerOps::SDC1()
     if (m_Opcode.base != 0) { WriteBack_GPR(m_Opcode.base, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SDC1, "R4300iOp32::SDC1");
+        CompileInterpterCall((void *)R4300iOp::SDC1, "R4300iOp::SDC1");
     }
     else
     {
@@ -2711,7 +2711,7 @@ void CArmRecompilerOps::SD()
     if (m_Opcode.rt != 0) { UnMap_GPR(m_Opcode.rt, true); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SD, "R4300iOp32::SD");
+        CompileInterpterCall((void *)R4300iOp::SD, "R4300iOp::SD");
     }
     else
     {
@@ -2729,11 +2729,11 @@ void CArmRecompilerOps::SPECIAL_SLL()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_SLL, "R4300iOp32::SPECIAL_SLL");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SLL<true>, "R4300iOp::SPECIAL_SLL");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SPECIAL_SLL, "R4300iOp::SPECIAL_SLL");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SLL<false>, "R4300iOp::SPECIAL_SLL");
     }
 }
 
@@ -2743,11 +2743,11 @@ void CArmRecompilerOps::SPECIAL_SRL()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_SRL, "R4300iOp32::SPECIAL_SRL");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SRL<true>, "R4300iOp::SPECIAL_SRL");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SPECIAL_SRL, "R4300iOp::SPECIAL_SRL");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SRL<false>, "R4300iOp::SPECIAL_SRL");
     }
 }
 
@@ -2757,11 +2757,11 @@ void CArmRecompilerOps::SPECIAL_SRA()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_SRA, "R4300iOp32::SPECIAL_SRA");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SRA<true>, "R4300iOp::SPECIAL_SRA");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SPECIAL_SRA, "R4300iOp::SPECIAL_SRA");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SRA<false>, "R4300iOp::SPECIAL_SRA");
     }
 }
 
@@ -2772,11 +2772,11 @@ void CArmRecompilerOps::SPECIAL_SLLV()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_SLLV, "R4300iOp32::SPECIAL_SLLV");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SLLV<true>, "R4300iOp::SPECIAL_SLLV");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SPECIAL_SLLV, "R4300iOp::SPECIAL_SLLV");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SLLV<false>, "R4300iOp::SPECIAL_SLLV");
     }
 }
 
@@ -2787,11 +2787,11 @@ void CArmRecompilerOps::SPECIAL_SRLV()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_SRLV, "R4300iOp32::SPECIAL_SRLV");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SRLV<true>, "R4300iOp::SPECIAL_SRLV");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SPECIAL_SRLV, "R4300iOp::SPECIAL_SRLV");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SRLV<false>, "R4300iOp::SPECIAL_SRLV");
     }
 }
 
@@ -2802,11 +2802,11 @@ void CArmRecompilerOps::SPECIAL_SRAV()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_SRAV, "R4300iOp32::SPECIAL_SRAV");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SRAV<true>, "R4300iOp::SPECIAL_SRAV");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SPECIAL_SRAV, "R4300iOp::SPECIAL_SRAV");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SRAV<false>, "R4300iOp::SPECIAL_SRAV");
     }
 }
 
@@ -2994,7 +2994,7 @@ void CArmRecompilerOps::SPECIAL_MFLO()
     UnMap_GPR(m_Opcode.rd, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_MFLO, "R4300iOp32::SPECIAL_MFLO");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_MFLO, "R4300iOp::SPECIAL_MFLO");
     }
     else
     {
@@ -3007,7 +3007,7 @@ void CArmRecompilerOps::SPECIAL_MTLO()
     if (m_Opcode.rs != 0) { WriteBack_GPR(m_Opcode.rs, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_MTLO, "R4300iOp32::SPECIAL_MTLO");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_MTLO, "R4300iOp::SPECIAL_MTLO");
     }
     else
     {
@@ -3020,7 +3020,7 @@ void CArmRecompilerOps::SPECIAL_MFHI()
     UnMap_GPR(m_Opcode.rd, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_MFHI, "R4300iOp32::SPECIAL_MFHI");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_MFHI, "R4300iOp::SPECIAL_MFHI");
     }
     else
     {
@@ -3033,7 +3033,7 @@ void CArmRecompilerOps::SPECIAL_MTHI()
     if (m_Opcode.rs != 0) { WriteBack_GPR(m_Opcode.rs, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_MTHI, "R4300iOp32::SPECIAL_MTHI");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_MTHI, "R4300iOp::SPECIAL_MTHI");
     }
     else
     {
@@ -3048,7 +3048,7 @@ void CArmRecompilerOps::SPECIAL_DSLLV()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DSLLV, "R4300iOp32::SPECIAL_DSLLV");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DSLLV, "R4300iOp::SPECIAL_DSLLV");
     }
     else
     {
@@ -3063,7 +3063,7 @@ void CArmRecompilerOps::SPECIAL_DSRLV()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DSRLV, "R4300iOp32::SPECIAL_DSRLV");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DSRLV, "R4300iOp::SPECIAL_DSRLV");
     }
     else
     {
@@ -3078,7 +3078,7 @@ void CArmRecompilerOps::SPECIAL_DSRAV()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DSRAV, "R4300iOp32::SPECIAL_DSRAV");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DSRAV, "R4300iOp::SPECIAL_DSRAV");
     }
     else
     {
@@ -3092,7 +3092,7 @@ void CArmRecompilerOps::SPECIAL_MULT()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_MULT, "R4300iOp32::SPECIAL_MULT");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_MULT, "R4300iOp::SPECIAL_MULT");
     }
     else
     {
@@ -3106,7 +3106,7 @@ void CArmRecompilerOps::SPECIAL_MULTU()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_MULTU, "R4300iOp32::SPECIAL_MULTU");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_MULTU, "R4300iOp::SPECIAL_MULTU");
     }
     else
     {
@@ -3120,7 +3120,7 @@ void CArmRecompilerOps::SPECIAL_DIV()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DIV, "R4300iOp32::SPECIAL_DIV");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DIV, "R4300iOp::SPECIAL_DIV");
     }
     else
     {
@@ -3134,7 +3134,7 @@ void CArmRecompilerOps::SPECIAL_DIVU()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DIVU, "R4300iOp32::SPECIAL_DIVU");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DIVU, "R4300iOp::SPECIAL_DIVU");
     }
     else
     {
@@ -3148,7 +3148,7 @@ void CArmRecompilerOps::SPECIAL_DMULT()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DMULT, "R4300iOp32::SPECIAL_DMULT");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DMULT, "R4300iOp::SPECIAL_DMULT");
     }
     else
     {
@@ -3162,7 +3162,7 @@ void CArmRecompilerOps::SPECIAL_DMULTU()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DMULTU, "R4300iOp32::SPECIAL_DMULTU");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DMULTU, "R4300iOp::SPECIAL_DMULTU");
     }
     else
     {
@@ -3176,7 +3176,7 @@ void CArmRecompilerOps::SPECIAL_DDIV()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DDIV, "R4300iOp32::SPECIAL_DDIV");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DDIV, "R4300iOp::SPECIAL_DDIV");
     }
     else
     {
@@ -3190,7 +3190,7 @@ void CArmRecompilerOps::SPECIAL_DDIVU()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DDIVU, "R4300iOp32::SPECIAL_DDIVU");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DDIVU, "R4300iOp::SPECIAL_DDIVU");
     }
     else
     {
@@ -3205,11 +3205,11 @@ void CArmRecompilerOps::SPECIAL_ADD()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_ADD, "R4300iOp32::SPECIAL_ADD");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_ADD<true>, "R4300iOp::SPECIAL_ADD");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SPECIAL_ADD, "R4300iOp::SPECIAL_ADD");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_ADD<false>, "R4300iOp::SPECIAL_ADD");
     }
 }
 
@@ -3220,11 +3220,11 @@ void CArmRecompilerOps::SPECIAL_ADDU()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_ADDU, "R4300iOp32::SPECIAL_ADDU");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_ADDU<true>, "R4300iOp::SPECIAL_ADDU");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SPECIAL_ADDU, "R4300iOp::SPECIAL_ADDU");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_ADDU<false>, "R4300iOp::SPECIAL_ADDU");
     }
 }
 
@@ -3292,11 +3292,11 @@ void CArmRecompilerOps::SPECIAL_AND()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_AND, "R4300iOp32::SPECIAL_AND");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_AND<true>, "R4300iOp::SPECIAL_AND");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SPECIAL_AND, "R4300iOp::SPECIAL_AND");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_AND<false>, "R4300iOp::SPECIAL_AND");
     }
 }
 
@@ -3307,11 +3307,11 @@ void CArmRecompilerOps::SPECIAL_OR()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_OR, "R4300iOp32::SPECIAL_OR");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_OR<true>, "R4300iOp::SPECIAL_OR");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SPECIAL_OR, "R4300iOp::SPECIAL_OR");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_OR<false>, "R4300iOp::SPECIAL_OR");
     }
 }
 
@@ -3473,11 +3473,11 @@ void CArmRecompilerOps::SPECIAL_NOR()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_NOR, "R4300iOp32::SPECIAL_NOR");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_NOR<true>, "R4300iOp::SPECIAL_NOR");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SPECIAL_NOR, "R4300iOp::SPECIAL_NOR");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_NOR<false>, "R4300iOp::SPECIAL_NOR");
     }
 }
 
@@ -3504,11 +3504,11 @@ void CArmRecompilerOps::SPECIAL_SLT()
                 if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
                 if (g_Settings->LoadBool(Game_32Bit))
                 {
-                    CompileInterpterCall((void *)R4300iOp32::SPECIAL_SLT, "R4300iOp32::SPECIAL_SLT");
+                    CompileInterpterCall((void *)R4300iOp::SPECIAL_SLT<true>, "R4300iOp::SPECIAL_SLT");
                 }
                 else
                 {
-                    CompileInterpterCall((void *)R4300iOp::SPECIAL_SLT, "R4300iOp::SPECIAL_SLT");
+                    CompileInterpterCall((void *)R4300iOp::SPECIAL_SLT<false>, "R4300iOp::SPECIAL_SLT");
                 }
             }
             else
@@ -3715,11 +3715,11 @@ void CArmRecompilerOps::SPECIAL_SLTU()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_SLTU, "R4300iOp32::SPECIAL_SLTU");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SLTU<true>, "R4300iOp::SPECIAL_SLTU");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::SPECIAL_SLTU, "R4300iOp::SPECIAL_SLTU");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_SLTU<false>, "R4300iOp::SPECIAL_SLTU");
     }
 }
 
@@ -3730,7 +3730,7 @@ void CArmRecompilerOps::SPECIAL_DADD()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DADD, "R4300iOp32::SPECIAL_DADD");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DADD, "R4300iOp::SPECIAL_DADD");
     }
     else
     {
@@ -3745,7 +3745,7 @@ void CArmRecompilerOps::SPECIAL_DADDU()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DADDU, "R4300iOp32::SPECIAL_DADDU");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DADDU, "R4300iOp::SPECIAL_DADDU");
     }
     else
     {
@@ -3760,7 +3760,7 @@ void CArmRecompilerOps::SPECIAL_DSUB()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DSUB, "R4300iOp32::SPECIAL_DSUB");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DSUB, "R4300iOp::SPECIAL_DSUB");
     }
     else
     {
@@ -3775,7 +3775,7 @@ void CArmRecompilerOps::SPECIAL_DSUBU()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DSUBU, "R4300iOp32::SPECIAL_DSUBU");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DSUBU, "R4300iOp::SPECIAL_DSUBU");
     }
     else
     {
@@ -3789,7 +3789,7 @@ void CArmRecompilerOps::SPECIAL_DSLL()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DSLL, "R4300iOp32::SPECIAL_DSLL");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DSLL, "R4300iOp::SPECIAL_DSLL");
     }
     else
     {
@@ -3803,7 +3803,7 @@ void CArmRecompilerOps::SPECIAL_DSRL()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DSRL, "R4300iOp32::SPECIAL_DSRL");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DSRL, "R4300iOp::SPECIAL_DSRL");
     }
     else
     {
@@ -3817,7 +3817,7 @@ void CArmRecompilerOps::SPECIAL_DSRA()
     if (m_Opcode.rt != 0) { UnMap_GPR(m_Opcode.rt, true); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DSRA, "R4300iOp32::SPECIAL_DSRA");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DSRA, "R4300iOp::SPECIAL_DSRA");
     }
     else
     {
@@ -3831,7 +3831,7 @@ void CArmRecompilerOps::SPECIAL_DSLL32()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DSLL32, "R4300iOp32::SPECIAL_DSLL32");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DSLL32, "R4300iOp::SPECIAL_DSLL32");
     }
     else
     {
@@ -3845,7 +3845,7 @@ void CArmRecompilerOps::SPECIAL_DSRL32()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DSRL32, "R4300iOp32::SPECIAL_DSRL32");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DSRL32, "R4300iOp::SPECIAL_DSRL32");
     }
     else
     {
@@ -3859,7 +3859,7 @@ void CArmRecompilerOps::SPECIAL_DSRA32()
     if (m_Opcode.rt != 0) { WriteBack_GPR(m_Opcode.rt, false); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::SPECIAL_DSRA32, "R4300iOp32::SPECIAL_DSRA32");
+        CompileInterpterCall((void *)R4300iOp::SPECIAL_DSRA32, "R4300iOp::SPECIAL_DSRA32");
     }
     else
     {
@@ -3882,11 +3882,11 @@ void CArmRecompilerOps::COP0_MF()
     UnMap_GPR(m_Opcode.rt, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP0_MF, "R4300iOp32::COP0_MF");
+        CompileInterpterCall((void *)R4300iOp::COP0_MF<true>, "R4300iOp::COP0_MF");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::COP0_MF, "R4300iOp::COP0_MF");
+        CompileInterpterCall((void *)R4300iOp::COP0_MF<false>, "R4300iOp::COP0_MF");
     }
 }
 
@@ -3913,7 +3913,7 @@ void CArmRecompilerOps::COP0_MT()
     case 30: //ErrEPC
         if (g_Settings->LoadBool(Game_32Bit))
         {
-            CompileInterpterCall((void *)R4300iOp32::COP0_MT, "R4300iOp32::COP0_MT");
+            CompileInterpterCall((void *)R4300iOp::COP0_MT, "R4300iOp::COP0_MT");
         }
         else
         {
@@ -3928,7 +3928,7 @@ void CArmRecompilerOps::COP0_MT()
         m_RegWorkingSet.SetBlockCycleCount(m_RegWorkingSet.GetBlockCycleCount() + g_System->CountPerOp());
         if (g_Settings->LoadBool(Game_32Bit))
         {
-            CompileInterpterCall((void *)R4300iOp32::COP0_MT, "R4300iOp32::COP0_MT");
+            CompileInterpterCall((void *)R4300iOp::COP0_MT, "R4300iOp::COP0_MT");
         }
         else
         {
@@ -3945,7 +3945,7 @@ void CArmRecompilerOps::COP0_CO_TLBR()
     if (!g_System->bUseTlb()) { return; }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP0_CO_TLBR, "R4300iOp32::COP0_CO_TLBR");
+        CompileInterpterCall((void *)R4300iOp::COP0_CO_TLBR, "R4300iOp::COP0_CO_TLBR");
     }
     else
     {
@@ -3958,7 +3958,7 @@ void CArmRecompilerOps::COP0_CO_TLBWI()
     if (!g_System->bUseTlb()) { return; }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP0_CO_TLBWI, "R4300iOp32::COP0_CO_TLBWI");
+        CompileInterpterCall((void *)R4300iOp::COP0_CO_TLBWI, "R4300iOp::COP0_CO_TLBWI");
     }
     else
     {
@@ -3990,7 +3990,7 @@ void CArmRecompilerOps::COP0_CO_TLBP()
     if (!g_System->bUseTlb()) { return; }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP0_CO_TLBP, "R4300iOp32::COP0_CO_TLBP");
+        CompileInterpterCall((void *)R4300iOp::COP0_CO_TLBP, "R4300iOp::COP0_CO_TLBP");
     }
     else
     {
@@ -4031,11 +4031,11 @@ void CArmRecompilerOps::COP1_MF()
     UnMap_GPR(m_Opcode.rt, false);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_MF, "R4300iOp32::COP1_MF");
+        CompileInterpterCall((void *)R4300iOp::COP1_MF<true>, "R4300iOp::COP1_MF");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::COP1_MF, "R4300iOp::COP1_MF");
+        CompileInterpterCall((void *)R4300iOp::COP1_MF<false>, "R4300iOp::COP1_MF");
     }
 }
 
@@ -4045,7 +4045,7 @@ void CArmRecompilerOps::COP1_DMF()
     UnMap_GPR(m_Opcode.rt, false);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_DMF, "R4300iOp32::COP1_DMF");
+        CompileInterpterCall((void *)R4300iOp::COP1_DMF, "R4300iOp::COP1_DMF");
     }
     else
     {
@@ -4065,11 +4065,11 @@ void CArmRecompilerOps::COP1_CF()
     }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_CF, "R4300iOp32::COP1_CF");
+        CompileInterpterCall((void *)R4300iOp::COP1_CF<true>, "R4300iOp::COP1_CF");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::COP1_CF, "R4300iOp::COP1_CF");
+        CompileInterpterCall((void *)R4300iOp::COP1_CF<false>, "R4300iOp::COP1_CF");
     }
 }
 
@@ -4079,7 +4079,7 @@ void CArmRecompilerOps::COP1_MT()
     if (m_Opcode.rt != 0) { UnMap_GPR(m_Opcode.rt, true); }
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_MT, "R4300iOp32::COP1_MT");
+        CompileInterpterCall((void *)R4300iOp::COP1_MT, "R4300iOp::COP1_MT");
     }
     else
     {
@@ -4094,11 +4094,11 @@ void CArmRecompilerOps::COP1_DMT()
 
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_DMT, "R4300iOp32::COP1_DMT");
+        CompileInterpterCall((void *)R4300iOp::COP1_DMT<true>, "R4300iOp::COP1_DMT");
     }
     else
     {
-        CompileInterpterCall((void *)R4300iOp::COP1_DMT, "R4300iOp::COP1_DMT");
+        CompileInterpterCall((void *)R4300iOp::COP1_DMT<false>, "R4300iOp::COP1_DMT");
     }
 }
 
@@ -4115,7 +4115,7 @@ void CArmRecompilerOps::COP1_CT()
     UnMap_GPR(m_Opcode.rt, true);
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_CT, "R4300iOp32::COP1_CT");
+        CompileInterpterCall((void *)R4300iOp::COP1_CT, "R4300iOp::COP1_CT");
     }
     else
     {
@@ -4129,7 +4129,7 @@ void CArmRecompilerOps::COP1_S_ADD()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_ADD, "R4300iOp32::COP1_S_ADD");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_ADD, "R4300iOp::COP1_S_ADD");
     }
     else
     {
@@ -4142,7 +4142,7 @@ void CArmRecompilerOps::COP1_S_SUB()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_SUB, "R4300iOp32::COP1_S_SUB");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_SUB, "R4300iOp::COP1_S_SUB");
     }
     else
     {
@@ -4170,7 +4170,7 @@ void CArmRecompilerOps::COP1_S_DIV()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_DIV, "R4300iOp32::COP1_S_DIV");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_DIV, "R4300iOp::COP1_S_DIV");
     }
     else
     {
@@ -4183,7 +4183,7 @@ void CArmRecompilerOps::COP1_S_ABS()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_ABS, "R4300iOp32::COP1_S_ABS");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_ABS, "R4300iOp::COP1_S_ABS");
     }
     else
     {
@@ -4196,7 +4196,7 @@ void CArmRecompilerOps::COP1_S_NEG()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_NEG, "R4300iOp32::COP1_S_NEG");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_NEG, "R4300iOp::COP1_S_NEG");
     }
     else
     {
@@ -4209,7 +4209,7 @@ void CArmRecompilerOps::COP1_S_SQRT()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_SQRT, "R4300iOp32::COP1_S_SQRT");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_SQRT, "R4300iOp::COP1_S_SQRT");
     }
     else
     {
@@ -4222,7 +4222,7 @@ void CArmRecompilerOps::COP1_S_MOV()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_MOV, "R4300iOp32::COP1_S_MOV");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_MOV, "R4300iOp::COP1_S_MOV");
     }
     else
     {
@@ -4235,7 +4235,7 @@ void CArmRecompilerOps::COP1_S_ROUND_L()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_ROUND_L, "R4300iOp32::COP1_S_ROUND_L");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_ROUND_L, "R4300iOp::COP1_S_ROUND_L");
     }
     else
     {
@@ -4248,7 +4248,7 @@ void CArmRecompilerOps::COP1_S_TRUNC_L()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_TRUNC_L, "R4300iOp32::COP1_S_TRUNC_L");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_TRUNC_L, "R4300iOp::COP1_S_TRUNC_L");
     }
     else
     {
@@ -4261,7 +4261,7 @@ void CArmRecompilerOps::COP1_S_CEIL_L()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_CEIL_L, "R4300iOp32::COP1_S_CEIL_L");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_CEIL_L, "R4300iOp::COP1_S_CEIL_L");
     }
     else
     {
@@ -4274,7 +4274,7 @@ void CArmRecompilerOps::COP1_S_FLOOR_L()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_FLOOR_L, "R4300iOp32::COP1_S_FLOOR_L");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_FLOOR_L, "R4300iOp::COP1_S_FLOOR_L");
     }
     else
     {
@@ -4287,7 +4287,7 @@ void CArmRecompilerOps::COP1_S_ROUND_W()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_ROUND_W, "R4300iOp32::COP1_S_ROUND_W");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_ROUND_W, "R4300iOp::COP1_S_ROUND_W");
     }
     else
     {
@@ -4300,7 +4300,7 @@ void CArmRecompilerOps::COP1_S_TRUNC_W()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_TRUNC_W, "R4300iOp32::COP1_S_TRUNC_W");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_TRUNC_W, "R4300iOp::COP1_S_TRUNC_W");
     }
     else
     {
@@ -4313,7 +4313,7 @@ void CArmRecompilerOps::COP1_S_CEIL_W()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_CEIL_W, "R4300iOp32::COP1_S_CEIL_W");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_CEIL_W, "R4300iOp::COP1_S_CEIL_W");
     }
     else
     {
@@ -4326,7 +4326,7 @@ void CArmRecompilerOps::COP1_S_FLOOR_W()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_FLOOR_W, "R4300iOp32::COP1_S_FLOOR_W");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_FLOOR_W, "R4300iOp::COP1_S_FLOOR_W");
     }
     else
     {
@@ -4339,7 +4339,7 @@ void CArmRecompilerOps::COP1_S_CVT_D()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_CVT_D, "R4300iOp32::COP1_S_CVT_D");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_CVT_D, "R4300iOp::COP1_S_CVT_D");
     }
     else
     {
@@ -4352,7 +4352,7 @@ void CArmRecompilerOps::COP1_S_CVT_W()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_CVT_W, "R4300iOp32::COP1_S_CVT_W");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_CVT_W, "R4300iOp::COP1_S_CVT_W");
     }
     else
     {
@@ -4365,7 +4365,7 @@ void CArmRecompilerOps::COP1_S_CVT_L()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_CVT_L, "R4300iOp32::COP1_S_CVT_L");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_CVT_L, "R4300iOp::COP1_S_CVT_L");
     }
     else
     {
@@ -4378,7 +4378,7 @@ void CArmRecompilerOps::COP1_S_CMP()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_S_CMP, "R4300iOp32::COP1_S_CMP");
+        CompileInterpterCall((void *)R4300iOp::COP1_S_CMP, "R4300iOp::COP1_S_CMP");
     }
     else
     {
@@ -4391,7 +4391,7 @@ void CArmRecompilerOps::COP1_D_ADD()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_ADD, "R4300iOp32::COP1_D_ADD");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_ADD, "R4300iOp::COP1_D_ADD");
     }
     else
     {
@@ -4404,7 +4404,7 @@ void CArmRecompilerOps::COP1_D_SUB()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_SUB, "R4300iOp32::COP1_D_SUB");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_SUB, "R4300iOp::COP1_D_SUB");
     }
     else
     {
@@ -4417,7 +4417,7 @@ void CArmRecompilerOps::COP1_D_MUL()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_MUL, "R4300iOp32::COP1_D_MUL");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_MUL, "R4300iOp::COP1_D_MUL");
     }
     else
     {
@@ -4430,7 +4430,7 @@ void CArmRecompilerOps::COP1_D_DIV()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_DIV, "R4300iOp32::COP1_D_DIV");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_DIV, "R4300iOp::COP1_D_DIV");
     }
     else
     {
@@ -4443,7 +4443,7 @@ void CArmRecompilerOps::COP1_D_ABS()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_ABS, "R4300iOp32::COP1_D_ABS");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_ABS, "R4300iOp::COP1_D_ABS");
     }
     else
     {
@@ -4456,7 +4456,7 @@ void CArmRecompilerOps::COP1_D_NEG()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_NEG, "R4300iOp32::COP1_D_NEG");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_NEG, "R4300iOp::COP1_D_NEG");
     }
     else
     {
@@ -4469,7 +4469,7 @@ void CArmRecompilerOps::COP1_D_SQRT()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_SQRT, "R4300iOp32::COP1_D_SQRT");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_SQRT, "R4300iOp::COP1_D_SQRT");
     }
     else
     {
@@ -4482,7 +4482,7 @@ void CArmRecompilerOps::COP1_D_MOV()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_MOV, "R4300iOp32::COP1_D_MOV");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_MOV, "R4300iOp::COP1_D_MOV");
     }
     else
     {
@@ -4495,7 +4495,7 @@ void CArmRecompilerOps::COP1_D_ROUND_L()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_ROUND_L, "R4300iOp32::COP1_D_ROUND_L");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_ROUND_L, "R4300iOp::COP1_D_ROUND_L");
     }
     else
     {
@@ -4508,7 +4508,7 @@ void CArmRecompilerOps::COP1_D_TRUNC_L()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_TRUNC_L, "R4300iOp32::COP1_D_TRUNC_L");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_TRUNC_L, "R4300iOp::COP1_D_TRUNC_L");
     }
     else
     {
@@ -4521,7 +4521,7 @@ void CArmRecompilerOps::COP1_D_CEIL_L()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_CEIL_L, "R4300iOp32::COP1_D_CEIL_L");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_CEIL_L, "R4300iOp::COP1_D_CEIL_L");
     }
     else
     {
@@ -4534,7 +4534,7 @@ void CArmRecompilerOps::COP1_D_FLOOR_L()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_FLOOR_L, "R4300iOp32::COP1_D_FLOOR_L");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_FLOOR_L, "R4300iOp::COP1_D_FLOOR_L");
     }
     else
     {
@@ -4547,7 +4547,7 @@ void CArmRecompilerOps::COP1_D_ROUND_W()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_ROUND_W, "R4300iOp32::COP1_D_ROUND_W");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_ROUND_W, "R4300iOp::COP1_D_ROUND_W");
     }
     else
     {
@@ -4560,7 +4560,7 @@ void CArmRecompilerOps::COP1_D_TRUNC_W()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_TRUNC_W, "R4300iOp32::COP1_D_TRUNC_W");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_TRUNC_W, "R4300iOp::COP1_D_TRUNC_W");
     }
     else
     {
@@ -4573,7 +4573,7 @@ void CArmRecompilerOps::COP1_D_CEIL_W()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_CEIL_W, "R4300iOp32::COP1_D_CEIL_W");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_CEIL_W, "R4300iOp::COP1_D_CEIL_W");
     }
     else
     {
@@ -4586,7 +4586,7 @@ void CArmRecompilerOps::COP1_D_FLOOR_W()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_FLOOR_W, "R4300iOp32::COP1_D_FLOOR_W");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_FLOOR_W, "R4300iOp::COP1_D_FLOOR_W");
     }
     else
     {
@@ -4599,7 +4599,7 @@ void CArmRecompilerOps::COP1_D_CVT_S()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_CVT_S, "R4300iOp32::COP1_D_CVT_S");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_CVT_S, "R4300iOp::COP1_D_CVT_S");
     }
     else
     {
@@ -4612,7 +4612,7 @@ void CArmRecompilerOps::COP1_D_CVT_W()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_CVT_W, "R4300iOp32::COP1_D_CVT_W");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_CVT_W, "R4300iOp::COP1_D_CVT_W");
     }
     else
     {
@@ -4625,7 +4625,7 @@ void CArmRecompilerOps::COP1_D_CVT_L()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_CVT_L, "R4300iOp32::COP1_D_CVT_L");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_CVT_L, "R4300iOp::COP1_D_CVT_L");
     }
     else
     {
@@ -4638,7 +4638,7 @@ void CArmRecompilerOps::COP1_D_CMP()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_D_CMP, "R4300iOp32::COP1_D_CMP");
+        CompileInterpterCall((void *)R4300iOp::COP1_D_CMP, "R4300iOp::COP1_D_CMP");
     }
     else
     {
@@ -4651,7 +4651,7 @@ void CArmRecompilerOps::COP1_W_CVT_S()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_W_CVT_S, "R4300iOp32::COP1_W_CVT_S");
+        CompileInterpterCall((void *)R4300iOp::COP1_W_CVT_S, "R4300iOp::COP1_W_CVT_S");
     }
     else
     {
@@ -4664,7 +4664,7 @@ void CArmRecompilerOps::COP1_W_CVT_D()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_W_CVT_D, "R4300iOp32::COP1_W_CVT_D");
+        CompileInterpterCall((void *)R4300iOp::COP1_W_CVT_D, "R4300iOp::COP1_W_CVT_D");
     }
     else
     {
@@ -4677,7 +4677,7 @@ void CArmRecompilerOps::COP1_L_CVT_S()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_L_CVT_S, "R4300iOp32::COP1_L_CVT_S");
+        CompileInterpterCall((void *)R4300iOp::COP1_L_CVT_S, "R4300iOp::COP1_L_CVT_S");
     }
     else
     {
@@ -4690,7 +4690,7 @@ void CArmRecompilerOps::COP1_L_CVT_D()
     CompileCop1Test();
     if (g_Settings->LoadBool(Game_32Bit))
     {
-        CompileInterpterCall((void *)R4300iOp32::COP1_L_CVT_D, "R4300iOp32::COP1_L_CVT_D");
+        CompileInterpterCall((void *)R4300iOp::COP1_L_CVT_D, "R4300iOp::COP1_L_CVT_D");
     }
     else
     {
@@ -5858,7 +5858,7 @@ void CArmRecompilerOps::SetCurrentPC(uint32_t ProgramCounter)
     m_CompilePC = ProgramCounter;
     __except_try()
     {
-        if (!g_MMU->LW_VAddr(m_CompilePC, m_Opcode.Hex))
+        if (!CRecompiler::LoadCodeWord(m_CompilePC, m_Opcode.Hex))
         {
             g_Notify->FatalError(GS(MSG_FAIL_LOAD_WORD));
         }
@@ -5910,6 +5910,18 @@ void CArmRecompilerOps::UpdateSyncCPU(CRegInfo & RegSet, uint32_t Cycles)
     RegSet.AfterCallDirect();
 }
 
+void CArmRecompilerOps::CompileRspTaskSync(void)
+{
+    if (!g_System->AsyncDlist())
+    {
+        return;
+    }
+
+    m_RegWorkingSet.BeforeCallDirect();
+    CallFunction(AddressOf(&CN64System::WaitForRspTask), "CN64System::WaitForRspTask");
+    m_RegWorkingSet.AfterCallDirect();
+}
+
 void CArmRecompilerOps::UpdateCounters(CRegInfo & RegSet, bool CheckTimer, bool ClearValues)
 {
     if (RegSet.GetBlockCycleCount() != 0)
@@ -6023,7 +6035,7 @@ void CArmRecompilerOps::SW_Const(uint32_t Value, uint32_t VAddr)
     }
 
     uint32_t PAddr;
-    if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+    if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
     {
         CPU_Message("%s\nFailed to translate address: %08X", __FUNCTION__, VAddr);
         if (g_Settings->LoadBool(Debugger_ShowUnhandledMemory))
@@ -6078,6 +6090,7 @@ void CArmRecompilerOps::SW_Const(uint32_t Value, uint32_t VAddr)
             MoveConstToVariable(Value, PAddr + g_MMU->Rdram(), stdstr_f("RDRAM + %X", PAddr).c_str());
             break;
         }
+        CompileRspTaskSync();
         switch (PAddr)
         {
         case 0x04040000: MoveConstToVariable(Value, &g_Reg->SP_MEM_ADDR_REG, "SP_MEM_ADDR_REG"); break;
@@ -6132,6 +6145,7 @@ void CArmRecompilerOps::SW_Const(uint32_t Value, uint32_t VAddr)
         }
         break;
     case 0x04300000:
+        CompileRspTaskSync();
         switch (PAddr)
         {
         case 0x04300000:
@@ -6250,6 +6264,7 @@ void CArmRecompilerOps::SW_Const(uint32_t Value, uint32_t VAddr)
         switch (PAddr)
         {
         case 0x04400000:
+            CompileRspTaskSync();
             if (g_Plugins->Gfx()->ViStatusChanged != NULL)
             {
                 ArmReg TempReg = Map_TempReg(Arm_Any, -1, false);
@@ -6275,6 +6290,7 @@ void CArmRecompilerOps::SW_Const(uint32_t Value, uint32_t VAddr)
             break;
         case 0x04400004: MoveConstToVariable((Value & 0xFFFFFF), &g_Reg->VI_ORIGIN_REG, "VI_ORIGIN_REG"); break;
         case 0x04400008:
+            CompileRspTaskSync();
             if (g_Plugins->Gfx()->ViWidthChanged != NULL)
             {
                 ArmReg TempReg = Map_TempReg(Arm_Any, -1, false);
@@ -6541,7 +6557,7 @@ void CArmRecompilerOps::SW_Register(ArmReg Reg, uint32_t VAddr)
     }
 
     uint32_t PAddr;
-    if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+    if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
     {
         CPU_Message("%s\nFailed to translate address: %08X", __FUNCTION__, VAddr);
         if (g_Settings->LoadBool(Debugger_ShowUnhandledMemory))
@@ -6582,6 +6598,7 @@ void CArmRecompilerOps::SW_Register(ArmReg Reg, uint32_t VAddr)
         }
         break;
     case 0x04000000:
+        CompileRspTaskSync();
         switch (PAddr)
         {
         case 0x04040000: MoveArmRegToVariable(Reg, &g_Reg->SP_MEM_ADDR_REG, "SP_MEM_ADDR_REG"); break;
@@ -6648,6 +6665,7 @@ void CArmRecompilerOps::SW_Register(ArmReg Reg, uint32_t VAddr)
         m_RegWorkingSet.AfterCallDirect();
         break;
     case 0x04300000:
+        CompileRspTaskSync();
         switch (PAddr)
         {
         case 0x04300000:
@@ -6675,6 +6693,7 @@ void CArmRecompilerOps::SW_Register(ArmReg Reg, uint32_t VAddr)
     case 0x04400000:
         switch (PAddr) {
         case 0x04400000:
+            CompileRspTaskSync();
             if (g_Plugins->Gfx()->ViStatusChanged != NULL)
             {
                 ArmReg TempReg = Map_TempReg(Arm_Any, -1, false);
@@ -6699,6 +6718,7 @@ void CArmRecompilerOps::SW_Register(ArmReg Reg, uint32_t VAddr)
             AndConstToVariable(&g_Reg->VI_ORIGIN_REG, "VI_ORIGIN_REG", 0xFFFFFF);
             break;
         case 0x04400008:
+            CompileRspTaskSync();
             if (g_Plugins->Gfx()->ViWidthChanged != NULL)
             {
                 ArmReg TempReg = Map_TempReg(Arm_Any, -1, false);
@@ -6989,7 +7009,7 @@ void CArmRecompilerOps::LB_KnownAddress(ArmReg Reg, uint32_t VAddr, bool SignExt
     }
 
     uint32_t PAddr;
-    if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+    if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
     {
         g_Notify->BreakPoint(__FILE__, __LINE__);
         return;
@@ -7044,7 +7064,7 @@ void CArmRecompilerOps::LW_KnownAddress(ArmReg Reg, uint32_t VAddr)
     else
     {
         uint32_t PAddr;
-        if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+        if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
         {
             g_Notify->BreakPoint(__FILE__, __LINE__);
         }
@@ -7070,6 +7090,7 @@ void CArmRecompilerOps::LW_KnownAddress(ArmReg Reg, uint32_t VAddr)
                 MoveVariableToArmReg(PAddr + g_MMU->Rdram(), stdstr_f("RDRAM + %X", PAddr).c_str(), Reg);
                 break;
             }
+            CompileRspTaskSync();
             switch (PAddr)
             {
             case 0x04040010: MoveVariableToArmReg(&g_Reg->SP_STATUS_REG, "SP_STATUS_REG", Reg); break;
@@ -7100,6 +7121,7 @@ void CArmRecompilerOps::LW_KnownAddress(ArmReg Reg, uint32_t VAddr)
             MoveVariableToArmReg(&CMipsMemoryVM::m_MemLookupValue.UW[0], "CMipsMemoryVM::m_MemLookupValue.UW[0]", Reg);
             break;
         case 0x04300000:
+            CompileRspTaskSync();
             switch (PAddr)
             {
             case 0x04300000: MoveVariableToArmReg(&g_Reg->MI_MODE_REG, "MI_MODE_REG", Reg); break;
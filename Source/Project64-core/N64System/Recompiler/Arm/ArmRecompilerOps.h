@@ -268,6 +268,7 @@ private:
     void LB_KnownAddress(ArmReg Reg, uint32_t VAddr, bool SignExtend);
     void LW_KnownAddress(ArmReg Reg, uint32_t VAddr);
     void CompileInterpterCall (void * Function, const char * FunctionName);
+    void CompileRspTaskSync(void);
     void OverflowDelaySlot(bool TestTimer);
 
     EXIT_LIST m_ExitInfo;
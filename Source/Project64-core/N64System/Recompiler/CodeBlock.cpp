@@ -75,11 +75,14 @@ m_Test(1)
     m_Sections.push_back(m_EnterSection);
     m_SectionMap.insert(SectionMap::value_type(VAddrEnter, m_EnterSection));
 
-    if (g_TransVaddr->VAddrToRealAddr(VAddrEnter, *(reinterpret_cast<void **>(&m_MemLocation[0]))))
+    if (CRecompiler::CodeRealAddr(VAddrEnter, *(reinterpret_cast<void **>(&m_MemLocation[0]))))
     {
         m_MemLocation[1] = m_MemLocation[0] + 1;
-        m_MemContents[0] = *m_MemLocation[0];
-        m_MemContents[1] = *m_MemLocation[1];
+        if (!CRecompiler::ReadCodeSnapshot(VAddrEnter, m_MemContents, sizeof(m_MemContents)))
+        {
+            m_MemContents[0] = *m_MemLocation[0];
+            m_MemContents[1] = *m_MemLocation[1];
+        }
     }
     else
     {
@@ -447,7 +450,7 @@ bool CCodeBlock::AnalyzeInstruction(uint32_t PC, uint32_t & TargetPC, uint32_t &
     PermLoop = false;
 
     OPCODE Command;
-    if (!g_MMU->LW_VAddr(PC, Command.Hex))
+    if (!CRecompiler::LoadCodeWord(PC, Command.Hex))
     {
         g_Notify->BreakPoint(__FILE__, __LINE__);
         return false;
@@ -771,9 +774,18 @@ bool CCodeBlock::Compile()
     m_RecompilerOps->CompileExitCode();
     m_CompiledLocationEnd = *g_RecompPos;
 
-    uint32_t PAddr;
-    g_TransVaddr->TranslateVaddr(VAddrFirst(), PAddr);
-    MD5(g_MMU->Rdram() + PAddr, (VAddrLast() - VAddrFirst()) + 4).get_digest(m_Hash);
+    uint32_t Length = (VAddrLast() - VAddrFirst()) + 4;
+    std::vector<uint8_t> Code(Length);
+    if (CRecompiler::ReadCodeSnapshot(VAddrFirst(), &Code[0], Length))
+    {
+        MD5(&Code[0], Length).get_digest(m_Hash);
+    }
+    else
+    {
+        uint32_t PAddr;
+        g_TransVaddr->TranslateVaddr(VAddrFirst(), PAddr);
+        MD5(g_MMU->Rdram() + PAddr, Length).get_digest(m_Hash);
+    }
 
 #if defined(ANDROID) && (defined(__arm__) || defined(_M_ARM))
     __clear_cache_android((uint8_t *)((uint32_t)m_CompiledLocation & ~1), m_CompiledLocationEnd);
@@ -29,7 +29,7 @@ static bool DelaySlotEffectsJump(uint32_t JumpPC)
 {
     OPCODE Command;
 
-    if (!g_MMU->LW_VAddr(JumpPC, Command.Hex))
+    if (!CRecompiler::LoadCodeWord(JumpPC, Command.Hex))
     {
         return true;
     }
@@ -77,7 +77,7 @@ static bool DelaySlotEffectsJump(uint32_t JumpPC)
                     bool EffectDelaySlot = false;
                     OPCODE NewCommand;
 
-                    if (!g_MMU->LW_VAddr(JumpPC + 4, NewCommand.Hex))
+                    if (!CRecompiler::LoadCodeWord(JumpPC + 4, NewCommand.Hex))
                     {
                         return true;
                     }
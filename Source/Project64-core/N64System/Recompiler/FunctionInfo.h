@@ -32,6 +32,9 @@ public:
     uint64_t MemContents(int32_t i) { return m_MemContents[i]; }
     uint64_t* MemLocation(int32_t i) { return m_MemLocation[i]; }
 
+    uint32_t JumpTablePAddr() const { return m_JumpTablePAddr; }
+    void SetJumpTablePAddr(uint32_t PAddr) { m_JumpTablePAddr = PAddr; }
+
 private:
     CCompiledFunc(void);                              // Disable default constructor
     CCompiledFunc(const CCompiledFunc&);              // Disable copy constructor
@@ -51,6 +54,8 @@ private:
 
     //Validation
     uint64_t m_MemContents[2], * m_MemLocation[2];
+
+    uint32_t m_JumpTablePAddr; // Jump table entry the function was last added to
 };
 
 typedef std::map<uint32_t, CCompiledFunc *> CCompiledFuncList;
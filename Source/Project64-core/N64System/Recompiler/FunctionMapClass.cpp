@@ -15,7 +15,10 @@
 
 CFunctionMap::CFunctionMap() :
 m_JumpTable(NULL),
-m_FunctionTable(NULL)
+m_FunctionTable(NULL),
+m_CodePageBits(NULL),
+m_CodePageBlocks(NULL),
+m_CodePages(0)
 {
 }
 
@@ -48,6 +51,11 @@ bool CFunctionMap::AllocateMemory()
             return false;
         }
         memset(m_JumpTable, 0, (RdramSize() >> 2) * sizeof(PCCompiledFunc));
+
+        m_CodePages = RdramSize() >> 12;
+        m_CodePageBits = new uint32_t[(m_CodePages + 31) >> 5];
+        m_CodePageBlocks = new CODE_PAGE_BLOCKS[m_CodePages];
+        memset(m_CodePageBits, 0, ((m_CodePages + 31) >> 5) * sizeof(uint32_t));
     }
     WriteTrace(TraceRecompiler, TraceDebug, "Done");
     return true;
@@ -72,6 +80,17 @@ void CFunctionMap::CleanBuffers()
         delete[] m_JumpTable;
         m_JumpTable = NULL;
     }
+    if (m_CodePageBits)
+    {
+        delete[] m_CodePageBits;
+        m_CodePageBits = NULL;
+    }
+    if (m_CodePageBlocks)
+    {
+        delete[] m_CodePageBlocks;
+        m_CodePageBlocks = NULL;
+    }
+    m_CodePages = 0;
 }
 
 void CFunctionMap::Reset(bool bAllocate)
@@ -83,4 +102,149 @@ void CFunctionMap::Reset(bool bAllocate)
         AllocateMemory();
     }
     WriteTrace(TraceRecompiler, TraceDebug, "Done");
-}
\ No newline at end of file
+}
+
+void CFunctionMap::AddJumpTableEntry(uint32_t PAddr, CCompiledFunc * Func)
+{
+    //a function is only ever linked in one place so it can be unlinked without searching the table
+    uint32_t OldPAddr = Func->JumpTablePAddr();
+    if (OldPAddr != PAddr && OldPAddr < (m_CodePages << 12) && m_JumpTable[OldPAddr >> 2] == Func)
+    {
+        m_JumpTable[OldPAddr >> 2] = NULL;
+    }
+    Func->SetJumpTablePAddr(PAddr);
+    m_JumpTable[PAddr >> 2] = Func;
+    if (m_CodePageBlocks == NULL)
+    {
+        return;
+    }
+
+    CODE_PAGE_BLOCK Block;
+    Block.Func = Func;
+    Block.EnterPAddr = PAddr;
+    Block.StartPAddr = PAddr - (Func->EnterPC() - Func->MinPC());
+    Block.EndPAddr = PAddr + (Func->MaxPC() - Func->EnterPC()) + 4;
+
+    uint32_t LastPage = (Block.EndPAddr - 1) >> 12;
+    for (uint32_t Page = Block.StartPAddr >> 12; Page <= LastPage && Page < m_CodePages; Page++)
+    {
+        CODE_PAGE_BLOCKS & Blocks = m_CodePageBlocks[Page];
+
+        //drop entries that are no longer in the jump table (evicted or cleared through another page)
+        for (size_t i = 0; i < Blocks.size();)
+        {
+            if (m_JumpTable[Blocks[i].EnterPAddr >> 2] != Blocks[i].Func)
+            {
+                Blocks[i] = Blocks.back();
+                Blocks.pop_back();
+                continue;
+            }
+            i++;
+        }
+        Blocks.push_back(Block);
+        m_CodePageBits[Page >> 5] |= (1 << (Page & 0x1F));
+    }
+}
+
+void CFunctionMap::RemoveFunction(CCompiledFunc * Func)
+{
+    if (m_FunctionTable != NULL)
+    {
+        PCCompiledFunc_TABLE table = m_FunctionTable[Func->EnterPC() >> 0xC];
+        if (table != NULL && table[(Func->EnterPC() & 0xFFF) >> 2] == Func)
+        {
+            table[(Func->EnterPC() & 0xFFF) >> 2] = NULL;
+        }
+    }
+
+    uint32_t PAddr = Func->JumpTablePAddr();
+    if (m_JumpTable == NULL || m_CodePageBlocks == NULL || PAddr >= (m_CodePages << 12))
+    {
+        return;
+    }
+    if (m_JumpTable[PAddr >> 2] == Func)
+    {
+        m_JumpTable[PAddr >> 2] = NULL;
+    }
+
+    uint32_t StartPAddr = PAddr - (Func->EnterPC() - Func->MinPC());
+    uint32_t LastPage = (PAddr + (Func->MaxPC() - Func->EnterPC()) + 3) >> 12;
+    for (uint32_t Page = StartPAddr >> 12; Page <= LastPage && Page < m_CodePages; Page++)
+    {
+        CODE_PAGE_BLOCKS & Blocks = m_CodePageBlocks[Page];
+        for (size_t i = 0; i < Blocks.size();)
+        {
+            if (Blocks[i].Func == Func)
+            {
+                Blocks[i] = Blocks.back();
+                Blocks.pop_back();
+                continue;
+            }
+            i++;
+        }
+        if (Blocks.empty())
+        {
+            m_CodePageBits[Page >> 5] &= ~(1 << (Page & 0x1F));
+        }
+    }
+}
+
+bool CFunctionMap::CodePageUsed(uint32_t PAddr, uint32_t Length) const
+{
+    if (m_CodePageBits == NULL)
+    {
+        return true;
+    }
+    uint32_t LastPage = (PAddr + Length - 1) >> 12;
+    for (uint32_t Page = PAddr >> 12; Page <= LastPage && Page < m_CodePages; Page++)
+    {
+        if ((m_CodePageBits[Page >> 5] & (1 << (Page & 0x1F))) != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t CFunctionMap::ClearCodePages(uint32_t PAddr, uint32_t Length)
+{
+    if (m_CodePageBlocks == NULL)
+    {
+        memset((uint8_t *)m_JumpTable + PAddr, 0, Length);
+        return 0;
+    }
+
+    uint32_t Removed = 0, EndPAddr = PAddr + Length;
+    uint32_t LastPage = (EndPAddr - 1) >> 12;
+    for (uint32_t Page = PAddr >> 12; Page <= LastPage && Page < m_CodePages; Page++)
+    {
+        if ((m_CodePageBits[Page >> 5] & (1 << (Page & 0x1F))) == 0)
+        {
+            continue;
+        }
+
+        CODE_PAGE_BLOCKS & Blocks = m_CodePageBlocks[Page];
+        for (size_t i = 0; i < Blocks.size();)
+        {
+            const CODE_PAGE_BLOCK & Block = Blocks[i];
+            bool Linked = m_JumpTable[Block.EnterPAddr >> 2] == Block.Func;
+            if (Linked && (Block.EndPAddr <= PAddr || Block.StartPAddr >= EndPAddr))
+            {
+                i++;
+                continue;
+            }
+            if (Linked)
+            {
+                m_JumpTable[Block.EnterPAddr >> 2] = NULL;
+                Removed += 1;
+            }
+            Blocks[i] = Blocks.back();
+            Blocks.pop_back();
+        }
+        if (Blocks.empty())
+        {
+            m_CodePageBits[Page >> 5] &= ~(1 << (Page & 0x1F));
+        }
+    }
+    return Removed;
+}
@@ -9,6 +9,7 @@
 *                                                                           *
 ****************************************************************************/
 #pragma once
+#include <vector>
 #include <Project64-core/N64System/Recompiler/FunctionInfo.h>
 #include <Project64-core/Settings/GameSettings.h>
 
@@ -25,13 +26,33 @@ protected:
     bool AllocateMemory();
     void Reset(bool bAllocate);
 
+    //Code page tracking, every block placed in the jump table is recorded against
+    //the 4kb pages of rdram it was compiled from
+    void AddJumpTableEntry(uint32_t PAddr, CCompiledFunc * Func);
+    void RemoveFunction(CCompiledFunc * Func);
+    bool CodePageUsed(uint32_t PAddr, uint32_t Length) const;
+    uint32_t ClearCodePages(uint32_t PAddr, uint32_t Length);
+
 public:
     PCCompiledFunc_TABLE * FunctionTable() const { return m_FunctionTable; }
     PCCompiledFunc       * JumpTable() const { return m_JumpTable; }
 
 private:
+    typedef struct
+    {
+        CCompiledFunc * Func;
+        uint32_t EnterPAddr;
+        uint32_t StartPAddr;
+        uint32_t EndPAddr;
+    } CODE_PAGE_BLOCK;
+
+    typedef std::vector<CODE_PAGE_BLOCK> CODE_PAGE_BLOCKS;
+
     void CleanBuffers();
 
     PCCompiledFunc       * m_JumpTable;
     PCCompiledFunc_TABLE * m_FunctionTable;
+    uint32_t             * m_CodePageBits;
+    CODE_PAGE_BLOCKS     * m_CodePageBlocks;
+    uint32_t               m_CodePages;
 };
@@ -15,6 +15,7 @@
 #include <Project64-core/N64System/N64Types.h>
 #include <Project64-core/N64System/Recompiler/CodeBlock.h>
 #include <Project64-core/N64System/Recompiler/RecompilerCodeLog.h>
+#include <Project64-core/N64System/Recompiler/RecompilerClass.h>
 #include <Project64-core/N64System/SystemGlobals.h>
 #include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
 #include <Project64-core/N64System/Mips/OpcodeName.h>
@@ -33,6 +34,7 @@ LoopAnalysis::LoopAnalysis(CCodeBlock * CodeBlock, CCodeSection * Section) :
     m_Test(m_BlockInfo->NextTest())
 {
     memset(&m_Command, 0, sizeof(m_Command));
+    memset(m_RegReads, 0, sizeof(m_RegReads));
 }
 
 LoopAnalysis::~LoopAnalysis()
@@ -179,15 +181,20 @@ bool LoopAnalysis::CheckLoopRegisterUsage(CCodeSection * Section)
     m_NextInstruction = NORMAL;
     uint32_t ContinueSectionPC = Section->m_ContinueSection ? Section->m_ContinueSection->m_EnterPC : (uint32_t)-1;
     CPU_Message("ContinueSectionPC = %08X", ContinueSectionPC);
+    bool bCountReads = m_CountedSections.insert(Section->m_SectionID).second;
 
     do
     {
-        if (!g_MMU->LW_VAddr(m_PC, m_Command.Hex))
+        if (!CRecompiler::LoadCodeWord(m_PC, m_Command.Hex))
         {
             g_Notify->BreakPoint(__FILE__, __LINE__);
             return false;
         }
         CPU_Message("  %08X: %s", m_PC, R4300iOpcodeName(m_Command.Hex, m_PC));
+        if (bCountReads)
+        {
+            CountRegisterReads();
+        }
         switch (m_Command.op)
         {
         case R4300i_SPECIAL:
@@ -823,6 +830,35 @@ bool LoopAnalysis::SyncRegState(CRegInfo & RegSet, const CRegInfo& SyncReg)
     return bChanged;
 }
 
+void LoopAnalysis::CountRegisterReads()
+{
+    switch (m_Command.op)
+    {
+    case R4300i_J:
+    case R4300i_JAL:
+        break;
+    case R4300i_SPECIAL:
+    case R4300i_BEQ: case R4300i_BNE: case R4300i_BEQL: case R4300i_BNEL:
+    case R4300i_SB: case R4300i_SH: case R4300i_SWL: case R4300i_SW:
+    case R4300i_SDL: case R4300i_SDR: case R4300i_SWR: case R4300i_SC: case R4300i_SD:
+        m_RegReads[m_Command.rs] += 1;
+        m_RegReads[m_Command.rt] += 1;
+        break;
+    case R4300i_CP0:
+    case R4300i_CP1:
+        //MTC0, MTC1, DMTC1, CTC1 read rt
+        if (m_Command.fmt == R4300i_COP1_MT || m_Command.fmt == R4300i_COP1_DMT || m_Command.fmt == R4300i_COP1_CT)
+        {
+            m_RegReads[m_Command.rt] += 1;
+        }
+        break;
+    default:
+        m_RegReads[m_Command.rs] += 1;
+        break;
+    }
+    m_RegReads[0] = 0;
+}
+
 void LoopAnalysis::SetJumpRegSet(CCodeSection * Section, const CRegInfo &Reg)
 {
     RegisterMap::iterator itr = m_JumpRegisters.find(Section->m_SectionID);
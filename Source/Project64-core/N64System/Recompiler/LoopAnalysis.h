@@ -10,6 +10,7 @@
 ****************************************************************************/
 #pragma once
 
+#include <set>
 #include <Project64-core/N64System/Recompiler/RegInfo.h>
 #include <Project64-core/N64System/Mips/OpCode.h>
 #include <Project64-core/N64System/N64Types.h>
@@ -25,6 +26,9 @@ public:
 
     bool SetupRegisterForLoop();
 
+    //number of times a GPR is read by the instructions in the loop
+    uint32_t RegisterReads(int32_t Reg) const { return m_RegReads[Reg]; }
+
 private:
     LoopAnalysis();                               // Disable default constructor
     LoopAnalysis(const LoopAnalysis&);            // Disable copy constructor
@@ -35,6 +39,7 @@ private:
     bool SyncRegState(CRegInfo & RegSet, const CRegInfo& SyncReg);
     void SetJumpRegSet(CCodeSection * Section, const CRegInfo &Reg);
     void SetContinueRegSet(CCodeSection * Section, const CRegInfo &Reg);
+    void CountRegisterReads();
 
     /********************** R4300i OpCodes: Special **********************/
     void SPECIAL_SLL();
@@ -80,6 +85,8 @@ private:
     RegisterMap    m_EnterRegisters;
     RegisterMap    m_ContinueRegisters;
     RegisterMap    m_JumpRegisters;
+    std::set<uint32_t> m_CountedSections;
+    uint32_t       m_RegReads[32];
     CCodeSection * m_EnterSection;
     CCodeBlock   * m_BlockInfo;
     uint32_t       m_PC;
@@ -15,10 +15,25 @@
 #include <Project64-core/N64System/N64Class.h>
 #include <Project64-core/N64System/Interpreter/InterpreterCPU.h>
 #include <Project64-core/ExceptionHandler.h>
+#include <Common/Util.h>
+
+CRecompiler::CODE_SNAPSHOT * CRecompiler::m_CodeSnapshot = NULL;
 
 CRecompiler::CRecompiler(CRegisters & Registers, bool & EndEmulation) :
 m_Registers(Registers),
 m_EndEmulation(EndEmulation),
+m_CompileThread(NULL),
+m_CompileEvent(false),
+m_CompileThreadStop(false),
+m_CompileThreadDone(false),
+m_CompiledCodeReady(false),
+m_EvictRequested(false),
+m_BackgroundCompiled(0),
+m_BackgroundStale(0),
+m_InterpretedOps(0),
+m_CodeInvalidations(0),
+m_CodeInvalidationsAvoided(0),
+m_CodeInvalidationTime(0),
 PROGRAM_COUNTER(Registers.m_PROGRAM_COUNTER)
 {
     CFunctionMap::AllocateMemory();
@@ -30,6 +45,7 @@ PROGRAM_COUNTER(Registers.m_PROGRAM_COUNTER)
 
 CRecompiler::~CRecompiler()
 {
+    StopCompileThread();
     ResetRecompCode(false);
 }
 
@@ -74,6 +90,10 @@ void CRecompiler::Run()
         {
             RecompilerMain_ChangeMemory();
         }
+        else if (bBackgroundCompile())
+        {
+            RecompilerMain_Lookup_Background();
+        }
         else
         {
             if (g_System->bUseTlb())
@@ -133,11 +153,12 @@ void CRecompiler::RecompilerMain_VirtualTable()
             CCompiledFunc * info = table[TableEntry];
             if (info != NULL)
             {
+                TouchCodeRegion((const uint8_t *)info->Function());
                 (info->Function())();
                 continue;
             }
         }
-        CCompiledFunc * info = CompileCode();
+        CCompiledFunc * info = CompileCode(PC);
         if (info == NULL || m_EndEmulation)
         {
             break;
@@ -160,6 +181,7 @@ void CRecompiler::RecompilerMain_VirtualTable()
         }
 
         table[TableEntry] = info;
+        TouchCodeRegion((const uint8_t *)info->Function());
         (info->Function())();
     }
 }
@@ -347,7 +369,7 @@ void CRecompiler::RecompilerMain_Lookup()
             CCompiledFunc * info = JumpTable()[PhysicalAddr >> 2];
             if (info == NULL)
             {
-                info = CompileCode();
+                info = CompileCode(PROGRAM_COUNTER);
                 if (info == NULL || m_EndEmulation)
                 {
                     break;
@@ -356,8 +378,9 @@ void CRecompiler::RecompilerMain_Lookup()
                 {
                     g_MMU->ProtectMemory(PROGRAM_COUNTER & ~0xFFF, PROGRAM_COUNTER | 0xFFF);
                 }
-                JumpTable()[PhysicalAddr >> 2] = info;
+                AddJumpTableEntry(PhysicalAddr, info);
             }
+            TouchCodeRegion((const uint8_t *)info->Function());
             (info->Function())();
         }
         else
@@ -551,7 +574,7 @@ void CRecompiler::RecompilerMain_Lookup_TLB()
 
             if (info == NULL)
             {
-                info = CompileCode();
+                info = CompileCode(PROGRAM_COUNTER);
                 if (info == NULL || m_EndEmulation)
                 {
                     break;
@@ -560,8 +583,9 @@ void CRecompiler::RecompilerMain_Lookup_TLB()
                 {
                     g_MMU->ProtectMemory(PROGRAM_COUNTER & ~0xFFF, PROGRAM_COUNTER | 0xFFF);
                 }
-                JumpTable()[PhysicalAddr >> 2] = info;
+                AddJumpTableEntry(PhysicalAddr, info);
             }
+            TouchCodeRegion((const uint8_t *)info->Function());
             (info->Function())();
         }
         else
@@ -593,7 +617,7 @@ void CRecompiler::RecompilerMain_Lookup_validate()
             CCompiledFunc * info = JumpTable()[PhysicalAddr >> 2];
             if (info == NULL)
             {
-                info = CompileCode();
+                info = CompileCode(PROGRAM_COUNTER);
                 if (info == NULL || m_EndEmulation)
                 {
                     break;
@@ -602,7 +626,7 @@ void CRecompiler::RecompilerMain_Lookup_validate()
                 {
                     g_MMU->ProtectMemory(PROGRAM_COUNTER & ~0xFFF, PROGRAM_COUNTER | 0xFFF);
                 }
-                JumpTable()[PhysicalAddr >> 2] = info;
+                AddJumpTableEntry(PhysicalAddr, info);
             }
             else
             {
@@ -614,6 +638,7 @@ void CRecompiler::RecompilerMain_Lookup_validate()
                     continue;
                 }
             }
+            TouchCodeRegion((const uint8_t *)info->Function());
             (info->Function())();
         }
         else
@@ -661,7 +686,7 @@ void CRecompiler::RecompilerMain_Lookup_validate_TLB()
 
             if (info == NULL)
             {
-                info = CompileCode();
+                info = CompileCode(PROGRAM_COUNTER);
                 if (info == NULL || m_EndEmulation)
                 {
                     break;
@@ -670,7 +695,7 @@ void CRecompiler::RecompilerMain_Lookup_validate_TLB()
                 {
                     g_MMU->ProtectMemory(PC & ~0xFFF, PC | 0xFFF);
                 }
-                JumpTable()[PhysicalAddr >> 2] = info;
+                AddJumpTableEntry(PhysicalAddr, info);
             }
             else
             {
@@ -695,6 +720,7 @@ void CRecompiler::RecompilerMain_Lookup_validate_TLB()
                 }
             }
 
+            TouchCodeRegion((const uint8_t *)info->Function());
             if (bRecordExecutionTimes())
             {
                 uint64_t PreNonCPUTime = g_System->m_CPU_Usage.NonCPUTime();
@@ -748,6 +774,429 @@ void CRecompiler::RecompilerMain_Lookup_validate_TLB()
     WriteTrace(TraceRecompiler, TraceDebug, "Done");
 }
 
+void CRecompiler::RecompilerMain_Lookup_Background()
+{
+    WriteTrace(TraceRecompiler, TraceInfo, "Start");
+    bool & Done = m_EndEmulation;
+    uint32_t & PC = PROGRAM_COUNTER;
+
+    uint32_t PhysicalAddr;
+
+    StartCompileThread();
+    while (!Done)
+    {
+        if (m_CompiledCodeReady)
+        {
+            PublishCompiledCode();
+        }
+        if (m_EvictRequested)
+        {
+            //The compile thread filled its code region, it is only safe to
+            //evict the next region here since nothing compiled is executing
+            PublishCompiledCode();
+            CGuard Guard(m_CompileCS);
+            CheckRecompMem();
+            m_EvictRequested = false;
+            m_CompileEvent.Trigger();
+        }
+
+        if (!g_TransVaddr->TranslateVaddr(PC, PhysicalAddr))
+        {
+            m_Registers.DoTLBReadMiss(false, PC);
+            if (!g_TransVaddr->TranslateVaddr(PC, PhysicalAddr))
+            {
+                g_Notify->DisplayError(stdstr_f("Failed to translate PC to a PAddr: %X\n\nEmulation stopped", PC).c_str());
+                Done = true;
+            }
+            continue;
+        }
+        if (PhysicalAddr < g_System->RdramSize())
+        {
+            CCompiledFunc * info = JumpTable()[PhysicalAddr >> 2];
+            if (info == NULL)
+            {
+                info = BackgroundLookup(PC, PhysicalAddr);
+                if (info == NULL)
+                {
+                    InterpretBlock();
+                    continue;
+                }
+            }
+            if (g_System->bSMM_ValidFunc() &&
+                (*(info->MemLocation(0)) != info->MemContents(0) ||
+                *(info->MemLocation(1)) != info->MemContents(1)))
+            {
+                ClearRecompCode_Phys(PhysicalAddr > 0x1000 ? (PhysicalAddr - 0x1000) & ~0xFFF : 0, PhysicalAddr > 0x1000 ? 0x3000 : 0x2000, Remove_ValidateFunc);
+                continue;
+            }
+            TouchCodeRegion((const uint8_t *)info->Function());
+            (info->Function())();
+        }
+        else
+        {
+            uint32_t opsExecuted = 0;
+
+            while (g_TransVaddr->TranslateVaddr(PC, PhysicalAddr) && PhysicalAddr >= g_System->RdramSize())
+            {
+                CInterpreterCPU::ExecuteOps(g_System->CountPerOp());
+                opsExecuted += g_System->CountPerOp();
+            }
+
+            if (g_SyncSystem)
+            {
+                g_System->UpdateSyncCPU(g_SyncSystem, opsExecuted);
+                g_System->SyncCPU(g_SyncSystem);
+            }
+        }
+    }
+    StopCompileThread();
+    WriteTrace(TraceRecompiler, TraceInfo, "Done (compiled in background: %d, stale: %d, ops interpreted: %llu)", m_BackgroundCompiled, m_BackgroundStale, (unsigned long long)m_InterpretedOps);
+}
+
+void CRecompiler::InterpretBlock()
+{
+    //Step the interpreter until control leaves the block, by then the compile
+    //thread may have compiled code for the next address
+    uint32_t & PC = PROGRAM_COUNTER;
+    uint32_t CountPerOp = g_System->CountPerOp();
+
+    while (!m_EndEmulation)
+    {
+        uint32_t PrevPC = PC;
+        CInterpreterCPU::ExecuteOps(CountPerOp);
+        m_InterpretedOps += 1;
+
+        if (R4300iOp::m_NextInstruction == NORMAL && PC != PrevPC + 4)
+        {
+            break;
+        }
+    }
+}
+
+CCompiledFunc * CRecompiler::BackgroundLookup(uint32_t VAddr, uint32_t PAddr)
+{
+    {
+        CGuard Guard(m_CompileQueueCS);
+
+        COMPILE_QUEUE::iterator itr = m_CompileQueue.find(PAddr);
+        if (itr != m_CompileQueue.end())
+        {
+            if (itr->second.State != Compile_Foreground)
+            {
+                itr->second.Hits += 1;
+                return NULL;
+            }
+            delete itr->second.Snapshot;
+            m_CompileQueue.erase(itr);
+        }
+        else if ((VAddr & 0xC0000000) == 0x80000000)
+        {
+            //code that was compiled before and is unchanged can be used straight away
+            CCompiledFunc * Func = FindCompiledFunc(VAddr);
+            if (Func != NULL)
+            {
+                AddJumpTableEntry(PAddr, Func);
+                return Func;
+            }
+
+            //Snapshot the code around the block so the compile thread never reads
+            //memory the emulation thread or a dma can be writing to
+            CODE_SNAPSHOT * Snapshot = new CODE_SNAPSHOT;
+            Snapshot->VAddr = VAddr & ~0xFFF;
+            Snapshot->PAddr = PAddr & ~0xFFF;
+            Snapshot->Length = CodeSnapshotSize;
+            if (Snapshot->PAddr + Snapshot->Length > g_System->RdramSize())
+            {
+                Snapshot->Length = g_System->RdramSize() - Snapshot->PAddr;
+            }
+            Snapshot->Memory = g_MMU->Rdram() + Snapshot->PAddr;
+            Snapshot->Missed = false;
+            memcpy(Snapshot->Words, Snapshot->Memory, Snapshot->Length);
+
+            COMPILE_REQUEST Request = { VAddr, 1, Compile_Queued, Snapshot, NULL };
+            m_CompileQueue.insert(COMPILE_QUEUE::value_type(PAddr, Request));
+            m_CompileEvent.Trigger();
+            return NULL;
+        }
+    }
+
+    //The block could not be compiled from a snapshot (tlb mapped code or
+    //code that reads memory outside of it), so compile it here
+    return CompileForeground(VAddr, PAddr);
+}
+
+CCompiledFunc * CRecompiler::CompileForeground(uint32_t VAddr, uint32_t PAddr)
+{
+    CGuard Guard(m_CompileCS);
+    CCompiledFunc * Func = CompileCode(VAddr);
+    if (Func == NULL || m_EndEmulation)
+    {
+        return NULL;
+    }
+    if (g_System->bSMM_Protect())
+    {
+        g_MMU->ProtectMemory(VAddr & ~0xFFF, VAddr | 0xFFF);
+    }
+    AddJumpTableEntry(PAddr, Func);
+    return Func;
+}
+
+bool CRecompiler::NextCompileRequest(uint32_t & PAddr, uint32_t & VAddr, CODE_SNAPSHOT * & Snapshot)
+{
+    CGuard Guard(m_CompileQueueCS);
+
+    //Hottest block first, the queue only holds blocks waiting on the compiler so it stays small
+    COMPILE_QUEUE::iterator Hottest = m_CompileQueue.end();
+    for (COMPILE_QUEUE::iterator itr = m_CompileQueue.begin(); itr != m_CompileQueue.end(); itr++)
+    {
+        if (itr->second.State != Compile_Queued)
+        {
+            continue;
+        }
+        if (Hottest == m_CompileQueue.end() || itr->second.Hits > Hottest->second.Hits)
+        {
+            Hottest = itr;
+        }
+    }
+    if (Hottest == m_CompileQueue.end())
+    {
+        return false;
+    }
+    PAddr = Hottest->first;
+    VAddr = Hottest->second.VAddr;
+    Snapshot = Hottest->second.Snapshot;
+    return true;
+}
+
+void CRecompiler::CompileRequestDone(uint32_t PAddr, CCompiledFunc * Func, bool Missed)
+{
+    CGuard Guard(m_CompileQueueCS);
+
+    COMPILE_QUEUE::iterator itr = m_CompileQueue.find(PAddr);
+    if (itr == m_CompileQueue.end())
+    {
+        delete Func;
+        return;
+    }
+    if (Missed || Func == NULL)
+    {
+        delete Func;
+        itr->second.State = Compile_Foreground;
+        return;
+    }
+    itr->second.Func = Func;
+    itr->second.State = Compile_Done;
+    m_CompiledCodeReady = true;
+}
+
+void CRecompiler::PublishCompiledCode()
+{
+    CGuard Guard(m_CompileQueueCS);
+    m_CompiledCodeReady = false;
+
+    for (COMPILE_QUEUE::iterator itr = m_CompileQueue.begin(); itr != m_CompileQueue.end();)
+    {
+        COMPILE_REQUEST & Request = itr->second;
+        if (Request.State != Compile_Done)
+        {
+            itr++;
+            continue;
+        }
+
+        //The block is only published if the code it was compiled from is still
+        //mapped to the same place and has not been modified since the snapshot
+        uint32_t PAddr;
+        if (JumpTable()[itr->first >> 2] == NULL &&
+            g_TransVaddr->TranslateVaddr(Request.VAddr, PAddr) && PAddr == itr->first &&
+            SnapshotCurrent(Request.Snapshot, Request.Func))
+        {
+            AddCompiledFunc(Request.Func);
+            if (g_System->bSMM_Protect())
+            {
+                g_MMU->ProtectMemory(Request.VAddr & ~0xFFF, Request.VAddr | 0xFFF);
+            }
+            AddJumpTableEntry(itr->first, Request.Func);
+            m_BackgroundCompiled += 1;
+        }
+        else
+        {
+            delete Request.Func;
+            m_BackgroundStale += 1;
+        }
+        delete Request.Snapshot;
+        m_CompileQueue.erase(itr++);
+    }
+}
+
+bool CRecompiler::SnapshotCurrent(const CODE_SNAPSHOT * Snapshot, const CCompiledFunc * Func)
+{
+    uint32_t Start = Func->MinPC() - Snapshot->VAddr;
+    uint32_t End = (Func->MaxPC() - Snapshot->VAddr) + 4;
+    if (Start >= End || End > Snapshot->Length)
+    {
+        return false;
+    }
+    return memcmp(g_MMU->Rdram() + Snapshot->PAddr + Start, ((const uint8_t *)Snapshot->Words) + Start, End - Start) == 0;
+}
+
+void CRecompiler::ClearCompileQueue()
+{
+    CGuard Guard(m_CompileQueueCS);
+    for (COMPILE_QUEUE::iterator itr = m_CompileQueue.begin(); itr != m_CompileQueue.end(); itr++)
+    {
+        delete itr->second.Func;
+        delete itr->second.Snapshot;
+    }
+    m_CompileQueue.clear();
+    m_CompiledCodeReady = false;
+}
+
+void CRecompiler::StartCompileThread()
+{
+    if (m_CompileThread != NULL)
+    {
+        return;
+    }
+    WriteTrace(TraceRecompiler, TraceDebug, "Start");
+    m_CompileThreadStop = false;
+    m_CompileThreadDone = false;
+    m_EvictRequested = false;
+    m_CompileThread = new CThread((CThread::CTHREAD_START_ROUTINE)CompileThreadProc);
+    m_CompileThread->Start(this);
+    WriteTrace(TraceRecompiler, TraceDebug, "Done");
+}
+
+void CRecompiler::StopCompileThread()
+{
+    if (m_CompileThread == NULL)
+    {
+        return;
+    }
+    WriteTrace(TraceRecompiler, TraceDebug, "Start");
+    m_CompileThreadStop = true;
+    m_CompileEvent.Trigger();
+
+    //A compile in progress is writing to the code buffer, the thread has to
+    //finish it before the thread object or the queue can be freed
+    while (!m_CompileThreadDone || m_CompileThread->isRunning())
+    {
+        pjutil::Sleep(10);
+    }
+    delete m_CompileThread;
+    m_CompileThread = NULL;
+
+    ClearCompileQueue();
+    WriteTrace(TraceRecompiler, TraceDebug, "Done");
+}
+
+void CRecompiler::CompileThreadProc(CRecompiler * _this)
+{
+    _this->CompileThread();
+    _this->m_CompileThreadDone = true;
+}
+
+void CRecompiler::CompileThread()
+{
+    WriteTrace(TraceRecompiler, TraceDebug, "Start");
+    while (!m_CompileThreadStop)
+    {
+        m_CompileEvent.IsTriggered(SyncEvent::INFINITE_TIMEOUT);
+
+        while (!m_CompileThreadStop && !m_EvictRequested)
+        {
+            CGuard Guard(m_CompileCS);
+
+            uint32_t PAddr, VAddr;
+            CODE_SNAPSHOT * Snapshot;
+            if (!NextCompileRequest(PAddr, VAddr, Snapshot))
+            {
+                break;
+            }
+            if (RecompMemNeedsEviction())
+            {
+                //wait for the emulation thread to evict the next code region
+                m_EvictRequested = true;
+                break;
+            }
+            CheckRecompMem();
+
+            //Only the snapshot is read while compiling, the block is checked
+            //against memory and published by the emulation thread
+            m_CodeSnapshot = Snapshot;
+            CCompiledFunc * Func = CompileBlock(VAddr);
+            m_CodeSnapshot = NULL;
+            CompileRequestDone(PAddr, Func, Snapshot->Missed);
+        }
+    }
+    WriteTrace(TraceRecompiler, TraceDebug, "Done");
+}
+
+bool CRecompiler::ReadCodeSnapshot(uint32_t VAddr, void * Buffer, uint32_t Length)
+{
+    CODE_SNAPSHOT * Snapshot = m_CodeSnapshot;
+    if (Snapshot == NULL)
+    {
+        return false;
+    }
+    uint32_t Offset = VAddr - Snapshot->VAddr;
+    if (Offset >= Snapshot->Length || Length > Snapshot->Length - Offset)
+    {
+        Snapshot->Missed = true;
+        memset(Buffer, 0, Length);
+        return true;
+    }
+    memcpy(Buffer, ((const uint8_t *)Snapshot->Words) + Offset, Length);
+    return true;
+}
+
+bool CRecompiler::LoadCodeWord(uint32_t VAddr, uint32_t & Value)
+{
+    if (ReadCodeSnapshot(VAddr, &Value, sizeof(Value)))
+    {
+        return true;
+    }
+    return g_MMU->LW_VAddr(VAddr, Value);
+}
+
+bool CRecompiler::TranslateCodeVaddr(uint32_t VAddr, uint32_t & PAddr)
+{
+    CODE_SNAPSHOT * Snapshot = m_CodeSnapshot;
+    if (Snapshot == NULL)
+    {
+        return g_TransVaddr->TranslateVaddr(VAddr, PAddr);
+    }
+
+    //the tlb can change under the compile thread, only the fixed kseg0/kseg1
+    //mapping is used and a block using anything else is thrown away and
+    //compiled on the emulation thread
+    if ((VAddr & 0xC0000000) != 0x80000000)
+    {
+        Snapshot->Missed = true;
+    }
+    PAddr = VAddr & 0x1FFFFFFF;
+    return true;
+}
+
+bool CRecompiler::CodeRealAddr(uint32_t VAddr, void * & RealAddress)
+{
+    CODE_SNAPSHOT * Snapshot = m_CodeSnapshot;
+    if (Snapshot == NULL)
+    {
+        return g_TransVaddr->VAddrToRealAddr(VAddr, RealAddress);
+    }
+
+    //the compile thread does not look at the tlb, the address is taken from
+    //where the emulation thread found the snapshot in memory
+    uint32_t Offset = VAddr - Snapshot->VAddr;
+    if (Offset >= Snapshot->Length)
+    {
+        Snapshot->Missed = true;
+        return false;
+    }
+    RealAddress = Snapshot->Memory + Offset;
+    return true;
+}
+
 void CRecompiler::Reset()
 {
     WriteTrace(TraceRecompiler, TraceDebug, "start");
@@ -759,8 +1208,10 @@ void CRecompiler::Reset()
 void CRecompiler::ResetRecompCode(bool bAllocate)
 {
     WriteTrace(TraceRecompiler, TraceDebug, "start");
+    CGuard Guard(m_CompileCS);
     CRecompMemory::Reset();
     CFunctionMap::Reset(bAllocate);
+    ClearCompileQueue();
 
     for (CCompiledFuncList::iterator iter = m_Functions.begin(); iter != m_Functions.end(); iter++)
     {
@@ -774,9 +1225,83 @@ void CRecompiler::ResetRecompCode(bool bAllocate)
         }
     }
     m_Functions.clear();
+    m_EvictedPCs.clear();
     WriteTrace(TraceRecompiler, TraceDebug, "Done");
 }
 
+uint32_t CRecompiler::EvictRecompCode(const uint8_t * RegionStart, const uint8_t * RegionEnd)
+{
+    WriteTrace(TraceRecompiler, TraceDebug, "start (RegionStart: %X RegionEnd: %X)", RegionStart, RegionEnd);
+    CGuard Guard(m_CompileCS);
+
+    //blocks the compile thread finished but that are not published yet
+    {
+        CGuard QueueGuard(m_CompileQueueCS);
+        for (COMPILE_QUEUE::iterator itr = m_CompileQueue.begin(); itr != m_CompileQueue.end(); itr++)
+        {
+            const uint8_t * Location = itr->second.Func != NULL ? (const uint8_t *)itr->second.Func->Function() : NULL;
+            if (Location >= RegionStart && Location < RegionEnd)
+            {
+                delete itr->second.Func;
+                itr->second.Func = NULL;
+                itr->second.State = Compile_Queued;
+            }
+        }
+    }
+
+    uint32_t Evicted = 0;
+    for (CCompiledFuncList::iterator iter = m_Functions.begin(); iter != m_Functions.end();)
+    {
+        CCompiledFunc * Head = NULL, *Tail = NULL;
+        CCompiledFunc * Func = iter->second;
+        while (Func != NULL)
+        {
+            CCompiledFunc * CurrentFunc = Func;
+            Func = Func->Next();
+
+            const uint8_t * Location = (const uint8_t *)CurrentFunc->Function();
+            if (Location >= RegionStart && Location < RegionEnd)
+            {
+                //Unlink the block from the lookup tables before deleting it,
+                //compiled code finds its successor through these tables
+                RemoveFunction(CurrentFunc);
+                m_BlockProfile.erase(CurrentFunc->Function());
+                if (m_EvictedPCs.size() >= MaxEvictedPCs)
+                {
+                    //only used to count recompiles, losing the history just under counts them
+                    m_EvictedPCs.clear();
+                }
+                m_EvictedPCs.insert(CurrentFunc->EnterPC());
+                delete CurrentFunc;
+                Evicted += 1;
+                continue;
+            }
+            CurrentFunc->SetNext(NULL);
+            if (Tail == NULL)
+            {
+                Head = CurrentFunc;
+            }
+            else
+            {
+                Tail->SetNext(CurrentFunc);
+            }
+            Tail = CurrentFunc;
+        }
+
+        if (Head == NULL)
+        {
+            m_Functions.erase(iter++);
+        }
+        else
+        {
+            iter->second = Head;
+            iter++;
+        }
+    }
+    WriteTrace(TraceRecompiler, TraceDebug, "Done (Evicted: %d)", Evicted);
+    return Evicted;
+}
+
 void CRecompiler::RecompilerMain_ChangeMemory()
 {
     g_Notify->BreakPoint(__FILE__, __LINE__);
@@ -946,21 +1471,41 @@ void CRecompiler::RecompilerMain_ChangeMemory()
 #endif
 }
 
-CCompiledFunc * CRecompiler::CompileCode()
+CCompiledFunc * CRecompiler::CompileCode(uint32_t EnterPC)
 {
-    WriteTrace(TraceRecompiler, TraceDebug, "Start (PC: %X)", PROGRAM_COUNTER);
+    WriteTrace(TraceRecompiler, TraceDebug, "Start (PC: %X)", EnterPC);
 
     uint32_t pAddr = 0;
-    if (!g_TransVaddr->TranslateVaddr(PROGRAM_COUNTER, pAddr))
+    if (!g_TransVaddr->TranslateVaddr(EnterPC, pAddr))
+    {
+        WriteTrace(TraceRecompiler, TraceError, "Failed to translate %X", EnterPC);
+        return NULL;
+    }
+
+    CCompiledFunc * Func = FindCompiledFunc(EnterPC);
+    if (Func != NULL)
+    {
+        return Func;
+    }
+
+    CheckRecompMem();
+
+    Func = CompileBlock(EnterPC);
+    if (Func == NULL)
     {
-        WriteTrace(TraceRecompiler, TraceError, "Failed to translate %X", PROGRAM_COUNTER);
         return NULL;
     }
+    AddCompiledFunc(Func);
+    WriteTrace(TraceRecompiler, TraceVerbose, "Done");
+    return Func;
+}
 
-    CCompiledFuncList::iterator iter = m_Functions.find(PROGRAM_COUNTER);
+CCompiledFunc * CRecompiler::FindCompiledFunc(uint32_t EnterPC)
+{
+    CCompiledFuncList::iterator iter = m_Functions.find(EnterPC);
     if (iter != m_Functions.end())
     {
-        WriteTrace(TraceRecompiler, TraceInfo, "exisiting functions for address (Program Counter: %X pAddr: %X)", PROGRAM_COUNTER, pAddr);
+        WriteTrace(TraceRecompiler, TraceInfo, "exisiting functions for address (Program Counter: %X)", EnterPC);
         for (CCompiledFunc * Func = iter->second; Func != NULL; Func = Func->Next())
         {
             uint32_t PAddr;
@@ -970,37 +1515,27 @@ CCompiledFunc * CRecompiler::CompileCode()
                 MD5(g_MMU->Rdram() + PAddr, (Func->MaxPC() - Func->MinPC()) + 4).get_digest(Hash);
                 if (memcmp(Hash.digest, Func->Hash().digest, sizeof(Hash.digest)) == 0)
                 {
-                    WriteTrace(TraceRecompiler, TraceInfo, "Using extisting compiled code (Program Counter: %X pAddr: %X)", PROGRAM_COUNTER, pAddr);
+                    WriteTrace(TraceRecompiler, TraceInfo, "Using extisting compiled code (Program Counter: %X)", EnterPC);
                     return Func;
                 }
             }
         }
     }
+    return NULL;
+}
 
-    CheckRecompMem();
-
+CCompiledFunc * CRecompiler::CompileBlock(uint32_t EnterPC)
+{
     //uint32_t StartTime = timeGetTime();
-    WriteTrace(TraceRecompiler, TraceDebug, "Compile Block-Start: Program Counter: %X pAddr: %X", PROGRAM_COUNTER, pAddr);
+    WriteTrace(TraceRecompiler, TraceDebug, "Compile Block-Start: Program Counter: %X", EnterPC);
 
-    CCodeBlock CodeBlock(PROGRAM_COUNTER, *g_RecompPos);
+    CCodeBlock CodeBlock(EnterPC, *g_RecompPos);
     if (!CodeBlock.Compile())
     {
         return NULL;
     }
 
-    if (bShowRecompMemSize())
-    {
-        ShowMemUsed();
-    }
-
     CCompiledFunc * Func = new CCompiledFunc(CodeBlock);
-    std::pair<CCompiledFuncList::iterator, bool> ret = m_Functions.insert(CCompiledFuncList::value_type(Func->EnterPC(), Func));
-    if (ret.second == false)
-    {
-        Func->SetNext(ret.first->second->Next());
-        ret.first->second->SetNext(Func);
-    }
-
     if (g_ModuleLogLevel[TraceRecompiler] >= TraceDebug)
     {
         WriteTrace(TraceRecompiler, TraceDebug, "info->Function() = %X", Func->Function());
@@ -1025,10 +1560,29 @@ CCompiledFunc * CRecompiler::CompileCode()
             WriteTrace(TraceRecompiler, TraceDebug, "%s", dumpline.c_str());
         }
     }
-    WriteTrace(TraceRecompiler, TraceVerbose, "Done");
     return Func;
 }
 
+void CRecompiler::AddCompiledFunc(CCompiledFunc * Func)
+{
+    if (bShowRecompMemSize())
+    {
+        ShowMemUsed();
+    }
+
+    m_BlocksCompiled += 1;
+    if (m_EvictedPCs.erase(Func->EnterPC()) != 0)
+    {
+        m_BlocksRecompiled += 1;
+    }
+    std::pair<CCompiledFuncList::iterator, bool> ret = m_Functions.insert(CCompiledFuncList::value_type(Func->EnterPC(), Func));
+    if (ret.second == false)
+    {
+        Func->SetNext(ret.first->second->Next());
+        ret.first->second->SetNext(Func);
+    }
+}
+
 void CRecompiler::ClearRecompCode_Phys(uint32_t Address, int length, REMOVE_REASON Reason)
 {
     if (g_System->LookUpMode() == FuncFind_VirtualLookup)
@@ -1056,8 +1610,15 @@ void CRecompiler::ClearRecompCode_Phys(uint32_t Address, int length, REMOVE_REAS
                 g_Notify->BreakPoint(__FILE__, __LINE__);
                 ClearLen = g_System->RdramSize() - Address;
             }
-            WriteTrace(TraceRecompiler, TraceInfo, "Reseting Jump Table, Addr: %X  len: %d", Address, ClearLen);
-            memset((uint8_t *)JumpTable() + Address, 0, ClearLen);
+            if (!CodePageUsed(Address, ClearLen))
+            {
+                WriteTrace(TraceRecompiler, TraceVerbose, "No code in range, Addr: %X  len: %d", Address, ClearLen);
+                RecordCodeInvalidation(false);
+                return;
+            }
+            uint32_t Removed = ClearCodePages(Address, ClearLen);
+            WriteTrace(TraceRecompiler, TraceInfo, "Reseting Jump Table, Addr: %X  len: %d  blocks removed: %d", Address, ClearLen, Removed);
+            RecordCodeInvalidation(true);
             if (g_System->bSMM_Protect())
             {
                 g_MMU->UnProtectMemory(Address + 0x80000000, Address + 0x80000004);
@@ -1070,6 +1631,29 @@ void CRecompiler::ClearRecompCode_Phys(uint32_t Address, int length, REMOVE_REAS
     }
 }
 
+void CRecompiler::RecordCodeInvalidation(bool HadCode)
+{
+    if (HadCode)
+    {
+        m_CodeInvalidations += 1;
+    }
+    else
+    {
+        m_CodeInvalidationsAvoided += 1;
+    }
+
+    HighResTimeStamp Now;
+    uint64_t NowTime = Now.SetToNow().GetMicroSeconds();
+    if (NowTime - m_CodeInvalidationTime < 1000000)
+    {
+        return;
+    }
+    WriteTrace(TraceRecompiler, TraceInfo, "Code invalidations per second: %d (avoided: %d)", m_CodeInvalidations, m_CodeInvalidationsAvoided);
+    m_CodeInvalidations = 0;
+    m_CodeInvalidationsAvoided = 0;
+    m_CodeInvalidationTime = NowTime;
+}
+
 void CRecompiler::ClearRecompCode_Virt(uint32_t Address, int length, REMOVE_REASON Reason)
 {
     uint32_t AddressIndex, WriteStart;
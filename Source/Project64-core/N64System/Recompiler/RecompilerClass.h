@@ -10,6 +10,10 @@
 ****************************************************************************/
 #pragma once
 
+#include <set>
+#include <Common/CriticalSection.h>
+#include <Common/SyncEvent.h>
+#include <Common/Thread.h>
 #include <Project64-core/N64System/Mips/RegisterClass.h>
 #include <Project64-core/N64System/Recompiler/FunctionMapClass.h>
 #include <Project64-core/N64System/Recompiler/RecompilerMemory.h>
@@ -46,6 +50,7 @@ public:
     void Run();
     void Reset();
     void ResetRecompCode(bool bAllocate);
+    uint32_t EvictRecompCode(const uint8_t * RegionStart, const uint8_t * RegionEnd);
 
     //Self modifying code methods
     void ClearRecompCode_Virt(uint32_t VirtualAddress, int32_t length, REMOVE_REASON Reason);
@@ -57,12 +62,22 @@ public:
 
     uint32_t& MemoryStackPos() { return m_MemoryStack; }
 
+    //Code reads made while compiling, these come from the snapshot when
+    //the block is being compiled by the background compile thread
+    static bool LoadCodeWord(uint32_t VAddr, uint32_t & Value);
+    static bool TranslateCodeVaddr(uint32_t VAddr, uint32_t & PAddr);
+    static bool CodeRealAddr(uint32_t VAddr, void * & RealAddress);
+    static bool ReadCodeSnapshot(uint32_t VAddr, void * Buffer, uint32_t Length);
+
 private:
     CRecompiler();                              // Disable default constructor
     CRecompiler(const CRecompiler&);            // Disable copy constructor
     CRecompiler& operator=(const CRecompiler&); // Disable assignment
 
-    CCompiledFunc * CompileCode();
+    CCompiledFunc * CompileCode(uint32_t EnterPC);
+    CCompiledFunc * FindCompiledFunc(uint32_t EnterPC);
+    CCompiledFunc * CompileBlock(uint32_t EnterPC);
+    void AddCompiledFunc(CCompiledFunc * Func);
 
     typedef struct
     {
@@ -72,6 +87,36 @@ private:
 
     typedef std::map <CCompiledFunc::Func, FUNCTION_PROFILE_DATA> FUNCTION_PROFILE;
 
+    enum { CodeSnapshotSize = 0x2000 };
+
+    typedef struct
+    {
+        uint32_t VAddr;   // start of the 4k page holding the block entry
+        uint32_t PAddr;
+        uint8_t * Memory; // host address of PAddr, found when the request was queued
+        uint32_t Length;
+        bool     Missed;  // compile read outside of the snapshot
+        uint32_t Words[CodeSnapshotSize / sizeof(uint32_t)];
+    } CODE_SNAPSHOT;
+
+    enum COMPILE_STATE
+    {
+        Compile_Queued,
+        Compile_Done,
+        Compile_Foreground,
+    };
+
+    typedef struct
+    {
+        uint32_t        VAddr;
+        uint32_t        Hits;
+        COMPILE_STATE   State;
+        CODE_SNAPSHOT * Snapshot;
+        CCompiledFunc * Func;
+    } COMPILE_REQUEST;
+
+    typedef std::map <uint32_t, COMPILE_REQUEST> COMPILE_QUEUE; // keyed by physical address
+
     // Main loops for the different look up methods
     void RecompilerMain_VirtualTable();
     void RecompilerMain_VirtualTable_validate();
@@ -80,6 +125,25 @@ private:
     void RecompilerMain_Lookup_TLB();
     void RecompilerMain_Lookup_validate();
     void RecompilerMain_Lookup_validate_TLB();
+    void RecompilerMain_Lookup_Background();
+
+    //Background compilation
+    static void CompileThreadProc(CRecompiler * _this);
+    void StartCompileThread();
+    void StopCompileThread();
+    void CompileThread();
+    CCompiledFunc * BackgroundLookup(uint32_t VAddr, uint32_t PAddr);
+    CCompiledFunc * CompileForeground(uint32_t VAddr, uint32_t PAddr);
+    bool NextCompileRequest(uint32_t & PAddr, uint32_t & VAddr, CODE_SNAPSHOT * & Snapshot);
+    void CompileRequestDone(uint32_t PAddr, CCompiledFunc * Func, bool Missed);
+    void PublishCompiledCode();
+    void ClearCompileQueue();
+    bool SnapshotCurrent(const CODE_SNAPSHOT * Snapshot, const CCompiledFunc * Func);
+    void InterpretBlock();
+
+    void RecordCodeInvalidation(bool HadCode);
+
+    enum { MaxEvictedPCs = 0x10000 };
 
     CCompiledFuncList  m_Functions;
     CRegisters       & m_Registers;
@@ -87,6 +151,25 @@ private:
     uint32_t           m_MemoryStack;
     FUNCTION_PROFILE m_BlockProfile;
 
+    CThread          * m_CompileThread;
+    CriticalSection    m_CompileCS;      // held while writing to the code buffer or freeing code from it
+    CriticalSection    m_CompileQueueCS;
+    SyncEvent          m_CompileEvent;
+    COMPILE_QUEUE      m_CompileQueue;
+    volatile bool      m_CompileThreadStop;
+    volatile bool      m_CompileThreadDone;
+    volatile bool      m_CompiledCodeReady;
+    volatile bool      m_EvictRequested;
+    uint32_t           m_BackgroundCompiled;
+    uint32_t           m_BackgroundStale;
+    uint64_t           m_InterpretedOps;
+    std::set<uint32_t> m_EvictedPCs;
+    uint32_t           m_CodeInvalidations;
+    uint32_t           m_CodeInvalidationsAvoided;
+    uint64_t           m_CodeInvalidationTime;
+
+    static CODE_SNAPSHOT * m_CodeSnapshot;
+
     //Quick access to registers
     uint32_t            & PROGRAM_COUNTER;
 };
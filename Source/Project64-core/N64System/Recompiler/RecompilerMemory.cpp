@@ -15,10 +15,18 @@
 #include <Common/MemoryManagement.h>
 
 CRecompMemory::CRecompMemory() :
+m_BlocksCompiled(0),
+m_BlocksRecompiled(0),
 m_RecompCode(NULL),
-m_RecompSize(0)
+m_RecompSize(0),
+m_CodeRegion(0),
+m_RegionsEvicted(0),
+m_BlocksEvicted(0),
+m_RegionClock(0)
 {
     m_RecompPos = NULL;
+    memset(m_RegionInUse, 0, sizeof(m_RegionInUse));
+    memset(m_RegionAge, 0, sizeof(m_RegionAge));
 }
 
 CRecompMemory::~CRecompMemory()
@@ -43,7 +51,7 @@ bool CRecompMemory::AllocateMemory()
         return false;
     }
 
-    m_RecompCode = (uint8_t *)CommitMemory(RecompCodeBase, InitialCompileBufferSize, MEM_EXECUTE_READWRITE);
+    m_RecompCode = (uint8_t *)CommitMemory(RecompCodeBase, CodeRegionSize, MEM_EXECUTE_READWRITE);
     if (m_RecompCode == NULL)
     {
         WriteTrace(TraceRecompiler, TraceError, "failed to commit initial buffer");
@@ -51,42 +59,103 @@ bool CRecompMemory::AllocateMemory()
         g_Notify->DisplayError(MSG_MEM_ALLOC_ERROR);
         return false;
     }
-    m_RecompSize = InitialCompileBufferSize;
+    m_RecompSize = CodeRegionSize;
     m_RecompPos = m_RecompCode;
-    memset(m_RecompCode, 0, InitialCompileBufferSize);
+    memset(m_RecompCode, 0, CodeRegionSize);
+    Reset();
     WriteTrace(TraceRecompiler, TraceDebug, "Done");
     return true;
 }
 
 void CRecompMemory::CheckRecompMem()
 {
-    uint32_t Size = (uint32_t)((uint8_t *)m_RecompPos - (uint8_t *)m_RecompCode);
-    if ((Size + 0x20000) < m_RecompSize)
+    uint32_t Size = (uint32_t)(m_RecompPos - CodeRegion(m_CodeRegion));
+    if ((Size + 0x20000) < CodeRegionSize)
     {
         return;
     }
-    if (m_RecompSize == MaxCompileBufferSize)
+
+    uint32_t NextRegion = NextCodeRegion();
+    uint8_t * RegionStart = CodeRegion(NextRegion);
+    if ((NextRegion + 1) * CodeRegionSize > m_RecompSize)
     {
-        g_Recompiler->ResetRecompCode(true);
-        return;
+        void * MemAddr = CommitMemory(RegionStart, CodeRegionSize, MEM_EXECUTE_READWRITE);
+        if (MemAddr == NULL)
+        {
+            WriteTrace(TraceRecompiler, TraceError, "failed to increase buffer");
+            g_Notify->FatalError(MSG_MEM_ALLOC_ERROR);
+        }
+        m_RecompSize += CodeRegionSize;
+    }
+    else if (m_RegionInUse[NextRegion])
+    {
+        uint32_t Blocks = g_Recompiler->EvictRecompCode(RegionStart, RegionStart + CodeRegionSize);
+        m_RegionsEvicted += 1;
+        m_BlocksEvicted += Blocks;
+        WriteTrace(TraceRecompiler, TraceInfo, "Evicted code region %d (%d blocks, age: %d)", NextRegion, Blocks, m_RegionClock - m_RegionAge[NextRegion]);
+    }
+    m_RegionClock += 1;
+    m_CodeRegion = NextRegion;
+    m_RegionInUse[NextRegion] = true;
+    m_RegionAge[NextRegion] = m_RegionClock;
+    m_RecompPos = RegionStart;
+}
+
+uint32_t CRecompMemory::NextCodeRegion() const
+{
+    //fill the regions that are free or not committed yet first
+    uint32_t Committed = m_RecompSize / CodeRegionSize;
+    for (uint32_t i = 0; i < Committed; i++)
+    {
+        if (!m_RegionInUse[i])
+        {
+            return i;
+        }
     }
-    void * MemAddr = CommitMemory(m_RecompCode + m_RecompSize, IncreaseCompileBufferSize, MEM_EXECUTE_READWRITE);
-    if (MemAddr == NULL)
+    if (Committed < CodeRegionCount)
     {
-        WriteTrace(TraceRecompiler, TraceError, "failed to increase buffer");
-        g_Notify->FatalError(MSG_MEM_ALLOC_ERROR);
+        return Committed;
     }
-    m_RecompSize += IncreaseCompileBufferSize;
+
+    //then reuse the region that was least recently entered
+    uint32_t Oldest = (m_CodeRegion + 1) % CodeRegionCount;
+    for (uint32_t i = 0; i < CodeRegionCount; i++)
+    {
+        if (i != m_CodeRegion && m_RegionAge[i] < m_RegionAge[Oldest])
+        {
+            Oldest = i;
+        }
+    }
+    return Oldest;
+}
+
+bool CRecompMemory::RecompMemNeedsEviction() const
+{
+    uint32_t Size = (uint32_t)(m_RecompPos - CodeRegion(m_CodeRegion));
+    return (Size + 0x20000) >= CodeRegionSize && m_RegionInUse[NextCodeRegion()];
 }
 
 void CRecompMemory::Reset()
 {
     m_RecompPos = m_RecompCode;
+    m_CodeRegion = 0;
+    memset(m_RegionInUse, 0, sizeof(m_RegionInUse));
+    memset(m_RegionAge, 0, sizeof(m_RegionAge));
+    m_RegionInUse[0] = true;
+    m_RegionAge[0] = m_RegionClock;
 }
 
 void CRecompMemory::ShowMemUsed()
 {
-    uint32_t Size = m_RecompPos - m_RecompCode;
+    uint32_t Size = 0;
+    for (uint32_t i = 0; i < CodeRegionCount; i++)
+    {
+        if (!m_RegionInUse[i])
+        {
+            continue;
+        }
+        Size += i == m_CodeRegion ? (uint32_t)(m_RecompPos - CodeRegion(i)) : CodeRegionSize;
+    }
     uint32_t MB = Size / 0x100000;
     Size -= MB * 0x100000;
     uint32_t KB = Size / 1024;
@@ -94,5 +163,8 @@ void CRecompMemory::ShowMemUsed()
 
     uint32_t TotalAvaliable = m_RecompSize / 0x100000;
 
-    g_Notify->DisplayMessage(0, stdstr_f("Memory used: %d mb %-3d kb %-3d bytes     Total Available: %d mb", MB, KB, Size, TotalAvaliable).c_str());
+    uint32_t RecompileRate = m_BlocksCompiled != 0 ? (m_BlocksRecompiled * 100) / m_BlocksCompiled : 0;
+
+    g_Notify->DisplayMessage(0, stdstr_f("Memory used: %d mb %-3d kb %-3d bytes     Total Available: %d mb     Region: %d/%d     Evicted: %d regions %d blocks     Recompiled: %d%%",
+        MB, KB, Size, TotalAvaliable, m_CodeRegion + 1, CodeRegionCount, m_RegionsEvicted, m_BlocksEvicted, RecompileRate).c_str());
 }
\ No newline at end of file
@@ -19,21 +19,43 @@ protected:
 
     bool AllocateMemory();
     void CheckRecompMem();
+    bool RecompMemNeedsEviction() const;
+    uint32_t NextCodeRegion() const;
     void Reset();
     void ShowMemUsed();
 
+    //Code cache statistics
+    uint32_t m_BlocksCompiled;
+    uint32_t m_BlocksRecompiled;
+
 public:
     uint8_t** RecompPos() { return &m_RecompPos; }
 
+    //Marks the region holding the code as used, called each time a block is entered from the look up loop
+    void TouchCodeRegion(const uint8_t * Code) { m_RegionAge[(uint32_t)(Code - m_RecompCode) / CodeRegionSize] = m_RegionClock; }
+
 private:
     CRecompMemory(const CRecompMemory&);				// Disable copy constructor
     CRecompMemory& operator=(const CRecompMemory&);		// Disable assignment
 
+    enum { MaxCompileBufferSize = 0x03C00000 };
+    enum { CodeRegionSize = 0x00400000 };
+    enum { CodeRegionCount = MaxCompileBufferSize / CodeRegionSize };
+
+    uint8_t * CodeRegion(uint32_t Region) const { return m_RecompCode + (Region * CodeRegionSize); }
+
     uint8_t * m_RecompCode;
     uint32_t  m_RecompSize;
     uint8_t * m_RecompPos;
 
-    enum { MaxCompileBufferSize = 0x03C00000 };
-    enum { InitialCompileBufferSize = 0x00500000 };
-    enum { IncreaseCompileBufferSize = 0x00100000 };
+    //The buffer is split in to fixed regions that are filled in order, once
+    //every region has been committed the region whose code was entered the
+    //longest ago is evicted and reused. The age is the region generation
+    //(incremented each time a new region is started) it was last entered in
+    uint32_t  m_CodeRegion;
+    bool      m_RegionInUse[CodeRegionCount];
+    uint32_t  m_RegionAge[CodeRegionCount];
+    uint32_t  m_RegionClock;
+    uint32_t  m_RegionsEvicted;
+    uint32_t  m_BlocksEvicted;
 };
@@ -261,7 +261,7 @@ void CX86RecompilerOps::Compile_Branch(BRANCH_COMPARE CompareType, BRANCH_TYPE B
                 {
                     OPCODE Command;
 
-                    if (!g_MMU->LW_VAddr(m_CompilePC + 4, Command.Hex))
+                    if (!CRecompiler::LoadCodeWord(m_CompilePC + 4, Command.Hex))
                     {
                         g_Notify->FatalError(GS(MSG_FAIL_LOAD_WORD));
                     }
@@ -2393,7 +2393,7 @@ void CX86RecompilerOps::LUI()
         x86Reg Reg = Map_MemoryStack(x86_Any, true, false);
         uint32_t Address;
 
-        g_TransVaddr->TranslateVaddr(((int16_t)m_Opcode.offset << 16), Address);
+        CRecompiler::TranslateCodeVaddr(((int16_t)m_Opcode.offset << 16), Address);
         if (Reg < 0)
         {
             MoveConstToVariable((uint32_t)(Address + g_MMU->Rdram()), &(g_Recompiler->MemoryStackPos()), "MemoryStack");
@@ -2551,7 +2551,7 @@ void CX86RecompilerOps::LB_KnownAddress(x86Reg Reg, uint32_t VAddr, bool SignExt
         return;
     }
 
-    if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+    if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
     {
         MoveConstToX86reg(0, Reg);
         CPU_Message("%s\nFailed to translate address %08X", __FUNCTION__, VAddr);
@@ -2622,7 +2622,7 @@ void CX86RecompilerOps::LH_KnownAddress(x86Reg Reg, uint32_t VAddr, bool SignExt
         return;
     }
 
-    if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+    if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
     {
         MoveConstToX86reg(0, Reg);
         CPU_Message("%s\nFailed to translate address %08X", __FUNCTION__, VAddr);
@@ -2981,7 +2981,7 @@ void CX86RecompilerOps::LW_KnownAddress(x86Reg Reg, uint32_t VAddr)
     }
     else
     {
-        if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+        if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
         {
             g_Notify->BreakPoint(__FILE__, __LINE__);
         }
@@ -3006,6 +3006,7 @@ void CX86RecompilerOps::LW_KnownAddress(x86Reg Reg, uint32_t VAddr)
                 MoveVariableToX86reg(PAddr + g_MMU->Rdram(), VarName, Reg);
                 break;
             }
+            CompileRspTaskSync();
             switch (PAddr)
             {
             case 0x04040010: MoveVariableToX86reg(&g_Reg->SP_STATUS_REG, "SP_STATUS_REG", Reg); break;
@@ -3043,6 +3044,7 @@ void CX86RecompilerOps::LW_KnownAddress(x86Reg Reg, uint32_t VAddr)
             }
             break;
         case 0x04300000:
+            CompileRspTaskSync();
             switch (PAddr)
             {
             case 0x04300000: MoveVariableToX86reg(&g_Reg->MI_MODE_REG, "MI_MODE_REG", Reg); break;
@@ -8886,17 +8888,57 @@ void CX86RecompilerOps::CompileInPermLoop(CRegInfo & RegSet, uint32_t ProgramCou
 bool CX86RecompilerOps::SetupRegisterForLoop(CCodeBlock * BlockInfo, const CRegInfo & RegSet)
 {
     CRegInfo OriginalReg = m_RegWorkingSet;
-    if (!LoopAnalysis(BlockInfo, m_Section).SetupRegisterForLoop())
+    LoopAnalysis Loop(BlockInfo, m_Section);
+    if (!Loop.SetupRegisterForLoop())
     {
         return false;
     }
+
+    //Registers that are changed in the loop and read again are loop carried, keep the
+    //most read of them in x86 registers across the loop sections so the back edge only
+    //has to sync the mapping instead of storing and reloading them each iteration
+    bool Resident[32] = { false };
+    if (g_System->bRegCaching() && g_System->b32BitCore())
+    {
+        for (int Count = 0; Count < MaxLoopResidentRegs; Count++)
+        {
+            int Best = 0;
+            for (int i = 1; i < 32; i++)
+            {
+                if (Resident[i] || OriginalReg.GetMipsRegState(i) == RegSet.GetMipsRegState(i))
+                {
+                    continue;
+                }
+                if (Loop.RegisterReads(i) > Loop.RegisterReads(Best))
+                {
+                    Best = i;
+                }
+            }
+            if (Best == 0)
+            {
+                break;
+            }
+            Resident[Best] = true;
+        }
+    }
+
     for (int i = 1; i < 32; i++)
     {
-        if (OriginalReg.GetMipsRegState(i) != RegSet.GetMipsRegState(i))
+        if (OriginalReg.GetMipsRegState(i) == RegSet.GetMipsRegState(i))
+        {
+            continue;
+        }
+        if (Resident[i])
+        {
+            CPU_Message("    regcache: keep %s resident in loop (reads: %d)", CRegName::GPR[i], Loop.RegisterReads(i));
+            Map_GPR_32bit(i, true, i);
+        }
+        else
         {
             UnMap_GPR(i, true);
         }
     }
+    ResetX86Protection();
     return true;
 }
 
@@ -9582,7 +9624,7 @@ void CX86RecompilerOps::SetCurrentPC(uint32_t ProgramCounter)
     m_CompilePC = ProgramCounter;
     __except_try()
     {
-        if (!g_MMU->LW_VAddr(m_CompilePC, m_Opcode.Hex))
+        if (!CRecompiler::LoadCodeWord(m_CompilePC, m_Opcode.Hex))
         {
             g_Notify->FatalError(GS(MSG_FAIL_LOAD_WORD));
         }
@@ -9640,6 +9682,18 @@ void CX86RecompilerOps::UpdateSyncCPU(CRegInfo & RegSet, uint32_t Cycles)
     RegSet.AfterCallDirect();
 }
 
+void CX86RecompilerOps::CompileRspTaskSync(void)
+{
+    if (!g_System->AsyncDlist())
+    {
+        return;
+    }
+
+    m_RegWorkingSet.BeforeCallDirect();
+    Call_Direct(AddressOf(&CN64System::WaitForRspTask), "CN64System::WaitForRspTask");
+    m_RegWorkingSet.AfterCallDirect();
+}
+
 void CX86RecompilerOps::UpdateCounters(CRegInfo & RegSet, bool CheckTimer, bool ClearValues)
 {
     if (RegSet.GetBlockCycleCount() != 0)
@@ -10093,7 +10147,7 @@ void CX86RecompilerOps::SB_Const(uint8_t Value, uint32_t VAddr)
         return;
     }
 
-    if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+    if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
     {
         CPU_Message("%s\nFailed to translate address: %08X", __FUNCTION__, VAddr);
         if (g_Settings->LoadBool(Debugger_ShowUnhandledMemory)) { g_Notify->DisplayError(stdstr_f("%s, \nFailed to translate address: %08X", __FUNCTION__, VAddr).c_str()); }
@@ -10141,7 +10195,7 @@ void CX86RecompilerOps::SB_Register(x86Reg Reg, uint32_t VAddr)
         return;
     }
 
-    if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+    if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
     {
         CPU_Message("%s\nFailed to translate address: %08X", __FUNCTION__, VAddr);
         if (g_Settings->LoadBool(Debugger_ShowUnhandledMemory))
@@ -10190,7 +10244,7 @@ void CX86RecompilerOps::SH_Const(uint16_t Value, uint32_t VAddr)
         return;
     }
 
-    if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+    if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
     {
         CPU_Message("%s\nFailed to translate address: %08X", __FUNCTION__, VAddr);
         if (g_Settings->LoadBool(Debugger_ShowUnhandledMemory))
@@ -10241,7 +10295,7 @@ void CX86RecompilerOps::SH_Register(x86Reg Reg, uint32_t VAddr)
         return;
     }
 
-    if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+    if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
     {
         CPU_Message("%s\nFailed to translate address: %08X", __FUNCTION__, VAddr);
         if (g_Settings->LoadBool(Debugger_ShowUnhandledMemory))
@@ -10291,7 +10345,7 @@ void CX86RecompilerOps::SW_Const(uint32_t Value, uint32_t VAddr)
         return;
     }
 
-    if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+    if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
     {
         CPU_Message("%s\nFailed to translate address: %08X", __FUNCTION__, VAddr);
         if (g_Settings->LoadBool(Debugger_ShowUnhandledMemory))
@@ -10347,6 +10401,7 @@ void CX86RecompilerOps::SW_Const(uint32_t Value, uint32_t VAddr)
             MoveConstToVariable(Value, PAddr + g_MMU->Rdram(), VarName);
             break;
         }
+        CompileRspTaskSync();
         switch (PAddr)
         {
         case 0x04040000: MoveConstToVariable(Value, &g_Reg->SP_MEM_ADDR_REG, "SP_MEM_ADDR_REG"); break;
@@ -10418,6 +10473,7 @@ void CX86RecompilerOps::SW_Const(uint32_t Value, uint32_t VAddr)
         }
         break;
     case 0x04300000:
+        CompileRspTaskSync();
         switch (PAddr)
         {
         case 0x04300000:
@@ -10545,6 +10601,7 @@ void CX86RecompilerOps::SW_Const(uint32_t Value, uint32_t VAddr)
                 JeLabel8("Continue", 0);
                 Jump = *g_RecompPos - 1;
                 MoveConstToVariable(Value, &g_Reg->VI_STATUS_REG, "VI_STATUS_REG");
+                CompileRspTaskSync();
                 m_RegWorkingSet.BeforeCallDirect();
                 Call_Direct((void *)g_Plugins->Gfx()->ViStatusChanged, "ViStatusChanged");
                 m_RegWorkingSet.AfterCallDirect();
@@ -10561,6 +10618,7 @@ void CX86RecompilerOps::SW_Const(uint32_t Value, uint32_t VAddr)
                 JeLabel8("Continue", 0);
                 Jump = *g_RecompPos - 1;
                 MoveConstToVariable(Value, &g_Reg->VI_WIDTH_REG, "VI_WIDTH_REG");
+                CompileRspTaskSync();
                 m_RegWorkingSet.BeforeCallDirect();
                 Call_Direct((void *)g_Plugins->Gfx()->ViWidthChanged, "ViWidthChanged");
                 m_RegWorkingSet.AfterCallDirect();
@@ -10864,7 +10922,7 @@ void CX86RecompilerOps::SW_Register(x86Reg Reg, uint32_t VAddr)
     char VarName[100];
     uint32_t PAddr;
 
-    if (!g_TransVaddr->TranslateVaddr(VAddr, PAddr))
+    if (!CRecompiler::TranslateCodeVaddr(VAddr, PAddr))
     {
         CPU_Message("%s\nFailed to translate address: %08X", __FUNCTION__, VAddr);
         if (g_Settings->LoadBool(Debugger_ShowUnhandledMemory))
@@ -10888,6 +10946,7 @@ void CX86RecompilerOps::SW_Register(x86Reg Reg, uint32_t VAddr)
         MoveX86regToVariable(Reg, PAddr + g_MMU->Rdram(), VarName);
         break;
     case 0x04000000:
+        CompileRspTaskSync();
         switch (PAddr)
         {
         case 0x04040000: MoveX86regToVariable(Reg, &g_Reg->SP_MEM_ADDR_REG, "SP_MEM_ADDR_REG"); break;
@@ -10969,6 +11028,7 @@ void CX86RecompilerOps::SW_Register(x86Reg Reg, uint32_t VAddr)
         m_RegWorkingSet.AfterCallDirect();
         break;
     case 0x04300000:
+        CompileRspTaskSync();
         switch (PAddr)
         {
         case 0x04300000:
@@ -11002,6 +11062,7 @@ void CX86RecompilerOps::SW_Register(x86Reg Reg, uint32_t VAddr)
                 JeLabel8("Continue", 0);
                 Jump = *g_RecompPos - 1;
                 MoveX86regToVariable(Reg, &g_Reg->VI_STATUS_REG, "VI_STATUS_REG");
+                CompileRspTaskSync();
                 m_RegWorkingSet.BeforeCallDirect();
                 Call_Direct((void *)g_Plugins->Gfx()->ViStatusChanged, "ViStatusChanged");
                 m_RegWorkingSet.AfterCallDirect();
@@ -11022,6 +11083,7 @@ void CX86RecompilerOps::SW_Register(x86Reg Reg, uint32_t VAddr)
                 JeLabel8("Continue", 0);
                 Jump = *g_RecompPos - 1;
                 MoveX86regToVariable(Reg, &g_Reg->VI_WIDTH_REG, "VI_WIDTH_REG");
+                CompileRspTaskSync();
                 m_RegWorkingSet.BeforeCallDirect();
                 Call_Direct((void *)g_Plugins->Gfx()->ViWidthChanged, "ViWidthChanged");
                 m_RegWorkingSet.AfterCallDirect();
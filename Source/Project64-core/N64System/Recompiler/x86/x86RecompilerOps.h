@@ -237,6 +237,9 @@ public:
     static void ChangeDefaultRoundingModel();
     void OverflowDelaySlot(bool TestTimer);
 
+    //loop carried GPRs kept in x86 registers across a loop, leaves the rest free for temporaries
+    enum { MaxLoopResidentRegs = 4 };
+
     /********* Helper Functions *********/
     typedef CRegInfo::REG_STATE REG_STATE;
 
@@ -353,6 +356,7 @@ private:
     void SH_Register(CX86Ops::x86Reg Reg, uint32_t Addr);
     void SW_Const(uint32_t Value, uint32_t Addr);
     void SW_Register(CX86Ops::x86Reg Reg, uint32_t Addr);
+    void CompileRspTaskSync(void);
     void LB_KnownAddress(x86Reg Reg, uint32_t VAddr, bool SignExtend);
     void LH_KnownAddress(x86Reg Reg, uint32_t VAddr, bool SignExtend);
     void LW_KnownAddress(x86Reg Reg, uint32_t VAddr);
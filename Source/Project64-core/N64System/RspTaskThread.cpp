@@ -0,0 +1,150 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#include "stdafx.h"
+#include "RspTaskThread.h"
+#include <Project64-core/N64System/SystemGlobals.h>
+#include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
+#include <Project64-core/Settings/GameSettings.h>
+#include <Project64-core/Plugin.h>
+#include <Project64-core/ExceptionHandler.h>
+#include <Common/MemoryManagement.h>
+#include <Common/Util.h>
+
+CRspTaskThread::CRspTaskThread() :
+    m_Thread(NULL),
+    m_Busy(false),
+    m_Quit(false)
+{
+}
+
+CRspTaskThread::~CRspTaskThread()
+{
+    Wait();
+    if (m_Thread == NULL)
+    {
+        return;
+    }
+    m_Quit = true;
+    m_TaskReady.Trigger();
+    for (int i = 0; i < 500 && m_Thread->isRunning(); i++)
+    {
+        pjutil::Sleep(10);
+    }
+    delete m_Thread;
+    m_Thread = NULL;
+}
+
+void CRspTaskThread::Start(void)
+{
+    Wait();
+    if (m_Thread == NULL)
+    {
+        m_Thread = new CThread((CThread::CTHREAD_START_ROUTINE)TaskThreadProc);
+        m_Thread->Start(this);
+    }
+    m_Busy = true;
+    m_TaskDone.Reset();
+    m_TaskReady.Trigger();
+}
+
+void CRspTaskThread::Wait(void)
+{
+    if (!m_Busy)
+    {
+        return;
+    }
+    m_TaskDone.IsTriggered(SyncEvent::INFINITE_TIMEOUT);
+    m_Busy = false;
+    ReleaseRdram();
+}
+
+void CRspTaskThread::TrackRdram(uint32_t PAddr, uint32_t Length)
+{
+    PAddr &= 0x1FFFFFFF;
+    if (Length == 0 || PAddr >= g_MMU->RdramSize())
+    {
+        return;
+    }
+    uint32_t End = PAddr + Length < g_MMU->RdramSize() ? PAddr + Length : g_MMU->RdramSize();
+
+    CGuard Guard(m_TrackedCS);
+    for (uint32_t Page = PAddr & ~0xFFF; Page < End; Page += 0x1000)
+    {
+        if (m_Tracked.insert(Page).second)
+        {
+            ::ProtectMemory(g_MMU->Rdram() + Page, 0x1000, MEM_READONLY);
+        }
+    }
+}
+
+bool CRspTaskThread::WriteFault(uint32_t PAddr)
+{
+    CGuard Guard(m_TrackedCS);
+    std::set<uint32_t>::iterator itr = m_Tracked.find(PAddr & ~0xFFF);
+    if (itr == m_Tracked.end())
+    {
+        return false;
+    }
+    ReleasePage(*itr);
+    m_Tracked.erase(itr);
+    return true;
+}
+
+void CRspTaskThread::ReleaseRdram(void)
+{
+    CGuard Guard(m_TrackedCS);
+    for (std::set<uint32_t>::const_iterator itr = m_Tracked.begin(); itr != m_Tracked.end(); itr++)
+    {
+        ReleasePage(*itr);
+    }
+    m_Tracked.clear();
+}
+
+void CRspTaskThread::ReleasePage(uint32_t Page)
+{
+    //The recompiler may have protected the page for code it compiled from it, there
+    //is no asking which pages those are so the page stays read only and the first
+    //write goes through the self modifying code check instead
+    if (g_Recompiler != NULL && CGameSettings::bSMM_Protect())
+    {
+        return;
+    }
+    ::ProtectMemory(g_MMU->Rdram() + Page, 0x1000, MEM_READWRITE);
+}
+
+bool CRspTaskThread::OnTaskThread(void) const
+{
+    return m_Thread != NULL && m_Thread->ThreadID() == CThread::GetCurrentThreadId();
+}
+
+void CRspTaskThread::TaskThreadProc(CRspTaskThread * _this)
+{
+    for (;;)
+    {
+        _this->m_TaskReady.IsTriggered(SyncEvent::INFINITE_TIMEOUT);
+        _this->m_TaskReady.Reset();
+        if (_this->m_Quit)
+        {
+            break;
+        }
+
+        __except_try()
+        {
+            g_Plugins->RSP()->DoRspCycles(CRSP_Plugin::UnlimitedCycles);
+        }
+        __except_catch()
+        {
+            WriteTrace(TraceRSP, TraceError, "exception generated");
+            g_Notify->FatalError("CRspTaskThread::TaskThreadProc()\nUnknown memory action\n\nEmulation stop");
+        }
+        _this->m_TaskDone.Trigger();
+    }
+}
@@ -0,0 +1,56 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#pragma once
+#include <Common/CriticalSection.h>
+#include <Common/SyncEvent.h>
+#include <Common/Thread.h>
+#include <set>
+
+// Runs graphics tasks through the RSP plugin on a thread of their own so the
+// display list is processed while the CPU keeps going. The thread is started
+// with the first task and kept for the session, Start hands it a task and Wait
+// blocks until that task is finished.
+//
+// The rdram the task reads is write protected while it runs (TrackRdram), a
+// cpu write to one of those pages faults and WriteFault tells the memory
+// filter to collect the task before the store is retried, so the task never
+// sees data the cpu wrote after it was started.
+class CRspTaskThread
+{
+public:
+    CRspTaskThread();
+    ~CRspTaskThread();
+
+    void Start(void);
+    void Wait(void);
+    bool Busy(void) const { return m_Busy; }
+    bool OnTaskThread(void) const;
+
+    void TrackRdram(uint32_t PAddr, uint32_t Length);
+    bool WriteFault(uint32_t PAddr);
+
+private:
+    CRspTaskThread(const CRspTaskThread&);            // Disable copy constructor
+    CRspTaskThread& operator=(const CRspTaskThread&); // Disable assignment
+
+    static void TaskThreadProc(CRspTaskThread * _this);
+
+    void ReleaseRdram(void);
+    void ReleasePage(uint32_t Page);
+
+    CThread * m_Thread;
+    SyncEvent m_TaskReady;
+    SyncEvent m_TaskDone;
+    bool m_Busy;
+    bool m_Quit;
+    CriticalSection m_TrackedCS;
+    std::set<uint32_t> m_Tracked; // rdram pages protected for the running task
+};
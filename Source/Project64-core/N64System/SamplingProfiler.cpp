@@ -0,0 +1,291 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#include "stdafx.h"
+#include <Project64-core/N64System/SamplingProfiler.h>
+#include <Project64-core/N64System/Mips/RegisterClass.h>
+#include <Project64-core/N64System/Mips/MemoryVirtualMem.h>
+#include <Common/LogClass.h>
+#include <Common/path.h>
+#include <Common/Util.h>
+#include <algorithm>
+#include <vector>
+
+enum { SAMPLE_PERIOD_MS = 1, MAX_REPORT_FUNCTIONS = 50 };
+
+CSamplingProfiler::CSamplingProfiler(CRegisters & Reg, CMipsMemoryVM & MMU) :
+m_Reg(Reg),
+m_MMU(MMU),
+m_SampleThread(NULL),
+m_SampleThreadStop(false),
+m_Recompiler(false),
+m_SampleCount(0)
+{
+}
+
+CSamplingProfiler::~CSamplingProfiler()
+{
+    if (m_SampleThread != NULL)
+    {
+        m_SampleThreadStop = true;
+        for (int i = 0; i < 500 && m_SampleThread->isRunning(); i++)
+        {
+            pjutil::Sleep(10);
+        }
+        delete m_SampleThread;
+        m_SampleThread = NULL;
+    }
+}
+
+void CSamplingProfiler::Start(bool Recompiler)
+{
+    if (m_SampleThread != NULL)
+    {
+        return;
+    }
+    WriteTrace(TraceN64System, TraceInfo, "Start (Recompiler: %s)", Recompiler ? "true" : "false");
+    m_Recompiler = Recompiler;
+    m_Samples.clear();
+    m_SampleCount = 0;
+    m_SampleThreadStop = false;
+    m_SampleThread = new CThread((CThread::CTHREAD_START_ROUTINE)SampleThreadProc);
+    m_SampleThread->Start(this);
+}
+
+void CSamplingProfiler::Stop(void)
+{
+    if (m_SampleThread == NULL)
+    {
+        return;
+    }
+    m_SampleThreadStop = true;
+    for (int i = 0; i < 500 && m_SampleThread->isRunning(); i++)
+    {
+        pjutil::Sleep(10);
+    }
+    delete m_SampleThread;
+    m_SampleThread = NULL;
+    WriteTrace(TraceN64System, TraceInfo, "Stopped, %d samples", m_SampleCount);
+    WriteResults();
+}
+
+void CSamplingProfiler::SampleThreadProc(CSamplingProfiler * _this)
+{
+    _this->SampleThread();
+}
+
+void CSamplingProfiler::SampleThread(void)
+{
+    while (!m_SampleThreadStop)
+    {
+        pjutil::Sleep(SAMPLE_PERIOD_MS);
+        TakeSample();
+    }
+}
+
+void CSamplingProfiler::TakeSample(void)
+{
+    // The registers are read without stopping the cpu, a sample can be torn
+    // between the PC and RA but that only moves one sample to another bucket
+    SAMPLE_KEY Key;
+    Key.PC = m_Reg.m_PROGRAM_COUNTER;
+    Key.RA = m_Reg.m_GPR[31].UW[0];
+    Key.OpClass = m_Recompiler ? OpClass_Recompiled : ClassifyOp(Key.PC);
+
+    CGuard Guard(m_CS);
+    m_Samples[Key] += 1;
+    m_SampleCount += 1;
+}
+
+CSamplingProfiler::OP_CLASS CSamplingProfiler::ClassifyOp(uint32_t PC)
+{
+    uint32_t PAddr;
+    if (!m_MMU.TranslateVaddr(PC, PAddr) || PAddr + 4 > m_MMU.RdramSize())
+    {
+        return OpClass_Unknown;
+    }
+    uint32_t Op = *(uint32_t *)(m_MMU.Rdram() + PAddr);
+
+    switch (Op >> 26)
+    {
+    case 0x00:
+        switch (Op & 0x3F)
+        {
+        case 0x08: case 0x09: return OpClass_Branch;
+        case 0x0C: case 0x0D: case 0x0F: return OpClass_Other;
+        }
+        return OpClass_ALU;
+    case 0x01: case 0x02: case 0x03: case 0x04: case 0x05: case 0x06: case 0x07:
+    case 0x14: case 0x15: case 0x16: case 0x17:
+        return OpClass_Branch;
+    case 0x08: case 0x09: case 0x0A: case 0x0B: case 0x0C: case 0x0D: case 0x0E: case 0x0F:
+    case 0x18: case 0x19:
+        return OpClass_ALU;
+    case 0x10: return OpClass_COP0;
+    case 0x11: return OpClass_COP1;
+    case 0x1A: case 0x1B:
+    case 0x20: case 0x21: case 0x22: case 0x23: case 0x24: case 0x25: case 0x26: case 0x27:
+    case 0x30: case 0x31: case 0x34: case 0x35: case 0x37:
+        return OpClass_Load;
+    case 0x28: case 0x29: case 0x2A: case 0x2B: case 0x2C: case 0x2D: case 0x2E:
+    case 0x38: case 0x39: case 0x3C: case 0x3D: case 0x3F:
+        return OpClass_Store;
+    }
+    return OpClass_Other;
+}
+
+void CSamplingProfiler::FindFunctions(FUNCTIONS & Functions)
+{
+    // There is no symbol table for the running game, so every JAL target found
+    // in RDRAM is taken as the start of a function
+    const uint32_t * Rdram = (const uint32_t *)m_MMU.Rdram();
+    uint32_t RdramSize = m_MMU.RdramSize();
+    for (uint32_t i = 0, n = RdramSize >> 2; i < n; i++)
+    {
+        uint32_t Op = Rdram[i];
+        if ((Op >> 26) != 0x03)
+        {
+            continue;
+        }
+        uint32_t Target = 0x80000000 | ((Op & 0x03FFFFFF) << 2);
+        if ((Target & 0x1FFFFFFF) < RdramSize)
+        {
+            Functions.insert(Target);
+        }
+    }
+}
+
+uint32_t CSamplingProfiler::FunctionFor(const FUNCTIONS & Functions, uint32_t PC)
+{
+    uint32_t PAddr;
+    if (!m_MMU.TranslateVaddr(PC, PAddr) || PAddr >= m_MMU.RdramSize())
+    {
+        return 0;
+    }
+    FUNCTIONS::const_iterator itr = Functions.upper_bound(0x80000000 | PAddr);
+    if (itr == Functions.begin())
+    {
+        return 0;
+    }
+    --itr;
+    return *itr;
+}
+
+std::string CSamplingProfiler::FunctionName(uint32_t Address)
+{
+    if (Address == 0)
+    {
+        return "unknown";
+    }
+    return m_MMU.LabelName(Address);
+}
+
+const char * CSamplingProfiler::OpClassName(OP_CLASS OpClass)
+{
+    switch (OpClass)
+    {
+    case OpClass_ALU: return "ALU";
+    case OpClass_Branch: return "Branch";
+    case OpClass_Load: return "Load";
+    case OpClass_Store: return "Store";
+    case OpClass_COP0: return "COP0";
+    case OpClass_COP1: return "COP1";
+    case OpClass_Other: return "Other";
+    case OpClass_Recompiled: return "Recompiled";
+    default:
+        break;
+    }
+    return "Unknown";
+}
+
+void CSamplingProfiler::WriteResults(void)
+{
+    CGuard Guard(m_CS);
+    if (m_SampleCount == 0)
+    {
+        return;
+    }
+
+    FUNCTIONS Functions;
+    FindFunctions(Functions);
+
+    typedef std::map<std::string, uint32_t> FOLDED_STACKS;
+    typedef std::map<uint32_t, uint32_t> FUNCTION_COUNT;
+
+    FOLDED_STACKS Folded;
+    FUNCTION_COUNT FunctionCount;
+    uint32_t OpClassCount[OpClass_Max];
+    memset(OpClassCount, 0, sizeof(OpClassCount));
+
+    for (SAMPLES::const_iterator itr = m_Samples.begin(); itr != m_Samples.end(); itr++)
+    {
+        const SAMPLE_KEY & Key = itr->first;
+        uint32_t Function = FunctionFor(Functions, Key.PC);
+        uint32_t Caller = FunctionFor(Functions, Key.RA - 8);
+
+        FunctionCount[Function] += itr->second;
+        OpClassCount[Key.OpClass] += itr->second;
+
+        char Leaf[32];
+        if (Key.OpClass == OpClass_Recompiled)
+        {
+            sprintf(Leaf, "block_0x%08X", Key.PC);
+        }
+        else
+        {
+            sprintf(Leaf, "%s", OpClassName(Key.OpClass));
+        }
+        std::string Stack = FunctionName(Caller);
+        Stack += ";";
+        Stack += FunctionName(Function);
+        Stack += ";";
+        Stack += Leaf;
+        Folded[Stack] += itr->second;
+    }
+
+    CLog FoldedLog;
+    if (FoldedLog.Open(CPath(g_Settings->LoadStringVal(Directory_Log).c_str(), "SampleProfile.folded")))
+    {
+        for (FOLDED_STACKS::const_iterator itr = Folded.begin(); itr != Folded.end(); itr++)
+        {
+            FoldedLog.LogF("%s %d\n", itr->first.c_str(), itr->second);
+        }
+    }
+
+    CLog Report;
+    if (!Report.Open(CPath(g_Settings->LoadStringVal(Directory_Log).c_str(), "SampleProfile.txt")))
+    {
+        return;
+    }
+    Report.LogF("Samples: %d (every %d ms, %s)\n\n", m_SampleCount, SAMPLE_PERIOD_MS, m_Recompiler ? "recompiler" : "interpreter");
+
+    std::vector<std::pair<uint32_t, uint32_t> > Ordered;
+    for (FUNCTION_COUNT::const_iterator itr = FunctionCount.begin(); itr != FunctionCount.end(); itr++)
+    {
+        Ordered.push_back(std::make_pair(itr->second, itr->first));
+    }
+    std::sort(Ordered.rbegin(), Ordered.rend());
+
+    Report.LogF("Function      Samples  Percent\n");
+    for (size_t i = 0; i < Ordered.size() && i < MAX_REPORT_FUNCTIONS; i++)
+    {
+        Report.LogF("%-12s %8d  %6.2f%%\n", FunctionName(Ordered[i].second).c_str(), Ordered[i].first, (Ordered[i].first * 100.0) / m_SampleCount);
+    }
+
+    Report.LogF("\nOpcode class  Samples  Percent\n");
+    for (int i = 0; i < OpClass_Max; i++)
+    {
+        if (OpClassCount[i] == 0)
+        {
+            continue;
+        }
+        Report.LogF("%-12s %8d  %6.2f%%\n", OpClassName((OP_CLASS)i), OpClassCount[i], (OpClassCount[i] * 100.0) / m_SampleCount);
+    }
+}
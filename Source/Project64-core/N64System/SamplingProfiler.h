@@ -0,0 +1,88 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#pragma once
+#include <Common/CriticalSection.h>
+#include <Common/Thread.h>
+#include <map>
+#include <set>
+#include <string>
+
+class CRegisters;
+class CMipsMemoryVM;
+
+// Samples the program counter from a separate thread so the emulation thread
+// pays nothing for it, then writes per function / per opcode class summaries
+// and a folded stack file (caller;function;leaf count) for flamegraph tools.
+class CSamplingProfiler
+{
+public:
+    CSamplingProfiler(CRegisters & Reg, CMipsMemoryVM & MMU);
+    ~CSamplingProfiler();
+
+    void Start(bool Recompiler);
+    void Stop(void);
+
+private:
+    CSamplingProfiler();                                    // Disable default constructor
+    CSamplingProfiler(const CSamplingProfiler&);            // Disable copy constructor
+    CSamplingProfiler& operator=(const CSamplingProfiler&); // Disable assignment
+
+    enum OP_CLASS
+    {
+        OpClass_Unknown,
+        OpClass_ALU,
+        OpClass_Branch,
+        OpClass_Load,
+        OpClass_Store,
+        OpClass_COP0,
+        OpClass_COP1,
+        OpClass_Other,
+        OpClass_Recompiled,
+        OpClass_Max,
+    };
+
+    struct SAMPLE_KEY
+    {
+        uint32_t PC;
+        uint32_t RA;
+        OP_CLASS OpClass;
+
+        bool operator<(const SAMPLE_KEY & rhs) const
+        {
+            if (PC != rhs.PC) { return PC < rhs.PC; }
+            if (RA != rhs.RA) { return RA < rhs.RA; }
+            return OpClass < rhs.OpClass;
+        }
+    };
+
+    typedef std::map<SAMPLE_KEY, uint32_t> SAMPLES;
+    typedef std::set<uint32_t> FUNCTIONS;
+
+    static void SampleThreadProc(CSamplingProfiler * _this);
+    void SampleThread(void);
+    void TakeSample(void);
+    OP_CLASS ClassifyOp(uint32_t PC);
+    void FindFunctions(FUNCTIONS & Functions);
+    uint32_t FunctionFor(const FUNCTIONS & Functions, uint32_t PC);
+    std::string FunctionName(uint32_t Address);
+    void WriteResults(void);
+
+    static const char * OpClassName(OP_CLASS OpClass);
+
+    CRegisters & m_Reg;
+    CMipsMemoryVM & m_MMU;
+    CThread * m_SampleThread;
+    volatile bool m_SampleThreadStop;
+    bool m_Recompiler;
+    CriticalSection m_CS;
+    SAMPLES m_Samples;
+    uint32_t m_SampleCount;
+};
@@ -0,0 +1,143 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#include "stdafx.h"
+#include "SaveStateWriter.h"
+#include <Project64-core/3rdParty/zip.h>
+#include <Common/HighResTimeStamp.h>
+#include <Common/path.h>
+#include <Common/Util.h>
+#if defined(ANDROID)
+#include <utime.h>
+#endif
+
+CSaveStateWriter::CSaveStateWriter() :
+    m_WriteThread(NULL),
+    m_Zip(false)
+{
+}
+
+CSaveStateWriter::~CSaveStateWriter()
+{
+    WaitForPending();
+}
+
+void CSaveStateWriter::Append(std::vector<uint8_t> & Data, const void * Src, size_t Len)
+{
+    const uint8_t * Start = (const uint8_t *)Src;
+    Data.insert(Data.end(), Start, Start + Len);
+}
+
+bool CSaveStateWriter::Write(const char * SaveFile, bool Zip, const std::vector<uint8_t> & Image, const std::vector<uint8_t> & ExtraInfo)
+{
+    HighResTimeStamp StartTime;
+    StartTime.SetToNow();
+
+    CPath StateFile(SaveFile);
+    CPath ExtraInfoFile(StateFile);
+    ExtraInfoFile.SetExtension(".dat");
+
+    if (Zip)
+    {
+        CPath ZipFile(StateFile);
+        ZipFile.SetNameExtension(stdstr_f("%s.zip", ZipFile.GetNameExtension().c_str()).c_str());
+
+        ZipFile.Delete();
+        zipFile file = zipOpen(ZipFile, 0);
+        if (file == NULL)
+        {
+            WriteTrace(TraceN64System, TraceError, "Failed to open %s", (const char *)ZipFile);
+            return false;
+        }
+        uint32_t SaveID_1 = 0x56D2CD23;
+
+        // Fastest deflate level, the saved files still load in any version
+        zipOpenNewFileInZip(file, StateFile.GetNameExtension().c_str(), NULL, NULL, 0, NULL, 0, NULL, Z_DEFLATED, Z_BEST_SPEED);
+        zipWriteInFileInZip(file, Image.data(), (uint32_t)Image.size());
+        zipCloseFileInZip(file);
+
+        zipOpenNewFileInZip(file, ExtraInfoFile.GetNameExtension().c_str(), NULL, NULL, 0, NULL, 0, NULL, Z_DEFLATED, Z_BEST_SPEED);
+        zipWriteInFileInZip(file, &SaveID_1, sizeof(SaveID_1));
+        zipWriteInFileInZip(file, ExtraInfo.data(), (uint32_t)ExtraInfo.size());
+        zipCloseFileInZip(file);
+
+        zipClose(file, "");
+#if defined(ANDROID)
+        utimes((const char *)ZipFile, NULL);
+#endif
+    }
+    else
+    {
+        ExtraInfoFile.Delete();
+        StateFile.Delete();
+        CFile hSaveFile(StateFile, CFileBase::modeWrite | CFileBase::modeCreate);
+        if (!hSaveFile.IsOpen())
+        {
+            WriteTrace(TraceN64System, TraceError, "Failed to open %s", (const char *)StateFile);
+            return false;
+        }
+        hSaveFile.SeekToBegin();
+        hSaveFile.Write(Image.data(), (uint32_t)Image.size());
+        hSaveFile.Close();
+
+        CFile hExtraInfo(ExtraInfoFile, CFileBase::modeWrite | CFileBase::modeCreate);
+        if (hExtraInfo.IsOpen())
+        {
+            hExtraInfo.Write(ExtraInfo.data(), (uint32_t)ExtraInfo.size());
+            hExtraInfo.Close();
+        }
+    }
+
+    HighResTimeStamp EndTime;
+    EndTime.SetToNow();
+    WriteTrace(TraceN64System, TraceInfo, "Wrote %s (%d bytes, zip: %s) in %d us", SaveFile, (uint32_t)Image.size(), Zip ? "true" : "false", (uint32_t)(EndTime.GetMicroSeconds() - StartTime.GetMicroSeconds()));
+    return true;
+}
+
+void CSaveStateWriter::Queue(const char * SaveFile, bool Zip, std::vector<uint8_t> & Image, std::vector<uint8_t> & ExtraInfo)
+{
+    WaitForPending();
+
+    m_SaveFile = SaveFile;
+    m_Zip = Zip;
+    m_Image.swap(Image);
+    m_ExtraInfo.swap(ExtraInfo);
+
+    m_WriteDone.Reset();
+    m_WriteThread = new CThread((CThread::CTHREAD_START_ROUTINE)WriteThreadProc);
+    m_WriteThread->Start(this);
+}
+
+void CSaveStateWriter::WaitForPending(void)
+{
+    if (m_WriteThread == NULL)
+    {
+        return;
+    }
+    m_WriteDone.IsTriggered(SyncEvent::INFINITE_TIMEOUT);
+    for (int i = 0; i < 500 && m_WriteThread->isRunning(); i++)
+    {
+        pjutil::Sleep(10);
+    }
+    delete m_WriteThread;
+    m_WriteThread = NULL;
+
+    std::vector<uint8_t>().swap(m_Image);
+    std::vector<uint8_t>().swap(m_ExtraInfo);
+}
+
+void CSaveStateWriter::WriteThreadProc(CSaveStateWriter * _this)
+{
+    if (!Write(_this->m_SaveFile.c_str(), _this->m_Zip, _this->m_Image, _this->m_ExtraInfo))
+    {
+        g_Notify->DisplayError(GS(MSG_FAIL_OPEN_SAVE));
+    }
+    _this->m_WriteDone.Trigger();
+}
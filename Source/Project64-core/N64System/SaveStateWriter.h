@@ -0,0 +1,46 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+#pragma once
+#include <Common/SyncEvent.h>
+#include <Common/Thread.h>
+#include <vector>
+
+// Writes a save state that has already been copied out of the system in memory.
+// The image holds the .pj layout and the extra info holds the .dat timer data, so
+// the files written here load exactly as the ones written directly by the core.
+// Queue hands the buffers to a worker thread so the deflate and disk write do
+// not stall emulation.
+class CSaveStateWriter
+{
+public:
+    CSaveStateWriter();
+    ~CSaveStateWriter();
+
+    static void Append(std::vector<uint8_t> & Data, const void * Src, size_t Len);
+    static bool Write(const char * SaveFile, bool Zip, const std::vector<uint8_t> & Image, const std::vector<uint8_t> & ExtraInfo);
+
+    // Takes ownership of the buffers contents, waits for the previous save first
+    void Queue(const char * SaveFile, bool Zip, std::vector<uint8_t> & Image, std::vector<uint8_t> & ExtraInfo);
+    void WaitForPending(void);
+
+private:
+    CSaveStateWriter(const CSaveStateWriter&);            // Disable copy constructor
+    CSaveStateWriter& operator=(const CSaveStateWriter&); // Disable assignment
+
+    static void WriteThreadProc(CSaveStateWriter * _this);
+
+    CThread * m_WriteThread;
+    SyncEvent m_WriteDone;
+    stdstr m_SaveFile;
+    bool m_Zip;
+    std::vector<uint8_t> m_Image;
+    std::vector<uint8_t> m_ExtraInfo;
+};
@@ -60,8 +60,26 @@ bool CAudioPlugin::LoadFunctions(void)
     return true;
 }
 
+void CAudioPlugin::LoadBuiltInFunctions(void)
+{
+    // Drops all audio, buffers complete as soon as they are queued
+    strcpy(m_PluginInfo.Name, "Null Audio (built in)");
+    m_PluginInfo.Version = 0x0101;
+    AiDacrateChanged = BuiltInAiDacrateChanged;
+    AiLenChanged = BuiltInAiLenChanged;
+    AiReadLength = BuiltInAiReadLength;
+    AiUpdate = NULL;
+    ProcessAList = DummyBuiltIn;
+}
+
 bool CAudioPlugin::Initiate(CN64System * System, RenderWindow * Window)
 {
+    if (m_BuiltIn)
+    {
+        m_Initialized = true;
+        return m_Initialized;
+    }
+
     struct AUDIO_INFO
     {
         void * hwnd;
@@ -200,6 +218,15 @@ void CAudioPlugin::DacrateChanged(SYSTEM_TYPE Type)
     AiDacrateChanged(Type);
 }
 
+void CAudioPlugin::BuiltInAiLenChanged(void)
+{
+    if (g_Reg->AI_LEN_REG != 0)
+    {
+        g_Reg->m_AudioIntrReg |= MI_INTR_AI;
+        g_Reg->CheckInterrupts();
+    }
+}
+
 #ifdef _WIN32
 void CAudioPlugin::AudioThread(CAudioPlugin * _this)
 {
@@ -35,6 +35,7 @@ private:
     void * m_hAudioThread;
 
     bool LoadFunctions(void);
+    void LoadBuiltInFunctions(void);
     void UnloadPluginDetails(void);
 
     void(CALL *AiUpdate)        (int32_t Wait);
@@ -42,4 +43,8 @@ private:
 
     // Function used in a thread for using audio
     static void AudioThread(CAudioPlugin * _this);
+
+    static void CALL BuiltInAiLenChanged(void);
+    static uint32_t CALL BuiltInAiReadLength(void) { return 0; }
+    static void CALL BuiltInAiDacrateChanged(SYSTEM_TYPE /*Type*/) {}
 };
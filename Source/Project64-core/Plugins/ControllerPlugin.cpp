@@ -10,6 +10,7 @@
 ****************************************************************************/
 #include "stdafx.h"
 #include <Project64-core/N64System/SystemGlobals.h>
+#include <Project64-core/N64System/N64Class.h>
 #include <Project64-core/N64System/N64RomClass.h>
 #include <Project64-core/N64System/Mips/RegisterClass.h>
 #include "ControllerPlugin.h"
@@ -62,10 +63,41 @@ bool CControl_Plugin::LoadFunctions(void)
     return true;
 }
 
+void CControl_Plugin::LoadBuiltInFunctions(void)
+{
+    // Plays back the benchmark input script
+    strcpy(m_PluginInfo.Name, "Scripted Input (built in)");
+    m_PluginInfo.Version = 0x0102;
+    GetKeys = BuiltInGetKeys;
+
+    m_AllocatedControllers = true;
+    for (int32_t i = 0; i < 4; i++)
+    {
+        m_Controllers[i] = new CCONTROL(m_PluginControllers[i].Present, m_PluginControllers[i].RawData, m_PluginControllers[i].Plugin);
+    }
+}
+
+void CControl_Plugin::BuiltInGetKeys(int32_t Control, BUTTONS * Keys)
+{
+    Keys->Value = g_System != NULL ? g_System->m_Benchmark.Buttons(Control) : 0;
+}
+
 bool CControl_Plugin::Initiate(CN64System * System, RenderWindow * Window)
 {
     static uint8_t Buffer[100];
 
+    if (m_BuiltIn)
+    {
+        for (int32_t i = 0; i < 4; i++)
+        {
+            m_PluginControllers[i].Present = System != NULL ? System->m_Benchmark.ControllerPresent(i) : i == 0;
+            m_PluginControllers[i].RawData = false;
+            m_PluginControllers[i].Plugin = PLUGIN_NONE;
+        }
+        m_Initialized = true;
+        return m_Initialized;
+    }
+
     for (int32_t i = 0; i < 4; i++)
     {
         m_PluginControllers[i].Present = false;
@@ -120,8 +120,11 @@ private:
     virtual int32_t GetSettingStartRange() const { return FirstCtrlSettings; }
     PLUGIN_TYPE type() { return PLUGIN_TYPE_CONTROLLER; }
     bool LoadFunctions(void);
+    void LoadBuiltInFunctions(void);
     void UnloadPluginDetails(void);
 
+    static void CALL BuiltInGetKeys(int32_t Control, BUTTONS * Keys);
+
     bool   m_AllocatedControllers;
 
     // What the different controls are set up as
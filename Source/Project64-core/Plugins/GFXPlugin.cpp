@@ -109,9 +109,35 @@ bool CGfxPlugin::LoadFunctions(void)
     return true;
 }
 
+void CGfxPlugin::LoadBuiltInFunctions(void)
+{
+    // Accepts every display list and draws nothing
+    strcpy(m_PluginInfo.Name, "Null Graphics (built in)");
+    m_PluginInfo.Version = 0x0103;
+    CaptureScreen = DummyCaptureScreen;
+    ChangeWindow = DummyBuiltIn;
+    DrawScreen = DummyDrawScreen;
+    DrawStatus = DummyDrawStatus;
+    MoveScreen = DummyMoveScreen;
+    ProcessDList = DummyBuiltIn;
+    ProcessRDPList = DummyBuiltIn;
+    ShowCFB = DummyBuiltIn;
+    UpdateScreen = DummyBuiltIn;
+    ViStatusChanged = DummyViStatusChanged;
+    ViWidthChanged = DummyViWidthChanged;
+    ResizeVideoOutput = DummyResizeVideoOutput;
+    SoftReset = DummySoftReset;
+}
+
 bool CGfxPlugin::Initiate(CN64System * System, RenderWindow * Window)
 {
     WriteTrace(TraceGFXPlugin, TraceDebug, "Start");
+    if (m_BuiltIn)
+    {
+        m_Initialized = true;
+        WriteTrace(TraceGFXPlugin, TraceDebug, "Done (built in)");
+        return m_Initialized;
+    }
     if (m_Initialized)
     {
         Close(Window);
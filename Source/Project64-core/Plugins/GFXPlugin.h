@@ -53,6 +53,7 @@ public:
     ~CGfxPlugin();
 
     bool LoadFunctions(void);
+    void LoadBuiltInFunctions(void);
     bool Initiate(CN64System * System, RenderWindow * Window);
 
     void(CALL *CaptureScreen)   (const char *);
@@ -104,4 +105,6 @@ private:
     static void CALL DummyViWidthChanged(void) {}
     static void CALL DummyResizeVideoOutput(int32_t /*Width*/, int32_t /*Height*/) {}
     static void CALL DummySoftReset(void) {}
+    static void CALL DummyCaptureScreen(const char * /*Directory*/) {}
+    static void CALL DummyDrawStatus(const char * /*lpString*/, int32_t /*RightAlign*/) {}
 };
\ No newline at end of file
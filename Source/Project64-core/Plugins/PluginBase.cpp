@@ -24,7 +24,8 @@ SetSettingInfo2(NULL),
 SetSettingInfo3(NULL),
 m_LibHandle(NULL),
 m_Initialized(false),
-m_RomOpen(false)
+m_RomOpen(false),
+m_BuiltIn(false)
 {
     memset(&m_PluginInfo, 0, sizeof(m_PluginInfo));
 }
@@ -144,6 +145,24 @@ bool CPlugin::Load(const char * FileName)
     return true;
 }
 
+bool CPlugin::LoadBuiltIn(void)
+{
+    if (m_LibHandle != NULL || m_BuiltIn)
+    {
+        UnloadPlugin();
+    }
+
+    m_BuiltIn = true;
+    m_PluginInfo.Type = (uint16_t)type();
+    m_PluginInfo.MemoryBswaped = true;
+    CloseDLL = DummyBuiltIn;
+    RomOpen = DummyBuiltIn;
+    RomClosed = DummyBuiltIn;
+    LoadBuiltInFunctions();
+    WriteTrace(PluginTraceType(), TraceDebug, "Loaded built in %s", m_PluginInfo.Name);
+    return true;
+}
+
 void CPlugin::RomOpened(RenderWindow * Render)
 {
     if (m_RomOpen)
@@ -229,10 +248,11 @@ void CPlugin::UnloadPlugin()
 {
     WriteTrace(PluginTraceType(), TraceDebug, "(%s): Start", PluginType());
     memset(&m_PluginInfo, 0, sizeof(m_PluginInfo));
-    if (m_LibHandle != NULL)
+    if (m_LibHandle != NULL || m_BuiltIn)
     {
         UnloadPluginDetails();
     }
+    m_BuiltIn = false;
     if (m_LibHandle != NULL)
     {
         pjutil::DynLibClose(m_LibHandle);
@@ -34,6 +34,7 @@ public:
     virtual int32_t GetSettingStartRange() const = 0;
 
     bool Load(const char * FileName);
+    bool LoadBuiltIn(void);
 
     void RomOpened(RenderWindow * Render);
     void RomClose(RenderWindow * Render);
@@ -52,6 +53,7 @@ protected:
     virtual void UnloadPluginDetails() = 0;
     virtual PLUGIN_TYPE type() = 0;
     virtual bool LoadFunctions(void) = 0;
+    virtual void LoadBuiltInFunctions(void) = 0;
 
     void(CALL *CloseDLL)            (void);
     void(CALL *RomOpen)             (void);
@@ -64,6 +66,7 @@ protected:
 
     pjutil::DynLibHandle m_LibHandle;
     bool m_Initialized, m_RomOpen;
+    bool m_BuiltIn; // Null plugin compiled into the core, used for headless benchmarks
     PLUGIN_INFO m_PluginInfo;
 
     // Loads a function pointer from the currently loaded DLL
@@ -76,4 +79,6 @@ protected:
     // i.e. _LoadFunction("CloseDLL", CloseDLL);
 #define LoadFunction(functionName) _LoadFunctionVoid(#functionName, (void **)&functionName)
 #define _LoadFunction(functionName,function) _LoadFunctionVoid(functionName, (void **)&function)
+
+    static void CALL DummyBuiltIn(void) {}
 };
@@ -112,7 +112,7 @@ void CPlugins::PluginChanged(CPlugins * _this)
 }
 
 template <typename plugin_type>
-static void LoadPlugin(SettingID PluginSettingID, SettingID PluginVerSettingID, plugin_type * & plugin, const char * PluginDir, stdstr & FileName, TraceModuleProject64 TraceLevel, const char * type, bool IsCopy)
+static void LoadPlugin(SettingID PluginSettingID, SettingID PluginVerSettingID, plugin_type * & plugin, const char * PluginDir, stdstr & FileName, TraceModuleProject64 TraceLevel, const char * type, bool IsCopy, bool BuiltIn)
 {
     if (plugin != NULL)
     {
@@ -127,6 +127,13 @@ static void LoadPlugin(SettingID PluginSettingID, SettingID PluginVerSettingID,
     plugin = new plugin_type();
     if (plugin)
     {
+        if (BuiltIn)
+        {
+            WriteTrace(TraceLevel, TraceDebug, "%s Loading built in", type);
+            plugin->LoadBuiltIn();
+            WriteTrace(TraceLevel, TraceDebug, "%s Loading Done", type);
+            return;
+        }
         WriteTrace(TraceLevel, TraceDebug, "%s Loading (%s): Starting", type, (const char *)PluginFileName);
         if (plugin->Load(PluginFileName))
         {
@@ -151,10 +158,15 @@ void CPlugins::CreatePlugins(void)
 {
     WriteTrace(TracePlugins, TraceInfo, "Start");
 
-    LoadPlugin(Game_Plugin_Gfx, Plugin_GFX_CurVer, m_Gfx, m_PluginDir.c_str(), m_GfxFile, TraceGFXPlugin, "GFX", m_SyncPlugins);
-    LoadPlugin(Game_Plugin_Audio, Plugin_AUDIO_CurVer, m_Audio, m_PluginDir.c_str(), m_AudioFile, TraceAudioPlugin, "Audio", m_SyncPlugins);
-    LoadPlugin(Game_Plugin_RSP, Plugin_RSP_CurVer, m_RSP, m_PluginDir.c_str(), m_RSPFile, TraceRSPPlugin, "RSP", m_SyncPlugins);
-    LoadPlugin(Game_Plugin_Controller, Plugin_CONT_CurVer, m_Control, m_PluginDir.c_str(), m_ControlFile, TraceControllerPlugin, "Control", m_SyncPlugins);
+    // Benchmark runs use the null gfx, audio and controller plugins in the core so the result
+    // measures the emulator, the rsp plugin still runs the microcode unless --null-rsp is given
+    bool Benchmark = g_Settings->LoadDword(Cmd_BenchmarkFrames) != 0;
+    bool NullRsp = Benchmark && g_Settings->LoadBool(Cmd_BenchmarkNullRsp);
+
+    LoadPlugin(Game_Plugin_Gfx, Plugin_GFX_CurVer, m_Gfx, m_PluginDir.c_str(), m_GfxFile, TraceGFXPlugin, "GFX", m_SyncPlugins, Benchmark);
+    LoadPlugin(Game_Plugin_Audio, Plugin_AUDIO_CurVer, m_Audio, m_PluginDir.c_str(), m_AudioFile, TraceAudioPlugin, "Audio", m_SyncPlugins, Benchmark);
+    LoadPlugin(Game_Plugin_RSP, Plugin_RSP_CurVer, m_RSP, m_PluginDir.c_str(), m_RSPFile, TraceRSPPlugin, "RSP", m_SyncPlugins, NullRsp);
+    LoadPlugin(Game_Plugin_Controller, Plugin_CONT_CurVer, m_Control, m_PluginDir.c_str(), m_ControlFile, TraceControllerPlugin, "Control", m_SyncPlugins, Benchmark);
 
     //Enable debugger
     if (m_RSP != NULL && m_RSP->EnableDebugging)
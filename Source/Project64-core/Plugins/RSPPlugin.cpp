@@ -22,6 +22,7 @@ void DummyFunc1(int a) { a += 1; }
 CRSP_Plugin::CRSP_Plugin(void) :
     DoRspCycles(NULL),
     EnableDebugging(NULL),
+    StartTask(NULL),
     m_CycleCount(0),
     GetDebugInfo(NULL),
     InitiateDebugger(NULL)
@@ -45,6 +46,7 @@ bool CRSP_Plugin::LoadFunctions(void)
     _LoadFunction("InitiateRSPDebugger", InitiateDebugger);
     LoadFunction(EnableDebugging);
     if (EnableDebugging == NULL) { EnableDebugging = DummyFunc1; }
+    _LoadFunction("StartRspTask", StartTask);
 
     //Make sure dll had all needed functions
     if (DoRspCycles == NULL) { UnloadPlugin(); return false; }
@@ -65,9 +67,46 @@ bool CRSP_Plugin::LoadFunctions(void)
     return true;
 }
 
+void CRSP_Plugin::LoadBuiltInFunctions(void)
+{
+    strcpy(m_PluginInfo.Name, "Null RSP (built in)");
+    m_PluginInfo.Version = 0x0103;
+    DoRspCycles = BuiltInDoRspCycles;
+    EnableDebugging = DummyFunc1;
+}
+
+// Hands graphics and audio tasks straight to the other plugins, the way a high
+// level RSP does, then reports the task as finished without running microcode
+uint32_t CRSP_Plugin::BuiltInDoRspCycles(uint32_t Cycles)
+{
+    uint32_t TaskType = *(uint32_t *)(g_MMU->Dmem() + 0xFC0);
+    if (TaskType == 1)
+    {
+        g_Plugins->Gfx()->ProcessDList();
+        g_Reg->m_GfxIntrReg |= MI_INTR_DP;
+    }
+    else if (TaskType == 2)
+    {
+        g_Plugins->Audio()->ProcessAList();
+    }
+
+    g_Reg->SP_STATUS_REG |= SP_STATUS_SIG2 | SP_STATUS_BROKE | SP_STATUS_HALT;
+    if ((g_Reg->SP_STATUS_REG & SP_STATUS_INTR_BREAK) != 0)
+    {
+        g_Reg->m_RspIntrReg |= MI_INTR_SP;
+    }
+    return Cycles;
+}
+
 bool CRSP_Plugin::Initiate(CPlugins * Plugins, CN64System * System)
 {
     WriteTrace(TraceRSPPlugin, TraceDebug, "Starting");
+    if (m_BuiltIn)
+    {
+        m_Initialized = true;
+        WriteTrace(TraceRSPPlugin, TraceDebug, "Done (built in)");
+        return m_Initialized;
+    }
     if (m_PluginInfo.Version == 1 || m_PluginInfo.Version == 0x100)
     {
         WriteTrace(TraceRSPPlugin, TraceDebug, "Invalid Version: %X", m_PluginInfo.Version);
@@ -365,6 +404,7 @@ void CRSP_Plugin::UnloadPluginDetails(void)
     memset(&m_RSPDebug, 0, sizeof(m_RSPDebug));
     DoRspCycles = NULL;
     EnableDebugging = NULL;
+    StartTask = NULL;
     GetDebugInfo = NULL;
     InitiateDebugger = NULL;
 }
@@ -52,9 +52,16 @@ public:
 
     bool Initiate(CPlugins * Plugins, CN64System * System);
 
+    // Passed to DoRspCycles when the task should run until it stops
+    static const uint32_t UnlimitedCycles = 0xFFFFFFFF;
+
     uint32_t(CALL *DoRspCycles)(uint32_t);
     void(CALL *EnableDebugging)(int32_t Enable);
 
+    // Optional, tells the plugin the next DoRspCycles starts a new task. Plugins
+    // without it are given UnlimitedCycles so they never leave a task part way through
+    void(CALL *StartTask)(void);
+
     void * GetDebugMenu(void) { return m_RSPDebug.hRSPMenu; }
     void ProcessMenuItem(int32_t id);
 
@@ -67,8 +74,11 @@ private:
     virtual int32_t GetSettingStartRange() const { return FirstRSPSettings; }
 
     bool LoadFunctions(void);
+    void LoadBuiltInFunctions(void);
     void UnloadPluginDetails(void);
 
+    static uint32_t CALL BuiltInDoRspCycles(uint32_t Cycles);
+
     RSPDEBUG_INFO m_RSPDebug;
     uint32_t      m_CycleCount;
 
@@ -12,6 +12,7 @@
 #include "RomList.h"
 #include <Project64-core/3rdParty/zip.h>
 #include <Project64-core/N64System/N64RomClass.h>
+#include <Project64-core/N64System/ByteSwap.h>
 
 #ifdef _WIN32
 #include <Project64-core/3rdParty/7zip.h>
@@ -51,6 +52,7 @@ CRomList::CRomList() :
         m_NotesIniFile = new CIniFile(g_Settings->LoadStringVal(SupportFile_Notes).c_str());
         m_ExtIniFile = new CIniFile(g_Settings->LoadStringVal(SupportFile_ExtInfo).c_str());
         m_RomIniFile = new CIniFile(g_Settings->LoadStringVal(SupportFile_RomDatabase).c_str());
+        m_RomIniFile->UseIndex();
         m_PlaytimeFile = std::make_unique<CIniFile>(g_Settings->LoadStringVal(SupportFile_Playtime).c_str());
 #ifdef _WIN32
         m_ZipIniFile = new CIniFile(g_Settings->LoadStringVal(RomList_7zipCache).c_str());
@@ -565,32 +567,14 @@ void CRomList::FillRomExtensionInfo(ROM_INFO * pRomInfo)
 
 void CRomList::ByteSwapRomData(uint8_t * Data, int32_t DataLen)
 {
-    int32_t count;
-
     switch (*((uint32_t *)&Data[0]))
     {
     case 0x12408037:
-        for (count = 0; count < DataLen; count += 4)
-        {
-            Data[count] ^= Data[count + 2];
-            Data[count + 2] ^= Data[count];
-            Data[count] ^= Data[count + 2];
-            Data[count + 1] ^= Data[count + 3];
-            Data[count + 3] ^= Data[count + 1];
-            Data[count + 1] ^= Data[count + 3];
-        }
+        CByteSwap::SwapHalfWords(Data, Data, DataLen);
         break;
     case 0x40072780: //64DD IPL
     case 0x40123780:
-        for (count = 0; count < DataLen; count += 4)
-        {
-            Data[count] ^= Data[count + 3];
-            Data[count + 3] ^= Data[count];
-            Data[count] ^= Data[count + 3];
-            Data[count + 1] ^= Data[count + 2];
-            Data[count + 2] ^= Data[count + 1];
-            Data[count + 1] ^= Data[count + 2];
-        }
+        CByteSwap::SwapWords(Data, Data, DataLen);
         break;
     case 0x80371240: break;
     }
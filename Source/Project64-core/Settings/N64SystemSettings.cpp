@@ -51,7 +51,7 @@ void CN64SystemSettings::RefreshSettings(void *)
 {
     m_bBasicMode = g_Settings->LoadBool(UserInterface_BasicMode);
     m_bDisplayFrameRate = g_Settings->LoadBool(UserInterface_DisplayFrameRate);
-    m_bShowCPUPer = g_Settings->LoadBool(UserInterface_ShowCPUPer);
+    m_bShowCPUPer = g_Settings->LoadBool(UserInterface_ShowCPUPer) || g_Settings->LoadDword(Cmd_BenchmarkFrames) != 0;
     m_bShowDListAListCount = g_Settings->LoadBool(Debugger_ShowDListAListCount);
     m_bLimitFPS = g_Settings->LoadBool(GameRunning_LimitFPS);
 }
\ No newline at end of file
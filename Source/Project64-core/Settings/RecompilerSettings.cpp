@@ -14,6 +14,7 @@
 int CRecompilerSettings::m_RefCount = 0;
 
 bool CRecompilerSettings::m_bShowRecompMemSize;
+bool CRecompilerSettings::m_bBackgroundCompile;
 
 CRecompilerSettings::CRecompilerSettings()
 {
@@ -21,6 +22,7 @@ CRecompilerSettings::CRecompilerSettings()
     if (m_RefCount == 1)
     {
         g_Settings->RegisterChangeCB(Debugger_ShowRecompMemSize, this, (CSettings::SettingChangedFunc)StaticRefreshSettings);
+        g_Settings->RegisterChangeCB(Setting_BackgroundCompile, this, (CSettings::SettingChangedFunc)StaticRefreshSettings);
 
         RefreshSettings();
     }
@@ -32,10 +34,12 @@ CRecompilerSettings::~CRecompilerSettings()
     if (m_RefCount == 0)
     {
         g_Settings->UnregisterChangeCB(Debugger_ShowRecompMemSize, this, (CSettings::SettingChangedFunc)StaticRefreshSettings);
+        g_Settings->UnregisterChangeCB(Setting_BackgroundCompile, this, (CSettings::SettingChangedFunc)StaticRefreshSettings);
     }
 }
 
 void CRecompilerSettings::RefreshSettings()
 {
     m_bShowRecompMemSize = g_Settings->LoadBool(Debugger_ShowRecompMemSize);
+    m_bBackgroundCompile = g_Settings->LoadBool(Setting_BackgroundCompile);
 }
\ No newline at end of file
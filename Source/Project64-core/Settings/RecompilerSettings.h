@@ -19,6 +19,7 @@ public:
     virtual ~CRecompilerSettings();
 
     static inline bool bShowRecompMemSize(void) { return m_bShowRecompMemSize; }
+    static inline bool bBackgroundCompile(void) { return m_bBackgroundCompile; }
 
 private:
     static void StaticRefreshSettings(CRecompilerSettings * _this)
@@ -30,6 +31,7 @@ private:
 
     //Settings that can be changed on the fly
     static bool m_bShowRecompMemSize;
+    static bool m_bBackgroundCompile;
 
     static int32_t m_RefCount;
 };
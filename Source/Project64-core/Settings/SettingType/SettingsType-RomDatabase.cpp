@@ -65,6 +65,8 @@ void CSettingTypeRomDatabase::Initialize( void )
 
     m_SettingsIniFile = new CIniFile(g_Settings->LoadStringVal(SupportFile_RomDatabase).c_str());
     m_GlideIniFile = new CIniFile(g_Settings->LoadStringVal(SupportFile_Glide64RDB).c_str());
+    m_SettingsIniFile->UseIndex();
+    m_GlideIniFile->UseIndex();
 
     g_Settings->RegisterChangeCB(Game_IniKey,NULL,GameChanged);
     g_Settings->RegisterChangeCB(Cmd_BaseDirectory,NULL,BaseDirChanged);
@@ -108,6 +110,8 @@ void CSettingTypeRomDatabase::BaseDirChanged ( void * /*Data */ )
     }
     m_SettingsIniFile = new CIniFile(g_Settings->LoadStringVal(SupportFile_RomDatabase).c_str());
     m_GlideIniFile = new CIniFile(g_Settings->LoadStringVal(SupportFile_Glide64RDB).c_str());
+    m_SettingsIniFile->UseIndex();
+    m_GlideIniFile->UseIndex();
 }
 
 void CSettingTypeRomDatabase::GameChanged ( void * /*Data */ )
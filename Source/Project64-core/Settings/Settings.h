@@ -25,6 +25,10 @@ enum SettingID
     Cmd_BaseDirectory,
     Cmd_RomFile,
     Cmd_ShowHelp,
+    Cmd_BenchmarkFrames,
+    Cmd_BenchmarkInput,
+    Cmd_BenchmarkNullRsp,
+    Cmd_BenchmarkAsyncDlist,
 
     //Support Files
     SupportFile_Playtime,
@@ -63,6 +67,12 @@ enum SettingID
     Setting_EnableDisk,
     Setting_PreAllocSyncMem,
     Setting_ReducedSyncMem,
+    Setting_BackgroundCompile,
+    Setting_CachedInterpreter,
+    Setting_SamplingProfiler,
+    Setting_AsyncDlistCycles,
+    Setting_BuiltInAudioHle,
+    Setting_RspCycleSlice,
 
     //RDB Settings
     Rdb_GoodName,
@@ -90,6 +90,10 @@ void CSettings::AddHowToHandleSetting(const char * BaseDirectory)
     AddHandler(Cmd_BaseDirectory, new CSettingTypeTempString(BaseDirectory));
     AddHandler(Cmd_ShowHelp, new CSettingTypeTempBool(false));
     AddHandler(Cmd_RomFile, new CSettingTypeTempString(""));
+    AddHandler(Cmd_BenchmarkFrames, new CSettingTypeTempNumber(0));
+    AddHandler(Cmd_BenchmarkInput, new CSettingTypeTempString(""));
+    AddHandler(Cmd_BenchmarkNullRsp, new CSettingTypeTempBool(false));
+    AddHandler(Cmd_BenchmarkAsyncDlist, new CSettingTypeTempNumber(0));
 
     //Support Files
     AddHandler(SupportFile_Playtime, new CSettingTypeApplicationPath("Settings", "Playtime", SupportFile_PlaytimeDefault));
@@ -130,6 +134,12 @@ void CSettings::AddHowToHandleSetting(const char * BaseDirectory)
     AddHandler(Setting_EnableDisk, new CSettingTypeTempBool(false));
     AddHandler(Setting_PreAllocSyncMem, new CSettingTypeApplication("", "PreAllocSyncMem", true));
     AddHandler(Setting_ReducedSyncMem, new CSettingTypeApplication("", "ReducedSyncMem", false));
+    AddHandler(Setting_BackgroundCompile, new CSettingTypeApplication("", "Background Compile", false));
+    AddHandler(Setting_CachedInterpreter, new CSettingTypeApplication("", "Cached Interpreter", false));
+    AddHandler(Setting_SamplingProfiler, new CSettingTypeApplication("", "Sampling Profiler", false));
+    AddHandler(Setting_AsyncDlistCycles, new CSettingTypeApplication("", "Async Display List Cycles", (uint32_t)0));
+    AddHandler(Setting_BuiltInAudioHle, new CSettingTypeApplication("", "Built In Audio HLE", false));
+    AddHandler(Setting_RspCycleSlice, new CSettingTypeApplication("", "RSP Cycle Slice", (uint32_t)0));
     AddHandler(Setting_LanguageDirDefault, new CSettingTypeRelativePath("Lang", ""));
     AddHandler(Setting_LanguageDir, new CSettingTypeApplicationPath("Lang Directory", "Directory", Setting_LanguageDirDefault));
 
@@ -32,6 +32,8 @@
 #include "RSP registers.h"
 #include "RSP Command.h"
 #include "Recompiler CPU.h"
+#include "Recompiler X64.h"
+#include "Interpreter Simd.h"
 #include "memory.h"
 #include "OpCode.h"
 #include "log.h"
@@ -42,7 +44,8 @@
 
 UDWORD EleSpec[32], Indx[32];
 OPCODE RSPOpC;
-uint32_t *PrgCount, NextInstruction, RSP_Running, RSP_MfStatusCount;
+uint32_t *PrgCount, NextInstruction, RSP_Running, RSP_MfStatusCount, RSP_Preempted;
+int32_t RSP_Cycles;
 
 p_func RSP_Opcode[64];
 p_func RSP_RegImm[32];
@@ -66,7 +69,19 @@ void SetCPU(DWORD core)
 	switch (core)
 	{
 	case RecompilerCPU:
+#if defined(_M_X64) || defined(__x86_64__)
+		/*
+		 * BuildRecompilerCPU fills the op tables with the x86 emitters,
+		 * which use 32 bit absolute addresses and can not run here. The
+		 * x64 recompiler looks the interpreter function for each op up
+		 * in these tables, to call the ops it does not emit itself and
+		 * for blocks it hands back to the interpreter, so they have to
+		 * hold the interpreter ops.
+		 */
+		BuildInterpreterCPU();
+#else
 		BuildRecompilerCPU();
+#endif
 		break;
 	case InterpreterCPU:
 		BuildInterpreterCPU();
@@ -174,7 +189,10 @@ void Build_RSP ( void )
 		}
 	}
 
+	InitSimdElements();
+
 	PrgCount = RSPInfo.SP_PC_REG;
+	RSP_Preempted = FALSE;
 }
 
 /******************************************************************
@@ -187,6 +205,11 @@ void Build_RSP ( void )
             be greater than the number of cycles that the RSP 
 			should have performed.
 			(this value is ignored if the RSP is stoped)
+
+  Cycles are counted as one per opcode and only checked at points
+  where the RSP can be stopped cleanly, the start of a block or a
+  loop. When they run out the RSP is left running (not halted) and
+  the next call picks the task up from SP_PC.
 *******************************************************************/ 
 
 DWORD RunInterpreterCPU(DWORD Cycles);
@@ -198,6 +221,7 @@ __declspec(dllexport) DWORD DoRspCycles ( DWORD Cycles )
 {
     extern Boolean AudioHle, GraphicsHle;
 	DWORD TaskType = *(DWORD*)(RSPInfo.DMEM + 0xFC0);
+	uint32_t Resuming = RSP_Preempted;
 		
 /*	if (*RSPInfo.SP_STATUS_REG & SP_STATUS_SIG0)
 	{
@@ -207,7 +231,11 @@ __declspec(dllexport) DWORD DoRspCycles ( DWORD Cycles )
 		return Cycles;
 	}
 */
-	if (TaskType == 1 && GraphicsHle && *(DWORD*)(RSPInfo.DMEM + 0x0ff0) != 0)
+	if (Resuming)
+	{
+		/* the task was started by an earlier call */
+	}
+	else if (TaskType == 1 && GraphicsHle && *(DWORD*)(RSPInfo.DMEM + 0x0ff0) != 0)
 	{
 		if (RSPInfo.ProcessDList != NULL)
 		{
@@ -260,22 +288,36 @@ __declspec(dllexport) DWORD DoRspCycles ( DWORD Cycles )
 	}
 
 	WaitForSingleObjectEx(hMutex, 1000 * 100, FALSE);
+	if (Profiling)
+	{
+		StartTaskProfile(TaskType, Resuming);
+	}
 
-	if (BreakOnStart)
+	if (BreakOnStart && !Resuming)
 	{
 		Enter_RSP_Commands_Window();
 	}
 	RSP_MfStatusCount = 0;
+	RSP_Preempted = FALSE;
+	RSP_Cycles = Cycles > 0x7FFFFFFF ? 0x7FFFFFFF : (int32_t)Cycles;
 
 	switch (CPUCore)
 	{
 	case RecompilerCPU:
+#if defined(_M_X64) || defined(__x86_64__)
+		RunRecompilerX64(Cycles);
+#else
 		RunRecompilerCPU(Cycles);
+#endif
 		break;
 	case InterpreterCPU:
 		RunInterpreterCPU(Cycles);
 		break;
 	}
+	if (Profiling)
+	{
+		StopTaskProfile();
+	}
 	ReleaseMutex(hMutex);
 
 	if (Profiling && !IndvidualBlock)
@@ -283,5 +325,5 @@ __declspec(dllexport) DWORD DoRspCycles ( DWORD Cycles )
 		StartTimer((DWORD)Timer_R4300_Running);
 	}
 
-	return Cycles;
+	return Cycles > 0x7FFFFFFF ? 0x7FFFFFFF - RSP_Cycles : Cycles - RSP_Cycles;
 }
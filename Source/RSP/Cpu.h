@@ -36,7 +36,8 @@ extern p_func RSP_Cop2[32];
 extern p_func RSP_Vector[64];
 extern p_func RSP_Lc2[32];
 extern p_func RSP_Sc2[32];
-extern uint32_t * PrgCount, RSP_Running;
+extern uint32_t * PrgCount, RSP_Running, RSP_Preempted;
+extern int32_t RSP_Cycles;
 extern OPCODE RSPOpC;
 
 void SetCPU(DWORD core);
@@ -32,10 +32,12 @@
 #include "Cpu.h"
 #include "Interpreter Ops.h"
 #include "Interpreter CPU.h"
+#include "Interpreter Simd.h"
 #include "RSP registers.h"
 #include "RSP Command.h"
 #include "memory.h"
 #include "opcode.h"
+#include "Profiling.h"
 #include "log.h"
 
 DWORD RSP_NextInstruction, RSP_JumpTo;
@@ -334,6 +336,9 @@ void BuildInterpreterCPU(void) {
 	RSP_Vector[61] = rsp_UnknownOpcode;
 	RSP_Vector[62] = rsp_UnknownOpcode;
 	RSP_Vector[63] = rsp_UnknownOpcode;
+	if (SimdVector) {
+		BuildInterpreterSimd();
+	}
 
 	RSP_Lc2[ 0] = RSP_Opcode_LBV;
 	RSP_Lc2[ 1] = RSP_Opcode_LSV;
@@ -402,6 +407,40 @@ void BuildInterpreterCPU(void) {
 	RSP_Sc2[31] = rsp_UnknownOpcode;
 }
 
+void ExecuteInterpreterOpcode(void) {
+	RDP_LogLoc(*PrgCount);
+
+	RSP_LW_IMEM(*PrgCount, &RSPOpC.Hex);
+	if (Profiling && ProfileOpcodes) {
+		ProfileOpcode(RSPOpC.Hex);
+	}
+	RSP_Opcode[ RSPOpC.op ]();
+	RSP_GPR[0].W = 0x00000000; /* MIPS $zero hard-wired to 0 */
+
+	switch (RSP_NextInstruction) {
+	case NORMAL: 
+		*PrgCount = (*PrgCount + 4) & 0xFFC;
+		break;
+	case DELAY_SLOT:
+		RSP_NextInstruction = JUMP;
+		*PrgCount = (*PrgCount + 4) & 0xFFC;
+		break;
+	case JUMP:
+		RSP_NextInstruction = NORMAL;
+		*PrgCount  = RSP_JumpTo;
+		break;
+	case SINGLE_STEP: 
+		*PrgCount = (*PrgCount + 4) & 0xFFC;
+		RSP_NextInstruction = SINGLE_STEP_DONE;
+		break;
+	case SINGLE_STEP_DONE:
+		*PrgCount = (*PrgCount + 4) & 0xFFC;
+		*RSPInfo.SP_STATUS_REG |= SP_STATUS_HALT;
+		RSP_Running = FALSE;
+		break;
+	}
+}
+
 DWORD RunInterpreterCPU(DWORD Cycles) {
 	DWORD CycleCount;
 	RSP_Running = TRUE;
@@ -409,6 +448,10 @@ DWORD RunInterpreterCPU(DWORD Cycles) {
 	CycleCount = 0;
 
 	while (RSP_Running) {
+		if (RSP_Cycles <= 0 && RSP_NextInstruction == NORMAL) {
+			RSP_Preempted = TRUE;
+			break;
+		}
 		if (NoOfBpoints != 0) {
 			if (CheckForRSPBPoint(*PrgCount)) {
 				if (InRSPCommandsWindow) {
@@ -439,35 +482,8 @@ DWORD RunInterpreterCPU(DWORD Cycles) {
 			}
 		}
 
-
-		RDP_LogLoc(*PrgCount);
-
-		RSP_LW_IMEM(*PrgCount, &RSPOpC.Hex);
-		RSP_Opcode[ RSPOpC.op ]();
-		RSP_GPR[0].W = 0x00000000; /* MIPS $zero hard-wired to 0 */
-
-		switch (RSP_NextInstruction) {
-		case NORMAL: 
-			*PrgCount = (*PrgCount + 4) & 0xFFC;
-			break;
-		case DELAY_SLOT:
-			RSP_NextInstruction = JUMP;
-			*PrgCount = (*PrgCount + 4) & 0xFFC;
-			break;
-		case JUMP:
-			RSP_NextInstruction = NORMAL;
-			*PrgCount  = RSP_JumpTo;
-			break;
-		case SINGLE_STEP: 
-			*PrgCount = (*PrgCount + 4) & 0xFFC;
-			RSP_NextInstruction = SINGLE_STEP_DONE;
-			break;
-		case SINGLE_STEP_DONE:
-			*PrgCount = (*PrgCount + 4) & 0xFFC;
-			*RSPInfo.SP_STATUS_REG |= SP_STATUS_HALT;
-			RSP_Running = FALSE;
-			break;
-		}
+		ExecuteInterpreterOpcode();
+		RSP_Cycles -= 1;
 	}
 	return Cycles;
 }
@@ -45,4 +45,5 @@ extern DWORD RSP_NextInstruction, RSP_JumpTo, RSP_MfStatusCount;
 unsigned int RSP_branch_if(int condition);
 
 void BuildInterpreterCPU(void);
+void ExecuteInterpreterOpcode(void);
 DWORD RunInterpreterCPU(DWORD Cycles);
@@ -0,0 +1,495 @@
+/*
+ * RSP Compiler plug in for Project64 (A Nintendo 64 emulator).
+ *
+ * (c) Copyright 2001 jabo (jabo@emulation64.com) and
+ * zilmar (zilmar@emulation64.com)
+ *
+ * pj64 homepage: www.pj64.net
+ * 
+ * Permission to use, copy, modify and distribute Project64 in both binary and
+ * source form, for non-commercial purposes, is hereby granted without fee,
+ * providing that this license information and copyright notice appear with
+ * all copies and any derived work.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event shall the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Project64 is freeware for PERSONAL USE only. Commercial users should
+ * seek permission of the copyright holders first. Commercial use includes
+ * charging money for Project64 or software derived from Project64.
+ *
+ * The copyright holders request that bug fixes and improvements to the code
+ * should be forwarded to them so if they want them.
+ *
+ */
+
+
+#include <windows.h>
+#include "Rsp.h"
+#include "CPU.h"
+#include "RSP Registers.h"
+#include "Interpreter CPU.h"
+#include "Interpreter Simd.h"
+#include "Types.h"
+
+/*
+ * SSE2 versions of the multiply, add and logical vector ops for the
+ * interpreter.  They work on all eight lanes at once and must give
+ * exactly the same vector, accumulator and flag results as the scalar
+ * functions in Interpreter Ops.c, which are still used for everything
+ * else.  The accumulator keeps its UDWORD per lane layout so the
+ * recompiler and debugger do not need to know which ops were used.
+ */
+
+Boolean Sse2Supported = FALSE, Ssse3Supported = FALSE;
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#if defined(_MSC_VER) || defined(__SSSE3__)
+#include <tmmintrin.h>
+#define SIMD_ELEMENT_SHUFFLE
+#endif
+
+static __m128i ElementMask[32];
+static Boolean UseElementShuffle = FALSE;
+
+static __inline __m128i LoadVect(int Reg) {
+	return _mm_loadu_si128((__m128i *)&RSP_Vect[Reg]);
+}
+
+static __inline void StoreVect(int Reg, __m128i Value) {
+	_mm_storeu_si128((__m128i *)&RSP_Vect[Reg], Value);
+}
+
+/* rt with the element spec of the op applied */
+static __inline __m128i LoadElement(void) {
+	VECTOR Temp;
+	int el;
+
+#ifdef SIMD_ELEMENT_SHUFFLE
+	if (UseElementShuffle) {
+		return _mm_shuffle_epi8(LoadVect(RSPOpC.rt), ElementMask[RSPOpC.rs]);
+	}
+#endif
+	for (el = 0; el < 8; el ++) {
+		Temp.UHW[el] = RSP_Vect[RSPOpC.rt].UHW[EleSpec[RSPOpC.rs].B[el]];
+	}
+	return _mm_loadu_si128((__m128i *)&Temp);
+}
+
+/* Each register holds two lanes of the accumulator */
+static __inline void LoadAccum(__m128i Accum[4]) {
+	int i;
+
+	for (i = 0; i < 4; i ++) {
+		Accum[i] = _mm_loadu_si128((__m128i *)&RSP_ACCUM[i * 2]);
+	}
+}
+
+static __inline void StoreAccum(__m128i Accum[4]) {
+	int i;
+
+	for (i = 0; i < 4; i ++) {
+		_mm_storeu_si128((__m128i *)&RSP_ACCUM[i * 2], Accum[i]);
+	}
+}
+
+/* Build accumulator rows from the four 16 bit slices HW[0] to HW[3] */
+static __inline void Compose(__m128i HW0, __m128i HW1, __m128i HW2, __m128i HW3, __m128i Row[4]) {
+	__m128i Low, High;
+
+	Low = _mm_unpacklo_epi16(HW0, HW1);
+	High = _mm_unpacklo_epi16(HW2, HW3);
+	Row[0] = _mm_unpacklo_epi32(Low, High);
+	Row[1] = _mm_unpackhi_epi32(Low, High);
+	Low = _mm_unpackhi_epi16(HW0, HW1);
+	High = _mm_unpackhi_epi16(HW2, HW3);
+	Row[2] = _mm_unpacklo_epi32(Low, High);
+	Row[3] = _mm_unpackhi_epi32(Low, High);
+}
+
+/* Replace the accumulator keeping HW[0] of each lane */
+static __inline void SetAccum(__m128i HW1, __m128i HW2, __m128i HW3) {
+	__m128i Accum[4], Row[4], Keep;
+	int i;
+
+	LoadAccum(Accum);
+	Compose(_mm_setzero_si128(), HW1, HW2, HW3, Row);
+	Keep = _mm_set_epi32(0, 0xFFFF, 0, 0xFFFF);
+	for (i = 0; i < 4; i ++) {
+		Accum[i] = _mm_or_si128(_mm_and_si128(Accum[i], Keep), Row[i]);
+	}
+	StoreAccum(Accum);
+}
+
+/* Only HW[1] of each lane is replaced */
+static __inline void SetAccumMiddle(__m128i HW1) {
+	__m128i Accum[4], Row[4], Clear;
+	int i;
+
+	LoadAccum(Accum);
+	Compose(_mm_setzero_si128(), HW1, _mm_setzero_si128(), _mm_setzero_si128(), Row);
+	Clear = _mm_set_epi32(0, (int)0xFFFF0000, 0, (int)0xFFFF0000);
+	for (i = 0; i < 4; i ++) {
+		Accum[i] = _mm_or_si128(_mm_andnot_si128(Clear, Accum[i]), Row[i]);
+	}
+	StoreAccum(Accum);
+}
+
+/* 64 bit add to every lane of the accumulator */
+static __inline void AddAccum(__m128i Accum[4], __m128i HW1, __m128i HW2, __m128i HW3) {
+	__m128i Row[4];
+	int i;
+
+	LoadAccum(Accum);
+	Compose(_mm_setzero_si128(), HW1, HW2, HW3, Row);
+	for (i = 0; i < 4; i ++) {
+		Accum[i] = _mm_add_epi64(Accum[i], Row[i]);
+	}
+	StoreAccum(Accum);
+}
+
+/* W[0] or W[1] of four lanes */
+static __inline __m128i AccumLow(const __m128i * Accum) {
+	return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(Accum[0]), _mm_castsi128_ps(Accum[1]), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+static __inline __m128i AccumHigh(const __m128i * Accum) {
+	return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(Accum[0]), _mm_castsi128_ps(Accum[1]), _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+/* W[1] clamped to a signed 16 bit value */
+static __inline __m128i ClampHigh(const __m128i Accum[4]) {
+	return _mm_packs_epi32(AccumHigh(Accum), AccumHigh(Accum + 2));
+}
+
+/* HW[1], or 0 / 0xFFFF if W[1] does not fit in a signed 16 bit value */
+static __inline __m128i ClampLow(const __m128i Accum[4]) {
+	__m128i High0, High1, Middle, Under, Over, Min, Max;
+
+	High0 = AccumHigh(Accum);
+	High1 = AccumHigh(Accum + 2);
+	Middle = _mm_packs_epi32(_mm_srai_epi32(AccumLow(Accum), 16), _mm_srai_epi32(AccumLow(Accum + 2), 16));
+	Min = _mm_set1_epi32(-32768);
+	Max = _mm_set1_epi32(32767);
+	Under = _mm_packs_epi32(_mm_cmplt_epi32(High0, Min), _mm_cmplt_epi32(High1, Min));
+	Over = _mm_packs_epi32(_mm_cmpgt_epi32(High0, Max), _mm_cmpgt_epi32(High1, Max));
+	return _mm_or_si128(_mm_andnot_si128(_mm_or_si128(Under, Over), Middle), Over);
+}
+
+/* VCO carry bits moved into lanes as 0 or 1 */
+static __inline __m128i CarryIn(void) {
+	__m128i Bits;
+
+	Bits = _mm_set_epi16(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+	Bits = _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16((short)(RSP_Flags[0].UW & 0xFF)), Bits), Bits);
+	return _mm_srli_epi16(Bits, 15);
+}
+
+/* Lane masks to VCO, lane 0 is bit 7 (and 15) */
+static __inline DWORD FlagBits(__m128i Low, __m128i High) {
+	Low = _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(Low, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(1, 0, 3, 2));
+	High = _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(High, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(1, 0, 3, 2));
+	return (DWORD)_mm_movemask_epi8(_mm_packs_epi16(Low, High));
+}
+
+/* High half of rd * rt with rd signed and rt unsigned */
+static __inline __m128i MulHighSignedUnsigned(__m128i Signed, __m128i Unsigned) {
+	return _mm_add_epi16(_mm_mulhi_epi16(Signed, Unsigned), _mm_and_si128(Signed, _mm_srai_epi16(Unsigned, 15)));
+}
+
+/************************** Vect functions **************************/
+void RSP_Simd_VMULF (void) {
+	__m128i a, b, Low, High, Special, Sign;
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	Low = _mm_mullo_epi16(a, b);
+	High = _mm_mulhi_epi16(a, b);
+
+	/* (a * b) << 1, rounded with 0x8000 */
+	High = _mm_or_si128(_mm_slli_epi16(High, 1), _mm_srli_epi16(Low, 15));
+	Low = _mm_slli_epi16(Low, 1);
+	High = _mm_add_epi16(High, _mm_srli_epi16(Low, 15));
+	Low = _mm_xor_si128(Low, _mm_set1_epi16((short)0x8000));
+
+	/* 0x8000 * 0x8000 is the only product that does not fit */
+	Special = _mm_set1_epi16((short)0x8000);
+	Special = _mm_and_si128(_mm_cmpeq_epi16(a, Special), _mm_cmpeq_epi16(b, Special));
+	Sign = _mm_andnot_si128(Special, _mm_srai_epi16(High, 15));
+
+	SetAccum(Low, High, Sign);
+	StoreVect(RSPOpC.sa, _mm_add_epi16(High, Special));
+}
+
+void RSP_Simd_VMULU (void) {
+	__m128i a, b, Low, High, Special, Sign, Accum[4], Row[4];
+	int i;
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	Low = _mm_mullo_epi16(a, b);
+	High = _mm_mulhi_epi16(a, b);
+
+	High = _mm_or_si128(_mm_slli_epi16(High, 1), _mm_srli_epi16(Low, 15));
+	Low = _mm_slli_epi16(Low, 1);
+	High = _mm_add_epi16(High, _mm_srli_epi16(Low, 15));
+	Low = _mm_xor_si128(Low, _mm_set1_epi16((short)0x8000));
+
+	Special = _mm_set1_epi16((short)0x8000);
+	Special = _mm_and_si128(_mm_cmpeq_epi16(a, Special), _mm_cmpeq_epi16(b, Special));
+	Sign = _mm_andnot_si128(Special, _mm_srai_epi16(High, 15));
+
+	/* HW[0] is cleared */
+	Compose(_mm_setzero_si128(), Low, High, Sign, Row);
+	for (i = 0; i < 4; i ++) {
+		Accum[i] = Row[i];
+	}
+	StoreAccum(Accum);
+	StoreVect(RSPOpC.sa, _mm_or_si128(_mm_andnot_si128(Sign, High), Special));
+}
+
+void RSP_Simd_VMUDL (void) {
+	__m128i High;
+
+	High = _mm_mulhi_epu16(LoadVect(RSPOpC.rd), LoadElement());
+	SetAccum(High, _mm_setzero_si128(), _mm_setzero_si128());
+	StoreVect(RSPOpC.sa, High);
+}
+
+void RSP_Simd_VMUDM (void) {
+	__m128i a, b, High;
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	High = MulHighSignedUnsigned(a, b);
+	SetAccum(_mm_mullo_epi16(a, b), High, _mm_srai_epi16(High, 15));
+	StoreVect(RSPOpC.sa, High);
+}
+
+void RSP_Simd_VMUDN (void) {
+	__m128i a, b, Low, High;
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	Low = _mm_mullo_epi16(a, b);
+	High = MulHighSignedUnsigned(b, a);
+	SetAccum(Low, High, _mm_srai_epi16(High, 15));
+	StoreVect(RSPOpC.sa, Low);
+}
+
+void RSP_Simd_VMUDH (void) {
+	__m128i a, b, Low, High;
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	Low = _mm_mullo_epi16(a, b);
+	High = _mm_mulhi_epi16(a, b);
+	SetAccum(_mm_setzero_si128(), Low, High);
+	StoreVect(RSPOpC.sa, _mm_packs_epi32(_mm_unpacklo_epi16(Low, High), _mm_unpackhi_epi16(Low, High)));
+}
+
+void RSP_Simd_VMACF (void) {
+	__m128i a, b, Low, High, Accum[4];
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	Low = _mm_mullo_epi16(a, b);
+	High = _mm_mulhi_epi16(a, b);
+
+	/* sign extended product << 17 */
+	AddAccum(Accum, _mm_slli_epi16(Low, 1), _mm_or_si128(_mm_slli_epi16(High, 1), _mm_srli_epi16(Low, 15)), _mm_srai_epi16(High, 15));
+	StoreVect(RSPOpC.sa, ClampHigh(Accum));
+}
+
+void RSP_Simd_VMADL (void) {
+	__m128i Accum[4];
+
+	AddAccum(Accum, _mm_mulhi_epu16(LoadVect(RSPOpC.rd), LoadElement()), _mm_setzero_si128(), _mm_setzero_si128());
+	StoreVect(RSPOpC.sa, ClampLow(Accum));
+}
+
+void RSP_Simd_VMADM (void) {
+	__m128i a, b, High, Accum[4];
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	High = MulHighSignedUnsigned(a, b);
+	AddAccum(Accum, _mm_mullo_epi16(a, b), High, _mm_srai_epi16(High, 15));
+	StoreVect(RSPOpC.sa, ClampHigh(Accum));
+}
+
+void RSP_Simd_VMADN (void) {
+	__m128i a, b, High, Accum[4];
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	High = MulHighSignedUnsigned(b, a);
+	AddAccum(Accum, _mm_mullo_epi16(a, b), High, _mm_srai_epi16(High, 15));
+	StoreVect(RSPOpC.sa, ClampLow(Accum));
+}
+
+void RSP_Simd_VMADH (void) {
+	__m128i a, b, Accum[4];
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	AddAccum(Accum, _mm_setzero_si128(), _mm_mullo_epi16(a, b), _mm_mulhi_epi16(a, b));
+	StoreVect(RSPOpC.sa, ClampHigh(Accum));
+}
+
+void RSP_Simd_VADD (void) {
+	__m128i a, b, Carry;
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	Carry = CarryIn();
+	SetAccumMiddle(_mm_add_epi16(_mm_add_epi16(a, b), Carry));
+
+	/* adding the carry to the smaller value first can not saturate too early */
+	StoreVect(RSPOpC.sa, _mm_adds_epi16(_mm_adds_epi16(_mm_min_epi16(a, b), Carry), _mm_max_epi16(a, b)));
+	RSP_Flags[0].UW = 0;
+}
+
+void RSP_Simd_VSUB (void) {
+	__m128i a, b, Carry, Sub, SatSub, Result;
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	Carry = CarryIn();
+	Sub = _mm_add_epi16(b, Carry);
+	SatSub = _mm_adds_epi16(b, Carry);
+	SetAccumMiddle(_mm_sub_epi16(a, Sub));
+
+	/* 0x7FFF + 1 saturates, take the extra one off afterwards */
+	Result = _mm_subs_epi16(a, SatSub);
+	Result = _mm_adds_epi16(Result, _mm_cmpgt_epi16(SatSub, Sub));
+	StoreVect(RSPOpC.sa, Result);
+	RSP_Flags[0].UW = 0;
+}
+
+void RSP_Simd_VADDC (void) {
+	__m128i a, b, Sum, Sign;
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	Sum = _mm_add_epi16(a, b);
+	SetAccumMiddle(Sum);
+	StoreVect(RSPOpC.sa, Sum);
+
+	Sign = _mm_set1_epi16((short)0x8000);
+	RSP_Flags[0].UW = FlagBits(_mm_cmpgt_epi16(_mm_xor_si128(a, Sign), _mm_xor_si128(Sum, Sign)), _mm_setzero_si128());
+}
+
+void RSP_Simd_VSUBC (void) {
+	__m128i a, b, Diff, Sign, Borrow, NotEqual;
+
+	a = LoadVect(RSPOpC.rd);
+	b = LoadElement();
+	Diff = _mm_sub_epi16(a, b);
+	SetAccumMiddle(Diff);
+	StoreVect(RSPOpC.sa, Diff);
+
+	Sign = _mm_set1_epi16((short)0x8000);
+	Borrow = _mm_cmpgt_epi16(_mm_xor_si128(b, Sign), _mm_xor_si128(a, Sign));
+	NotEqual = _mm_xor_si128(_mm_cmpeq_epi16(a, b), _mm_set1_epi16(-1));
+	RSP_Flags[0].UW = FlagBits(Borrow, NotEqual);
+}
+
+void RSP_Simd_VAND (void) {
+	__m128i Result;
+
+	Result = _mm_and_si128(LoadVect(RSPOpC.rd), LoadElement());
+	SetAccumMiddle(Result);
+	StoreVect(RSPOpC.sa, Result);
+}
+
+void RSP_Simd_VNAND (void) {
+	__m128i Result;
+
+	Result = _mm_xor_si128(_mm_and_si128(LoadVect(RSPOpC.rd), LoadElement()), _mm_set1_epi16(-1));
+	SetAccumMiddle(Result);
+	StoreVect(RSPOpC.sa, Result);
+}
+
+void RSP_Simd_VOR (void) {
+	__m128i Result;
+
+	Result = _mm_or_si128(LoadVect(RSPOpC.rd), LoadElement());
+	SetAccumMiddle(Result);
+	StoreVect(RSPOpC.sa, Result);
+}
+
+void RSP_Simd_VNOR (void) {
+	__m128i Result;
+
+	Result = _mm_xor_si128(_mm_or_si128(LoadVect(RSPOpC.rd), LoadElement()), _mm_set1_epi16(-1));
+	SetAccumMiddle(Result);
+	StoreVect(RSPOpC.sa, Result);
+}
+
+void RSP_Simd_VXOR (void) {
+	__m128i Result;
+
+	Result = _mm_xor_si128(LoadVect(RSPOpC.rd), LoadElement());
+	SetAccumMiddle(Result);
+	StoreVect(RSPOpC.sa, Result);
+}
+
+void RSP_Simd_VNXOR (void) {
+	__m128i Result;
+
+	Result = _mm_xor_si128(_mm_xor_si128(LoadVect(RSPOpC.rd), LoadElement()), _mm_set1_epi16(-1));
+	SetAccumMiddle(Result);
+	StoreVect(RSPOpC.sa, Result);
+}
+
+void InitSimdElements(void) {
+	uint8_t Mask[16];
+	int i, el;
+
+	for (i = 0; i < 32; i ++) {
+		for (el = 0; el < 8; el ++) {
+			Mask[el * 2] = (uint8_t)(EleSpec[i].B[el] * 2);
+			Mask[el * 2 + 1] = (uint8_t)(EleSpec[i].B[el] * 2 + 1);
+		}
+		ElementMask[i] = _mm_loadu_si128((__m128i *)Mask);
+	}
+}
+
+void BuildInterpreterSimd(void) {
+	if (!Sse2Supported) {
+		return;
+	}
+	UseElementShuffle = Ssse3Supported;
+
+	RSP_Vector[ 0] = RSP_Simd_VMULF;
+	RSP_Vector[ 1] = RSP_Simd_VMULU;
+	RSP_Vector[ 4] = RSP_Simd_VMUDL;
+	RSP_Vector[ 5] = RSP_Simd_VMUDM;
+	RSP_Vector[ 6] = RSP_Simd_VMUDN;
+	RSP_Vector[ 7] = RSP_Simd_VMUDH;
+	RSP_Vector[ 8] = RSP_Simd_VMACF;
+	RSP_Vector[12] = RSP_Simd_VMADL;
+	RSP_Vector[13] = RSP_Simd_VMADM;
+	RSP_Vector[14] = RSP_Simd_VMADN;
+	RSP_Vector[15] = RSP_Simd_VMADH;
+	RSP_Vector[16] = RSP_Simd_VADD;
+	RSP_Vector[17] = RSP_Simd_VSUB;
+	RSP_Vector[20] = RSP_Simd_VADDC;
+	RSP_Vector[21] = RSP_Simd_VSUBC;
+	RSP_Vector[40] = RSP_Simd_VAND;
+	RSP_Vector[41] = RSP_Simd_VNAND;
+	RSP_Vector[42] = RSP_Simd_VOR;
+	RSP_Vector[43] = RSP_Simd_VNOR;
+	RSP_Vector[44] = RSP_Simd_VXOR;
+	RSP_Vector[45] = RSP_Simd_VNXOR;
+}
+#else
+void InitSimdElements(void) {
+}
+
+void BuildInterpreterSimd(void) {
+}
+#endif
@@ -41,6 +41,7 @@ extern "C" {
 #include "Rsp.h"
 #include "Cpu.h"
 #include "Recompiler CPU.h"
+#include "Interpreter Simd.h"
 #include "RSP Command.h"
 #include "RSP Registers.h"
 #include "memory.h"
@@ -62,10 +63,12 @@ extern "C" {
 	Boolean DebuggingEnabled = FALSE,
 		Profiling,
 		IndvidualBlock,
+		ProfileOpcodes,
 		ShowErrors,
 		BreakOnStart = FALSE,
 		LogRDP = FALSE,
-		LogX86Code = FALSE;
+		LogX86Code = FALSE,
+		SimdVector = FALSE;
 	uint32_t CPUCore = RecompilerCPU;
 
 	void* hMutex = NULL;
@@ -79,12 +82,15 @@ extern "C" {
 
 enum {
 	Set_BreakOnStart, Set_CPUCore, Set_LogRDP, Set_LogX86Code, Set_Profiling, Set_IndvidualBlock,
-	Set_ShowErrors,
+	Set_ProfileOpcodes, Set_ShowErrors,
 
 	//Compiler settings
 	Set_CheckDest, Set_Accum, Set_Mmx, Set_Mmx2, Set_Sse, Set_Sections,
 	Set_ReOrdering, Set_GPRConstants, Set_Flags, Set_AlignVector,
 
+	//Interpreter settings
+	Set_SimdVector,
+
 	//Game Settings
 	Set_JumpTableSize, Set_Mfc0Count, Set_SemaphoreExit
 };
@@ -214,6 +220,7 @@ void FixMenuState(void)
 	CheckMenuItem(hRSPMenu, ID_PROFILING_ON, MF_BYCOMMAND | (Profiling ? MFS_CHECKED : MF_UNCHECKED));
 	CheckMenuItem(hRSPMenu, ID_PROFILING_OFF, MF_BYCOMMAND | (Profiling ? MFS_UNCHECKED : MF_CHECKED));
 	CheckMenuItem(hRSPMenu, ID_PROFILING_LOGINDIVIDUALBLOCKS, MF_BYCOMMAND | (IndvidualBlock ? MFS_CHECKED : MF_UNCHECKED));
+	CheckMenuItem(hRSPMenu, ID_PROFILING_LOGOPCODES, MF_BYCOMMAND | (ProfileOpcodes ? MFS_CHECKED : MF_UNCHECKED));
 	CheckMenuItem(hRSPMenu, ID_SHOWCOMPILERERRORS, MF_BYCOMMAND | (ShowErrors ? MFS_CHECKED : MF_UNCHECKED));
 }
 #endif
@@ -293,6 +300,7 @@ void DetectCpuSpecs(void)
 {
 	DWORD Intel_Features = 0;
 	DWORD AMD_Features = 0;
+	DWORD Intel_ExtFeatures = 0;
 
 #if defined(_MSC_VER)
 	__try {
@@ -302,6 +310,7 @@ void DetectCpuSpecs(void)
 			mov eax, 1
 			cpuid
 			mov[Intel_Features], edx
+			mov[Intel_ExtFeatures], ecx
 
 			/* AMD features */
 			mov eax, 80000001h
@@ -312,19 +321,20 @@ void DetectCpuSpecs(void)
 		int cpuInfo[4];
 		__cpuid(cpuInfo, 1);
 		Intel_Features = cpuInfo[3];
+		Intel_ExtFeatures = cpuInfo[2];
 		__cpuid(cpuInfo, 0x80000001);
 		AMD_Features = cpuInfo[3];
 #endif
 	}
 	__except (EXCEPTION_EXECUTE_HANDLER) {
-		AMD_Features = Intel_Features = 0;
+		AMD_Features = Intel_Features = Intel_ExtFeatures = 0;
 	}
 #else
 	/*
 	 * To do:  With GCC, there is <cpuid.h>, but __cpuid() there is a macro and
 	 *         needs five arguments, not two.  Also, GCC lacks SEH.
 	 */
-	AMD_Features = Intel_Features = 0;
+	AMD_Features = Intel_Features = Intel_ExtFeatures = 0;
 #endif
 
 	if (Intel_Features & 0x02000000)
@@ -348,6 +358,9 @@ void DetectCpuSpecs(void)
 	{
 		ConditionalMove = FALSE;
 	}
+	Sse2Supported = (Intel_Features & 0x04000000) != 0;
+	Ssse3Supported = (Intel_ExtFeatures & 0x00000200) != 0;
+	SimdVector = Sse2Supported;
 }
 
 EXPORT void InitiateRSP(RSP_INFO Rsp_Info, uint32_t* CycleCount)
@@ -432,6 +445,24 @@ void ProcessMenuItem(int ID)
 		}
 	}
 	break;
+	case ID_PROFILING_LOGOPCODES:
+	{
+		uState = GetMenuState(hRSPMenu, ID_PROFILING_LOGOPCODES, MF_BYCOMMAND);
+
+		if (uState & MFS_CHECKED)
+		{
+			CheckMenuItem(hRSPMenu, ID_PROFILING_LOGOPCODES, MF_BYCOMMAND | MFS_UNCHECKED);
+			SetSetting(Set_ProfileOpcodes, FALSE);
+			if (DebuggingEnabled) { ProfileOpcodes = FALSE; }
+		}
+		else
+		{
+			CheckMenuItem(hRSPMenu, ID_PROFILING_LOGOPCODES, MF_BYCOMMAND | MFS_CHECKED);
+			SetSetting(Set_ProfileOpcodes, TRUE);
+			if (DebuggingEnabled) { ProfileOpcodes = TRUE; }
+		}
+	}
+	break;
 	case ID_SHOWCOMPILERERRORS:
 	{
 		uState = GetMenuState(hRSPMenu, ID_SHOWCOMPILERERRORS, MF_BYCOMMAND);
@@ -575,6 +606,7 @@ EXPORT void RomClosed(void)
 		GenerateTimerResults();
 	}
 	ClearAllx86Code();
+	RSP_Preempted = FALSE;
 	StopRDPLog();
 	StopCPULog();
 
@@ -583,6 +615,20 @@ EXPORT void RomClosed(void)
 #endif
 }
 
+/******************************************************************
+  Function: StartRspTask
+  Purpose:  This function is called before DoRspCycles when the RSP
+            has been started on a new task, rather than carrying on
+            one that ran out of cycles. The core may have been reset
+            or loaded a save state since the last task gave up the RSP.
+  input:    none
+  output:   none
+*******************************************************************/
+EXPORT void StartRspTask(void)
+{
+	RSP_Preempted = FALSE;
+}
+
 #ifdef _WIN32
 static BOOL GetBooleanCheck(HWND hDlg, DWORD DialogID)
 {
@@ -731,6 +777,7 @@ EXPORT void EnableDebugging(Boolean Enabled)
 		LogX86Code = GetSetting(Set_LogX86Code);
 		Profiling = GetSetting(Set_Profiling);
 		IndvidualBlock = GetSetting(Set_IndvidualBlock);
+		ProfileOpcodes = GetSetting(Set_ProfileOpcodes);
 		ShowErrors = GetSetting(Set_ShowErrors);
 
 		Compiler.bDest = GetSetting(Set_CheckDest);
@@ -743,6 +790,7 @@ EXPORT void EnableDebugging(Boolean Enabled)
 		Compiler.bGPRConstants = GetSetting(Set_GPRConstants);
 		Compiler.bFlags = GetSetting(Set_Flags);
 		Compiler.bAlignVector = GetSetting(Set_AlignVector);
+		SimdVector = GetSetting(Set_SimdVector) && Sse2Supported;
 		SetCPU(CPUCore);
 	}
 #ifdef _WIN32
@@ -768,6 +816,7 @@ EXPORT void PluginLoaded(void)
 	LogX86Code = FALSE;
 	Profiling = FALSE;
 	IndvidualBlock = FALSE;
+	ProfileOpcodes = FALSE;
 	ShowErrors = FALSE;
 
 	memset(&Compiler, 0, sizeof(Compiler));
@@ -792,6 +841,7 @@ EXPORT void PluginLoaded(void)
 	RegisterSetting(Set_LogX86Code, Data_DWORD_General, "Log X86 Code", NULL, LogX86Code, NULL);
 	RegisterSetting(Set_Profiling, Data_DWORD_General, "Profiling", NULL, Profiling, NULL);
 	RegisterSetting(Set_IndvidualBlock, Data_DWORD_General, "Indvidual Block", NULL, IndvidualBlock, NULL);
+	RegisterSetting(Set_ProfileOpcodes, Data_DWORD_General, "Profile Opcodes", NULL, ProfileOpcodes, NULL);
 	RegisterSetting(Set_ShowErrors, Data_DWORD_General, "Show Errors", NULL, ShowErrors, NULL);
 
 	//Compiler settings
@@ -805,6 +855,7 @@ EXPORT void PluginLoaded(void)
 	RegisterSetting(Set_GPRConstants, Data_DWORD_General, "Detect GPR Constants", NULL, Compiler.bGPRConstants, NULL);
 	RegisterSetting(Set_Flags, Data_DWORD_General, "Check Flag Usage", NULL, Compiler.bFlags, NULL);
 	RegisterSetting(Set_AlignVector, Data_DWORD_General, "Assume Vector loads align", NULL, Compiler.bAlignVector, NULL);
+	RegisterSetting(Set_SimdVector, Data_DWORD_General, "Use SIMD Vector Unit", NULL, SimdVector, NULL);
 
 	RegisterSetting(Set_JumpTableSize, Data_DWORD_Game, "JumpTableSize", NULL, 0x800, NULL);
 	RegisterSetting(Set_Mfc0Count, Data_DWORD_Game, "Mfc0Count", NULL, 0x0, NULL);
@@ -27,16 +27,78 @@
 #include <stdio.h>
 #include <windows.h>
 #include <shellapi.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 extern "C" {
+#include "Rsp.h"
+#include "Recompiler CPU.h"
+#include "RSP Command.h"
+#include "memory.h"
 #include "profiling.h"
 }
 #pragma warning(disable:4786)
 #include <Common/StdString.h>
 #include <Common/FileClass.h>
 #include <Common/LogClass.h>
+#include <algorithm>
 #include <map>
 #include <vector>
 
+static __int64 TimeStamp ( void )
+{
+#if defined(_MSC_VER)
+	return (__int64)__rdtsc();
+#else
+	LARGE_INTEGER Counter;
+	QueryPerformanceCounter(&Counter);
+	return Counter.QuadPart;
+#endif
+}
+
+//Opcodes are counted by what they do: the fields that pick the instruction are kept and
+//the registers are set to something that does not turn it into a pseudo op when named
+static DWORD OpcodeKey ( DWORD Hex )
+{
+	switch (Hex >> 26)
+	{
+	case 0: return (Hex & 0xFC00003F) | 0x00221800; //SPECIAL: funct
+	case 1: return (Hex & 0xFC1F0000) | 0x00200000; //REGIMM: rt
+	case 16: //COP0
+	case 18: //COP2: vector ops by funct, moves by rs
+		if ((Hex & 0x02000000) != 0) { return Hex & 0xFE00003F; }
+		return (Hex & 0xFFE00000) | 0x00021000;
+	case 50: //LWC2
+	case 58: //SWC2: by rd
+		return (Hex & 0xFC00F800) | 0x00220000;
+	}
+	return (Hex & 0xFC000000) | 0x00220000;
+}
+
+static bool VectorUnitOp ( DWORD Key )
+{
+	DWORD op = Key >> 26;
+	return op == 18 || op == 50 || op == 58;
+}
+
+static stdstr OpcodeMnemonic ( DWORD Key )
+{
+	stdstr Name = RSPOpcodeName(Key, 0);
+	size_t End = Name.find_first_of(" \t");
+	return End == stdstr::npos ? Name : Name.substr(0, End);
+}
+
+static const char * TaskName ( DWORD TaskType )
+{
+	switch (TaskType)
+	{
+	case 1: return "graphics";
+	case 2: return "audio";
+	case 4: return "jpeg";
+	}
+	return "other";
+}
+
 class CProfiling
 {
 typedef std::map<DWORD, __int64 >     PROFILE_ENRTIES;
@@ -44,14 +106,51 @@ typedef PROFILE_ENRTIES::iterator     PROFILE_ENRTY;
 typedef PROFILE_ENRTIES::value_type   PROFILE_VALUE;
 typedef struct { SPECIAL_TIMERS Timer; char * Name; } TIMER_NAME;
 
+	//Cost of the tasks run by one microcode, split by opcode when opcodes are being logged
+	typedef struct { unsigned __int64 Count; __int64 Time; } OPCODE_COST;
+	typedef std::map<DWORD, OPCODE_COST> OPCODE_ENTRIES;
+	typedef struct { DWORD Tasks; __int64 Time; unsigned __int64 Ops; OPCODE_ENTRIES Opcodes; } TASK_COST;
+	typedef std::pair<DWORD, DWORD> TASK_KEY; //task type, microcode hash
+	typedef std::map<TASK_KEY, TASK_COST> TASK_ENTRIES;
+
 	DWORD m_CurrentTimerAddr, CurrentDisplayCount;
 	DWORD m_StartTimeHi, m_StartTimeLo; //The Current Timer start time
+	DWORD m_MapHits, m_MapMisses; //microcode jump table lookups
+	DWORD m_ElidedAccum, m_ElidedVector, m_ElidedFlags, m_ElidedByLiveness; //dead writes left out of compiled code
 	PROFILE_ENRTIES m_Entries;
+	TASK_ENTRIES m_Tasks;
+	TASK_COST * m_Task; //task being run, NULL between tasks
+	OPCODE_COST * m_Opcode; //opcode being run
+	__int64 m_TaskStart, m_OpcodeStart;
+	__int64 m_CountersReset; //time stamp and wall clock when the counters were reset, to convert time stamps to time
+	DWORD m_CountersResetMs;
+
+	static bool SortByTime ( const TASK_ENTRIES::value_type * a, const TASK_ENTRIES::value_type * b )
+	{
+		return a->second.Time > b->second.Time;
+	}
+
+	static bool SortOpcodeByTime ( const OPCODE_ENTRIES::value_type * a, const OPCODE_ENTRIES::value_type * b )
+	{
+		return a->second.Time > b->second.Time;
+	}
 
 public:	
 	CProfiling ()
 	{
 		m_CurrentTimerAddr = Timer_None;
+		m_MapHits = 0;
+		m_MapMisses = 0;
+		m_ElidedAccum = 0;
+		m_ElidedVector = 0;
+		m_ElidedFlags = 0;
+		m_ElidedByLiveness = 0;
+		m_Task = NULL;
+		m_Opcode = NULL;
+		m_TaskStart = 0;
+		m_OpcodeStart = 0;
+		m_CountersReset = TimeStamp();
+		m_CountersResetMs = GetTickCount();
 	}
 	
 	//recording timing against current timer, returns the address of the timer stoped
@@ -112,10 +211,148 @@ public:
 		return OldTimerAddr;
 	}
 
+	void CountJumpTableLookup ( bool Hit )
+	{
+		if (Hit) { m_MapHits += 1; } else { m_MapMisses += 1; }
+	}
+
+	void CountElidedWrites ( DWORD Accum, DWORD Vector, DWORD Flags, DWORD LivenessOnly )
+	{
+		m_ElidedAccum += Accum;
+		m_ElidedVector += Vector;
+		m_ElidedFlags += Flags;
+		m_ElidedByLiveness += LivenessOnly;
+	}
+
+	//Task costs are kept by task type and by the microcode in IMEM, a task
+	//that was preempted is only counted once however many slices it runs in
+	void StartTask ( DWORD TaskType, int Resume )
+	{
+		m_Task = &m_Tasks[TASK_KEY(TaskType, ImemHash(JumpTableSize))];
+		if (!Resume) { m_Task->Tasks += 1; }
+		m_Opcode = NULL;
+		m_TaskStart = TimeStamp();
+	}
+
+	void StopTask ( void )
+	{
+		if (m_Task == NULL) { return; }
+
+		__int64 Now = TimeStamp();
+		if (m_Opcode != NULL)
+		{
+			m_Opcode->Time += Now - m_OpcodeStart;
+			m_Opcode = NULL;
+		}
+		m_Task->Time += Now - m_TaskStart;
+		m_Task = NULL;
+	}
+
+	//Called before each interpreted opcode, the time up to here goes to the one before it
+	void CountOpcode ( DWORD Hex )
+	{
+		if (m_Task == NULL) { return; }
+
+		__int64 Now = TimeStamp();
+		if (m_Opcode != NULL)
+		{
+			m_Opcode->Time += Now - m_OpcodeStart;
+		}
+		OPCODE_ENTRIES::iterator Entry = m_Task->Opcodes.find(OpcodeKey(Hex));
+		if (Entry == m_Task->Opcodes.end())
+		{
+			OPCODE_COST Cost = { 0, 0 };
+			Entry = m_Task->Opcodes.insert(OPCODE_ENTRIES::value_type(OpcodeKey(Hex), Cost)).first;
+		}
+		m_Opcode = &Entry->second;
+		m_Opcode->Count += 1;
+		m_Task->Ops += 1;
+		m_OpcodeStart = Now;
+	}
+
 	//Reset all the counters back to 0
 	void ResetCounters ( void )
 	{
 		m_Entries.clear();
+		m_MapHits = 0;
+		m_MapMisses = 0;
+		m_ElidedAccum = 0;
+		m_ElidedVector = 0;
+		m_ElidedFlags = 0;
+		m_ElidedByLiveness = 0;
+		m_Tasks.clear();
+		m_Task = NULL;
+		m_Opcode = NULL;
+		m_CountersReset = TimeStamp();
+		m_CountersResetMs = GetTickCount();
+	}
+
+	//Report of where the RSP time went by task type, microcode and opcode, along with the same
+	//split as folded stacks (task;microcode;opcode time) for flame graph tools
+	void GenerateTaskLog ( CLog & Log )
+	{
+		if (m_Tasks.empty()) { return; }
+
+		DWORD ElapsedMs = GetTickCount() - m_CountersResetMs;
+		double TicksPerUs = ElapsedMs != 0 ? (double)(TimeStamp() - m_CountersReset) / (ElapsedMs * 1000.0) : 0;
+		if (TicksPerUs <= 0) { TicksPerUs = 1; }
+
+		std::vector<const TASK_ENTRIES::value_type *> TaskList;
+		for (TASK_ENTRIES::const_iterator Task = m_Tasks.begin(); Task != m_Tasks.end(); Task++)
+		{
+			TaskList.push_back(&(*Task));
+		}
+		std::sort(TaskList.begin(), TaskList.end(), SortByTime);
+
+		CLog Folded;
+		Folded.Open("RSP Profiling.folded");
+
+		Log.LogF("\r\nTask      Microcode   Tasks   Host ms  us/task           Ops  Vector ops  Vector time\r\n");
+		for (size_t i = 0; i < TaskList.size(); i++)
+		{
+			DWORD TaskType = TaskList[i]->first.first, Microcode = TaskList[i]->first.second;
+			const TASK_COST & Cost = TaskList[i]->second;
+			double Us = Cost.Time / TicksPerUs;
+
+			unsigned __int64 VectorOps = 0;
+			__int64 VectorTime = 0, OpcodeTime = 0;
+			for (OPCODE_ENTRIES::const_iterator Opcode = Cost.Opcodes.begin(); Opcode != Cost.Opcodes.end(); Opcode++)
+			{
+				OpcodeTime += Opcode->second.Time;
+				if (VectorUnitOp(Opcode->first))
+				{
+					VectorOps += Opcode->second.Count;
+					VectorTime += Opcode->second.Time;
+				}
+			}
+			Log.LogF("%-8s  %08X  %7u  %8.1f  %7.1f  %12llu  %9.1f%%  %10.1f%%\r\n", TaskName(TaskType), Microcode, Cost.Tasks,
+				Us / 1000.0, Us / Cost.Tasks, (unsigned long long)Cost.Ops, Cost.Ops != 0 ? (VectorOps * 100.0) / Cost.Ops : 0.0,
+				OpcodeTime != 0 ? (VectorTime * 100.0) / OpcodeTime : 0.0);
+
+			if (Cost.Opcodes.empty())
+			{
+				Folded.LogF("%s;%08X %lld\n", TaskName(TaskType), Microcode, (long long)Cost.Time);
+				continue;
+			}
+
+			std::vector<const OPCODE_ENTRIES::value_type *> OpcodeList;
+			for (OPCODE_ENTRIES::const_iterator Opcode = Cost.Opcodes.begin(); Opcode != Cost.Opcodes.end(); Opcode++)
+			{
+				OpcodeList.push_back(&(*Opcode));
+			}
+			std::sort(OpcodeList.begin(), OpcodeList.end(), SortOpcodeByTime);
+			for (size_t x = 0; x < OpcodeList.size(); x++)
+			{
+				const OPCODE_COST & Op = OpcodeList[x]->second;
+				stdstr Name = OpcodeMnemonic(OpcodeList[x]->first);
+				Folded.LogF("%s;%08X;%s %lld\n", TaskName(TaskType), Microcode, Name.c_str(), (long long)Op.Time);
+				if (x < 20)
+				{
+					Log.LogF("    %-8s %12llu ops  %6.2f%% of time  %7.1f ticks/op\r\n", Name.c_str(), (unsigned long long)Op.Count,
+						OpcodeTime != 0 ? (Op.Time * 100.0) / OpcodeTime : 0.0, (double)Op.Time / Op.Count);
+				}
+			}
+		}
 	}
 
 	//Generate a log file with the current results, this will also reset the counters
@@ -180,8 +417,12 @@ public:
 						break;
 					}
 				}
-				Log.LogF("%s\t%2.2f",Buffer,  CpuUsage);
+				Log.LogF("%s\t%2.2f\r\n",Buffer,  CpuUsage);
 			}
+			Log.LogF("Microcode jump tables: %d hits, %d misses\r\n", m_MapHits, m_MapMisses);
+			Log.LogF("Dead writes compiled out: %d accumulator, %d vector, %d flag (%d found by liveness)\r\n",
+				m_ElidedAccum, m_ElidedVector, m_ElidedFlags, m_ElidedByLiveness);
+			GenerateTaskLog(Log);
 		}
 
 		ShellExecute(NULL,"open",LogFileName.c_str(),NULL,NULL,SW_SHOW);
@@ -216,6 +457,31 @@ void GenerateTimerResults (void)
 	GetProfiler().GenerateLog();
 }
 
+void CountJumpTableLookup (int Hit)
+{
+	GetProfiler().CountJumpTableLookup(Hit != 0);
+}
+
+void CountElidedWrites (DWORD Accum, DWORD Vector, DWORD Flags, DWORD LivenessOnly)
+{
+	GetProfiler().CountElidedWrites(Accum, Vector, Flags, LivenessOnly);
+}
+
+void StartTaskProfile (DWORD TaskType, int Resume)
+{
+	GetProfiler().StartTask(TaskType, Resume);
+}
+
+void StopTaskProfile (void)
+{
+	GetProfiler().StopTask();
+}
+
+void ProfileOpcode (DWORD Hex)
+{
+	GetProfiler().CountOpcode(Hex);
+}
+
 #ifdef todelete
 #include <windows.h>
 #include <stdio.h>
@@ -35,3 +35,8 @@ void  ResetTimerList       ( void );
 DWORD StartTimer           ( DWORD Address );
 void  StopTimer            ( void );
 void  GenerateTimerResults ( void );
+void  CountJumpTableLookup ( int Hit );
+void  CountElidedWrites    ( DWORD Accum, DWORD Vector, DWORD Flags, DWORD LivenessOnly );
+void  StartTaskProfile     ( DWORD TaskType, int Resume );
+void  StopTaskProfile      ( void );
+void  ProfileOpcode        ( DWORD Hex );
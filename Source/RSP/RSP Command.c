@@ -216,6 +216,13 @@ void DumpRSPCode (void)
 		WriteFile(hLogFile, string, characters_to_write, &dwWritten, NULL);
 	}
 	CloseHandle(hLogFile);
+
+	/* IMEM as it is, for Tests/RSP/LivenessTest */
+	strcpy(LogFileName + strlen(LogFileName) - 3, "bin");
+	hLogFile = CreateFile(LogFileName,GENERIC_WRITE, FILE_SHARE_READ,NULL,CREATE_ALWAYS,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	WriteFile(hLogFile, RSPInfo.IMEM, 0x1000, &dwWritten, NULL);
+	CloseHandle(hLogFile);
 }
 
 void DumpRSPData (void)
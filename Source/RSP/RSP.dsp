@@ -115,6 +115,10 @@ SOURCE=".\Interpreter Ops.c"
 # End Source File
 # Begin Source File
 
+SOURCE=".\Interpreter Simd.c"
+# End Source File
+# Begin Source File
+
 SOURCE=.\log.cpp
 # End Source File
 # Begin Source File
@@ -147,6 +151,10 @@ SOURCE=".\Recompiler Sections.c"
 # End Source File
 # Begin Source File
 
+SOURCE=".\Recompiler X64.c"
+# End Source File
+# Begin Source File
+
 SOURCE=".\RSP Command.c"
 # End Source File
 # Begin Source File
@@ -195,6 +203,10 @@ SOURCE=".\Interpreter Ops.h"
 # End Source File
 # Begin Source File
 
+SOURCE=".\Interpreter Simd.h"
+# End Source File
+# Begin Source File
+
 SOURCE=.\log.h
 # End Source File
 # Begin Source File
@@ -219,6 +231,10 @@ SOURCE=".\Recompiler Ops.h"
 # End Source File
 # Begin Source File
 
+SOURCE=".\Recompiler X64.h"
+# End Source File
+# Begin Source File
+
 SOURCE=.\resource.h
 # End Source File
 # Begin Source File
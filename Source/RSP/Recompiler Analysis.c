@@ -124,6 +124,355 @@ Boolean IsNextInstructionMmx(DWORD PC)
 		return FALSE;
 }
 
+/************************************************************
+** Liveness
+**
+** Backward liveness of the vector registers, the accumulator
+** slices and the flag registers over all of IMEM, worked out
+** once per compiled block and again whenever the block is
+** reordered. Anything leaving through JR/JALR, BREAK or the
+** end of IMEM, and any opcode not known here, keeps everything
+** live so the answers are always safe.
+*************************************************************/
+
+typedef struct {
+	DWORD Vect;		/* one bit per vector register */
+	BYTE Accum;		/* High16BitAccum | Middle16BitAccum | Low16BitAccum */
+	BYTE Flags;		/* VcoFlag | VccFlag | VceFlag */
+} RSP_LIVE;
+
+static RSP_LIVE LiveIn[0x400], LiveOut[0x400];
+static Boolean LivenessValid = FALSE;
+
+DWORD ElidedAccumWrites, ElidedVectorWrites, ElidedFlagWrites, LivenessOnlyWrites;
+
+#define BRANCH_NONE		0
+#define BRANCH_COND		1
+#define BRANCH_JUMP		2
+#define BRANCH_REG		3
+
+static int LivenessBranchType(DWORD PC, DWORD * Target)
+{
+	OPCODE RspOp;
+	RSP_LW_IMEM(PC, &RspOp.Hex);
+
+	switch (RspOp.op) {
+	case RSP_REGIMM:
+		switch (RspOp.rt) {
+		case RSP_REGIMM_BLTZ:
+		case RSP_REGIMM_BGEZ:
+		case RSP_REGIMM_BLTZAL:
+		case RSP_REGIMM_BGEZAL:
+			*Target = (PC + ((short)RspOp.offset << 2) + 4) & 0xFFC;
+			return BRANCH_COND;
+		}
+		break;
+	case RSP_SPECIAL:
+		switch (RspOp.funct) {
+		case RSP_SPECIAL_JR:
+		case RSP_SPECIAL_JALR:
+			return BRANCH_REG;
+		}
+		break;
+	case RSP_J:
+	case RSP_JAL:
+		*Target = (RspOp.target << 2) & 0xFFC;
+		return BRANCH_JUMP;
+	case RSP_BEQ:
+	case RSP_BNE:
+	case RSP_BLEZ:
+	case RSP_BGTZ:
+		*Target = (PC + ((short)RspOp.offset << 2) + 4) & 0xFFC;
+		return BRANCH_COND;
+	}
+	return BRANCH_NONE;
+}
+
+static void LiveEverything(RSP_LIVE * Live)
+{
+	Live->Vect = 0xFFFFFFFF;
+	Live->Accum = EntireAccum;
+	Live->Flags = AllRspFlags;
+}
+
+static BYTE FlagForControlReg(DWORD Reg)
+{
+	switch (Reg & 3) {
+	case 0: return VcoFlag;
+	case 1: return VccFlag;
+	default: return VceFlag;
+	}
+}
+
+/* Turns what is live after the op at PC into what is live before it */
+static void LiveTransfer(DWORD PC, RSP_LIVE * Live)
+{
+	OPCODE RspOp;
+	RSP_LW_IMEM(PC, &RspOp.Hex);
+
+	switch (RspOp.op) {
+	case RSP_REGIMM:
+	case RSP_J:
+	case RSP_JAL:
+	case RSP_BEQ:
+	case RSP_BNE:
+	case RSP_BLEZ:
+	case RSP_BGTZ:
+	case RSP_ADDI:
+	case RSP_ADDIU:
+	case RSP_SLTI:
+	case RSP_SLTIU:
+	case RSP_ANDI:
+	case RSP_ORI:
+	case RSP_XORI:
+	case RSP_LUI:
+	case RSP_CP0:
+	case RSP_LB:
+	case RSP_LH:
+	case RSP_LW:
+	case RSP_LBU:
+	case RSP_LHU:
+	case RSP_SB:
+	case RSP_SH:
+	case RSP_SW:
+		break;
+	case RSP_SPECIAL:
+		/* the task ends here, leave the state as it is */
+		if (RspOp.funct == RSP_SPECIAL_BREAK) {
+			LiveEverything(Live);
+		}
+		break;
+	case RSP_CP2:
+		if ((RspOp.rs & 0x10) != 0) {
+			switch (RspOp.funct) {
+			case RSP_VECTOR_VMULF:
+			case RSP_VECTOR_VMULU:
+			case RSP_VECTOR_VMUDL:
+			case RSP_VECTOR_VMUDM:
+			case RSP_VECTOR_VMUDN:
+			case RSP_VECTOR_VMUDH:
+				Live->Vect &= ~(1 << RspOp.sa);
+				Live->Accum = 0;
+				Live->Vect |= (1 << RspOp.rd) | (1 << RspOp.rt);
+				break;
+			case RSP_VECTOR_VMACF:
+			case RSP_VECTOR_VMACU:
+			case RSP_VECTOR_VMADL:
+			case RSP_VECTOR_VMADM:
+			case RSP_VECTOR_VMADN:
+				Live->Vect &= ~(1 << RspOp.sa);
+				Live->Accum = EntireAccum;
+				Live->Vect |= (1 << RspOp.rd) | (1 << RspOp.rt);
+				break;
+			case RSP_VECTOR_VMADH:
+				/* only adds in to the upper 32 bits */
+				Live->Vect &= ~(1 << RspOp.sa);
+				Live->Accum |= High16BitAccum | Middle16BitAccum;
+				Live->Vect |= (1 << RspOp.rd) | (1 << RspOp.rt);
+				break;
+			case RSP_VECTOR_VMACQ:
+				Live->Vect &= ~(1 << RspOp.sa);
+				Live->Accum |= High16BitAccum | Middle16BitAccum;
+				break;
+
+			case RSP_VECTOR_VADD:
+			case RSP_VECTOR_VSUB:
+				Live->Vect &= ~(1 << RspOp.sa);
+				Live->Accum &= ~Low16BitAccum;
+				Live->Flags |= VcoFlag;
+				Live->Vect |= (1 << RspOp.rd) | (1 << RspOp.rt);
+				break;
+			case RSP_VECTOR_VADDC:
+			case RSP_VECTOR_VSUBC:
+				Live->Vect &= ~(1 << RspOp.sa);
+				Live->Accum &= ~Low16BitAccum;
+				Live->Flags &= ~VcoFlag;
+				Live->Vect |= (1 << RspOp.rd) | (1 << RspOp.rt);
+				break;
+			case RSP_VECTOR_VLT:
+			case RSP_VECTOR_VEQ:
+			case RSP_VECTOR_VNE:
+			case RSP_VECTOR_VGE:
+				Live->Vect &= ~(1 << RspOp.sa);
+				Live->Accum &= ~Low16BitAccum;
+				Live->Flags &= ~VccFlag;
+				Live->Flags |= VcoFlag;
+				Live->Vect |= (1 << RspOp.rd) | (1 << RspOp.rt);
+				break;
+			case RSP_VECTOR_VCL:
+				/* VCC is only updated for some of the elements */
+				Live->Vect &= ~(1 << RspOp.sa);
+				Live->Accum &= ~Low16BitAccum;
+				Live->Flags = AllRspFlags;
+				Live->Vect |= (1 << RspOp.rd) | (1 << RspOp.rt);
+				break;
+			case RSP_VECTOR_VCH:
+			case RSP_VECTOR_VCR:
+				Live->Vect &= ~(1 << RspOp.sa);
+				Live->Accum &= ~Low16BitAccum;
+				Live->Flags = 0;
+				Live->Vect |= (1 << RspOp.rd) | (1 << RspOp.rt);
+				break;
+			case RSP_VECTOR_VMRG:
+				Live->Vect &= ~(1 << RspOp.sa);
+				Live->Accum &= ~Low16BitAccum;
+				Live->Flags |= VccFlag;
+				Live->Vect |= (1 << RspOp.rd) | (1 << RspOp.rt);
+				break;
+			case RSP_VECTOR_VABS:
+			case RSP_VECTOR_VAND:
+			case RSP_VECTOR_VNAND:
+			case RSP_VECTOR_VOR:
+			case RSP_VECTOR_VNOR:
+			case RSP_VECTOR_VXOR:
+			case RSP_VECTOR_VNXOR:
+				Live->Vect &= ~(1 << RspOp.sa);
+				Live->Accum &= ~Low16BitAccum;
+				Live->Vect |= (1 << RspOp.rd) | (1 << RspOp.rt);
+				break;
+
+			case RSP_VECTOR_VRCP:
+			case RSP_VECTOR_VRCPL:
+			case RSP_VECTOR_VRCPH:
+			case RSP_VECTOR_VRSQ:
+			case RSP_VECTOR_VRSQL:
+			case RSP_VECTOR_VRSQH:
+			case RSP_VECTOR_VMOV:
+				/* only one element of the destination is written */
+				Live->Accum &= ~Low16BitAccum;
+				Live->Vect |= (1 << RspOp.rt);
+				break;
+
+			case RSP_VECTOR_VSAW:
+				Live->Vect &= ~(1 << RspOp.sa);
+				switch ((RspOp.rs & 0xF)) {
+				case 8: Live->Accum |= High16BitAccum; break;
+				case 9: Live->Accum |= Middle16BitAccum; break;
+				case 10: Live->Accum |= Low16BitAccum; break;
+				}
+				break;
+			case RSP_VECTOR_VNOOP:
+				break;
+			default:
+				LiveEverything(Live);
+				break;
+			}
+		} else {
+			switch (RspOp.rs) {
+			case RSP_COP2_MF: Live->Vect |= (1 << RspOp.rd); break;
+			case RSP_COP2_MT: break;
+			case RSP_COP2_CF: Live->Flags |= FlagForControlReg(RspOp.rd); break;
+			case RSP_COP2_CT: Live->Flags &= ~FlagForControlReg(RspOp.rd); break;
+			default:
+				LiveEverything(Live);
+				break;
+			}
+		}
+		break;
+	case RSP_LC2:
+		/* vector loads never write all of every register they touch */
+		if (RspOp.rd > RSP_LSC2_TV) {
+			LiveEverything(Live);
+		}
+		break;
+	case RSP_SC2:
+		if (RspOp.rd == RSP_LSC2_TV) {
+			Live->Vect |= 0xFF << (RspOp.rt & 0x18);
+		} else if (RspOp.rd <= RSP_LSC2_WV) {
+			Live->Vect |= (1 << RspOp.rt);
+		} else {
+			LiveEverything(Live);
+		}
+		break;
+	default:
+		LiveEverything(Live);
+		break;
+	}
+}
+
+static void LiveUnion(RSP_LIVE * Live, DWORD PC)
+{
+	if (PC >= 0x1000) {
+		LiveEverything(Live);
+		return;
+	}
+	Live->Vect |= LiveIn[PC >> 2].Vect;
+	Live->Accum |= LiveIn[PC >> 2].Accum;
+	Live->Flags |= LiveIn[PC >> 2].Flags;
+}
+
+static void BuildLiveness(void)
+{
+	DWORD PC, DelayTarget;
+	int DelayType;
+	Boolean Changed;
+
+	memset(LiveIn, 0, sizeof(LiveIn));
+	memset(LiveOut, 0, sizeof(LiveOut));
+
+	do {
+		Changed = FALSE;
+		PC = 0x1000;
+		do {
+			RSP_LIVE Live = { 0, 0, 0 };
+
+			PC -= 4;
+			DelayType = PC >= 4 ? LivenessBranchType(PC - 4, &DelayTarget) : BRANCH_NONE;
+
+			switch (DelayType) {
+			case BRANCH_NONE:
+				LiveUnion(&Live, PC + 4);
+				break;
+			case BRANCH_COND:
+				LiveUnion(&Live, DelayTarget);
+				LiveUnion(&Live, PC + 4);
+				break;
+			case BRANCH_JUMP:
+				/* the slot runs on in to PC + 4 when it is not reached through
+				   the jump, from a jr, a branch or the task starting there */
+				LiveUnion(&Live, DelayTarget);
+				LiveUnion(&Live, PC + 4);
+				break;
+			default:
+				LiveEverything(&Live);
+				break;
+			}
+			LiveOut[PC >> 2] = Live;
+			LiveTransfer(PC, &Live);
+
+			if (Live.Vect != LiveIn[PC >> 2].Vect || Live.Accum != LiveIn[PC >> 2].Accum ||
+				Live.Flags != LiveIn[PC >> 2].Flags) {
+				LiveIn[PC >> 2] = Live;
+				Changed = TRUE;
+			}
+		} while (PC != 0);
+	} while (Changed);
+
+	LivenessValid = TRUE;
+}
+
+void InvalidateLiveness(void)
+{
+	LivenessValid = FALSE;
+}
+
+static RSP_LIVE * LiveAfter(int PC)
+{
+	if (LivenessValid == FALSE) {
+		BuildLiveness();
+	}
+	return &LiveOut[(PC & 0xFFC) >> 2];
+}
+
+static void CountElidedWrite(DWORD * Counter, int PC, Boolean FoundByLiveness)
+{
+	/* only count the op being compiled, not the ones looked ahead at */
+	if ((DWORD)PC != CompilePC) { return; }
+
+	*Counter += 1;
+	if (FoundByLiveness) { LivenessOnlyWrites += 1; }
+}
+
 /************************************************************
 ** WriteToAccum2
 **
@@ -432,12 +781,22 @@ DWORD WriteToAccum2(int Location, int PC, Boolean RecursiveCall)
 
 Boolean WriteToAccum(int Location, int PC)
 {
-	DWORD value = WriteToAccum2(Location, PC, FALSE);
+	DWORD value;
 
+	if (Compiler.bAccum == FALSE) return TRUE;
+
+	if ((LiveAfter(PC)->Accum & Location) == 0) {
+		CountElidedWrite(&ElidedAccumWrites, PC, WriteToAccum2(Location, PC, FALSE) != FALSE);
+		return FALSE;
+	}
+
+	value = WriteToAccum2(Location, PC, FALSE);
 	if (value == HIT_BRANCH) {
 		return TRUE; /* ??? */
-	} else
+	} else {
+		if (value == FALSE) { CountElidedWrite(&ElidedAccumWrites, PC, FALSE); }
 		return value;
+	}
 }
 
 /************************************************************
@@ -770,12 +1129,42 @@ Boolean WriteToVectorDest2(DWORD DestReg, int PC, Boolean RecursiveCall)
 Boolean WriteToVectorDest(DWORD DestReg, int PC)
 {
 	DWORD value;
-	value = WriteToVectorDest2(DestReg, PC, FALSE);
 
+	if (Compiler.bDest == FALSE) return TRUE;
+
+	if ((LiveAfter(PC)->Vect & (1 << DestReg)) == 0) {
+		CountElidedWrite(&ElidedVectorWrites, PC, WriteToVectorDest2(DestReg, PC, FALSE) != FALSE);
+		return FALSE;
+	}
+
+	value = WriteToVectorDest2(DestReg, PC, FALSE);
 	if (value == HIT_BRANCH) {
 		return TRUE; /* ??? */
-	} else
+	} else {
+		if (value == FALSE) { CountElidedWrite(&ElidedVectorWrites, PC, FALSE); }
 		return value;
+	}
+}
+
+/************************************************************
+** WriteToRspFlags
+**
+** Output:
+**	TRUE: One of the flags is read before it is written again
+**	FALSE: The flags written here are never looked at
+**
+** Input: PC, Flags (VcoFlag, VccFlag, VceFlag)
+*************************************************************/
+
+Boolean WriteToRspFlags(int Flags, int PC)
+{
+	if (Compiler.bFlags == FALSE) return TRUE;
+
+	if ((LiveAfter(PC)->Flags & Flags) == 0) {
+		CountElidedWrite(&ElidedFlagWrites, PC, TRUE);
+		return FALSE;
+	}
+	return TRUE;
 }
 
 /************************************************************
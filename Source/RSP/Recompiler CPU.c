@@ -50,6 +50,9 @@
 #define X86_RECOMP_VERBOSE
 #define BUILD_BRANCHLABELS_VERBOSE
 
+/* Room kept free in each buffer for the next block, 512 bytes for every op in IMEM */
+enum { MaxBlockSize = 0x80000 };
+
 DWORD CompilePC, JumpTableSize, BlockID = 0;
 DWORD dwBuffer = MainBuffer;
 Boolean ChangedPC;
@@ -534,6 +537,7 @@ void ReOrderSubBlock(RSP_BLOCK * Block) {
 	}
 	/* it wont actually re-order the op at the end */
 	ReOrderInstructions(Block->CurrPC, end);
+	InvalidateLiveness();
 }
 
 /******************************************************
@@ -607,14 +611,7 @@ void CompilerToggleBuffer(void) {
 }
 
 void ClearAllx86Code (void) {
-	extern DWORD NoOfMaps, MapsCRC[32];
-	extern BYTE *JumpTables;
-
-	memset(&MapsCRC, 0, sizeof(DWORD) * 0x20);
-	NoOfMaps = 0;
-	memset(JumpTables,0,0x1000*32);
-
-	RecompPos = RecompCode;
+	ResetJumpTables();
 
 	pLastPrimary = NULL;
 	pLastSecondary = NULL;
@@ -757,6 +754,47 @@ void CompilerLinkBlocks(void) {
 	x86_SetBranch32b(RecompPos - 4, KnownCode);
 }
 
+/******************************************************
+** CompileCycleCheck
+**
+** Desc:
+**   Emitted at each jump table entry, charges the ops up
+**   to the next label or branch against RSP_Cycles. The
+**   budget is tested before it is charged so a new slice
+**   always gets through at least one sub block
+**
+********************************************************/
+
+static DWORD SubBlockOps(DWORD PC) {
+	DWORD Count, End = 0x1000;
+
+	for (Count = 0; Count < RspCode.LabelCount; Count++) {
+		if (RspCode.BranchLabels[Count] > PC && RspCode.BranchLabels[Count] < End) {
+			End = RspCode.BranchLabels[Count];
+		}
+	}
+	for (Count = 0; Count < RspCode.BranchCount; Count++) {
+		if (RspCode.BranchLocations[Count] >= PC && RspCode.BranchLocations[Count] + 8 < End) {
+			End = RspCode.BranchLocations[Count] + 8;
+		}
+	}
+	return End > PC ? (End - PC) >> 2 : 1;
+}
+
+void CompileCycleCheck(void) {
+	BYTE * Jump;
+
+	CompConstToVariable(0, &RSP_Cycles, "RSP_Cycles");
+	JgLabel8("BudgetLeft", 0);
+	Jump = RecompPos - 1;
+	MoveConstToVariable(CompilePC, PrgCount, "RSP PC");
+	Ret();
+
+	CPU_Message("      BudgetLeft:");
+	x86_SetBranch8b(Jump, RecompPos);
+	SubConstFromVariable(SubBlockOps(CompilePC), &RSP_Cycles, "RSP_Cycles");
+}
+
 void CompilerRSPBlock(void)
 {
 	BYTE * IMEM_SAVE = (BYTE *)malloc(0x1000);
@@ -769,6 +807,12 @@ void CompilerRSPBlock(void)
 	CurrentBlock.StartPC = CompilePC;
 	CurrentBlock.CurrPC = CompilePC;
 
+	InvalidateLiveness();
+	ElidedAccumWrites = 0;
+	ElidedVectorWrites = 0;
+	ElidedFlagWrites = 0;
+	LivenessOnlyWrites = 0;
+
 	/* Align the block to a boundary */	
 	if (X86BaseAddress & 7)
 	{
@@ -794,6 +838,7 @@ void CompilerRSPBlock(void)
 
 	/* this is for the block about to be compiled */
 	*(JumpTable + (CompilePC >> 2)) = RecompPos;
+	CompileCycleCheck();
 
 	do {
 		/*
@@ -810,6 +855,7 @@ void CompilerRSPBlock(void)
 				/* reorder from here to next label or branch */
 				CurrentBlock.CurrPC = CompilePC;
 				ReOrderSubBlock(&CurrentBlock);
+				CompileCycleCheck();
 			} else if (NextInstruction != DELAY_SLOT_DONE) {
 				/*
 				 * we could link the blocks here, but performance
@@ -876,6 +922,7 @@ void CompilerRSPBlock(void)
 				CurrentBlock.CurrPC = CompilePC;
 				/* reorder from after delay to next label or branch */
 				ReOrderSubBlock(&CurrentBlock);
+				CompileCycleCheck();
 			} else {
 				CompilerLinkBlocks();
 			}
@@ -889,9 +936,15 @@ void CompilerRSPBlock(void)
 		}
 	} while (NextInstruction != FINISH_BLOCK && (CompilePC < 0x1000 || NextInstruction == DELAY_SLOT));
 	CPU_Message("==== end of recompiled code ====");
+	CPU_Message("Dead writes elided: %d accumulator, %d vector, %d flag (%d found by liveness)",
+		ElidedAccumWrites, ElidedVectorWrites, ElidedFlagWrites, LivenessOnlyWrites);
+	if (Profiling) {
+		CountElidedWrites(ElidedAccumWrites, ElidedVectorWrites, ElidedFlagWrites, LivenessOnlyWrites);
+	}
 
 	if (Compiler.bReOrdering == TRUE) {
 		memcpy(RSPInfo.IMEM, IMEM_SAVE, 0x1000);
+		InvalidateLiveness();
 	}
 	free(IMEM_SAVE);
 }
@@ -899,6 +952,11 @@ void CompilerRSPBlock(void)
 DWORD RunRecompilerCPU ( DWORD Cycles ) {
 	BYTE * Block;
 
+	/* opcodes are only logged one at a time by the interpreter */
+	if (Profiling && ProfileOpcodes) {
+		return RunInterpreterCPU(Cycles);
+	}
+
 	RSP_Running = TRUE;
 	SetJumpTable(JumpTableSize);
 
@@ -907,6 +965,14 @@ DWORD RunRecompilerCPU ( DWORD Cycles ) {
 		Block = *(JumpTable + (*PrgCount >> 2));
 
 		if (Block == NULL) {
+			/* jump tables are reused for new microcode, the code they pointed at is not */
+			if (RecompPos + MaxBlockSize > RecompCode + RecompCodeSize ||
+				(pLastSecondary != NULL && pLastSecondary + MaxBlockSize > RecompCodeSecondary + RecompCodeSecondarySize))
+			{
+				CPU_Message("==== recompiler buffer full, clearing all code ====");
+				ClearAllx86Code();
+				SetJumpTable(JumpTableSize);
+			}
 			if (Profiling && !IndvidualBlock) {
 				StartTimer((DWORD)Timer_Compiling);
 			}
@@ -962,6 +1028,12 @@ DWORD RunRecompilerCPU ( DWORD Cycles ) {
 		{
 			RSP_Running = FALSE;
 		}
+		else if (RSP_Running && RSP_Cycles <= 0)
+		{
+			/* out of budget, the next call carries on from SP_PC */
+			RSP_Preempted = TRUE;
+			break;
+		}
 	}
 
 	if (IsMmxEnabled == TRUE) {
@@ -37,8 +37,17 @@ extern Boolean ChangedPC;
 #define Low16BitAccum		4
 #define EntireAccum			(Low16BitAccum|Middle16BitAccum|High16BitAccum)
 
+#define VcoFlag				1
+#define VccFlag				2
+#define VceFlag				4
+#define AllRspFlags			(VcoFlag|VccFlag|VceFlag)
+
+extern DWORD ElidedAccumWrites, ElidedVectorWrites, ElidedFlagWrites, LivenessOnlyWrites;
+
+void InvalidateLiveness(void);
 Boolean WriteToAccum(int Location, int PC);
 Boolean WriteToVectorDest(DWORD DestReg, int PC);
+Boolean WriteToRspFlags(int Flags, int PC);
 Boolean UseRspFlags(int PC);
 
 Boolean DelaySlotAffectBranch(DWORD PC);
@@ -3444,7 +3444,9 @@ void Compile_Vector_VADD ( void ) {
 			MoveX86regHalfToVariable(x86_EAX, &RSP_Vect[RSPOpC.sa].HW[el], Reg);
 		}
 	}
-	MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	if (WriteToRspFlags(VcoFlag, CompilePC) != FALSE) {
+		MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	}
 	Pop(x86_EBP);
 }
 
@@ -3567,7 +3569,9 @@ void Compile_Vector_VSUB ( void ) {
 		}
 	}
 
-	MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	if (WriteToRspFlags(VcoFlag, CompilePC) != FALSE) {
+		MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	}
 	Pop(x86_EBP);
 }
 
@@ -3750,6 +3754,7 @@ void Compile_Vector_VADDC ( void ) {
 
     Boolean bWriteToDest = WriteToVectorDest(RSPOpC.sa, CompilePC);
     Boolean bWriteToAccum = WriteToAccum(Low16BitAccum, CompilePC);
+    Boolean bWriteToFlags = WriteToRspFlags(VcoFlag, CompilePC);
     Boolean bElement = (RSPOpC.rs & 8) ? TRUE : FALSE;
 
 	#ifndef CompileVaddc
@@ -3765,7 +3770,9 @@ void Compile_Vector_VADDC ( void ) {
 	}
 
 	/* Initialize flag register */
-	XorX86RegToX86Reg(x86_ECX, x86_ECX);
+	if (bWriteToFlags != FALSE) {
+		XorX86RegToX86Reg(x86_ECX, x86_ECX);
+	}
 
 	Push(x86_EBP);
 	sprintf(Reg, "RSP_Vect[%i].HW[0]", RSPOpC.rd);
@@ -3787,13 +3794,15 @@ void Compile_Vector_VADDC ( void ) {
 
 		AddX86RegToX86Reg(x86_EAX, x86_EBX);
 
-		XorX86RegToX86Reg(x86_EDX, x86_EDX);
-		TestConstToX86Reg(0xFFFF0000, x86_EAX);
-		Setnz(x86_EDX);
-		if ((7 - el) != 0) {
-			ShiftLeftSignImmed(x86_EDX, (BYTE)(7 - el));
+		if (bWriteToFlags != FALSE) {
+			XorX86RegToX86Reg(x86_EDX, x86_EDX);
+			TestConstToX86Reg(0xFFFF0000, x86_EAX);
+			Setnz(x86_EDX);
+			if ((7 - el) != 0) {
+				ShiftLeftSignImmed(x86_EDX, (BYTE)(7 - el));
+			}
+			OrX86RegToX86Reg(x86_ECX, x86_EDX);
 		}
-		OrX86RegToX86Reg(x86_ECX, x86_EDX);
 
 		if (bWriteToAccum != FALSE) {
 			sprintf(Reg, "RSP_ACCUM[%i].HW[1]", el);
@@ -3805,7 +3814,9 @@ void Compile_Vector_VADDC ( void ) {
 			MoveX86regHalfToVariable(x86_EAX, &RSP_Vect[RSPOpC.sa].HW[el], Reg);
 		}
 	}
-	MoveX86regToVariable(x86_ECX, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	if (bWriteToFlags != FALSE) {
+		MoveX86regToVariable(x86_ECX, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	}
 	Pop(x86_EBP);
 }
 
@@ -3815,6 +3826,7 @@ void Compile_Vector_VSUBC ( void ) {
 
     Boolean bWriteToDest = WriteToVectorDest(RSPOpC.sa, CompilePC);
     Boolean bWriteToAccum = WriteToAccum(Low16BitAccum, CompilePC);
+    Boolean bWriteToFlags = WriteToRspFlags(VcoFlag, CompilePC);
     Boolean bElement = (RSPOpC.rs & 8) ? TRUE : FALSE;
 
 	#ifndef CompileVsubc
@@ -3830,7 +3842,9 @@ void Compile_Vector_VSUBC ( void ) {
 	}
 
 	/* Initialize flag register */
-	XorX86RegToX86Reg(x86_ECX, x86_ECX);
+	if (bWriteToFlags != FALSE) {
+		XorX86RegToX86Reg(x86_ECX, x86_ECX);
+	}
 
 	for (count = 0; count < 8; count++) {
 		CPU_Message("     Iteration: %i", count);
@@ -3847,17 +3861,19 @@ void Compile_Vector_VSUBC ( void ) {
 
 		SubX86RegToX86Reg(x86_EAX, x86_EBX);
 
-		XorX86RegToX86Reg(x86_EDX, x86_EDX);
-		TestConstToX86Reg(0x0000FFFF, x86_EAX);
-		Setnz(x86_EDX);
-		ShiftLeftSignImmed(x86_EDX, (BYTE)(15 - el));
-		OrX86RegToX86Reg(x86_ECX, x86_EDX);
+		if (bWriteToFlags != FALSE) {
+			XorX86RegToX86Reg(x86_EDX, x86_EDX);
+			TestConstToX86Reg(0x0000FFFF, x86_EAX);
+			Setnz(x86_EDX);
+			ShiftLeftSignImmed(x86_EDX, (BYTE)(15 - el));
+			OrX86RegToX86Reg(x86_ECX, x86_EDX);
 
-		XorX86RegToX86Reg(x86_EDX, x86_EDX);
-		TestConstToX86Reg(0xFFFF0000, x86_EAX);
-		Setnz(x86_EDX);
-		ShiftLeftSignImmed(x86_EDX, (BYTE)(7 - el));
-		OrX86RegToX86Reg(x86_ECX, x86_EDX);
+			XorX86RegToX86Reg(x86_EDX, x86_EDX);
+			TestConstToX86Reg(0xFFFF0000, x86_EAX);
+			Setnz(x86_EDX);
+			ShiftLeftSignImmed(x86_EDX, (BYTE)(7 - el));
+			OrX86RegToX86Reg(x86_ECX, x86_EDX);
+		}
 
 		if (bWriteToAccum != FALSE) {
 			sprintf(Reg, "RSP_ACCUM[%i].HW[1]", el);
@@ -3868,7 +3884,9 @@ void Compile_Vector_VSUBC ( void ) {
 			MoveX86regHalfToVariable(x86_EAX, &RSP_Vect[RSPOpC.sa].HW[el], Reg);
 		}
 	}
-	MoveX86regToVariable(x86_ECX, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	if (bWriteToFlags != FALSE) {
+		MoveX86regToVariable(x86_ECX, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	}
 }
 
 void Compile_Vector_VSAW ( void ) {
@@ -3996,8 +4014,12 @@ void Compile_Vector_VLT(void)
 		}
 	}
 
-	MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
-	MoveX86regToVariable(x86_EBX, &RSP_Flags[1].UW, "RSP_Flags[1].UW");
+	if (WriteToRspFlags(VcoFlag, CompilePC) != FALSE) {
+		MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	}
+	if (WriteToRspFlags(VccFlag, CompilePC) != FALSE) {
+		MoveX86regToVariable(x86_EBX, &RSP_Flags[1].UW, "RSP_Flags[1].UW");
+	}
 
 	if (bWriteToDest != FALSE) {
 		for (el = 0; el < 8; el += 2) {
@@ -4064,8 +4086,12 @@ void Compile_Vector_VEQ(void)
 		}
 	}
 
-	MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
-	MoveX86regToVariable(x86_EBX, &RSP_Flags[1].UW, "RSP_Flags[1].UW");
+	if (WriteToRspFlags(VcoFlag, CompilePC) != FALSE) {
+		MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	}
+	if (WriteToRspFlags(VccFlag, CompilePC) != FALSE) {
+		MoveX86regToVariable(x86_EBX, &RSP_Flags[1].UW, "RSP_Flags[1].UW");
+	}
 
 	if (bWriteToDest != FALSE) {
 		for (count = 0; count < 8; count++) {
@@ -4130,8 +4156,12 @@ void Compile_Vector_VNE(void)
 		}
 	}
 
-	MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
-	MoveX86regToVariable(x86_EBX, &RSP_Flags[1].UW, "RSP_Flags[1].UW");
+	if (WriteToRspFlags(VcoFlag, CompilePC) != FALSE) {
+		MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	}
+	if (WriteToRspFlags(VccFlag, CompilePC) != FALSE) {
+		MoveX86regToVariable(x86_EBX, &RSP_Flags[1].UW, "RSP_Flags[1].UW");
+	}
 
 	if (bWriteToDest != FALSE) {
 		for (el = 0; el < 4; el++) {
@@ -4270,8 +4300,12 @@ void Compile_Vector_VGE(void)
 		}
 	}
 
-	MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
-	MoveX86regToVariable(x86_EBX, &RSP_Flags[1].UW, "RSP_Flags[1].UW");
+	if (WriteToRspFlags(VcoFlag, CompilePC) != FALSE) {
+		MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	}
+	if (WriteToRspFlags(VccFlag, CompilePC) != FALSE) {
+		MoveX86regToVariable(x86_EBX, &RSP_Flags[1].UW, "RSP_Flags[1].UW");
+	}
 
 	if (bWriteToDest != FALSE) {
 		for (el = 0; el < 8; el += 2) {
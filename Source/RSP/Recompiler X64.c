@@ -0,0 +1,1101 @@
+/*
+ * RSP Compiler plug in for Project64 (A Nintendo 64 emulator).
+ *
+ * (c) Copyright 2001 jabo (jabo@emulation64.com) and
+ * zilmar (zilmar@emulation64.com)
+ *
+ * pj64 homepage: www.pj64.net
+ * 
+ * Permission to use, copy, modify and distribute Project64 in both binary and
+ * source form, for non-commercial purposes, is hereby granted without fee,
+ * providing that this license information and copyright notice appear with
+ * all copies and any derived work.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event shall the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Project64 is freeware for PERSONAL USE only. Commercial users should
+ * seek permission of the copyright holders first. Commercial use includes
+ * charging money for Project64 or software derived from Project64.
+ *
+ * The copyright holders request that bug fixes and improvements to the code
+ * should be forwarded to them so if they want them.
+ *
+ */
+
+
+#include <windows.h>
+#include <stdio.h>
+
+#include "Rsp.h"
+#include "Cpu.h"
+#include "Interpreter CPU.h"
+#include "Interpreter Ops.h"
+#include "Interpreter Simd.h"
+#include "Recompiler CPU.h"
+#include "Recompiler X64.h"
+#include "RSP registers.h"
+#include "RSP Command.h"
+#include "breakpoint.h"
+#include "memory.h"
+#include "opcode.h"
+#include "log.h"
+#include "Profiling.h"
+#include "Types.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+
+/*
+ * 64 bit recompiler.
+ *
+ * The x86 recompiler addresses every variable with a 32 bit absolute and
+ * is entered through inline asm, neither of which is available on x64.
+ * This one compiles a block of RSP code into a straight run of native code
+ * that keeps rbx pointed at RSP_GPR, reaches the other globals relative to
+ * it, and calls the interpreter functions for anything it does not do
+ * itself.  VADD, VSUB and the multiply and multiply accumulate ops are
+ * emitted as SSE2 on xmm0 to xmm5 (the other xmm registers are callee
+ * saved on Win64), the rest of the vector unit is called.
+ * The block is a normal function so no inline asm is needed and it works
+ * with both the Win64 and System V calling conventions.
+ *
+ * Ops that can stop the RSP (break, cop0) are left to the interpreter,
+ * which also runs the rare branch that has one of those in its delay slot.
+ */
+
+#pragma warning(disable : 4152) // nonstandard extension, function/data pointer conversion in expression
+
+#define PUTDST8(dest,value)  (*((BYTE *)(dest))=(BYTE)(value)); dest += 1;
+#define PUTDST16(dest,value) (*((WORD *)(dest))=(WORD)(value)); dest += 2;
+#define PUTDST32(dest,value) (*((DWORD *)(dest))=(DWORD)(value)); dest += 4;
+#define PUTDSTPTR(dest, value) \
+    *(void **)(dest) = (void *)(value); dest += sizeof(void *);
+
+enum { X64_EAX = 0, X64_ECX = 1, X64_EDX = 2, X64_EBX = 3 };
+
+enum { X64_NormalOp, X64_BranchOp, X64_InterpretOp };
+
+/* Largest block and the space kept free for it in RecompCode */
+enum { X64_MaxBlockOps = 0x400, X64_MaxBlockSize = 0x20000 };
+
+void ClearAllx86Code(void);
+
+static p_func X64_Function(OPCODE Op) {
+	p_func Function = RSP_Opcode[Op.op];
+
+	if (Function == RSP_Opcode_SPECIAL) { return RSP_Special[Op.funct]; }
+	if (Function == RSP_Opcode_REGIMM) { return RSP_RegImm[Op.rt]; }
+	if (Function == RSP_Opcode_COP0) { return RSP_Cop0[Op.rs]; }
+	if (Function == RSP_Opcode_LC2) { return RSP_Lc2[Op.rd]; }
+	if (Function == RSP_Opcode_SC2) { return RSP_Sc2[Op.rd]; }
+	if (Function == RSP_Opcode_COP2) {
+		Function = RSP_Cop2[Op.rs];
+		if (Function == RSP_COP2_VECTOR) { return RSP_Vector[Op.funct]; }
+	}
+	return Function;
+}
+
+static int X64_OpType(OPCODE Op, p_func Function) {
+	if (Function == rsp_UnknownOpcode) {
+		return X64_InterpretOp;
+	}
+	switch (Op.op) {
+	case RSP_SPECIAL:
+		if (Op.funct == RSP_SPECIAL_JR || Op.funct == RSP_SPECIAL_JALR) { return X64_BranchOp; }
+		if (Op.funct == RSP_SPECIAL_BREAK) { return X64_InterpretOp; }
+		break;
+	case RSP_REGIMM:
+	case RSP_J:
+	case RSP_JAL:
+	case RSP_BEQ:
+	case RSP_BNE:
+	case RSP_BLEZ:
+	case RSP_BGTZ:
+		return X64_BranchOp;
+	case RSP_CP0:
+		return X64_InterpretOp;
+	}
+	return X64_NormalOp;
+}
+
+/************************** Emitter **************************/
+
+static Boolean X64_Offset(void * Variable, int * Offset) {
+	int64_t Diff = (int64_t)((BYTE *)Variable - (BYTE *)RSP_GPR);
+
+	if (Diff < -0x7FFFFFFF || Diff > 0x7FFFFFFF) {
+		return FALSE;
+	}
+	*Offset = (int)Diff;
+	return TRUE;
+}
+
+/* modrm for [rbx + Offset] */
+static void X64_RbxOperand(int Reg, int Offset) {
+	if (Offset >= -128 && Offset <= 127) {
+		PUTDST8(RecompPos, 0x43 | (Reg << 3));
+		PUTDST8(RecompPos, Offset);
+	} else {
+		PUTDST8(RecompPos, 0x83 | (Reg << 3));
+		PUTDST32(RecompPos, Offset);
+	}
+}
+
+static void X64_MoveConstPtrToReg(int Reg, void * Const) {
+	PUTDST8(RecompPos, 0x48);
+	PUTDST8(RecompPos, 0xB8 + Reg);
+	PUTDST32(RecompPos, (DWORD)(size_t)Const);
+	PUTDST32(RecompPos, (DWORD)((uint64_t)(size_t)Const >> 32));
+}
+
+static void X64_MoveVariableToReg(int Reg, void * Variable, char * VariableName) {
+	int Offset;
+
+	CPU_Message("      mov %s, dword ptr [%s]", Reg == X64_EAX ? "eax" : Reg == X64_ECX ? "ecx" : "edx", VariableName);
+	if (X64_Offset(Variable, &Offset)) {
+		PUTDST8(RecompPos, 0x8B);
+		X64_RbxOperand(Reg, Offset);
+	} else {
+		X64_MoveConstPtrToReg(Reg, Variable);
+		PUTDST8(RecompPos, 0x8B);
+		PUTDST8(RecompPos, (Reg << 3) | Reg);
+	}
+}
+
+static void X64_MovePointerToReg(int Reg, void * Variable, char * VariableName) {
+	int Offset;
+
+	CPU_Message("      mov %s, qword ptr [%s]", Reg == X64_EAX ? "rax" : "rcx", VariableName);
+	if (X64_Offset(Variable, &Offset)) {
+		PUTDST8(RecompPos, 0x48);
+		PUTDST8(RecompPos, 0x8B);
+		X64_RbxOperand(Reg, Offset);
+	} else {
+		X64_MoveConstPtrToReg(Reg, Variable);
+		PUTDST8(RecompPos, 0x48);
+		PUTDST8(RecompPos, 0x8B);
+		PUTDST8(RecompPos, (Reg << 3) | Reg);
+	}
+}
+
+/* Reg must not be ecx */
+static void X64_MoveRegToVariable(int Reg, void * Variable, char * VariableName) {
+	int Offset;
+
+	CPU_Message("      mov dword ptr [%s], %s", VariableName, Reg == X64_EAX ? "eax" : "edx");
+	if (X64_Offset(Variable, &Offset)) {
+		PUTDST8(RecompPos, 0x89);
+		X64_RbxOperand(Reg, Offset);
+	} else {
+		X64_MoveConstPtrToReg(X64_ECX, Variable);
+		PUTDST8(RecompPos, 0x89);
+		PUTDST8(RecompPos, (Reg << 3) | X64_ECX);
+	}
+}
+
+static void X64_MoveConstToVariable(DWORD Const, void * Variable, char * VariableName) {
+	int Offset;
+
+	CPU_Message("      mov dword ptr [%s], %Xh", VariableName, Const);
+	if (X64_Offset(Variable, &Offset)) {
+		PUTDST8(RecompPos, 0xC7);
+		X64_RbxOperand(0, Offset);
+	} else {
+		X64_MoveConstPtrToReg(X64_EAX, Variable);
+		PUTDST16(RecompPos, 0x00C7);
+	}
+	PUTDST32(RecompPos, Const);
+}
+
+static void X64_SubConstFromVariable(DWORD Const, void * Variable, char * VariableName) {
+	int Offset;
+
+	CPU_Message("      sub dword ptr [%s], %Xh", VariableName, Const);
+	if (X64_Offset(Variable, &Offset)) {
+		PUTDST8(RecompPos, 0x81);
+		X64_RbxOperand(5, Offset);
+	} else {
+		X64_MoveConstPtrToReg(X64_EAX, Variable);
+		PUTDST16(RecompPos, 0x2881);
+	}
+	PUTDST32(RecompPos, Const);
+}
+
+/* *PrgCount = Const */
+static void X64_SetPC(DWORD PC) {
+	X64_MovePointerToReg(X64_EAX, &PrgCount, "PrgCount");
+	CPU_Message("      mov dword ptr [rax], %Xh", PC);
+	PUTDST16(RecompPos, 0x00C7);
+	PUTDST32(RecompPos, PC);
+}
+
+static void X64_Call(void * Function, char * FunctionName) {
+	CPU_Message("      call offset %s", FunctionName);
+	X64_MoveConstPtrToReg(X64_EAX, Function);
+	PUTDST16(RecompPos, 0xD0FF);
+}
+
+static void X64_MoveGPRToReg(int Reg, int GPR) {
+	CPU_Message("      mov %s, dword ptr [%s]", Reg == X64_EAX ? "eax" : "ecx", GPR_Name(GPR));
+	PUTDST8(RecompPos, 0x8B);
+	X64_RbxOperand(Reg, GPR * 4);
+}
+
+static void X64_MoveEaxToGPR(int GPR) {
+	CPU_Message("      mov dword ptr [%s], eax", GPR_Name(GPR));
+	PUTDST8(RecompPos, 0x89);
+	X64_RbxOperand(X64_EAX, GPR * 4);
+}
+
+static void X64_MoveConstToGPR(DWORD Const, int GPR) {
+	CPU_Message("      mov dword ptr [%s], %Xh", GPR_Name(GPR), Const);
+	PUTDST8(RecompPos, 0xC7);
+	X64_RbxOperand(0, GPR * 4);
+	PUTDST32(RecompPos, Const);
+}
+
+/* add/or/and/sub/xor/cmp eax, [GPR] using the 0x03 style opcode */
+static void X64_GPROpToEax(BYTE OpCode, char * Name, int GPR) {
+	CPU_Message("      %s eax, dword ptr [%s]", Name, GPR_Name(GPR));
+	PUTDST8(RecompPos, OpCode);
+	X64_RbxOperand(X64_EAX, GPR * 4);
+}
+
+/* add/or/and/xor/cmp eax, imm32 using the short eax form */
+static void X64_ConstOpToEax(BYTE OpCode, char * Name, DWORD Const) {
+	CPU_Message("      %s eax, %Xh", Name, Const);
+	PUTDST8(RecompPos, OpCode);
+	PUTDST32(RecompPos, Const);
+}
+
+/* setcc al, movzx eax, al */
+static void X64_SetEaxOnCondition(BYTE Condition, char * Name) {
+	CPU_Message("      %s al", Name);
+	PUTDST8(RecompPos, 0x0F);
+	PUTDST8(RecompPos, 0x90 | Condition);
+	PUTDST8(RecompPos, 0xC0);
+	CPU_Message("      movzx eax, al");
+	PUTDST8(RecompPos, 0x0F);
+	PUTDST16(RecompPos, 0xC0B6);
+}
+
+/* condition codes as used by jcc, setcc and cmovcc */
+enum { X64_Below = 0x2, X64_Equal = 0x4, X64_NotEqual = 0x5, X64_Less = 0xC, X64_GreaterEqual = 0xD, X64_LessEqual = 0xE, X64_Greater = 0xF };
+
+/************************** SSE2 emitter **************************/
+
+enum { X64_XMM0 = 0, X64_XMM1, X64_XMM2, X64_XMM3, X64_XMM4, X64_XMM5 };
+
+/* 66 0F xx ops used on xmm registers */
+enum {
+	X64_PUNPCKLWD = 0x61, X64_PUNPCKLDQ = 0x62, X64_PCMPGTW = 0x65, X64_PCMPGTD = 0x66,
+	X64_PUNPCKHWD = 0x69, X64_PUNPCKHDQ = 0x6A, X64_PACKSSDW = 0x6B, X64_MOVDQA = 0x6F,
+	X64_PCMPEQW = 0x75, X64_PCMPEQD = 0x76, X64_PADDQ = 0xD4, X64_PMULLW = 0xD5,
+	X64_PAND = 0xDB, X64_PANDN = 0xDF, X64_PMULHUW = 0xE4, X64_PMULHW = 0xE5,
+	X64_PSUBSW = 0xE9, X64_PMINSW = 0xEA, X64_POR = 0xEB, X64_PADDSW = 0xED,
+	X64_PMAXSW = 0xEE, X64_PXOR = 0xEF, X64_PSUBW = 0xF9, X64_PADDW = 0xFD,
+};
+
+/* shift by immediate, the opcode picks the lane size and the sub op the shift */
+enum { X64_ShiftWord = 0x71, X64_ShiftDword = 0x72, X64_ShiftQword = 0x73 };
+enum { X64_ShiftRight = 2, X64_ShiftRightArith = 4, X64_ShiftLeft = 6 };
+
+/* 16 bit lane masks for the VCO carry bits, lane 0 is bit 7 */
+static const WORD X64_CarryBits[8] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
+
+static void X64_SseRegToReg(BYTE OpCode, char * Name, int Dest, int Source) {
+	CPU_Message("      %s xmm%d, xmm%d", Name, Dest, Source);
+	PUTDST8(RecompPos, 0x66);
+	PUTDST8(RecompPos, 0x0F);
+	PUTDST8(RecompPos, OpCode);
+	PUTDST8(RecompPos, 0xC0 | (Dest << 3) | Source);
+}
+
+static void X64_SseShift(BYTE OpCode, int SubOp, char * Name, int Reg, BYTE Shift) {
+	CPU_Message("      %s xmm%d, %d", Name, Reg, Shift);
+	PUTDST8(RecompPos, 0x66);
+	PUTDST8(RecompPos, 0x0F);
+	PUTDST8(RecompPos, OpCode);
+	PUTDST8(RecompPos, 0xC0 | (SubOp << 3) | Reg);
+	PUTDST8(RecompPos, Shift);
+}
+
+/* pshufd (66), pshuflw (F2) and pshufhw (F3) */
+static void X64_SseShuffle(BYTE Prefix, char * Name, int Dest, int Source, BYTE Order) {
+	CPU_Message("      %s xmm%d, xmm%d, %02Xh", Name, Dest, Source, Order);
+	PUTDST8(RecompPos, Prefix);
+	PUTDST8(RecompPos, 0x0F);
+	PUTDST8(RecompPos, 0x70);
+	PUTDST8(RecompPos, 0xC0 | (Dest << 3) | Source);
+	PUTDST8(RecompPos, Order);
+}
+
+static void X64_SseShufps(int Dest, int Source, BYTE Order) {
+	CPU_Message("      shufps xmm%d, xmm%d, %02Xh", Dest, Source, Order);
+	PUTDST8(RecompPos, 0x0F);
+	PUTDST8(RecompPos, 0xC6);
+	PUTDST8(RecompPos, 0xC0 | (Dest << 3) | Source);
+	PUTDST8(RecompPos, Order);
+}
+
+/* Variable has to be in reach of rbx, see X64_VectorInReach */
+static void X64_SseMoveVariableToReg(int Reg, void * Variable, char * VariableName) {
+	int Offset;
+
+	X64_Offset(Variable, &Offset);
+	CPU_Message("      movdqu xmm%d, xmmword ptr [%s]", Reg, VariableName);
+	PUTDST8(RecompPos, 0xF3);
+	PUTDST8(RecompPos, 0x0F);
+	PUTDST8(RecompPos, 0x6F);
+	X64_RbxOperand(Reg, Offset);
+}
+
+static void X64_SseMoveRegToVariable(int Reg, void * Variable, char * VariableName) {
+	int Offset;
+
+	X64_Offset(Variable, &Offset);
+	CPU_Message("      movdqu xmmword ptr [%s], xmm%d", VariableName, Reg);
+	PUTDST8(RecompPos, 0xF3);
+	PUTDST8(RecompPos, 0x0F);
+	PUTDST8(RecompPos, 0x7F);
+	X64_RbxOperand(Reg, Offset);
+}
+
+static void X64_SseZero(int Reg) {
+	X64_SseRegToReg(X64_PXOR, "pxor", Reg, Reg);
+}
+
+static void X64_SseCopy(int Dest, int Source) {
+	X64_SseRegToReg(X64_MOVDQA, "movdqa", Dest, Source);
+}
+
+/************************** Compiler **************************/
+
+static void X64_CompileCall(OPCODE Op, p_func Function, DWORD PC, Boolean SetPC) {
+	if (SetPC) {
+		X64_SetPC(PC);
+	}
+	X64_MoveConstToVariable(Op.Hex, &RSPOpC, "RSPOpC.Hex");
+	X64_Call(Function, RSPOpcodeName(Op.Hex, PC));
+	if (Op.rt == 0 || Op.rd == 0) {
+		X64_MoveConstToGPR(0, 0);
+	}
+}
+
+static char * X64_VectName(int Reg) {
+	static char Name[8][16];
+	static int Next;
+	char * Result = Name[Next++ & 7];
+
+	sprintf(Result, "RSP_Vect[%d]", Reg);
+	return Result;
+}
+
+static char * X64_AccumName(int Row) {
+	static char * Names[4] = { "RSP_ACCUM[0]", "RSP_ACCUM[2]", "RSP_ACCUM[4]", "RSP_ACCUM[6]" };
+	return Names[Row];
+}
+
+/* Everything the vector ops touch has to be addressable from rbx */
+static Boolean X64_VectorInReach(void) {
+	int Offset;
+
+	return X64_Offset(RSP_Vect, &Offset) && X64_Offset(&RSP_Vect[32], &Offset) &&
+		X64_Offset(RSP_ACCUM, &Offset) && X64_Offset(&RSP_ACCUM[8], &Offset) &&
+		X64_Offset(RSP_Flags, &Offset) && X64_Offset((void *)X64_CarryBits, &Offset);
+}
+
+enum { X64_ElementNone, X64_ElementHalves, X64_ElementBroadcast, X64_ElementUnsupported };
+
+/* How the element spec of the op maps onto pshuflw/pshufhw/pshufd */
+static int X64_ElementType(int Element, BYTE * Low, BYTE * High) {
+	BYTE * Lanes = EleSpec[Element].UB;
+	int el;
+
+	*Low = 0;
+	*High = 0;
+	for (el = 0; el < 8; el ++) {
+		if (Lanes[el] != el) { break; }
+	}
+	if (el == 8) {
+		return X64_ElementNone;
+	}
+	for (el = 0; el < 8; el ++) {
+		if (Lanes[el] != Lanes[0]) { break; }
+	}
+	if (el == 8) {
+		*Low = Lanes[0];
+		return X64_ElementBroadcast;
+	}
+	for (el = 0; el < 4; el ++) {
+		if (Lanes[el] > 3 || Lanes[el + 4] < 4 || Lanes[el + 4] > 7) {
+			return X64_ElementUnsupported;
+		}
+		*Low |= Lanes[el] << (el * 2);
+		*High |= (Lanes[el + 4] - 4) << (el * 2);
+	}
+	return X64_ElementHalves;
+}
+
+/* xmm0 = rd, xmm1 = rt with the element spec applied */
+static void X64_SseLoadOperands(OPCODE Op) {
+	BYTE Low, High;
+
+	X64_SseMoveVariableToReg(X64_XMM0, &RSP_Vect[Op.rd], X64_VectName(Op.rd));
+	X64_SseMoveVariableToReg(X64_XMM1, &RSP_Vect[Op.rt], X64_VectName(Op.rt));
+	switch (X64_ElementType(Op.rs, &Low, &High)) {
+	case X64_ElementHalves:
+		X64_SseShuffle(0xF2, "pshuflw", X64_XMM1, X64_XMM1, Low);
+		X64_SseShuffle(0xF3, "pshufhw", X64_XMM1, X64_XMM1, High);
+		break;
+	case X64_ElementBroadcast:
+		if (Low < 4) {
+			X64_SseShuffle(0xF2, "pshuflw", X64_XMM1, X64_XMM1, (BYTE)(Low * 0x55));
+			X64_SseShuffle(0x66, "pshufd", X64_XMM1, X64_XMM1, 0x00);
+		} else {
+			X64_SseShuffle(0xF3, "pshufhw", X64_XMM1, X64_XMM1, (BYTE)((Low - 4) * 0x55));
+			X64_SseShuffle(0x66, "pshufd", X64_XMM1, X64_XMM1, 0xFF);
+		}
+		break;
+	}
+}
+
+/* Dest = high half of Signed * Unsigned, Temp is used */
+static void X64_SseMulHighSignedUnsigned(int Dest, int Signed, int Unsigned, int Temp) {
+	X64_SseCopy(Dest, Signed);
+	X64_SseRegToReg(X64_PMULHW, "pmulhw", Dest, Unsigned);
+	X64_SseCopy(Temp, Unsigned);
+	X64_SseShift(X64_ShiftWord, X64_ShiftRightArith, "psraw", Temp, 15);
+	X64_SseRegToReg(X64_PAND, "pand", Temp, Signed);
+	X64_SseRegToReg(X64_PADDW, "paddw", Dest, Temp);
+}
+
+/* xmm2 = VCO carry bits as 0 or 1 in each lane, uses eax and xmm3 */
+static void X64_SseCarryIn(void) {
+	X64_MoveVariableToReg(X64_EAX, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+	CPU_Message("      movd xmm2, eax");
+	PUTDST8(RecompPos, 0x66);
+	PUTDST8(RecompPos, 0x0F);
+	PUTDST8(RecompPos, 0x6E);
+	PUTDST8(RecompPos, 0xD0);
+	X64_SseShuffle(0xF2, "pshuflw", X64_XMM2, X64_XMM2, 0x00);
+	X64_SseShuffle(0x66, "pshufd", X64_XMM2, X64_XMM2, 0x00);
+	X64_SseMoveVariableToReg(X64_XMM3, (void *)X64_CarryBits, "X64_CarryBits");
+	X64_SseRegToReg(X64_PAND, "pand", X64_XMM2, X64_XMM3);
+	X64_SseRegToReg(X64_PCMPEQW, "pcmpeqw", X64_XMM2, X64_XMM3);
+	X64_SseShift(X64_ShiftWord, X64_ShiftRight, "psrlw", X64_XMM2, 15);
+}
+
+enum { X64_AccumSet, X64_AccumMiddle, X64_AccumAdd, X64_AccumReplace };
+
+/*
+ * Builds the accumulator from HW[1] in xmm0, HW[2] in xmm1 and HW[3] in
+ * xmm2 (HW[0] is zero) and then replaces HW[1] to HW[3] of each lane
+ * (Set), only HW[1] (Middle), adds it (Add) or stores it (Replace).
+ * Uses all of xmm0 to xmm5.
+ */
+static void X64_SseAccumulate(int Mode) {
+	static const int RowReg[4] = { X64_XMM4, X64_XMM2, X64_XMM3, X64_XMM0 };
+	int Row;
+
+	X64_SseCopy(X64_XMM3, X64_XMM1);
+	X64_SseRegToReg(X64_PUNPCKLWD, "punpcklwd", X64_XMM3, X64_XMM2);
+	X64_SseRegToReg(X64_PUNPCKHWD, "punpckhwd", X64_XMM1, X64_XMM2);
+	X64_SseCopy(X64_XMM2, X64_XMM0);
+	X64_SseRegToReg(X64_PUNPCKLWD, "punpcklwd", X64_XMM2, X64_XMM2);
+	X64_SseShift(X64_ShiftDword, X64_ShiftLeft, "pslld", X64_XMM2, 16);
+	X64_SseRegToReg(X64_PUNPCKHWD, "punpckhwd", X64_XMM0, X64_XMM0);
+	X64_SseShift(X64_ShiftDword, X64_ShiftLeft, "pslld", X64_XMM0, 16);
+
+	X64_SseCopy(X64_XMM4, X64_XMM2);
+	X64_SseRegToReg(X64_PUNPCKLDQ, "punpckldq", X64_XMM4, X64_XMM3);
+	X64_SseRegToReg(X64_PUNPCKHDQ, "punpckhdq", X64_XMM2, X64_XMM3);
+	X64_SseCopy(X64_XMM3, X64_XMM0);
+	X64_SseRegToReg(X64_PUNPCKLDQ, "punpckldq", X64_XMM3, X64_XMM1);
+	X64_SseRegToReg(X64_PUNPCKHDQ, "punpckhdq", X64_XMM0, X64_XMM1);
+
+	/* xmm1 = the bits of each lane to replace */
+	if (Mode == X64_AccumSet || Mode == X64_AccumMiddle) {
+		X64_SseRegToReg(X64_PCMPEQW, "pcmpeqw", X64_XMM1, X64_XMM1);
+		if (Mode == X64_AccumMiddle) {
+			X64_SseShift(X64_ShiftQword, X64_ShiftRight, "psrlq", X64_XMM1, 48);
+		}
+		X64_SseShift(X64_ShiftQword, X64_ShiftLeft, "psllq", X64_XMM1, 16);
+	}
+
+	for (Row = 0; Row < 4; Row ++) {
+		int Reg = RowReg[Row];
+
+		if (Mode != X64_AccumReplace) {
+			X64_SseMoveVariableToReg(X64_XMM5, &RSP_ACCUM[Row * 2], X64_AccumName(Row));
+		}
+		if (Mode == X64_AccumSet || Mode == X64_AccumMiddle) {
+			X64_SseRegToReg(X64_PXOR, "pxor", Reg, X64_XMM5);
+			X64_SseRegToReg(X64_PAND, "pand", Reg, X64_XMM1);
+			X64_SseRegToReg(X64_PXOR, "pxor", Reg, X64_XMM5);
+		} else if (Mode == X64_AccumAdd) {
+			X64_SseRegToReg(X64_PADDQ, "paddq", Reg, X64_XMM5);
+		}
+		X64_SseMoveRegToVariable(Reg, &RSP_ACCUM[Row * 2], X64_AccumName(Row));
+	}
+}
+
+/* xmm0 = W[1] of each lane clamped to a signed 16 bit value */
+static void X64_SseClampHigh(void) {
+	X64_SseMoveVariableToReg(X64_XMM0, &RSP_ACCUM[0], X64_AccumName(0));
+	X64_SseMoveVariableToReg(X64_XMM1, &RSP_ACCUM[2], X64_AccumName(1));
+	X64_SseShufps(X64_XMM0, X64_XMM1, 0xDD);
+	X64_SseMoveVariableToReg(X64_XMM2, &RSP_ACCUM[4], X64_AccumName(2));
+	X64_SseMoveVariableToReg(X64_XMM3, &RSP_ACCUM[6], X64_AccumName(3));
+	X64_SseShufps(X64_XMM2, X64_XMM3, 0xDD);
+	X64_SseRegToReg(X64_PACKSSDW, "packssdw", X64_XMM0, X64_XMM2);
+}
+
+/* xmm3 = HW[1] of each lane, or 0 / 0xFFFF if W[1] does not fit in a signed 16 bit value */
+static void X64_SseClampLow(void) {
+	X64_SseMoveVariableToReg(X64_XMM0, &RSP_ACCUM[0], X64_AccumName(0));
+	X64_SseMoveVariableToReg(X64_XMM1, &RSP_ACCUM[2], X64_AccumName(1));
+	X64_SseCopy(X64_XMM4, X64_XMM0);
+	X64_SseShufps(X64_XMM4, X64_XMM1, 0x88);
+	X64_SseShufps(X64_XMM0, X64_XMM1, 0xDD);
+	X64_SseMoveVariableToReg(X64_XMM2, &RSP_ACCUM[4], X64_AccumName(2));
+	X64_SseMoveVariableToReg(X64_XMM3, &RSP_ACCUM[6], X64_AccumName(3));
+	X64_SseCopy(X64_XMM5, X64_XMM2);
+	X64_SseShufps(X64_XMM5, X64_XMM3, 0x88);
+	X64_SseShufps(X64_XMM2, X64_XMM3, 0xDD);
+
+	/* xmm4 = HW[1] */
+	X64_SseShift(X64_ShiftDword, X64_ShiftRightArith, "psrad", X64_XMM4, 16);
+	X64_SseShift(X64_ShiftDword, X64_ShiftRightArith, "psrad", X64_XMM5, 16);
+	X64_SseRegToReg(X64_PACKSSDW, "packssdw", X64_XMM4, X64_XMM5);
+
+	/* xmm3 = W[1] < -32768 */
+	X64_SseRegToReg(X64_PCMPEQD, "pcmpeqd", X64_XMM1, X64_XMM1);
+	X64_SseShift(X64_ShiftDword, X64_ShiftLeft, "pslld", X64_XMM1, 15);
+	X64_SseCopy(X64_XMM3, X64_XMM1);
+	X64_SseRegToReg(X64_PCMPGTD, "pcmpgtd", X64_XMM3, X64_XMM0);
+	X64_SseCopy(X64_XMM5, X64_XMM1);
+	X64_SseRegToReg(X64_PCMPGTD, "pcmpgtd", X64_XMM5, X64_XMM2);
+	X64_SseRegToReg(X64_PACKSSDW, "packssdw", X64_XMM3, X64_XMM5);
+
+	/* xmm0 = W[1] > 32767 */
+	X64_SseRegToReg(X64_PCMPEQD, "pcmpeqd", X64_XMM1, X64_XMM1);
+	X64_SseShift(X64_ShiftDword, X64_ShiftRight, "psrld", X64_XMM1, 17);
+	X64_SseRegToReg(X64_PCMPGTD, "pcmpgtd", X64_XMM0, X64_XMM1);
+	X64_SseRegToReg(X64_PCMPGTD, "pcmpgtd", X64_XMM2, X64_XMM1);
+	X64_SseRegToReg(X64_PACKSSDW, "packssdw", X64_XMM0, X64_XMM2);
+
+	X64_SseRegToReg(X64_POR, "por", X64_XMM3, X64_XMM0);
+	X64_SseRegToReg(X64_PANDN, "pandn", X64_XMM3, X64_XMM4);
+	X64_SseRegToReg(X64_POR, "por", X64_XMM3, X64_XMM0);
+}
+
+/*
+ * VMULF and VMULU: xmm0 = 0xFFFF in the lanes that were 0x8000 * 0x8000,
+ * xmm1 = sign of the result outside those lanes, xmm2 = HW[2], xmm3 = HW[1]
+ */
+static void X64_SseMulFraction(void) {
+	X64_SseCopy(X64_XMM2, X64_XMM0);
+	X64_SseRegToReg(X64_PMULHW, "pmulhw", X64_XMM2, X64_XMM1);
+	X64_SseCopy(X64_XMM3, X64_XMM0);
+	X64_SseRegToReg(X64_PMULLW, "pmullw", X64_XMM3, X64_XMM1);
+
+	X64_SseRegToReg(X64_PCMPEQW, "pcmpeqw", X64_XMM5, X64_XMM5);
+	X64_SseShift(X64_ShiftWord, X64_ShiftLeft, "psllw", X64_XMM5, 15);
+	X64_SseRegToReg(X64_PCMPEQW, "pcmpeqw", X64_XMM0, X64_XMM5);
+	X64_SseRegToReg(X64_PCMPEQW, "pcmpeqw", X64_XMM1, X64_XMM5);
+	X64_SseRegToReg(X64_PAND, "pand", X64_XMM0, X64_XMM1);
+
+	/* (a * b) << 1, rounded with 0x8000 */
+	X64_SseShift(X64_ShiftWord, X64_ShiftLeft, "psllw", X64_XMM2, 1);
+	X64_SseCopy(X64_XMM4, X64_XMM3);
+	X64_SseShift(X64_ShiftWord, X64_ShiftRight, "psrlw", X64_XMM4, 15);
+	X64_SseRegToReg(X64_POR, "por", X64_XMM2, X64_XMM4);
+	X64_SseShift(X64_ShiftWord, X64_ShiftLeft, "psllw", X64_XMM3, 1);
+	X64_SseCopy(X64_XMM4, X64_XMM3);
+	X64_SseShift(X64_ShiftWord, X64_ShiftRight, "psrlw", X64_XMM4, 15);
+	X64_SseRegToReg(X64_PADDW, "paddw", X64_XMM2, X64_XMM4);
+	X64_SseRegToReg(X64_PXOR, "pxor", X64_XMM3, X64_XMM5);
+
+	X64_SseCopy(X64_XMM4, X64_XMM2);
+	X64_SseShift(X64_ShiftWord, X64_ShiftRightArith, "psraw", X64_XMM4, 15);
+	X64_SseCopy(X64_XMM1, X64_XMM0);
+	X64_SseRegToReg(X64_PANDN, "pandn", X64_XMM1, X64_XMM4);
+}
+
+/* Same results as the ops in Interpreter Simd.c, returns FALSE if the op has to be called */
+static Boolean X64_CompileVectorOp(OPCODE Op) {
+	BYTE Low, High;
+	int Dest = Op.sa;
+
+	if (!SimdVector || (Op.rs & 0x10) == 0 || !X64_VectorInReach()) {
+		return FALSE;
+	}
+	if (X64_ElementType(Op.rs, &Low, &High) == X64_ElementUnsupported) {
+		return FALSE;
+	}
+
+	switch (Op.funct) {
+	case RSP_VECTOR_VMULF:
+	case RSP_VECTOR_VMULU:
+		X64_SseLoadOperands(Op);
+		X64_SseMulFraction();
+		if (Op.funct == RSP_VECTOR_VMULF) {
+			X64_SseCopy(X64_XMM5, X64_XMM2);
+			X64_SseRegToReg(X64_PADDW, "paddw", X64_XMM5, X64_XMM0);
+		} else {
+			X64_SseCopy(X64_XMM5, X64_XMM1);
+			X64_SseRegToReg(X64_PANDN, "pandn", X64_XMM5, X64_XMM2);
+			X64_SseRegToReg(X64_POR, "por", X64_XMM5, X64_XMM0);
+		}
+		X64_SseMoveRegToVariable(X64_XMM5, &RSP_Vect[Dest], X64_VectName(Dest));
+		X64_SseCopy(X64_XMM0, X64_XMM3);
+		X64_SseCopy(X64_XMM4, X64_XMM1);
+		X64_SseCopy(X64_XMM1, X64_XMM2);
+		X64_SseCopy(X64_XMM2, X64_XMM4);
+		X64_SseAccumulate(Op.funct == RSP_VECTOR_VMULF ? X64_AccumSet : X64_AccumReplace);
+		return TRUE;
+	case RSP_VECTOR_VMUDL:
+	case RSP_VECTOR_VMADL:
+		X64_SseLoadOperands(Op);
+		X64_SseRegToReg(X64_PMULHUW, "pmulhuw", X64_XMM0, X64_XMM1);
+		if (Op.funct == RSP_VECTOR_VMUDL) {
+			X64_SseMoveRegToVariable(X64_XMM0, &RSP_Vect[Dest], X64_VectName(Dest));
+		}
+		X64_SseZero(X64_XMM1);
+		X64_SseZero(X64_XMM2);
+		break;
+	case RSP_VECTOR_VMUDM:
+	case RSP_VECTOR_VMADM:
+	case RSP_VECTOR_VMUDN:
+	case RSP_VECTOR_VMADN:
+		X64_SseLoadOperands(Op);
+		if (Op.funct == RSP_VECTOR_VMUDM || Op.funct == RSP_VECTOR_VMADM) {
+			X64_SseMulHighSignedUnsigned(X64_XMM2, X64_XMM0, X64_XMM1, X64_XMM3);
+		} else {
+			X64_SseMulHighSignedUnsigned(X64_XMM2, X64_XMM1, X64_XMM0, X64_XMM3);
+		}
+		X64_SseRegToReg(X64_PMULLW, "pmullw", X64_XMM0, X64_XMM1);
+		if (Op.funct == RSP_VECTOR_VMUDM) {
+			X64_SseMoveRegToVariable(X64_XMM2, &RSP_Vect[Dest], X64_VectName(Dest));
+		} else if (Op.funct == RSP_VECTOR_VMUDN) {
+			X64_SseMoveRegToVariable(X64_XMM0, &RSP_Vect[Dest], X64_VectName(Dest));
+		}
+		X64_SseCopy(X64_XMM1, X64_XMM2);
+		X64_SseShift(X64_ShiftWord, X64_ShiftRightArith, "psraw", X64_XMM2, 15);
+		break;
+	case RSP_VECTOR_VMUDH:
+	case RSP_VECTOR_VMADH:
+		X64_SseLoadOperands(Op);
+		X64_SseCopy(X64_XMM2, X64_XMM0);
+		X64_SseRegToReg(X64_PMULHW, "pmulhw", X64_XMM2, X64_XMM1);
+		X64_SseRegToReg(X64_PMULLW, "pmullw", X64_XMM0, X64_XMM1);
+		if (Op.funct == RSP_VECTOR_VMUDH) {
+			X64_SseCopy(X64_XMM3, X64_XMM0);
+			X64_SseRegToReg(X64_PUNPCKLWD, "punpcklwd", X64_XMM3, X64_XMM2);
+			X64_SseCopy(X64_XMM4, X64_XMM0);
+			X64_SseRegToReg(X64_PUNPCKHWD, "punpckhwd", X64_XMM4, X64_XMM2);
+			X64_SseRegToReg(X64_PACKSSDW, "packssdw", X64_XMM3, X64_XMM4);
+			X64_SseMoveRegToVariable(X64_XMM3, &RSP_Vect[Dest], X64_VectName(Dest));
+		}
+		X64_SseCopy(X64_XMM1, X64_XMM0);
+		X64_SseZero(X64_XMM0);
+		break;
+	case RSP_VECTOR_VMACF:
+		X64_SseLoadOperands(Op);
+		X64_SseCopy(X64_XMM2, X64_XMM0);
+		X64_SseRegToReg(X64_PMULHW, "pmulhw", X64_XMM2, X64_XMM1);
+		X64_SseRegToReg(X64_PMULLW, "pmullw", X64_XMM0, X64_XMM1);
+
+		/* sign extended product << 17 */
+		X64_SseCopy(X64_XMM1, X64_XMM2);
+		X64_SseShift(X64_ShiftWord, X64_ShiftLeft, "psllw", X64_XMM1, 1);
+		X64_SseCopy(X64_XMM3, X64_XMM0);
+		X64_SseShift(X64_ShiftWord, X64_ShiftRight, "psrlw", X64_XMM3, 15);
+		X64_SseRegToReg(X64_POR, "por", X64_XMM1, X64_XMM3);
+		X64_SseShift(X64_ShiftWord, X64_ShiftRightArith, "psraw", X64_XMM2, 15);
+		X64_SseShift(X64_ShiftWord, X64_ShiftLeft, "psllw", X64_XMM0, 1);
+		break;
+	case RSP_VECTOR_VADD:
+	case RSP_VECTOR_VSUB:
+		X64_SseLoadOperands(Op);
+		X64_SseCarryIn();
+		if (Op.funct == RSP_VECTOR_VADD) {
+			X64_SseCopy(X64_XMM3, X64_XMM0);
+			X64_SseRegToReg(X64_PADDW, "paddw", X64_XMM3, X64_XMM1);
+			X64_SseRegToReg(X64_PADDW, "paddw", X64_XMM3, X64_XMM2);
+
+			/* adding the carry to the smaller value first can not saturate too early */
+			X64_SseCopy(X64_XMM4, X64_XMM0);
+			X64_SseRegToReg(X64_PMINSW, "pminsw", X64_XMM4, X64_XMM1);
+			X64_SseRegToReg(X64_PADDSW, "paddsw", X64_XMM4, X64_XMM2);
+			X64_SseRegToReg(X64_PMAXSW, "pmaxsw", X64_XMM0, X64_XMM1);
+			X64_SseRegToReg(X64_PADDSW, "paddsw", X64_XMM4, X64_XMM0);
+			X64_SseMoveRegToVariable(X64_XMM4, &RSP_Vect[Dest], X64_VectName(Dest));
+			X64_SseCopy(X64_XMM0, X64_XMM3);
+		} else {
+			X64_SseCopy(X64_XMM3, X64_XMM1);
+			X64_SseRegToReg(X64_PADDW, "paddw", X64_XMM3, X64_XMM2);
+			X64_SseCopy(X64_XMM4, X64_XMM1);
+			X64_SseRegToReg(X64_PADDSW, "paddsw", X64_XMM4, X64_XMM2);
+			X64_SseCopy(X64_XMM5, X64_XMM0);
+			X64_SseRegToReg(X64_PSUBW, "psubw", X64_XMM5, X64_XMM3);
+
+			/* 0x7FFF + 1 saturates, take the extra one off afterwards */
+			X64_SseCopy(X64_XMM1, X64_XMM0);
+			X64_SseRegToReg(X64_PSUBSW, "psubsw", X64_XMM1, X64_XMM4);
+			X64_SseRegToReg(X64_PCMPGTW, "pcmpgtw", X64_XMM4, X64_XMM3);
+			X64_SseRegToReg(X64_PADDSW, "paddsw", X64_XMM1, X64_XMM4);
+			X64_SseMoveRegToVariable(X64_XMM1, &RSP_Vect[Dest], X64_VectName(Dest));
+			X64_SseCopy(X64_XMM0, X64_XMM5);
+		}
+		X64_SseZero(X64_XMM1);
+		X64_SseZero(X64_XMM2);
+		X64_SseAccumulate(X64_AccumMiddle);
+		X64_MoveConstToVariable(0, &RSP_Flags[0].UW, "RSP_Flags[0].UW");
+		return TRUE;
+	default:
+		return FALSE;
+	}
+
+	switch (Op.funct) {
+	case RSP_VECTOR_VMUDL:
+	case RSP_VECTOR_VMUDM:
+	case RSP_VECTOR_VMUDN:
+	case RSP_VECTOR_VMUDH:
+		X64_SseAccumulate(X64_AccumSet);
+		break;
+	case RSP_VECTOR_VMADL:
+	case RSP_VECTOR_VMADN:
+		X64_SseAccumulate(X64_AccumAdd);
+		X64_SseClampLow();
+		X64_SseMoveRegToVariable(X64_XMM3, &RSP_Vect[Dest], X64_VectName(Dest));
+		break;
+	default:
+		X64_SseAccumulate(X64_AccumAdd);
+		X64_SseClampHigh();
+		X64_SseMoveRegToVariable(X64_XMM0, &RSP_Vect[Dest], X64_VectName(Dest));
+		break;
+	}
+	return TRUE;
+}
+
+/* Returns FALSE if the op has to be called */
+static Boolean X64_CompileNativeOp(OPCODE Op) {
+	DWORD Immediate = (DWORD)(int)(short)Op.immediate;
+
+	switch (Op.op) {
+	case RSP_ADDI:
+	case RSP_ADDIU:
+	case RSP_ANDI:
+	case RSP_ORI:
+	case RSP_XORI:
+	case RSP_SLTI:
+	case RSP_SLTIU:
+		if (Op.rt == 0) { return TRUE; }
+		X64_MoveGPRToReg(X64_EAX, Op.rs);
+		switch (Op.op) {
+		case RSP_ADDI:
+		case RSP_ADDIU: X64_ConstOpToEax(0x05, "add", Immediate); break;
+		case RSP_ANDI: X64_ConstOpToEax(0x25, "and", Op.immediate); break;
+		case RSP_ORI: X64_ConstOpToEax(0x0D, "or", Op.immediate); break;
+		case RSP_XORI: X64_ConstOpToEax(0x35, "xor", Op.immediate); break;
+		case RSP_SLTI:
+			X64_ConstOpToEax(0x3D, "cmp", Immediate);
+			X64_SetEaxOnCondition(X64_Less, "setl");
+			break;
+		case RSP_SLTIU:
+			X64_ConstOpToEax(0x3D, "cmp", Immediate);
+			X64_SetEaxOnCondition(X64_Below, "setb");
+			break;
+		}
+		X64_MoveEaxToGPR(Op.rt);
+		return TRUE;
+	case RSP_LUI:
+		if (Op.rt != 0) {
+			X64_MoveConstToGPR(Op.immediate << 16, Op.rt);
+		}
+		return TRUE;
+	case RSP_CP2:
+		return X64_CompileVectorOp(Op);
+	case RSP_SPECIAL:
+		break;
+	default:
+		return FALSE;
+	}
+
+	switch (Op.funct) {
+	case RSP_SPECIAL_SLL:
+	case RSP_SPECIAL_SRL:
+	case RSP_SPECIAL_SRA:
+		if (Op.rd == 0) { return TRUE; }
+		X64_MoveGPRToReg(X64_EAX, Op.rt);
+		if (Op.sa != 0) {
+			CPU_Message("      %s eax, %d", Op.funct == RSP_SPECIAL_SLL ? "shl" : Op.funct == RSP_SPECIAL_SRL ? "shr" : "sar", Op.sa);
+			PUTDST8(RecompPos, 0xC1);
+			PUTDST8(RecompPos, Op.funct == RSP_SPECIAL_SLL ? 0xE0 : Op.funct == RSP_SPECIAL_SRL ? 0xE8 : 0xF8);
+			PUTDST8(RecompPos, Op.sa);
+		}
+		X64_MoveEaxToGPR(Op.rd);
+		return TRUE;
+	case RSP_SPECIAL_SLLV:
+	case RSP_SPECIAL_SRLV:
+	case RSP_SPECIAL_SRAV:
+		if (Op.rd == 0) { return TRUE; }
+		X64_MoveGPRToReg(X64_EAX, Op.rt);
+		X64_MoveGPRToReg(X64_ECX, Op.rs);
+		CPU_Message("      %s eax, cl", Op.funct == RSP_SPECIAL_SLLV ? "shl" : Op.funct == RSP_SPECIAL_SRLV ? "shr" : "sar");
+		PUTDST8(RecompPos, 0xD3);
+		PUTDST8(RecompPos, Op.funct == RSP_SPECIAL_SLLV ? 0xE0 : Op.funct == RSP_SPECIAL_SRLV ? 0xE8 : 0xF8);
+		X64_MoveEaxToGPR(Op.rd);
+		return TRUE;
+	case RSP_SPECIAL_ADD:
+	case RSP_SPECIAL_ADDU:
+	case RSP_SPECIAL_SUB:
+	case RSP_SPECIAL_SUBU:
+	case RSP_SPECIAL_AND:
+	case RSP_SPECIAL_OR:
+	case RSP_SPECIAL_XOR:
+	case RSP_SPECIAL_NOR:
+	case RSP_SPECIAL_SLT:
+	case RSP_SPECIAL_SLTU:
+		if (Op.rd == 0) { return TRUE; }
+		X64_MoveGPRToReg(X64_EAX, Op.rs);
+		switch (Op.funct) {
+		case RSP_SPECIAL_ADD:
+		case RSP_SPECIAL_ADDU: X64_GPROpToEax(0x03, "add", Op.rt); break;
+		case RSP_SPECIAL_SUB:
+		case RSP_SPECIAL_SUBU: X64_GPROpToEax(0x2B, "sub", Op.rt); break;
+		case RSP_SPECIAL_AND: X64_GPROpToEax(0x23, "and", Op.rt); break;
+		case RSP_SPECIAL_OR: X64_GPROpToEax(0x0B, "or", Op.rt); break;
+		case RSP_SPECIAL_XOR: X64_GPROpToEax(0x33, "xor", Op.rt); break;
+		case RSP_SPECIAL_NOR:
+			X64_GPROpToEax(0x0B, "or", Op.rt);
+			CPU_Message("      not eax");
+			PUTDST16(RecompPos, 0xD0F7);
+			break;
+		case RSP_SPECIAL_SLT:
+			X64_GPROpToEax(0x3B, "cmp", Op.rt);
+			X64_SetEaxOnCondition(X64_Less, "setl");
+			break;
+		case RSP_SPECIAL_SLTU:
+			X64_GPROpToEax(0x3B, "cmp", Op.rt);
+			X64_SetEaxOnCondition(X64_Below, "setb");
+			break;
+		}
+		X64_MoveEaxToGPR(Op.rd);
+		return TRUE;
+	}
+	return FALSE;
+}
+
+static void X64_CompileOp(OPCODE Op, p_func Function, DWORD PC) {
+	CPU_Message("  %X %s", PC, RSPOpcodeName(Op.Hex, PC));
+	if (!X64_CompileNativeOp(Op)) {
+		X64_CompileCall(Op, Function, PC, FALSE);
+	}
+}
+
+/* Leaves the target in RSP_JumpTo */
+static void X64_CompileBranch(OPCODE Op, p_func Function, DWORD PC) {
+	DWORD Target = (PC + 4 + ((short)Op.offset << 2)) & 0xFFC;
+	DWORD NextPC = (PC + 8) & 0xFFC;
+	BYTE Condition = 0;
+
+	CPU_Message("  %X %s", PC, RSPOpcodeName(Op.Hex, PC));
+	switch (Op.op) {
+	case RSP_J:
+		X64_MoveConstToVariable((Op.target << 2) & 0xFFC, &RSP_JumpTo, "RSP_JumpTo");
+		return;
+	case RSP_JAL:
+		X64_MoveConstToGPR(NextPC, 31);
+		X64_MoveConstToVariable((Op.target << 2) & 0xFFC, &RSP_JumpTo, "RSP_JumpTo");
+		return;
+	case RSP_SPECIAL:
+		if (Op.funct == RSP_SPECIAL_JR) {
+			X64_MoveGPRToReg(X64_EAX, Op.rs);
+			X64_ConstOpToEax(0x25, "and", 0xFFC);
+			X64_MoveRegToVariable(X64_EAX, &RSP_JumpTo, "RSP_JumpTo");
+			return;
+		}
+		break;
+	case RSP_BEQ: Condition = X64_Equal; break;
+	case RSP_BNE: Condition = X64_NotEqual; break;
+	case RSP_BLEZ: Condition = X64_LessEqual; break;
+	case RSP_BGTZ: Condition = X64_Greater; break;
+	case RSP_REGIMM:
+		if (Op.rt == RSP_REGIMM_BLTZ) { Condition = X64_Less; }
+		if (Op.rt == RSP_REGIMM_BGEZ) { Condition = X64_GreaterEqual; }
+		break;
+	}
+
+	if (Condition == 0) {
+		X64_CompileCall(Op, Function, PC, TRUE);
+		return;
+	}
+
+	X64_MoveGPRToReg(X64_EAX, Op.rs);
+	if (Op.op == RSP_BEQ || Op.op == RSP_BNE) {
+		X64_GPROpToEax(0x3B, "cmp", Op.rt);
+	} else {
+		CPU_Message("      cmp eax, 0");
+		PUTDST8(RecompPos, 0x83);
+		PUTDST16(RecompPos, 0x00F8);
+	}
+	CPU_Message("      mov ecx, %Xh", Target);
+	PUTDST8(RecompPos, 0xB9);
+	PUTDST32(RecompPos, Target);
+	CPU_Message("      mov edx, %Xh", NextPC);
+	PUTDST8(RecompPos, 0xBA);
+	PUTDST32(RecompPos, NextPC);
+	CPU_Message("      cmovcc edx, ecx");
+	PUTDST8(RecompPos, 0x0F);
+	PUTDST8(RecompPos, 0x40 | Condition);
+	PUTDST8(RecompPos, 0xD1);
+	X64_MoveRegToVariable(X64_EDX, &RSP_JumpTo, "RSP_JumpTo");
+}
+
+static void X64_Prologue(void) {
+	CPU_Message("      push rbx");
+	PUTDST8(RecompPos, 0x53);
+	CPU_Message("      sub rsp, 20h");
+	PUTDST32(RecompPos, 0x20EC8348);
+	CPU_Message("      mov rbx, offset RSP_GPR");
+	X64_MoveConstPtrToReg(X64_EBX, RSP_GPR);
+}
+
+static void X64_Epilogue(void) {
+	CPU_Message("      add rsp, 20h");
+	PUTDST32(RecompPos, 0x20C48348);
+	CPU_Message("      pop rbx");
+	PUTDST8(RecompPos, 0x5B);
+	CPU_Message("      ret");
+	PUTDST8(RecompPos, 0xC3);
+}
+
+static BYTE * X64_CompileBlock(DWORD StartPC) {
+	DWORD PC = StartPC, DelayPC, Count;
+	OPCODE Op, DelayOp;
+	p_func Function, DelayFunction;
+	BYTE * Block;
+	int Type;
+
+	RSP_LW_IMEM(PC, &Op.Hex);
+	Function = X64_Function(Op);
+	Type = X64_OpType(Op, Function);
+	if (Type == X64_BranchOp) {
+		RSP_LW_IMEM((PC + 4) & 0xFFC, &DelayOp.Hex);
+		if (X64_OpType(DelayOp, X64_Function(DelayOp)) != X64_NormalOp) {
+			Type = X64_InterpretOp;
+		}
+	}
+	if (Type == X64_InterpretOp) {
+		return NULL;
+	}
+
+	if (RecompPos + X64_MaxBlockSize > RecompCode + RecompCodeSize) {
+		ClearAllx86Code();
+		SetJumpTable(JumpTableSize);
+	}
+	Block = RecompPos;
+	CPU_Message("====== x64 block %X ======", StartPC);
+	X64_Prologue();
+
+	for (Count = 0; Count < X64_MaxBlockOps; Count++) {
+		RSP_LW_IMEM(PC, &Op.Hex);
+		Function = X64_Function(Op);
+		Type = X64_OpType(Op, Function);
+
+		if (Type == X64_BranchOp) {
+			DelayPC = (PC + 4) & 0xFFC;
+			RSP_LW_IMEM(DelayPC, &DelayOp.Hex);
+			DelayFunction = X64_Function(DelayOp);
+			if (X64_OpType(DelayOp, DelayFunction) != X64_NormalOp) {
+				break;
+			}
+			X64_CompileBranch(Op, Function, PC);
+			X64_CompileOp(DelayOp, DelayFunction, DelayPC);
+
+			/* the jump is taken here, so the interpreter state is back to normal */
+			X64_MoveVariableToReg(X64_EDX, &RSP_JumpTo, "RSP_JumpTo");
+			X64_MovePointerToReg(X64_EAX, &PrgCount, "PrgCount");
+			CPU_Message("      mov dword ptr [rax], edx");
+			PUTDST16(RecompPos, 0x1089);
+			X64_MoveConstToVariable(NORMAL, &RSP_NextInstruction, "RSP_NextInstruction");
+			X64_SubConstFromVariable(Count + 2, &RSP_Cycles, "RSP_Cycles");
+			X64_Epilogue();
+			*(JumpTable + (StartPC >> 2)) = Block;
+			return Block;
+		}
+		if (Type == X64_InterpretOp) {
+			break;
+		}
+		X64_CompileOp(Op, Function, PC);
+		PC = (PC + 4) & 0xFFC;
+		if (PC == 0) {
+			break;
+		}
+	}
+
+	X64_SetPC(PC);
+	X64_SubConstFromVariable(Count, &RSP_Cycles, "RSP_Cycles");
+	X64_Epilogue();
+	*(JumpTable + (StartPC >> 2)) = Block;
+	return Block;
+}
+
+DWORD RunRecompilerX64(DWORD Cycles) {
+	BYTE * Block;
+
+	/* opcodes are only logged one at a time by the interpreter */
+	if (NoOfBpoints != 0 || Stepping_Commands || LogRDP || (Profiling && ProfileOpcodes)) {
+		return RunInterpreterCPU(Cycles);
+	}
+
+	RSP_Running = TRUE;
+	SetJumpTable(JumpTableSize);
+
+	while (RSP_Running) {
+		if (RSP_NextInstruction != NORMAL) {
+			ExecuteInterpreterOpcode();
+			RSP_Cycles -= 1;
+			continue;
+		}
+		if (RSP_Cycles <= 0) {
+			/* out of budget, the next call carries on from SP_PC */
+			RSP_Preempted = TRUE;
+			break;
+		}
+
+		Block = *(JumpTable + (*PrgCount >> 2));
+		if (Block == NULL) {
+			if (Profiling && !IndvidualBlock) {
+				StartTimer((DWORD)Timer_Compiling);
+			}
+			Block = X64_CompileBlock(*PrgCount);
+			if (Profiling && !IndvidualBlock) {
+				StopTimer();
+			}
+			if (Block == NULL) {
+				ExecuteInterpreterOpcode();
+				RSP_Cycles -= 1;
+				continue;
+			}
+		}
+
+		if (Profiling && IndvidualBlock) {
+			StartTimer(*PrgCount);
+		}
+		((void (*)(void))Block)();
+		if (Profiling && IndvidualBlock) {
+			StopTimer();
+		}
+	}
+	return Cycles;
+}
+#else
+DWORD RunRecompilerX64(DWORD Cycles) {
+	return RunInterpreterCPU(Cycles);
+}
+#endif
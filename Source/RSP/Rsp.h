@@ -154,6 +154,7 @@ EXPORT void InitiateRSP(RSP_INFO Rsp_Info, uint32_t * CycleCount);
 EXPORT void InitiateRSPDebugger(DEBUG_INFO Debug_Info);
 EXPORT void RomOpen(void);
 EXPORT void RomClosed(void);
+EXPORT void StartRspTask(void);
 EXPORT void DllConfig(void * hWnd);
 EXPORT void EnableDebugging(int Enabled);
 EXPORT void PluginLoaded(void);
@@ -165,7 +166,7 @@ int GetStoredWinPos(char * WinName, uint32_t * X, uint32_t * Y);
 #define InterpreterCPU	0
 #define RecompilerCPU	1
 
-extern int DebuggingEnabled, Profiling, IndvidualBlock, ShowErrors, BreakOnStart, LogRDP, LogX86Code;
+extern int DebuggingEnabled, Profiling, IndvidualBlock, ProfileOpcodes, ShowErrors, BreakOnStart, LogRDP, LogX86Code;
 extern uint32_t CPUCore;
 extern DEBUG_INFO DebugInfo;
 extern RSP_INFO RSPInfo;
@@ -29,15 +29,18 @@ enum { MaxMaps	= 32 };
 #include <windows.h>
 #include "Rsp.h"
 #include "RSP Registers.h"
+#include "memory.h"
+#include "Profiling.h"
 
-DWORD NoOfMaps, MapsCRC[MaxMaps], Table;
+DWORD NoOfMaps, MapsCRC[MaxMaps], MapsLastUsed[MaxMaps], MapsUseCount;
+uint32_t Table;
 BYTE * RecompCode, * RecompCodeSecondary, * RecompPos, *JumpTables;
 void ** JumpTable;
 
 int AllocateMemory (void) {
 	if (RecompCode == NULL){
-		RecompCode=(BYTE *) VirtualAlloc( NULL, 0x00400004, MEM_RESERVE, PAGE_EXECUTE_READWRITE);
-		RecompCode=(BYTE *) VirtualAlloc( RecompCode, 0x00400000, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+		RecompCode=(BYTE *) VirtualAlloc( NULL, RecompCodeSize + 4, MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+		RecompCode=(BYTE *) VirtualAlloc( RecompCode, RecompCodeSize, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
 		
 		if(RecompCode == NULL) {
 			DisplayError("Not enough memory for RSP RecompCode!");
@@ -46,7 +49,7 @@ int AllocateMemory (void) {
 	}
 
 	if (RecompCodeSecondary == NULL){
-		RecompCodeSecondary = (BYTE *)VirtualAlloc( NULL, 0x00200000, MEM_COMMIT, PAGE_EXECUTE_READWRITE );
+		RecompCodeSecondary = (BYTE *)VirtualAlloc( NULL, RecompCodeSecondarySize, MEM_COMMIT, PAGE_EXECUTE_READWRITE );
 		if(RecompCodeSecondary == NULL) {
 			DisplayError("Not enough memory for RSP RecompCode Secondary!");
 			return FALSE;
@@ -54,7 +57,7 @@ int AllocateMemory (void) {
 	}
 
 	if (JumpTables == NULL){
-		JumpTables = (BYTE *)VirtualAlloc( NULL, 0x1000 * MaxMaps, MEM_COMMIT, PAGE_READWRITE );
+		JumpTables = (BYTE *)VirtualAlloc( NULL, JumpTableBytes * MaxMaps, MEM_COMMIT, PAGE_READWRITE );
 		if( JumpTables == NULL ) {  
 			DisplayError("Not enough memory for Jump Table!");
 			return FALSE;
@@ -79,15 +82,15 @@ void FreeMemory (void) {
 
 void ResetJumpTables ( void )
 {
-	memset(JumpTables,0,0x1000 * MaxMaps);
+	memset(JumpTables,0,JumpTableBytes * MaxMaps);
 	RecompPos = RecompCode;
 	NoOfMaps = 0;
 }
 
-void SetJumpTable (DWORD End) {
+/* Hash of the microcode loaded in IMEM, used to tell microcodes apart */
+uint32_t ImemHash (uint32_t End) {
 	DWORD CRC, count;
 
-	CRC = 0;
 	if (End < 0x800)
 	{
 		End = 0x800;
@@ -98,25 +101,60 @@ void SetJumpTable (DWORD End) {
 		End = 0x800;
 	}
 
-	for (count = 0; count < End; count += 0x40) {
-		CRC += *(DWORD *)(RSPInfo.IMEM + count);		
+	CRC = 2166136261;
+	for (count = 0; count < End; count += 4) {
+		CRC = (CRC ^ *(DWORD *)(RSPInfo.IMEM + count)) * 16777619;
 	}
+	return CRC;
+}
 
+/*
+ * Each microcode gets its own jump table, keyed by a hash of the loaded
+ * IMEM, so switching back to a microcode seen before (audio and graphics
+ * tasks alternate every frame) picks up its compiled blocks again. Every
+ * word is hashed so two microcodes that only differ in a few places do not
+ * share a table. Once all the tables are in use the one used least
+ * recently is cleared for the new microcode; its compiled code stays in
+ * the recompiler buffer, so the recompilers check there is room for a
+ * block before compiling one and clear all of the code when there is not.
+ */
+void SetJumpTable (uint32_t End) {
+	DWORD CRC, count, Oldest;
+
+	CRC = ImemHash(End);
+	MapsUseCount += 1;
+	if (Table < NoOfMaps && CRC == MapsCRC[Table]) {
+		MapsLastUsed[Table] = MapsUseCount;
+		if (Profiling) { CountJumpTableLookup(TRUE); }
+		return;
+	}
 	for (count = 0; count <	NoOfMaps; count++ ) {
 		if (CRC == MapsCRC[count]) {
-			JumpTable = (void **)(JumpTables + count * 0x1000);
+			JumpTable = (void **)(JumpTables + count * JumpTableBytes);
 			Table = count;
+			MapsLastUsed[count] = MapsUseCount;
+			if (Profiling) { CountJumpTableLookup(TRUE); }
 			return;
 		}
 	}
-	//DisplayError("%X %X",NoOfMaps,CRC);
+	if (Profiling) { CountJumpTableLookup(FALSE); }
+
 	if (NoOfMaps == MaxMaps) {
-		ResetJumpTables();
-	}
-	MapsCRC[NoOfMaps] = CRC;
-	JumpTable = (void **)(JumpTables + NoOfMaps * 0x1000);
-	Table = NoOfMaps;
-	NoOfMaps += 1;
+		Oldest = 0;
+		for (count = 1; count < NoOfMaps; count++ ) {
+			if (MapsLastUsed[count] < MapsLastUsed[Oldest]) {
+				Oldest = count;
+			}
+		}
+	} else {
+		Oldest = NoOfMaps;
+		NoOfMaps += 1;
+	}
+	memset(JumpTables + Oldest * JumpTableBytes, 0, JumpTableBytes);
+	MapsCRC[Oldest] = CRC;
+	MapsLastUsed[Oldest] = MapsUseCount;
+	JumpTable = (void **)(JumpTables + Oldest * JumpTableBytes);
+	Table = Oldest;
 }
 
 void RSP_LB_DMEM ( uint32_t Addr, uint8_t * Value ) {
@@ -26,9 +26,16 @@
 
 #include "Types.h"
 
+/* One pointer per IMEM instruction */
+enum { JumpTableBytes = (0x1000 >> 2) * sizeof(void *) };
+
+enum { RecompCodeSize = 0x00400000, RecompCodeSecondarySize = 0x00200000 };
+
 int  AllocateMemory ( void );
 void FreeMemory     ( void );
+uint32_t ImemHash  (uint32_t End);
 void SetJumpTable  (uint32_t End);
+void ResetJumpTables ( void );
 
 extern uint8_t * RecompCode, * RecompCodeSecondary, * RecompPos;
 extern void ** JumpTable;
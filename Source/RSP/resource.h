@@ -37,13 +37,14 @@
 #define ID_CPUMETHOD_RECOMPILER         5016
 #define ID_CPUMETHOD_INTERPT            5017
 #define ID_SETTINGS_LOGX86CODE          5019
+#define ID_PROFILING_LOGOPCODES         5020
 
 // Next default values for new objects
 // 
 #ifdef APSTUDIO_INVOKED
 #ifndef APSTUDIO_READONLY_SYMBOLS
 #define _APS_NEXT_RESOURCE_VALUE        108
-#define _APS_NEXT_COMMAND_VALUE         5020
+#define _APS_NEXT_COMMAND_VALUE         5021
 #define _APS_NEXT_CONTROL_VALUE         1032
 #define _APS_NEXT_SYMED_VALUE           101
 #endif
@@ -0,0 +1,18 @@
+bench=./Project64-bench/project64-bench
+report=./User/Logs/Benchmark.txt
+
+# run project64-bench.sh first, then
+#     bench-async-dlist.sh <vi count> <async cycles> <input script> <rom>
+# times the same recorded input with display lists run inline and on the
+# task thread and prints the time per vi of both runs
+if [ $# -ne 4 ]; then
+    echo "usage: $0 <vi count> <async cycles> <input script> <rom>"
+    exit 1
+fi
+
+for cycles in 0 $2; do
+    $bench --benchmark $1 --input "$3" --async-dlist $cycles "$4" || exit 1
+    cp $report ./Benchmark-async-$cycles.txt
+    echo "async display list cycles $cycles:"
+    grep -e "Time per vi" -e "Async display lists" -e " fps" ./Benchmark-async-$cycles.txt
+done
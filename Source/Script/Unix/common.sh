@@ -20,6 +20,7 @@ echo Compiling common library sources for Project64...
 $CC -o $obj/CriticalSection.asm         $src/CriticalSection.cpp $C_FLAGS
 $CC -o $obj/FileClass.asm               $src/FileClass.cpp $C_FLAGS
 $CC -o $obj/IniFileClass.asm            $src/IniFileClass.cpp $C_FLAGS
+$CC -o $obj/IniFileIndex.asm            $src/IniFileIndex.cpp $C_FLAGS
 $CC -o $obj/LogClass.asm                $src/LogClass.cpp $C_FLAGS
 $CC -o $obj/md5.asm                     $src/md5.cpp $C_FLAGS
 $CC -o $obj/MemoryManagement.asm        $src/MemoryManagement.cpp $C_FLAGS
@@ -37,6 +38,7 @@ echo Assembling common library sources...
 $AS -o $obj/CriticalSection.o           $obj/CriticalSection.asm
 $AS -o $obj/FileClass.o                 $obj/FileClass.asm
 $AS -o $obj/IniFileClass.o              $obj/IniFileClass.asm
+$AS -o $obj/IniFileIndex.o              $obj/IniFileIndex.asm
 $AS -o $obj/LogClass.o                  $obj/LogClass.asm
 $AS -o $obj/md5.o                       $obj/md5.asm
 $AS -o $obj/MemoryManagement.o          $obj/MemoryManagement.asm
@@ -64,6 +66,7 @@ OBJ_LIST="\
  $obj/md5.o \
  $obj/LogClass.o \
  $obj/IniFileClass.o \
+ $obj/IniFileIndex.o \
  $obj/FileClass.o \
  $obj/CriticalSection.o"
 
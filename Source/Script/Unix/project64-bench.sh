@@ -0,0 +1,40 @@
+src=./../../Project64-bench
+obj=./Project64-bench
+
+mkdir -p $obj
+
+# run common.sh, settings.sh, zlib.sh and project64-core.sh first
+#
+# This does not link on Linux yet: Common and Project64-core still fail to
+# compile there (CriticalSection.cpp, IniFileClass.cpp, AppInit.cpp,
+# SystemGlobals.h among others), so the libraries above are never built.
+# There is no CMake target for the front end either.
+FLAGS_x86="\
+ -I$src/.. \
+ -I$src/../Project64-core \
+ -I$src/../3rdParty \
+ -fpermissive \
+ -S \
+ -masm=intel \
+ -march=native \
+ -Os"
+
+C_FLAGS=$FLAGS_x86
+
+CC=g++
+AS=as
+
+echo Compiling headless benchmark front end...
+$CC -o $obj/main.asm                    $src/main.cpp $C_FLAGS
+
+echo Assembling headless benchmark front end...
+$AS -o $obj/main.o                      $obj/main.asm
+
+echo Linking project64-bench...
+$CC -o $obj/project64-bench $obj/main.o \
+ ./Project64-core/libproject64-core.a \
+ ./Settings/libsettings.a \
+ ./Common/libcommon.a \
+ ./zlib/libpj64zip.a \
+ -ldl \
+ -lpthread
@@ -29,12 +29,12 @@ $CC -o $obj/AppInit.asm                 $src/AppInit.cpp $C_FLAGS
 $CC -o $obj/logging.asm                 $src/Logging.cpp $C_FLAGS
 $CC -o $obj/MemoryExceptionFilter.asm   $src/MemoryExceptionFilter.cpp $C_FLAGS
 $CC -o $obj/Multilanguage/LangClass.asm $src/Multilanguage/LanguageClass.cpp $C_FLAGS
+$CC -o $obj/N64System/ByteSwap.asm      $src/N64System/ByteSwap.cpp $C_FLAGS
 $CC -o $obj/N64System/CheatClass.asm    $src/N64System/CheatClass.cpp $C_FLAGS
 $CC -o $obj/N64System/EmuThread.asm     $src/N64System/EmulationThread.cpp $C_FLAGS
 $CC -o $obj/N64System/FPSClass.asm      $src/N64System/FramePerSecondClass.cpp $C_FLAGS
 $CC -o $obj/N64System/interp/CPU.asm    $src/N64System/Interpreter/InterpreterCPU.cpp $C_FLAGS
 $CC -o $obj/N64System/interp/Ops.asm    $src/N64System/Interpreter/InterpreterOps.cpp $C_FLAGS
-$CC -o $obj/N64System/interp/Ops32.asm  $src/N64System/Interpreter/InterpreterOps32.cpp $C_FLAGS
 $CC -o $obj/N64System/Mips/Audio.asm    $src/N64System/Mips/Audio.cpp $C_FLAGS
 $CC -o $obj/N64System/Mips/Disk.asm     $src/N64System/Mips/Disk.cpp $C_FLAGS
 $CC -o $obj/N64System/Mips/Dma.asm      $src/N64System/Mips/Dma.cpp $C_FLAGS
@@ -47,15 +47,23 @@ $CC -o $obj/N64System/Mips/OpName.asm   $src/N64System/Mips/OpcodeName.cpp $C_FL
 $CC -o $obj/N64System/Mips/PifRam.asm   $src/N64System/Mips/PifRam.cpp $C_FLAGS
 $CC -o $obj/N64System/Mips/RegClass.asm $src/N64System/Mips/RegisterClass.cpp $C_FLAGS
 $CC -o $obj/N64System/Mips/Rumble.asm   $src/N64System/Mips/Rumblepak.cpp $C_FLAGS
+$CC -o $obj/N64System/Mips/SaveMedia.asm $src/N64System/Mips/SaveMedia.cpp $C_FLAGS
 $CC -o $obj/N64System/Mips/Sram.asm     $src/N64System/Mips/Sram.cpp $C_FLAGS
 $CC -o $obj/N64System/Mips/SyEvents.asm $src/N64System/Mips/SystemEvents.cpp $C_FLAGS
 $CC -o $obj/N64System/Mips/SyTiming.asm $src/N64System/Mips/SystemTiming.cpp $C_FLAGS
+$CC -o $obj/N64System/Mips/TLBPageMap.asm $src/N64System/Mips/TLBPageMap.cpp $C_FLAGS
+$CC -o $obj/N64System/Mips/TimerSchedule.asm $src/N64System/Mips/TimerSchedule.cpp $C_FLAGS
 $CC -o $obj/N64System/Mips/TLBclass.asm $src/N64System/Mips/TLBclass.cpp $C_FLAGS
 $CC -o $obj/N64System/Mips/Transfer.asm $src/N64System/Mips/Transferpak.cpp $C_FLAGS
 $CC -o $obj/N64System/N64Class.asm      $src/N64System/N64Class.cpp $C_FLAGS
 $CC -o $obj/N64System/N64DiskClass.asm  $src/N64System/N64DiskClass.cpp $C_FLAGS
 $CC -o $obj/N64System/N64RomClass.asm   $src/N64System/N64RomClass.cpp $C_FLAGS
 $CC -o $obj/N64System/ProfileClass.asm  $src/N64System/ProfilingClass.cpp $C_FLAGS
+$CC -o $obj/N64System/SampleProf.asm    $src/N64System/SamplingProfiler.cpp $C_FLAGS
+$CC -o $obj/N64System/Benchmark.asm     $src/N64System/Benchmark.cpp $C_FLAGS
+$CC -o $obj/N64System/SaveState.asm     $src/N64System/SaveStateWriter.cpp $C_FLAGS
+$CC -o $obj/N64System/AudioHle.asm      $src/N64System/AudioHle.cpp $C_FLAGS
+$CC -o $obj/N64System/RspTask.asm       $src/N64System/RspTaskThread.cpp $C_FLAGS
 $CC -o $obj/N64System/dynarec/Block.asm $src/N64System/Recompiler/CodeBlock.cpp $C_FLAGS
 $CC -o $obj/N64System/dynarec/CSect.asm $src/N64System/Recompiler/CodeSection.cpp $C_FLAGS
 $CC -o $obj/N64System/dynarec/FnNfo.asm $src/N64System/Recompiler/FunctionInfo.cpp $C_FLAGS
@@ -110,12 +118,12 @@ $AS -o $obj/AppInit.o                   $obj/AppInit.asm
 $AS -o $obj/logging.o                   $obj/logging.asm
 $AS -o $obj/MemoryExceptionFilter.o     $obj/MemoryExceptionFilter.asm
 $AS -o $obj/Multilanguage/LangClass.o   $obj/Multilanguage/LangClass.asm
+$AS -o $obj/N64System/ByteSwap.o        $obj/N64System/ByteSwap.asm
 $AS -o $obj/N64System/CheatClass.o      $obj/N64System/CheatClass.asm
 $AS -o $obj/N64System/EmuThread.o       $obj/N64System/EmuThread.asm
 $AS -o $obj/N64System/FPSClass.o        $obj/N64System/FPSClass.asm
 $AS -o $obj/N64System/interp/CPU.o      $obj/N64System/interp/CPU.asm
 $AS -o $obj/N64System/interp/Ops.o      $obj/N64System/interp/Ops.asm
-$AS -o $obj/N64System/interp/Ops32.o    $obj/N64System/interp/Ops32.asm
 $AS -o $obj/N64System/Mips/Audio.o      $obj/N64System/Mips/Audio.asm
 $AS -o $obj/N64System/Mips/Disk.o       $obj/N64System/Mips/Disk.asm
 $AS -o $obj/N64System/Mips/Dma.o        $obj/N64System/Mips/Dma.asm
@@ -128,15 +136,23 @@ $AS -o $obj/N64System/Mips/OpName.o     $obj/N64System/Mips/OpName.asm
 $AS -o $obj/N64System/Mips/PifRam.o     $obj/N64System/Mips/PifRam.asm
 $AS -o $obj/N64System/Mips/RegClass.o   $obj/N64System/Mips/RegClass.asm
 $AS -o $obj/N64System/Mips/Rumble.o     $obj/N64System/Mips/Rumble.asm
+$AS -o $obj/N64System/Mips/SaveMedia.o  $obj/N64System/Mips/SaveMedia.asm
 $AS -o $obj/N64System/Mips/Sram.o       $obj/N64System/Mips/Sram.asm
 $AS -o $obj/N64System/Mips/SyEvents.o   $obj/N64System/Mips/SyEvents.asm
 $AS -o $obj/N64System/Mips/SyTiming.o   $obj/N64System/Mips/SyTiming.asm
+$AS -o $obj/N64System/Mips/TLBPageMap.o $obj/N64System/Mips/TLBPageMap.asm
+$AS -o $obj/N64System/Mips/TimerSchedule.o $obj/N64System/Mips/TimerSchedule.asm
 $AS -o $obj/N64System/Mips/TLBclass.o   $obj/N64System/Mips/TLBclass.asm
 $AS -o $obj/N64System/Mips/Transfer.o   $obj/N64System/Mips/Transfer.asm
 $AS -o $obj/N64System/N64Class.o        $obj/N64System/N64Class.asm
 $AS -o $obj/N64System/N64DiskClass.o    $obj/N64System/N64DiskClass.asm
 $AS -o $obj/N64System/N64RomClass.o     $obj/N64System/N64RomClass.asm
 $AS -o $obj/N64System/ProfileClass.o    $obj/N64System/ProfileClass.asm
+$AS -o $obj/N64System/SampleProf.o      $obj/N64System/SampleProf.asm
+$AS -o $obj/N64System/Benchmark.o       $obj/N64System/Benchmark.asm
+$AS -o $obj/N64System/SaveState.o       $obj/N64System/SaveState.asm
+$AS -o $obj/N64System/AudioHle.o        $obj/N64System/AudioHle.asm
+$AS -o $obj/N64System/RspTask.o         $obj/N64System/RspTask.asm
 $AS -o $obj/N64System/dynarec/Block.o   $obj/N64System/dynarec/Block.asm
 $AS -o $obj/N64System/dynarec/CSect.o   $obj/N64System/dynarec/CSect.asm
 $AS -o $obj/N64System/dynarec/FnNfo.o   $obj/N64System/dynarec/FnNfo.asm
@@ -190,12 +206,12 @@ $obj/AppInit.o \
 $obj/logging.o \
 $obj/MemoryExceptionFilter.o \
 $obj/Multilanguage/LangClass.o \
+$obj/N64System/ByteSwap.o \
 $obj/N64System/CheatClass.o \
 $obj/N64System/EmuThread.o \
 $obj/N64System/FPSClass.o \
 $obj/N64System/interp/CPU.o \
 $obj/N64System/interp/Ops.o \
-$obj/N64System/interp/Ops32.o \
 $obj/N64System/Mips/Audio.o \
 $obj/N64System/Mips/Disk.o \
 $obj/N64System/Mips/Dma.o \
@@ -208,15 +224,23 @@ $obj/N64System/Mips/OpName.o \
 $obj/N64System/Mips/PifRam.o \
 $obj/N64System/Mips/RegClass.o \
 $obj/N64System/Mips/Rumble.o \
+$obj/N64System/Mips/SaveMedia.o \
 $obj/N64System/Mips/Sram.o \
 $obj/N64System/Mips/SyEvents.o \
 $obj/N64System/Mips/SyTiming.o \
+$obj/N64System/Mips/TLBPageMap.o \
+$obj/N64System/Mips/TimerSchedule.o \
 $obj/N64System/Mips/TLBclass.o \
 $obj/N64System/Mips/Transfer.o \
 $obj/N64System/N64Class.o \
 $obj/N64System/N64DiskClass.o \
 $obj/N64System/N64RomClass.o \
 $obj/N64System/ProfileClass.o \
+$obj/N64System/SampleProf.o \
+$obj/N64System/Benchmark.o \
+$obj/N64System/SaveState.o \
+$obj/N64System/AudioHle.o \
+$obj/N64System/RspTask.o \
 $obj/N64System/dynarec/Block.o \
 $obj/N64System/dynarec/CSect.o \
 $obj/N64System/dynarec/FnNfo.o \
@@ -0,0 +1,52 @@
+src=./../../Tests
+rsp=./../../RSP
+obj=./Tests
+
+mkdir -p $obj/include
+
+# The RSP sources include a few headers with a different case to the file on disk
+ln -sf ../../$rsp/Cpu.h $obj/include/CPU.h
+ln -sf ../../$rsp/X86.h $obj/include/x86.h
+ln -sf ../../$rsp/OpCode.h $obj/include/opcode.h
+ln -sf "../../$rsp/RSP Registers.h" "$obj/include/RSP registers.h"
+
+RSP_FLAGS="\
+ -I$src/RSP/stub \
+ -I$obj/include \
+ -I$rsp \
+ -I$rsp/.. \
+ -msse2 \
+ -mssse3 \
+ -O2 \
+ -w \
+ -fcommon \
+ -ffunction-sections \
+ -Wl,--gc-sections"
+
+CC=gcc
+CXX=g++
+FAILED=0
+
+echo Building tests...
+$CXX -o $obj/SystemTimingTest $src/SystemTiming/SystemTimingTest.cpp $src/../Project64-core/N64System/Mips/TimerSchedule.cpp -I$src/.. -I$src/../Project64-core -I$src/../3rdParty -O2 -w || FAILED=1
+$CXX -o $obj/AudioHleTest $src/AudioHle/AudioHleTest.cpp $src/../Project64-core/N64System/AudioHle.cpp -I$src/.. -I$src/../Project64-core -I$src/../3rdParty -O2 -w || FAILED=1
+$CXX -o $obj/TLBLookupTest $src/TLB/TLBLookupTest.cpp $src/../Project64-core/N64System/Mips/TLBPageMap.cpp -I$src/.. -I$src/../Project64-core -I$src/../3rdParty -O2 -w || FAILED=1
+$CXX -o $obj/ByteSwapTest $src/ByteSwap/ByteSwapTest.cpp $src/../Project64-core/N64System/ByteSwap.cpp -I$src/.. -I$src/../Project64-core -I$src/../3rdParty -O2 -w || FAILED=1
+$CC -o $obj/VectorTest $src/RSP/VectorTest.c "$rsp/Interpreter Ops.c" "$rsp/Interpreter Simd.c" $RSP_FLAGS -lm || FAILED=1
+$CC -o $obj/LivenessTest $src/RSP/LivenessTest.c "$rsp/Interpreter CPU.c" "$rsp/Interpreter Ops.c" "$rsp/Interpreter Simd.c" "$rsp/memory.c" $RSP_FLAGS -lm || FAILED=1
+if [ "$(uname -m)" = "x86_64" ]; then
+    $CC -o $obj/RecompilerX64Test $src/RSP/RecompilerX64Test.c "$rsp/Recompiler X64.c" "$rsp/Interpreter CPU.c" "$rsp/Interpreter Ops.c" "$rsp/Interpreter Simd.c" "$rsp/memory.c" $RSP_FLAGS -lm || FAILED=1
+fi
+
+echo Running tests...
+$obj/SystemTimingTest || FAILED=1
+$obj/AudioHleTest || FAILED=1
+$obj/TLBLookupTest || FAILED=1
+$obj/ByteSwapTest || FAILED=1
+$obj/VectorTest || FAILED=1
+$obj/LivenessTest || FAILED=1
+if [ "$(uname -m)" = "x86_64" ]; then
+    $obj/RecompilerX64Test || FAILED=1
+fi
+
+exit $FAILED
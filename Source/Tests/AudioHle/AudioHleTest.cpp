@@ -0,0 +1,648 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+// Runs audio lists through CAudioHle and through CAudioReference, a sample at
+// a time transcription of the standard audio ABI, and checks both leave RDRAM
+// the same. Each list loads a random work area, sets up random buffers and
+// volumes, runs one command and saves the whole work area back, so a mismatch
+// is put down to the command that was tested.
+//
+//     AudioHleTest [lists per command]
+//
+// The reference addresses every sample on its own (the byte or halfword swap
+// applied per element) and does not share code with AudioHle.cpp, the vector
+// kernels, buffer clamping and word swapped fast paths there are what it checks.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Project64-core/N64System/AudioHle.h>
+
+// AudioHle.cpp only traces warnings, which are never turned on here
+uint32_t * g_ModuleLogLevel = NULL;
+void WriteTraceFull(uint32_t /*module*/, uint8_t /*severity*/, const char * /*file*/, int /*line*/, const char * /*function*/, const char * /*format*/, ...)
+{
+}
+
+enum
+{
+    A_SPNOOP, A_ADPCM, A_CLEARBUFF, A_ENVMIXER, A_LOADBUFF, A_RESAMPLE, A_SAVEBUFF, A_SEGMENT,
+    A_SETBUFF, A_SETVOL, A_DMEMMOVE, A_LOADADPCM, A_MIXER, A_INTERLEAVE, A_POLEF, A_SETLOOP,
+};
+
+enum
+{
+    A_INIT = 0x01,
+    A_LOOP = 0x02,
+    A_LEFT = 0x02,
+    A_VOL = 0x04,
+    A_AUX = 0x08,
+};
+
+enum
+{
+    RdramSize = 0x100000,
+    DmemBase = 0x5C0,
+    WorkSize = 0x1000 - DmemBase,
+    ListAddr = 0x0000,
+    ImageIn = 0x1000,
+    ImageOut = 0x2000,
+    StateBase = 0x10000,
+};
+
+static inline int16_t Clamp16(int32_t Value)
+{
+    return (int16_t)(Value < -32768 ? -32768 : (Value > 32767 ? 32767 : Value));
+}
+
+static const int16_t ResampleTable[64 * 4] =
+{
+    0x0c39, 0x66ad, 0x0d46, -0x0021, 0x0b39, 0x6696, 0x0e5f, -0x0028,
+    0x0a44, 0x6669, 0x0f83, -0x0030, 0x095a, 0x6626, 0x10b4, -0x0038,
+    0x087d, 0x65cd, 0x11f0, -0x0041, 0x07ab, 0x655e, 0x1338, -0x004a,
+    0x06e4, 0x64d9, 0x148c, -0x0054, 0x0628, 0x643f, 0x15eb, -0x005f,
+    0x0577, 0x638f, 0x1756, -0x006a, 0x04d1, 0x62cb, 0x18cb, -0x0076,
+    0x0435, 0x61f3, 0x1a4c, -0x0082, 0x03a4, 0x6106, 0x1bd7, -0x008f,
+    0x031c, 0x6007, 0x1d6c, -0x009c, 0x029f, 0x5ef5, 0x1f0b, -0x00aa,
+    0x022a, 0x5dd0, 0x20b3, -0x00b8, 0x01be, 0x5c9a, 0x2264, -0x00c6,
+    0x015b, 0x5b53, 0x241e, -0x00d4, 0x0101, 0x59fc, 0x25e0, -0x00e2,
+    0x00ae, 0x5896, 0x27a9, -0x00f0, 0x0063, 0x5720, 0x297a, -0x00fe,
+    0x001f, 0x559d, 0x2b50, -0x010c, -0x001e, 0x540d, 0x2d2c, -0x0118,
+    -0x0054, 0x5270, 0x2f0d, -0x0125, -0x0084, 0x50c7, 0x30f3, -0x0130,
+    -0x00ad, 0x4f14, 0x32dc, -0x013a, -0x00d2, 0x4d57, 0x34c8, -0x0143,
+    -0x00f1, 0x4b91, 0x36b6, -0x014a, -0x010b, 0x49c2, 0x38a5, -0x0150,
+    -0x0121, 0x47ed, 0x3a95, -0x0154, -0x0132, 0x4611, 0x3c85, -0x0155,
+    -0x0140, 0x4430, 0x3e74, -0x0154, -0x014a, 0x424a, 0x4060, -0x0151,
+    -0x0151, 0x4060, 0x424a, -0x014a, -0x0154, 0x3e74, 0x4430, -0x0140,
+    -0x0155, 0x3c85, 0x4611, -0x0132, -0x0154, 0x3a95, 0x47ed, -0x0121,
+    -0x0150, 0x38a5, 0x49c2, -0x010b, -0x014a, 0x36b6, 0x4b91, -0x00f1,
+    -0x0143, 0x34c8, 0x4d57, -0x00d2, -0x013a, 0x32dc, 0x4f14, -0x00ad,
+    -0x0130, 0x30f3, 0x50c7, -0x0084, -0x0125, 0x2f0d, 0x5270, -0x0054,
+    -0x0118, 0x2d2c, 0x540d, -0x001e, -0x010c, 0x2b50, 0x559d, 0x001f,
+    -0x00fe, 0x297a, 0x5720, 0x0063, -0x00f0, 0x27a9, 0x5896, 0x00ae,
+    -0x00e2, 0x25e0, 0x59fc, 0x0101, -0x00d4, 0x241e, 0x5b53, 0x015b,
+    -0x00c6, 0x2264, 0x5c9a, 0x01be, -0x00b8, 0x20b3, 0x5dd0, 0x022a,
+    -0x00aa, 0x1f0b, 0x5ef5, 0x029f, -0x009c, 0x1d6c, 0x6007, 0x031c,
+    -0x008f, 0x1bd7, 0x6106, 0x03a4, -0x0082, 0x1a4c, 0x61f3, 0x0435,
+    -0x0076, 0x18cb, 0x62cb, 0x04d1, -0x006a, 0x1756, 0x638f, 0x0577,
+    -0x005f, 0x15eb, 0x643f, 0x0628, -0x0054, 0x148c, 0x64d9, 0x06e4,
+    -0x004a, 0x1338, 0x655e, 0x07ab, -0x0041, 0x11f0, 0x65cd, 0x087d,
+    -0x0038, 0x10b4, 0x6626, 0x095a, -0x0030, 0x0f83, 0x6669, 0x0a44,
+    -0x0028, 0x0e5f, 0x6696, 0x0b39, -0x0021, 0x0d46, 0x66ad, 0x0c39,
+};
+
+class CAudioReference
+{
+public:
+    CAudioReference()
+    {
+        memset(this, 0, sizeof(*this));
+    }
+
+    void ProcessTask(const uint8_t * Dmem, uint8_t * Rdram)
+    {
+        m_Rdram = Rdram;
+        memset(m_Segments, 0, sizeof(m_Segments));
+        uint32_t List = *(const uint32_t *)(Dmem + 0xFF0);
+        uint32_t Size = *(const uint32_t *)(Dmem + 0xFF4);
+        for (uint32_t i = 0; i + 8 <= Size; i += 8)
+        {
+            uint32_t w1 = *(const uint32_t *)(Rdram + List + i);
+            uint32_t w2 = *(const uint32_t *)(Rdram + List + i + 4);
+            Command((w1 >> 24) & 0x7F, (uint8_t)(w1 >> 16), w1, w2);
+        }
+    }
+
+private:
+    uint8_t & U8(uint32_t Address) { return m_Dmem[(Address ^ 3) & 0xFFF]; }
+    int16_t & S16(uint32_t Address) { return *(int16_t *)(m_Dmem + ((Address ^ 2) & 0xFFF)); }
+    int16_t & Sample(uint32_t Pos) { return ((int16_t *)m_Dmem)[(Pos ^ 1) & 0x7FF]; }
+    int16_t * Raw(uint32_t Address) { return (int16_t *)(m_Dmem + Address); }
+    uint16_t & Dram16(uint32_t Address) { return *(uint16_t *)(m_Rdram + ((Address ^ 2) & (RdramSize - 1) & ~1)); }
+    uint32_t Segmented(uint32_t w2) { return m_Segments[(w2 >> 24) & 0xF] + (w2 & 0xFFFFFF); }
+
+    void Command(uint32_t Command, uint8_t Flags, uint32_t w1, uint32_t w2)
+    {
+        switch (Command)
+        {
+        case A_ADPCM: Adpcm(Flags, Segmented(w2)); break;
+        case A_CLEARBUFF:
+            for (uint32_t i = 0, Dmem = (uint16_t)(w1 + DmemBase), Count = ((w2 & 0xFFF) + 15) & ~15; i < Count; i++)
+            {
+                U8(Dmem + i) = 0;
+            }
+            break;
+        case A_ENVMIXER: EnvMixer(Flags, Segmented(w2)); break;
+        case A_LOADBUFF:
+            if (m_Count != 0)
+            {
+                memcpy(m_Dmem + (m_In & ~3), m_Rdram + (Segmented(w2) & ~7), (m_Count + 7) & ~7);
+            }
+            break;
+        case A_RESAMPLE: Resample(Flags, (w1 & 0xFFFF) << 1, Segmented(w2)); break;
+        case A_SAVEBUFF:
+            if (m_Count != 0)
+            {
+                memcpy(m_Rdram + (Segmented(w2) & ~7), m_Dmem + (m_Out & ~3), (m_Count + 7) & ~7);
+            }
+            break;
+        case A_SEGMENT: m_Segments[(w2 >> 24) & 0xF] = w2 & 0xFFFFFF; break;
+        case A_SETBUFF:
+            if ((Flags & A_AUX) != 0)
+            {
+                m_DryRight = (uint16_t)(w1 + DmemBase);
+                m_WetLeft = (uint16_t)((w2 >> 16) + DmemBase);
+                m_WetRight = (uint16_t)(w2 + DmemBase);
+            }
+            else
+            {
+                m_In = (uint16_t)(w1 + DmemBase);
+                m_Out = (uint16_t)((w2 >> 16) + DmemBase);
+                m_Count = (uint16_t)w2;
+            }
+            break;
+        case A_SETVOL:
+            if ((Flags & A_AUX) != 0)
+            {
+                m_Dry = (int16_t)w1;
+                m_Wet = (int16_t)w2;
+            }
+            else if ((Flags & A_VOL) != 0)
+            {
+                m_Vol[(Flags & A_LEFT) != 0 ? 0 : 1] = (int16_t)w1;
+            }
+            else
+            {
+                m_Target[(Flags & A_LEFT) != 0 ? 0 : 1] = (int16_t)w1;
+                m_Rate[(Flags & A_LEFT) != 0 ? 0 : 1] = (int32_t)w2;
+            }
+            break;
+        case A_DMEMMOVE:
+            for (uint32_t i = 0, In = (uint16_t)(w1 + DmemBase), Out = (uint16_t)((w2 >> 16) + DmemBase), Count = ((w2 & 0xFFFF) + 15) & ~15; i < Count; i++)
+            {
+                U8(Out + i) = U8(In + i);
+            }
+            break;
+        case A_LOADADPCM:
+            for (uint32_t i = 0, Count = ((w1 & 0xFFFF) + 7) >> 3 << 2; i < Count && i < 0x100; i++)
+            {
+                m_Table[i] = (int16_t)Dram16(Segmented(w2) + i * 2);
+            }
+            break;
+        case A_MIXER:
+            if (m_Count != 0)
+            {
+                int16_t * Dst = Raw((uint16_t)(w2 + DmemBase));
+                const int16_t * Src = Raw((uint16_t)((w2 >> 16) + DmemBase));
+                for (uint32_t i = 0, Count = ((m_Count + 31) & ~31) >> 1; i < Count; i++)
+                {
+                    Dst[i] = Clamp16(Dst[i] + ((Src[i] * (int16_t)w1) >> 15));
+                }
+            }
+            break;
+        case A_INTERLEAVE:
+            if (m_Count != 0)
+            {
+                uint16_t * Dst = (uint16_t *)Raw(m_Out);
+                const uint16_t * Left = (const uint16_t *)Raw((uint16_t)((w2 >> 16) + DmemBase));
+                const uint16_t * Right = (const uint16_t *)Raw((uint16_t)(w2 + DmemBase));
+                for (uint32_t i = 0, Count = ((m_Count + 15) & ~15) >> 2; i < Count; i++)
+                {
+                    uint16_t l1 = *(Left++), l2 = *(Left++);
+                    uint16_t r1 = *(Right++), r2 = *(Right++);
+                    *(Dst++) = r2;
+                    *(Dst++) = l2;
+                    *(Dst++) = r1;
+                    *(Dst++) = l1;
+                }
+            }
+            break;
+        case A_POLEF:
+            if (m_Count != 0)
+            {
+                Polef(Flags, (int16_t)w1, Segmented(w2));
+            }
+            break;
+        case A_SETLOOP: m_Loop = Segmented(w2); break;
+        }
+    }
+
+    void Adpcm(uint8_t Flags, uint32_t Address)
+    {
+        uint32_t In = m_In, Out = m_Out, Count = (uint16_t)((m_Count + 31) & ~31);
+        int16_t Last[16];
+        for (uint32_t i = 0; i < 16; i++)
+        {
+            Last[i] = (Flags & A_INIT) != 0 ? 0 : (int16_t)Dram16(((Flags & A_LOOP) != 0 ? m_Loop : Address) + i * 2);
+        }
+        for (uint32_t i = 0; i < 16; i++, Out += 2)
+        {
+            S16(Out) = Last[i];
+        }
+        for (; Count != 0; Count -= 32)
+        {
+            uint8_t Code = U8(In++);
+            uint32_t Scale = Code >> 4, Shift = Scale < 12 ? 12 - Scale : 0;
+            const int16_t * Book1 = m_Table + (Code & 0xF) * 16;
+            const int16_t * Book2 = Book1 + 8;
+            int16_t Frame[16];
+            for (uint32_t i = 0; i < 8; i++)
+            {
+                uint8_t Byte = U8(In++);
+                Frame[i * 2] = (int16_t)((uint16_t)(Byte & 0xF0) << 8) >> Shift;
+                Frame[i * 2 + 1] = (int16_t)((uint16_t)(Byte & 0x0F) << 12) >> Shift;
+            }
+            for (uint32_t Half = 0; Half < 2; Half++)
+            {
+                const int16_t * Src = Frame + Half * 8;
+                int16_t l1 = Last[Half == 0 ? 14 : 6], l2 = Last[Half == 0 ? 15 : 7];
+                for (uint32_t i = 0; i < 8; i++)
+                {
+                    int32_t Accu = ((int32_t)Src[i] << 11) + Book1[i] * l1 + Book2[i] * l2;
+                    for (uint32_t k = 0; k < i; k++)
+                    {
+                        Accu += Book2[k] * Src[i - 1 - k];
+                    }
+                    Last[Half * 8 + i] = Clamp16(Accu >> 11);
+                }
+            }
+            for (uint32_t i = 0; i < 16; i++, Out += 2)
+            {
+                S16(Out) = Last[i];
+            }
+        }
+        for (uint32_t i = 0; i < 16; i++)
+        {
+            Dram16(Address + i * 2) = (uint16_t)Last[i];
+        }
+    }
+
+    struct RAMP
+    {
+        int64_t Value, Step, Target;
+
+        int16_t Next(void)
+        {
+            Value += Step;
+            if (Step <= 0 ? Value <= Target : Value >= Target)
+            {
+                Value = Target;
+                Step = 0;
+            }
+            return (int16_t)(Value >> 16);
+        }
+    };
+
+    // Each group of eight samples loads the input and all the outputs before storing any of them
+    void EnvMixer(uint8_t Flags, uint32_t Address)
+    {
+        uint8_t * Save = m_Rdram + (Address & (RdramSize - 1));
+        int16_t Dry = m_Dry, Wet = m_Wet;
+        RAMP Ramps[2];
+        int32_t Seq[2], Rates[2];
+        if ((Flags & A_INIT) != 0)
+        {
+            for (int i = 0; i < 2; i++)
+            {
+                Ramps[i].Value = (int32_t)m_Vol[i] << 16;
+                Ramps[i].Target = (int32_t)m_Target[i] << 16;
+                Rates[i] = m_Rate[i];
+                Seq[i] = m_Vol[i] * m_Rate[i];
+            }
+        }
+        else
+        {
+            int32_t Fields[8];
+            memcpy(&Wet, Save, 2);
+            memcpy(&Dry, Save + 4, 2);
+            memcpy(Fields, Save + 8, sizeof(Fields));
+            for (int i = 0; i < 2; i++)
+            {
+                Ramps[i].Target = Fields[i];
+                Rates[i] = Fields[2 + i];
+                Seq[i] = Fields[4 + i];
+                Ramps[i].Value = Fields[6 + i];
+            }
+        }
+        Ramps[0].Step = Ramps[0].Target - Ramps[0].Value;
+        Ramps[1].Step = Ramps[1].Target - Ramps[1].Value;
+
+        uint32_t Outputs = (Flags & A_AUX) != 0 ? 4 : 2;
+        const int16_t * In = Raw(m_In);
+        int16_t * Buffers[4] = { Raw(m_Out), Raw(m_DryRight), Raw(m_WetLeft), Raw(m_WetRight) };
+        for (uint32_t y = 0, Ptr = 0; y < m_Count; y += 16, Ptr += 8)
+        {
+            for (int i = 0; i < 2; i++)
+            {
+                if (Ramps[i].Step != 0)
+                {
+                    Seq[i] = (int32_t)(((int64_t)Seq[i] * (int64_t)Rates[i]) >> 16);
+                    Ramps[i].Step = (Seq[i] - Ramps[i].Value) >> 3;
+                }
+            }
+            int16_t Gains[8][4], Input[8], Mixed[4][8];
+            for (uint32_t x = 0; x < 8; x++)
+            {
+                int16_t Left = Ramps[0].Next(), Right = Ramps[1].Next();
+                Gains[x][0] = Clamp16((Left * Dry + 0x4000) >> 15);
+                Gains[x][1] = Clamp16((Right * Dry + 0x4000) >> 15);
+                Gains[x][2] = Clamp16((Left * Wet + 0x4000) >> 15);
+                Gains[x][3] = Clamp16((Right * Wet + 0x4000) >> 15);
+                Input[x] = In[(Ptr + x) ^ 1];
+                for (uint32_t k = 0; k < Outputs; k++)
+                {
+                    Mixed[k][x] = Buffers[k][(Ptr + x) ^ 1];
+                }
+            }
+            for (uint32_t k = 0; k < Outputs; k++)
+            {
+                for (uint32_t x = 0; x < 8; x++)
+                {
+                    Buffers[k][(Ptr + x) ^ 1] = Clamp16(Mixed[k][x] + ((Input[x] * Gains[x][k]) >> 15));
+                }
+            }
+        }
+
+        int32_t Fields[8] =
+        {
+            (int32_t)Ramps[0].Target, (int32_t)Ramps[1].Target, Rates[0], Rates[1],
+            Seq[0], Seq[1], (int32_t)Ramps[0].Value, (int32_t)Ramps[1].Value,
+        };
+        memcpy(Save, &Wet, 2);
+        memcpy(Save + 4, &Dry, 2);
+        memcpy(Save + 8, Fields, sizeof(Fields));
+    }
+
+    void Resample(uint8_t Flags, uint32_t Pitch, uint32_t Address)
+    {
+        uint16_t InPos = (uint16_t)((m_In >> 1) - 4), OutPos = m_Out >> 1;
+        uint32_t PitchAccu = 0;
+        for (uint32_t k = 0; k < 4; k++)
+        {
+            Sample(InPos + k) = (Flags & A_INIT) != 0 ? 0 : (int16_t)Dram16(Address + k * 2);
+        }
+        if ((Flags & A_INIT) == 0)
+        {
+            PitchAccu = Dram16(Address + 8);
+        }
+        for (uint32_t Count = (uint16_t)((m_Count + 15) & ~15) >> 1; Count != 0; Count--)
+        {
+            const int16_t * Lut = ResampleTable + ((PitchAccu & 0xFC00) >> 8);
+            Sample(OutPos++) = Clamp16((Sample(InPos) * Lut[0] + Sample(InPos + 1) * Lut[1] + Sample(InPos + 2) * Lut[2] + Sample(InPos + 3) * Lut[3]) >> 15);
+            PitchAccu += Pitch;
+            InPos += PitchAccu >> 16;
+            PitchAccu &= 0xFFFF;
+        }
+        for (uint32_t k = 0; k < 4; k++)
+        {
+            Dram16(Address + k * 2) = (uint16_t)Sample(InPos + k);
+        }
+        Dram16(Address + 8) = (uint16_t)PitchAccu;
+    }
+
+    void Polef(uint8_t Flags, int16_t Gain, uint32_t Address)
+    {
+        int16_t * Dst = Raw(m_Out);
+        const int16_t * h1 = m_Table;
+        int16_t * h2 = m_Table + 8;
+        uint32_t In = m_In;
+        int16_t l1 = 0, l2 = 0, h2Before[8];
+        if ((Flags & A_INIT) == 0)
+        {
+            l1 = (int16_t)Dram16(Address + 4);
+            l2 = (int16_t)Dram16(Address + 6);
+        }
+        for (uint32_t i = 0; i < 8; i++)
+        {
+            h2Before[i] = h2[i];
+            h2[i] = (int16_t)(((int32_t)h2[i] * (uint16_t)Gain) >> 14);
+        }
+        for (uint32_t Count = (m_Count + 15) & ~15; Count != 0; Count -= 16, Dst += 8)
+        {
+            int16_t Frame[8];
+            for (uint32_t i = 0; i < 8; i++, In += 2)
+            {
+                Frame[i] = S16(In);
+            }
+            for (uint32_t i = 0; i < 8; i++)
+            {
+                int32_t Accu = Frame[i] * (uint16_t)Gain + h1[i] * l1 + h2Before[i] * l2;
+                for (uint32_t k = 0; k < i; k++)
+                {
+                    Accu += h2[k] * Frame[i - 1 - k];
+                }
+                Dst[i ^ 1] = Clamp16(Accu >> 14);
+            }
+            l1 = Dst[6 ^ 1];
+            l2 = Dst[7 ^ 1];
+        }
+        // the last two words of output go back as they are
+        memcpy(m_Rdram + (Address & (RdramSize - 1)), Dst - 4, 8);
+    }
+
+    uint8_t * m_Rdram;
+    uint32_t m_Segments[16];
+    uint16_t m_In, m_Out, m_Count, m_DryRight, m_WetLeft, m_WetRight;
+    int16_t m_Dry, m_Wet, m_Vol[2], m_Target[2];
+    int32_t m_Rate[2];
+    uint32_t m_Loop;
+    int16_t m_Table[0x100];
+    uint8_t m_Dmem[0x1000];
+};
+
+static uint32_t g_Seed;
+
+static uint32_t Random(uint32_t Range)
+{
+    g_Seed = g_Seed * 1103515245 + 12345;
+    return ((g_Seed >> 8) & 0xFFFFFF) % Range;
+}
+
+static uint32_t Random32(void)
+{
+    return (Random(0x10000) << 16) | Random(0x10000);
+}
+
+class CAudioList
+{
+public:
+    CAudioList(uint8_t * Rdram) : m_Rdram(Rdram), m_Size(0) {}
+
+    void Add(uint32_t Command, uint8_t Flags, uint16_t Low, uint32_t w2)
+    {
+        uint32_t * List = (uint32_t *)(m_Rdram + ListAddr + m_Size);
+        List[0] = (Command << 24) | ((uint32_t)Flags << 16) | Low;
+        List[1] = w2;
+        m_Size += 8;
+    }
+
+    uint32_t Size(void) const { return m_Size; }
+
+private:
+    uint8_t * m_Rdram;
+    uint32_t m_Size;
+};
+
+// An offset into the work area, as the list gives it, for a buffer of Len bytes
+static uint16_t Buffer(uint32_t Len, uint32_t Align)
+{
+    return (uint16_t)(Random((WorkSize - Len) / Align) * Align);
+}
+
+// Somewhere in RDRAM for the state a command reads and writes
+static uint32_t StateAddress(void)
+{
+    return (StateBase + Random(RdramSize / 2)) & ~7;
+}
+
+// The list for one command, with a random work area and random settings around it
+static void BuildList(CAudioList & List, uint32_t Command, bool Aligned)
+{
+    uint32_t Align = Aligned ? 16 : 4;
+    uint32_t Count = (Random(0x20) + 1) * 16 - (Aligned ? 0 : Random(16));
+    uint32_t Len = (Count + 31) & ~31;
+
+    List.Add(A_SEGMENT, 0, 0, (1 << 24) | (Random(0x40) << 12));
+    List.Add(A_SETBUFF, 0, 0, WorkSize);
+    List.Add(A_LOADBUFF, 0, 0, ImageIn);
+    List.Add(A_LOADADPCM, 0, 0x200, StateAddress());
+    List.Add(A_SETVOL, A_VOL | A_LEFT, (uint16_t)Random32(), 0);
+    List.Add(A_SETVOL, A_VOL, (uint16_t)Random32(), 0);
+    List.Add(A_SETVOL, A_LEFT, (uint16_t)Random32(), Random32());
+    List.Add(A_SETVOL, 0, (uint16_t)Random32(), Random32());
+    List.Add(A_SETVOL, A_AUX, (uint16_t)Random32(), Random32());
+    List.Add(A_SETLOOP, 0, 0, StateAddress());
+
+    uint32_t Segment = Random(2) << 24;
+    switch (Command)
+    {
+    case A_ADPCM:
+        List.Add(A_SETBUFF, 0, Buffer(Len / 32 * 9, 1), (Buffer(Len + 32, 2) << 16) | Count);
+        List.Add(A_ADPCM, (uint8_t)Random(4), 0, Segment | StateAddress());
+        break;
+    case A_CLEARBUFF:
+        List.Add(A_CLEARBUFF, 0, Buffer(Len, 1), Count);
+        break;
+    case A_ENVMIXER:
+        List.Add(A_SETBUFF, A_AUX, Buffer(Len, Align), (Buffer(Len, Align) << 16) | Buffer(Len, Align));
+        List.Add(A_SETBUFF, 0, Buffer(Len, Align), (Buffer(Len, Align) << 16) | Count);
+        List.Add(A_ENVMIXER, (uint8_t)(Random(2) * A_INIT | Random(2) * A_AUX), 0, Segment | StateAddress());
+        break;
+    case A_LOADBUFF:
+    case A_SAVEBUFF:
+        List.Add(A_SETBUFF, 0, Buffer(Len, 1), (Buffer(Len, 1) << 16) | Count);
+        List.Add(Command, 0, 0, Segment | StateAddress());
+        break;
+    case A_RESAMPLE:
+        List.Add(A_SETBUFF, 0, Buffer(Len * 2 + 16, 2) + 8, (Buffer(Len, 2) << 16) | Count);
+        List.Add(A_RESAMPLE, (uint8_t)Random(2), (uint16_t)Random(0x8000), Segment | StateAddress());
+        break;
+    case A_DMEMMOVE:
+        List.Add(A_DMEMMOVE, 0, Buffer(Len, 1), (Buffer(Len, 1) << 16) | Count);
+        break;
+    case A_LOADADPCM:
+        List.Add(A_LOADADPCM, 0, (uint16_t)Random(0x200), Segment | StateAddress());
+        List.Add(A_SETBUFF, 0, Buffer(Len / 32 * 9, 1), (Buffer(Len + 32, 2) << 16) | Count);
+        List.Add(A_ADPCM, A_INIT, 0, StateAddress());
+        break;
+    case A_MIXER:
+        List.Add(A_SETBUFF, 0, 0, Count);
+        List.Add(A_MIXER, 0, (uint16_t)Random32(), (Buffer(Len, Align) << 16) | Buffer(Len, Align));
+        break;
+    case A_INTERLEAVE:
+        List.Add(A_SETBUFF, 0, 0, (Buffer(Len * 2, Align) << 16) | Count);
+        List.Add(A_INTERLEAVE, 0, 0, (Buffer(Len, Align) << 16) | Buffer(Len, Align));
+        break;
+    case A_POLEF:
+        List.Add(A_SETBUFF, 0, Buffer(Len, 2), (Buffer(Len, Align) << 16) | Count);
+        List.Add(A_POLEF, (uint8_t)Random(2), (uint16_t)Random32(), Segment | StateAddress());
+        break;
+    }
+
+    List.Add(A_SETBUFF, 0, 0, WorkSize);
+    List.Add(A_SAVEBUFF, 0, 0, ImageOut);
+}
+
+static uint8_t g_Rdram[RdramSize], g_RdramRef[RdramSize], g_Dmem[0x1000];
+
+// Runs Lists random lists for a command through both, the number that did not match
+static uint32_t CheckCommand(CAudioHle & Hle, CAudioReference & Reference, const char * Name, uint32_t Command, bool Aligned, uint32_t Lists)
+{
+    uint32_t Failed = 0;
+    for (uint32_t i = 0; i < Lists; i++)
+    {
+        for (uint32_t x = 0; x < RdramSize; x += 4)
+        {
+            // mostly small samples so mixes do not all clamp
+            uint32_t Value = Random32();
+            *(uint32_t *)(g_Rdram + x) = Random(4) != 0 ? Value & 0x0FFF0FFF : Value;
+        }
+        CAudioList List(g_Rdram);
+        BuildList(List, Command, Aligned);
+        *(uint32_t *)(g_Dmem + 0xFF0) = ListAddr;
+        *(uint32_t *)(g_Dmem + 0xFF4) = List.Size();
+        memcpy(g_RdramRef, g_Rdram, RdramSize);
+
+        Hle.ProcessTask(g_Dmem, g_Rdram, RdramSize);
+        Reference.ProcessTask(g_Dmem, g_RdramRef);
+        if (memcmp(g_Rdram, g_RdramRef, RdramSize) != 0)
+        {
+            if (Failed == 0)
+            {
+                for (uint32_t x = 0; x < RdramSize; x += 2)
+                {
+                    if (*(uint16_t *)(g_Rdram + x) != *(uint16_t *)(g_RdramRef + x))
+                    {
+                        printf("%s%s: list %u: rdram %05X is %04X, expected %04X\n", Name, Aligned ? " (aligned)" : "", i, x,
+                            *(uint16_t *)(g_Rdram + x), *(uint16_t *)(g_RdramRef + x));
+                        break;
+                    }
+                }
+            }
+            Failed += 1;
+        }
+    }
+    return Failed;
+}
+
+int main(int argc, char ** argv)
+{
+    static const struct
+    {
+        const char * Name;
+        uint32_t Command;
+    } Commands[] =
+    {
+        { "ADPCM", A_ADPCM }, { "CLEARBUFF", A_CLEARBUFF }, { "ENVMIXER", A_ENVMIXER },
+        { "LOADBUFF", A_LOADBUFF }, { "RESAMPLE", A_RESAMPLE }, { "SAVEBUFF", A_SAVEBUFF },
+        { "DMEMMOVE", A_DMEMMOVE }, { "LOADADPCM", A_LOADADPCM }, { "MIXER", A_MIXER },
+        { "INTERLEAVE", A_INTERLEAVE }, { "POLEF", A_POLEF },
+    };
+
+    uint32_t Lists = argc > 1 ? atoi(argv[1]) : 200;
+    static CAudioHle Hle;
+    static CAudioReference Reference;
+    uint32_t Failed = 0;
+    g_Seed = 1;
+    for (uint32_t i = 0; i < sizeof(Commands) / sizeof(Commands[0]); i++)
+    {
+        for (int Aligned = 1; Aligned >= 0; Aligned--)
+        {
+            uint32_t Wrong = CheckCommand(Hle, Reference, Commands[i].Name, Commands[i].Command, Aligned != 0, Lists);
+            if (Wrong != 0)
+            {
+                printf("%s%s: %u of %u lists did not match\n", Commands[i].Name, Aligned ? " (aligned)" : "", Wrong, Lists);
+            }
+            Failed += Wrong;
+        }
+    }
+    printf("AudioHleTest %s (%u lists did not match)\n", Failed == 0 ? "passed" : "FAILED", Failed);
+    return Failed == 0 ? 0 : 1;
+}
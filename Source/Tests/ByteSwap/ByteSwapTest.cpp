@@ -0,0 +1,207 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+// Checks the CByteSwap kernels against the loops they replaced: the XOR swap
+// loops from the ROM, disk and ROM browser code, and the byte at a time ^ 3
+// copies and clears from the PI and SI DMA code.
+//
+// Buffers start at random offsets from a 16 byte boundary and have random
+// lengths, so the vector loops, the word loop and the byte tail all get
+// unaligned heads and tails. Each buffer is surrounded by guard bytes that
+// have to come back unchanged.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Project64-core/N64System/ByteSwap.h>
+
+enum
+{
+    BufferSize = 0x10000,
+    Guard = 64,
+};
+
+static uint32_t g_Seed;
+
+static uint32_t Random(uint32_t Range)
+{
+    g_Seed = g_Seed * 1103515245 + 12345;
+    return ((g_Seed >> 8) & 0xFFFFFF) % Range;
+}
+
+static void Fill(uint8_t * Buffer, uint32_t Len)
+{
+    for (uint32_t i = 0; i < Len; i++)
+    {
+        Buffer[i] = (uint8_t)Random(0x100);
+    }
+}
+
+// Mostly short lengths to hit every head and tail, some long enough to run
+// the vector loop many times
+static uint32_t RandomLength(void)
+{
+    return Random(4) == 0 ? Random(BufferSize - 2 * Guard) : Random(200);
+}
+
+// N64RomClass.cpp, N64DiskClass.cpp and RomList.cpp, z64 <- n64. The old
+// loops only ran on whole words, the bytes after the last word are copied
+static void RefSwapWords(uint8_t * Data, const uint8_t * Src, size_t Len)
+{
+    memcpy(Data, Src, Len);
+    for (size_t count = 0; count + 4 <= Len; count += 4)
+    {
+        Data[count] ^= Data[count + 3];
+        Data[count + 3] ^= Data[count];
+        Data[count] ^= Data[count + 3];
+        Data[count + 1] ^= Data[count + 2];
+        Data[count + 2] ^= Data[count + 1];
+        Data[count + 1] ^= Data[count + 2];
+    }
+}
+
+// N64RomClass.cpp and RomList.cpp, z64 <- v64
+static void RefSwapHalfWords(uint8_t * Data, const uint8_t * Src, size_t Len)
+{
+    memcpy(Data, Src, Len);
+    for (size_t count = 0; count + 4 <= Len; count += 4)
+    {
+        Data[count] ^= Data[count + 2];
+        Data[count + 2] ^= Data[count];
+        Data[count] ^= Data[count + 2];
+        Data[count + 1] ^= Data[count + 3];
+        Data[count + 3] ^= Data[count + 1];
+        Data[count + 1] ^= Data[count + 3];
+    }
+}
+
+// Dma.cpp and PifRam.cpp
+static void RefCopySwizzled(uint8_t * Dst, uint32_t DstAddr, const uint8_t * Src, uint32_t SrcAddr, uint32_t Len)
+{
+    for (uint32_t i = 0; i < Len; i++)
+    {
+        *(Dst + ((DstAddr + i) ^ 3)) = *(Src + ((SrcAddr + i) ^ 3));
+    }
+}
+
+static void RefClearSwizzled(uint8_t * Dst, uint32_t DstAddr, uint32_t Len)
+{
+    for (uint32_t i = 0; i < Len; i++)
+    {
+        *(Dst + ((DstAddr + i) ^ 3)) = 0;
+    }
+}
+
+static int Fail(const char * Kernel, uint32_t Step, uint32_t Offset, uint32_t Len, const uint8_t * Expected, const uint8_t * Result)
+{
+    for (uint32_t i = 0; i < BufferSize; i++)
+    {
+        if (Expected[i] != Result[i])
+        {
+            printf("%s: step %u, offset %u, length %u: byte %u is 0x%02X, expected 0x%02X\n", Kernel, Step, Offset, Len, i, Result[i], Expected[i]);
+            break;
+        }
+    }
+    return 1;
+}
+
+typedef void(*SWAP_KERNEL)(uint8_t * Dst, const uint8_t * Src, size_t Len);
+
+static int SwapTest(const char * Kernel, SWAP_KERNEL Swap, SWAP_KERNEL Reference, uint32_t Steps)
+{
+    static uint8_t Src[BufferSize], Expected[BufferSize], Result[BufferSize];
+
+    for (uint32_t Step = 0; Step < Steps; Step++)
+    {
+        uint32_t Len = RandomLength();
+        uint32_t SrcOffset = Guard + Random(16);
+        uint32_t DstOffset = Guard + Random(16);
+        bool InPlace = Random(2) == 0;
+        Fill(Src, BufferSize);
+        Fill(Result, BufferSize);
+        if (InPlace)
+        {
+            memcpy(Result + DstOffset, Src + SrcOffset, Len);
+        }
+        memcpy(Expected, Result, BufferSize);
+
+        Reference(Expected + DstOffset, Src + SrcOffset, Len);
+        Swap(Result + DstOffset, InPlace ? Result + DstOffset : Src + SrcOffset, Len);
+        if (memcmp(Expected, Result, BufferSize) != 0)
+        {
+            return Fail(Kernel, Step, DstOffset, Len, Expected, Result);
+        }
+    }
+    return 0;
+}
+
+static int CopyTest(uint32_t Steps)
+{
+    static uint8_t Src[BufferSize], Expected[BufferSize], Result[BufferSize];
+
+    for (uint32_t Step = 0; Step < Steps; Step++)
+    {
+        uint32_t Len = RandomLength();
+        uint32_t DstAddr = Guard + Random(BufferSize - 2 * Guard - Len + 1);
+        uint32_t SrcAddr = Guard + Random(BufferSize - 2 * Guard - Len + 1);
+        if (Random(2) == 0)
+        {
+            // Same word alignment on both sides, the memcpy path
+            SrcAddr = (SrcAddr & ~3u) | (DstAddr & 3);
+        }
+        Fill(Src, BufferSize);
+        Fill(Result, BufferSize);
+        memcpy(Expected, Result, BufferSize);
+
+        RefCopySwizzled(Expected, DstAddr, Src, SrcAddr, Len);
+        CByteSwap::CopySwizzled(Result, DstAddr, Src, SrcAddr, Len);
+        if (memcmp(Expected, Result, BufferSize) != 0)
+        {
+            return Fail("CopySwizzled", Step, DstAddr, Len, Expected, Result);
+        }
+    }
+    return 0;
+}
+
+static int ClearTest(uint32_t Steps)
+{
+    static uint8_t Expected[BufferSize], Result[BufferSize];
+
+    for (uint32_t Step = 0; Step < Steps; Step++)
+    {
+        uint32_t Len = RandomLength();
+        uint32_t DstAddr = Guard + Random(BufferSize - 2 * Guard - Len + 1);
+        Fill(Result, BufferSize);
+        memcpy(Expected, Result, BufferSize);
+
+        RefClearSwizzled(Expected, DstAddr, Len);
+        CByteSwap::ClearSwizzled(Result, DstAddr, Len);
+        if (memcmp(Expected, Result, BufferSize) != 0)
+        {
+            return Fail("ClearSwizzled", Step, DstAddr, Len, Expected, Result);
+        }
+    }
+    return 0;
+}
+
+int main(void)
+{
+    int Result = 0;
+    for (uint32_t Seed = 1; Seed <= 4 && Result == 0; Seed++)
+    {
+        g_Seed = Seed;
+        Result |= SwapTest("SwapWords", CByteSwap::SwapWords, RefSwapWords, 2000);
+        Result |= SwapTest("SwapHalfWords", CByteSwap::SwapHalfWords, RefSwapHalfWords, 2000);
+        Result |= CopyTest(2000);
+        Result |= ClearTest(2000);
+    }
+    printf("%s\n", Result == 0 ? "ByteSwapTest passed" : "ByteSwapTest FAILED");
+    return Result;
+}
@@ -0,0 +1,563 @@
+/*
+ * RSP Compiler plug in for Project64 (A Nintendo 64 emulator).
+ *
+ * (c) Copyright 2001 jabo (jabo@emulation64.com) and
+ * zilmar (zilmar@emulation64.com)
+ *
+ * pj64 homepage: www.pj64.net
+ *
+ * Permission to use, copy, modify and distribute Project64 in both binary and
+ * source form, for non-commercial purposes, is hereby granted without fee,
+ * providing that this license information and copyright notice appear with
+ * all copies and any derived work.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event shall the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Project64 is freeware for PERSONAL USE only. Commercial users should
+ * seek permission of the copyright holders first. Commercial use includes
+ * charging money for Project64 or software derived from Project64.
+ *
+ * The copyright holders request that bug fixes and improvements to the code
+ * should be forwarded to them so if they want them.
+ *
+ */
+
+/*
+ * Checks the liveness solver in Recompiler Analysis.c against the
+ * interpreter.  IMEM is run from a random state and at points along the
+ * way everything the solver says is dead after the op just run is
+ * overwritten with junk.  The run then carries on next to one that was
+ * left alone, and once both are done every register, accumulator slice,
+ * flag and DMEM byte has to match apart from the ones that were
+ * overwritten.  A value the solver got wrong gets read and shows up
+ * somewhere else.
+ *
+ * Random programs with loops, jumps and jr in to delay slots are always
+ * run.  IMEM captured from a game (the 4k RSP code.bin written by the
+ * debugger's code dump) can be given on the command line as well:
+ *     LivenessTest [iterations] [imem.bin ...]
+ *
+ * Built and run by Script/Unix/tests.sh.
+ */
+
+/* the solver keeps its tables to itself, this brings in the rest of the headers it needs */
+#include "Recompiler Analysis.c"
+#include <stdio.h>
+#include <setjmp.h>
+#include "RSP Registers.h"
+#include "Interpreter Ops.h"
+#include "Interpreter Simd.h"
+
+/* What the rest of the plugin would provide */
+UWORD32 RSP_GPR[32], RSP_Flags[4], Recp, RecpResult, SQroot, SQrootResult;
+UDWORD RSP_ACCUM[8], EleSpec[32], Indx[32];
+VECTOR RSP_Vect[32];
+OPCODE RSPOpC;
+p_func RSP_Opcode[64], RSP_RegImm[32], RSP_Special[64], RSP_Cop0[32], RSP_Cop2[32], RSP_Vector[64], RSP_Lc2[32], RSP_Sc2[32];
+uint32_t * PrgCount, RSP_Running, RSP_MfStatusCount, RSP_Preempted, CPUCore;
+int32_t RSP_Cycles;
+DWORD Mfc0Count, SemaphoreExit, JumpTableSize = 0x800;
+DWORD CompilePC, NextInstruction;
+DWORD Stepping_Commands, WaitingForStep;
+Boolean DebuggingEnabled, Profiling, ProfileOpcodes, IndvidualBlock, ShowErrors, BreakOnStart, LogRDP, LogX86Code;
+Boolean AudioHle, GraphicsHle, SimdVector, InRSPCommandsWindow;
+RSP_COMPILER Compiler;
+RSP_INFO RSPInfo;
+char * GPR_Strings[32];
+
+void DisplayError(char * Message, ...) { }
+void CPU_Message(const char * Message, ...) { }
+void RDP_LogLoc(DWORD PC) { }
+void RDP_LogMF0(DWORD PC, int Reg) { }
+void RDP_LogMT0(DWORD PC, int Reg, DWORD Value) { }
+void RDP_LogDlist(void) { }
+char * RSPOpcodeName(DWORD OpCode, DWORD PC) { return ""; }
+DWORD StartTimer(DWORD Address) { return 0; }
+void StopTimer(void) { }
+void CountJumpTableLookup(int Hit) { }
+void ProfileOpcode(DWORD Hex) { }
+void SP_DMA_READ(void) { }
+void SP_DMA_WRITE(void) { }
+int CheckForRSPBPoint(DWORD Location) { return FALSE; }
+void Enter_RSP_Commands_Window(void) { }
+void Enable_RSP_Commands_Window(void) { }
+void SetRSPCommandViewto(unsigned int NewLocation) { }
+void SetRSPCommandToStepping(void) { }
+void UpdateRSPRegistersScreen(void) { }
+unsigned int _controlfp(unsigned int New, unsigned int Mask) { return 0; }
+void ExitThread(DWORD ExitCode);
+int MessageBox(HWND hWnd, LPCSTR Text, LPCSTR Caption, UINT Type) { return 0; }
+void ClearAllx86Code(void) { }
+
+static void CheckInterrupts(void) { }
+
+enum { ProgramSize = 0x400, MaxSteps = 0x1000, MaxChecks = 64 };
+
+typedef struct {
+	VECTOR Vect[32];
+	UWORD32 GPR[32], Flags[4];
+	UDWORD Accum[8];
+	UWORD32 Recp, RecpResult, SQroot, SQrootResult;
+	BYTE DMEM[0x1000];
+	uint32_t SpRegisters[10], MfStatusCount;
+	uint32_t PC, Running, NextInstruction, JumpTo;
+} RSP_STATE;
+
+/* What was overwritten at a check point, left out when the runs are compared */
+typedef struct {
+	DWORD Vect;
+	BYTE Accum, Flags;
+} RSP_CLOBBERED;
+
+static BYTE IMEM[0x1000], DMEM[0x1000];
+static jmp_buf UnknownOpcode;
+static uint32_t Registers[10];
+static uint32_t Program[ProgramSize];
+static int ProgramLength;
+
+static uint64_t Seed = 88172645463325252ull;
+
+static uint64_t Random (void) {
+	Seed ^= Seed << 13;
+	Seed ^= Seed >> 7;
+	Seed ^= Seed << 17;
+	return Seed;
+}
+
+#define R_TYPE(rs, rt, rd, sa, funct) (((rs) << 21) | ((rt) << 16) | ((rd) << 11) | ((sa) << 6) | (funct))
+#define I_TYPE(op, rs, rt, imm)       (((uint32_t)(op) << 26) | ((rs) << 21) | ((rt) << 16) | ((imm) & 0xFFFF))
+#define VECTOR_OP(e, vt, vs, vd, funct) ((RSP_CP2 << 26) | (1 << 25) | ((e) << 21) | ((vt) << 16) | ((vs) << 11) | ((vd) << 6) | (funct))
+#define BREAK_OP                      R_TYPE(0, 0, 0, 0, RSP_SPECIAL_BREAK)
+
+static void Emit (uint32_t OpCode) {
+	Program[ProgramLength++] = OpCode;
+}
+
+/* r1 is kept for loop counters */
+static int RandomGPR (void) {
+	int Reg;
+
+	do {
+		Reg = (int)(Random() % 32);
+	} while (Reg == 1);
+	return Reg;
+}
+
+/* Vector ops on the first eight registers so values are used again */
+static uint32_t RandomVectorOp (void) {
+	int Funct;
+
+	do {
+		Funct = (int)(Random() % 64);
+	} while (RSP_Vector[Funct] == rsp_UnknownOpcode);
+	return VECTOR_OP((int)(Random() % 16), (int)(Random() % 8), (int)(Random() % 8), (int)(Random() % 8), Funct);
+}
+
+/* Anything that is not a branch */
+static uint32_t RandomOp (void) {
+	static const int Move[] = { RSP_COP2_MF, RSP_COP2_CF, RSP_COP2_MT, RSP_COP2_CT };
+	int Op, rs = (int)(Random() % 32);
+
+	switch (Random() % 8) {
+	case 0:
+		return R_TYPE(rs, (int)(Random() % 32), RandomGPR(), 0, RSP_SPECIAL_ADDU);
+	case 1:
+		Op = Move[Random() % 4];
+		return (RSP_CP2 << 26) | (Op << 21) | ((Op == RSP_COP2_MF || Op == RSP_COP2_CF ? RandomGPR() : rs) << 16) |
+			((int)(Random() % 8) << 11) | ((int)(Random() % 16) << 7);
+	case 2:
+		do {
+			Op = (int)(Random() % 32);
+		} while (RSP_Lc2[Op] == rsp_UnknownOpcode);
+		return (RSP_LC2 << 26) | (rs << 21) | ((int)(Random() % 8) << 16) | (Op << 11) | ((int)(Random() % 16) << 7) | (int)(Random() % 0x80);
+	case 3:
+		do {
+			Op = (int)(Random() % 32);
+		} while (RSP_Sc2[Op] == rsp_UnknownOpcode);
+		return (RSP_SC2 << 26) | (rs << 21) | ((int)(Random() % 8) << 16) | (Op << 11) | ((int)(Random() % 16) << 7) | (int)(Random() % 0x80);
+	}
+	return RandomVectorOp();
+}
+
+/*
+ * Straight code, forward branches and jumps, short counted loops, and jr.
+ * Branches land anywhere ahead, delay slots included, and half the jr go
+ * to the delay slot of a j or jal further on, which then runs on without
+ * the jump.
+ */
+static void RandomProgram (void) {
+	static const int RegImm[] = { RSP_REGIMM_BLTZ, RSP_REGIMM_BGEZ, RSP_REGIMM_BLTZAL, RSP_REGIMM_BGEZAL };
+	int Length = 40 + (int)(Random() % 400), Start, Target, Body, i, Slot;
+	int JrSetup[ProgramSize], JumpSlot[ProgramSize], JrCount = 0, SlotCount = 0;
+
+	ProgramLength = 0;
+	while (ProgramLength < Length) {
+		switch (Random() % 16) {
+		case 0:
+			if (ProgramLength + 20 > Length) {
+				Emit(RandomOp());
+				break;
+			}
+			Body = 1 + (int)(Random() % 12);
+			Emit(I_TYPE(RSP_ORI, 0, 1, 1 + (int)(Random() % 6)));
+			Start = ProgramLength;
+			for (i = 0; i < Body; i ++) {
+				Emit(RandomOp());
+			}
+			Emit(I_TYPE(RSP_ADDIU, 1, 1, -1));
+			Emit(I_TYPE(RSP_BGTZ, 1, 0, Start - (ProgramLength + 1)));
+			Emit(RandomOp());
+			break;
+		case 1:
+		case 2:
+		case 3:
+			Target = ProgramLength + 2 + (int)(Random() % 20);
+			switch (Random() % 4) {
+			case 0: Emit(I_TYPE(RSP_BEQ + (int)(Random() % 4), (int)(Random() % 32), (int)(Random() % 32), Target - (ProgramLength + 1))); break;
+			case 1: Emit(I_TYPE(RSP_REGIMM, (int)(Random() % 32), RegImm[Random() % 4], Target - (ProgramLength + 1))); break;
+			case 2:
+				Emit(((uint32_t)(Random() % 2 == 0 ? RSP_J : RSP_JAL) << 26) | Target);
+				JumpSlot[SlotCount++] = ProgramLength;
+				break;
+			default:
+				JrSetup[JrCount++] = ProgramLength;
+				Emit(I_TYPE(RSP_ORI, 0, 2, (Target + 1) * 4));
+				Emit(R_TYPE(2, 0, 0, 0, RSP_SPECIAL_JR));
+				break;
+			}
+			Emit(RandomOp());
+			break;
+		default:
+			Emit(RandomOp());
+		}
+	}
+	while (ProgramLength < ProgramSize) {
+		Emit(BREAK_OP);
+	}
+
+	for (i = 0; i < JrCount && SlotCount != 0; i ++) {
+		Slot = JumpSlot[Random() % SlotCount];
+		if (Slot > JrSetup[i] && Random() % 2 == 0) {
+			Program[JrSetup[i]] = I_TYPE(RSP_ORI, 0, 2, Slot * 4);
+		}
+	}
+}
+
+static uint16_t RandomElement (void) {
+	uint64_t Value = Random();
+
+	switch (Value % 6) {
+	case 0: return 0x8000;
+	case 1: return 0x7FFF;
+	case 2: return 0;
+	case 3: return 0xFFFF;
+	}
+	return (uint16_t)(Value >> 16);
+}
+
+static void RandomState (RSP_STATE * State, uint32_t PC) {
+	int i, el;
+
+	memset(State, 0, sizeof(RSP_STATE));
+	for (i = 0; i < 32; i ++) {
+		for (el = 0; el < 8; el ++) {
+			State->Vect[i].UHW[el] = RandomElement();
+		}
+		/* small addresses keep the loads and stores in the first few k of dmem */
+		State->GPR[i].UW = i <= 1 ? 0 : (uint32_t)Random() & 0xFF0;
+	}
+	for (i = 0; i < 4; i ++) {
+		State->Flags[i].UW = (uint32_t)Random() & 0xFFFF;
+	}
+	for (el = 0; el < 8; el ++) {
+		State->Accum[el].DW = (int64_t)(Random() << 16) >> 16;
+	}
+	for (i = 0; i < 0x1000; i ++) {
+		State->DMEM[i] = (BYTE)Random();
+	}
+	State->PC = PC;
+	State->Running = TRUE;
+	State->NextInstruction = NORMAL;
+}
+
+static void LoadState (const RSP_STATE * State) {
+	memcpy(RSP_Vect, State->Vect, sizeof(RSP_Vect));
+	memcpy(RSP_GPR, State->GPR, sizeof(RSP_GPR));
+	memcpy(RSP_Flags, State->Flags, sizeof(RSP_Flags));
+	memcpy(RSP_ACCUM, State->Accum, sizeof(RSP_ACCUM));
+	memcpy(DMEM, State->DMEM, sizeof(DMEM));
+	Recp = State->Recp;
+	RecpResult = State->RecpResult;
+	SQroot = State->SQroot;
+	SQrootResult = State->SQrootResult;
+	memcpy(Registers, State->SpRegisters, sizeof(Registers));
+	*PrgCount = State->PC;
+	RSP_MfStatusCount = State->MfStatusCount;
+	RSP_Running = State->Running;
+	RSP_NextInstruction = State->NextInstruction;
+	RSP_JumpTo = State->JumpTo;
+}
+
+static void SaveState (RSP_STATE * State) {
+	memcpy(State->Vect, RSP_Vect, sizeof(RSP_Vect));
+	memcpy(State->GPR, RSP_GPR, sizeof(RSP_GPR));
+	memcpy(State->Flags, RSP_Flags, sizeof(RSP_Flags));
+	memcpy(State->Accum, RSP_ACCUM, sizeof(RSP_ACCUM));
+	memcpy(State->DMEM, DMEM, sizeof(DMEM));
+	State->Recp = Recp;
+	State->RecpResult = RecpResult;
+	State->SQroot = SQroot;
+	State->SQrootResult = SQrootResult;
+	State->PC = *PrgCount;
+	memcpy(State->SpRegisters, Registers, sizeof(Registers));
+	State->MfStatusCount = RSP_MfStatusCount;
+	State->Running = RSP_Running;
+	State->NextInstruction = RSP_NextInstruction;
+	State->JumpTo = RSP_JumpTo;
+}
+
+/* The interpreter gives up on an unknown opcode, captured IMEM has data after the code */
+void ExitThread(DWORD ExitCode) {
+	longjmp(UnknownOpcode, 1);
+}
+
+/* Runs until a break, an unknown opcode or Steps ops, returns how many were run */
+static int Run (int Steps) {
+	volatile int Step = 0;
+
+	if (setjmp(UnknownOpcode) != 0) {
+		RSP_Running = FALSE;
+		return Step + 1;
+	}
+	for (; Step < Steps && RSP_Running; Step ++) {
+		ExecuteInterpreterOpcode();
+	}
+	return Step;
+}
+
+/* Overwrites what is in Dead with junk */
+static void Clobber (RSP_STATE * State, const RSP_CLOBBERED * Dead) {
+	int i, el;
+
+	for (i = 0; i < 32; i ++) {
+		if ((Dead->Vect & (1 << i)) == 0) { continue; }
+		for (el = 0; el < 8; el ++) {
+			State->Vect[i].UHW[el] ^= 0x5A5A + (uint16_t)Random();
+		}
+	}
+	for (el = 0; el < 8; el ++) {
+		if ((Dead->Accum & High16BitAccum) != 0) { State->Accum[el].HW[3] ^= 0x1234 + (uint16_t)Random(); }
+		if ((Dead->Accum & Middle16BitAccum) != 0) { State->Accum[el].HW[2] ^= 0x1234 + (uint16_t)Random(); }
+		if ((Dead->Accum & Low16BitAccum) != 0) { State->Accum[el].HW[1] ^= 0x1234 + (uint16_t)Random(); }
+	}
+	/* VCO, VCC and VCE sit in RSP_Flags 0 to 2, VCE is only 8 bits */
+	for (i = 0; i < 3; i ++) {
+		if ((Dead->Flags & (1 << i)) != 0) { State->Flags[i].UW ^= i < 2 ? 0xFFFF : 0xFF; }
+	}
+}
+
+/* Blanks out what was overwritten so the rest can be compared */
+static void Mask (RSP_STATE * State, const RSP_CLOBBERED * Dead) {
+	int i, el;
+
+	for (i = 0; i < 32; i ++) {
+		if ((Dead->Vect & (1 << i)) != 0) { memset(&State->Vect[i], 0, sizeof(State->Vect[i])); }
+	}
+	for (el = 0; el < 8; el ++) {
+		if ((Dead->Accum & High16BitAccum) != 0) { State->Accum[el].HW[3] = 0; }
+		if ((Dead->Accum & Middle16BitAccum) != 0) { State->Accum[el].HW[2] = 0; }
+		if ((Dead->Accum & Low16BitAccum) != 0) { State->Accum[el].HW[1] = 0; }
+	}
+	for (i = 0; i < 3; i ++) {
+		if ((Dead->Flags & (1 << i)) != 0) { State->Flags[i].UW = 0; }
+	}
+}
+
+/* Runs Steps on from Before with Dead overwritten, true when anything else ends up different to Final */
+static int ClobberShows (const RSP_STATE * Before, int Steps, const RSP_STATE * Final, const RSP_CLOBBERED * Dead) {
+	static RSP_STATE Checked, Expected;
+
+	Checked = *Before;
+	Clobber(&Checked, Dead);
+	LoadState(&Checked);
+	Run(Steps);
+	SaveState(&Checked);
+	Expected = *Final;
+	Mask(&Expected, Dead);
+	Mask(&Checked, Dead);
+	return memcmp(&Expected, &Checked, sizeof(Expected)) != 0;
+}
+
+/* Which of what the solver said was dead is read after all */
+static void ReportWrong (const RSP_STATE * Before, int Steps, const RSP_STATE * Final, const RSP_CLOBBERED * Dead) {
+	static const char * AccumNames[3] = { "high", "middle", "low" };
+	static const char * FlagNames[3] = { "vco", "vcc", "vce" };
+	RSP_CLOBBERED One;
+	int i;
+
+	for (i = 0; i < 32 + 3 + 3; i ++) {
+		memset(&One, 0, sizeof(One));
+		if (i < 32) {
+			One.Vect = Dead->Vect & (1 << i);
+		} else if (i < 35) {
+			One.Accum = Dead->Accum & (1 << (i - 32));
+		} else {
+			One.Flags = Dead->Flags & (1 << (i - 35));
+		}
+		if ((One.Vect | One.Accum | One.Flags) == 0 || !ClobberShows(Before, Steps, Final, &One)) {
+			continue;
+		}
+		if (i < 32) {
+			printf(" v%d", i);
+		} else if (i < 35) {
+			printf(" %s accumulator", AccumNames[i - 32]);
+		} else {
+			printf(" %s", FlagNames[i - 35]);
+		}
+	}
+	printf("\n");
+}
+
+/*
+ * Runs IMEM from Start and checks what the solver says after every op
+ * in a branch delay slot, reached through the branch or not, and after
+ * a few other ops picked at random, up to MaxChecks of them.
+ */
+static int CheckProgram (const RSP_STATE * Start, const char * Name, int * Reported) {
+	static RSP_STATE Before, Final;
+	const RSP_LIVE * Live;
+	RSP_CLOBBERED Dead;
+	int Failed = 0, Total, Ran, Checks = 0, i;
+	DWORD PC;
+
+	InvalidateLiveness();
+	LoadState(Start);
+	Total = Run(MaxSteps);
+	SaveState(&Final);
+
+	LoadState(Start);
+	for (Ran = 0; Ran < Total && Checks < MaxChecks; ) {
+		PC = *PrgCount;
+		Ran += Run(1);
+		if (!RSP_Running) {
+			break;
+		}
+		if (RSP_NextInstruction != NORMAL || IsOpcodeBranch(PC, *(OPCODE *)(IMEM + PC))) {
+			continue;
+		}
+		if ((PC == 0 || !IsOpcodeBranch(PC - 4, *(OPCODE *)(IMEM + PC - 4))) && Random() % 64 != 0) {
+			continue;
+		}
+
+		Checks += 1;
+		Live = LiveAfter(PC);
+		Dead.Vect = ~Live->Vect;
+		Dead.Accum = EntireAccum & ~Live->Accum;
+		Dead.Flags = AllRspFlags & ~Live->Flags;
+		SaveState(&Before);
+		if (ClobberShows(&Before, Total - Ran, &Final, &Dead)) {
+			Failed = 1;
+			if ((*Reported)++ < 10) {
+				printf("%s: after %03X the solver has as dead", Name, PC);
+				ReportWrong(&Before, Total - Ran, &Final, &Dead);
+				for (i = 0; i < ProgramLength && Program[i] != BREAK_OP; i ++) {
+					printf("  %03X: %08X\n", i * 4, Program[i]);
+				}
+			}
+		}
+		LoadState(&Before);
+	}
+	return Failed;
+}
+
+static int LoadImem (const char * FileName) {
+	FILE * File = fopen(FileName, "rb");
+	size_t Read;
+
+	if (File == NULL) {
+		printf("failed to open %s\n", FileName);
+		return FALSE;
+	}
+	Read = fread(IMEM, 1, sizeof(IMEM), File);
+	fclose(File);
+	if (Read != sizeof(IMEM)) {
+		printf("%s is not a 4k IMEM dump\n", FileName);
+		return FALSE;
+	}
+	memcpy(Program, IMEM, sizeof(Program));
+	ProgramLength = 0;
+	return TRUE;
+}
+
+static void SetupElements (void) {
+	static const uint64_t Elements[16] = {
+		0x0001020304050607, 0x0001020304050607, 0x0000020204040606, 0x0101030305050707,
+		0x0000000004040404, 0x0101010105050505, 0x0202020206060606, 0x0303030307070707,
+		0x0000000000000000, 0x0101010101010101, 0x0202020202020202, 0x0303030303030303,
+		0x0404040404040404, 0x0505050505050505, 0x0606060606060606, 0x0707070707070707,
+	};
+	int i, el;
+
+	/* same table as Build_RSP in Cpu.c */
+	for (i = 0; i < 16; i ++) {
+		EleSpec[i].DW = 0;
+		EleSpec[i + 16].DW = Elements[i];
+		for (el = 0; el < 8; el ++) {
+			EleSpec[i + 16].B[el] = 7 - EleSpec[i + 16].B[el];
+		}
+	}
+	InitSimdElements();
+}
+
+static void SetupRSP (void) {
+	RSPInfo.IMEM = IMEM;
+	RSPInfo.DMEM = DMEM;
+	RSPInfo.MI_INTR_REG = &Registers[0];
+	RSPInfo.SP_MEM_ADDR_REG = &Registers[1];
+	RSPInfo.SP_DRAM_ADDR_REG = &Registers[2];
+	RSPInfo.SP_RD_LEN_REG = &Registers[3];
+	RSPInfo.SP_WR_LEN_REG = &Registers[4];
+	RSPInfo.SP_STATUS_REG = &Registers[5];
+	RSPInfo.SP_DMA_FULL_REG = &Registers[6];
+	RSPInfo.SP_DMA_BUSY_REG = &Registers[7];
+	RSPInfo.SP_PC_REG = &Registers[8];
+	RSPInfo.SP_SEMAPHORE_REG = &Registers[9];
+	RSPInfo.CheckInterrupts = CheckInterrupts;
+	PrgCount = RSPInfo.SP_PC_REG;
+	Sse2Supported = TRUE;
+	Ssse3Supported = TRUE;
+	SetupElements();
+	SimdVector = TRUE;
+	BuildInterpreterCPU();
+}
+
+int main (int argc, char ** argv) {
+	static RSP_STATE Start;
+	int Failed = 0, Reported = 0, Iterations, i, Entry;
+
+	Iterations = argc > 1 ? atoi(argv[1]) : 3000;
+	SetupRSP();
+	for (i = 0; i < Iterations; i ++) {
+		RandomProgram();
+		memcpy(IMEM, Program, sizeof(Program));
+		RandomState(&Start, 0);
+		Failed += CheckProgram(&Start, "random program", &Reported);
+	}
+
+	/* captured microcode is started at 0 and at random ops as well, the
+	   ones it jumps to depend on data that is not there */
+	for (i = 2; i < argc; i ++) {
+		if (!LoadImem(argv[i])) {
+			Failed += 1;
+			continue;
+		}
+		for (Entry = 0; Entry < 64; Entry ++) {
+			RandomState(&Start, Entry == 0 ? 0 : (uint32_t)(Random() % 0x400) * 4);
+			Failed += CheckProgram(&Start, argv[i], &Reported);
+		}
+	}
+	printf("LivenessTest %s (%d programs the solver got wrong)\n", Failed == 0 ? "passed" : "FAILED", Failed);
+	return Failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,439 @@
+/*
+ * RSP Compiler plug in for Project64 (A Nintendo 64 emulator).
+ *
+ * (c) Copyright 2001 jabo (jabo@emulation64.com) and
+ * zilmar (zilmar@emulation64.com)
+ *
+ * pj64 homepage: www.pj64.net
+ * 
+ * Permission to use, copy, modify and distribute Project64 in both binary and
+ * source form, for non-commercial purposes, is hereby granted without fee,
+ * providing that this license information and copyright notice appear with
+ * all copies and any derived work.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event shall the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Project64 is freeware for PERSONAL USE only. Commercial users should
+ * seek permission of the copyright holders first. Commercial use includes
+ * charging money for Project64 or software derived from Project64.
+ *
+ * The copyright holders request that bug fixes and improvements to the code
+ * should be forwarded to them so if they want them.
+ *
+ */
+
+/*
+ * Checks the x64 recompiler in Recompiler X64.c against the interpreter.
+ * Random programs, and programs made of the vector ops the recompiler
+ * emits itself, are run from the same state by both, and the registers,
+ * accumulator, flags, DMEM and PC have to match afterwards.  This is done
+ * with and without the SSE2 vector ops, the recompiler only emits vector
+ * code when they are used.
+ *
+ * Built and run by Script/Unix/tests.sh on x86_64.
+ */
+
+#include <windows.h>
+#include "Rsp.h"
+#include "CPU.h"
+#include "RSP Registers.h"
+#include "Interpreter CPU.h"
+#include "Interpreter Ops.h"
+#include "Interpreter Simd.h"
+#include "Recompiler X64.h"
+#include "memory.h"
+#include "OpCode.h"
+#include "Types.h"
+
+/* What the rest of the plugin would provide */
+UWORD32 RSP_GPR[32], RSP_Flags[4], Recp, RecpResult, SQroot, SQrootResult;
+UDWORD RSP_ACCUM[8], EleSpec[32], Indx[32];
+VECTOR RSP_Vect[32];
+OPCODE RSPOpC;
+p_func RSP_Opcode[64], RSP_RegImm[32], RSP_Special[64], RSP_Cop0[32], RSP_Cop2[32], RSP_Vector[64], RSP_Lc2[32], RSP_Sc2[32];
+uint32_t * PrgCount, RSP_Running, RSP_MfStatusCount, RSP_Preempted, CPUCore;
+int32_t RSP_Cycles;
+DWORD Mfc0Count, SemaphoreExit, JumpTableSize = 0x800;
+DWORD Stepping_Commands, WaitingForStep;
+Boolean DebuggingEnabled, Profiling, ProfileOpcodes, IndvidualBlock, ShowErrors, BreakOnStart, LogRDP, LogX86Code;
+Boolean AudioHle, GraphicsHle, SimdVector, InRSPCommandsWindow;
+RSP_INFO RSPInfo;
+char * GPR_Strings[32];
+
+void DisplayError(char * Message, ...) { }
+void CPU_Message(const char * Message, ...) { }
+void RDP_LogLoc(DWORD PC) { }
+void RDP_LogMF0(DWORD PC, DWORD Reg) { }
+void RDP_LogMT0(DWORD PC, int Reg, DWORD Value) { }
+void RDP_LogDlist(void) { }
+char * RSPOpcodeName(DWORD OpCode, DWORD PC) { return ""; }
+DWORD StartTimer(DWORD Address) { return 0; }
+void StopTimer(void) { }
+void CountJumpTableLookup(int Hit) { }
+void ProfileOpcode(DWORD Hex) { }
+void SP_DMA_READ(void) { }
+void SP_DMA_WRITE(void) { }
+int CheckForRSPBPoint(DWORD Location) { return FALSE; }
+void Enter_RSP_Commands_Window(void) { }
+void Enable_RSP_Commands_Window(void) { }
+void SetRSPCommandViewto(unsigned int NewLocation) { }
+void SetRSPCommandToStepping(void) { }
+void UpdateRSPRegistersScreen(void) { }
+unsigned int _controlfp(unsigned int New, unsigned int Mask) { return 0; }
+void ExitThread(DWORD ExitCode) { exit(1); }
+int MessageBox(HWND hWnd, LPCSTR Text, LPCSTR Caption, UINT Type) { return 0; }
+
+/* Same as Recompiler CPU.c, the x86 recompiler is not built here */
+void ClearAllx86Code(void) {
+	ResetJumpTables();
+}
+
+static void CheckInterrupts(void) { }
+
+enum { ProgramSize = 0x400, Cycles = 0x10000 };
+
+typedef struct {
+	VECTOR Vect[32];
+	UWORD32 GPR[32], Flags[4];
+	UDWORD Accum[8];
+	BYTE DMEM[0x1000];
+	uint32_t PC, Status;
+} RSP_STATE;
+
+static BYTE IMEM[0x1000], DMEM[0x1000];
+static uint32_t Registers[10];
+static uint32_t Program[ProgramSize];
+static BYTE Targeted[ProgramSize + 32];
+static int ProgramLength;
+
+static uint64_t Seed = 88172645463325252ull;
+
+static uint64_t Random (void) {
+	Seed ^= Seed << 13;
+	Seed ^= Seed >> 7;
+	Seed ^= Seed << 17;
+	return Seed;
+}
+
+#define R_TYPE(rs, rt, rd, sa, funct) (((rs) << 21) | ((rt) << 16) | ((rd) << 11) | ((sa) << 6) | (funct))
+#define I_TYPE(op, rs, rt, imm)       (((uint32_t)(op) << 26) | ((rs) << 21) | ((rt) << 16) | ((imm) & 0xFFFF))
+#define VECTOR_OP(e, vt, vs, vd, funct) ((RSP_CP2 << 26) | (1 << 25) | ((e) << 21) | ((vt) << 16) | ((vs) << 11) | ((vd) << 6) | (funct))
+#define BREAK_OP                      R_TYPE(0, 0, 0, 0, RSP_SPECIAL_BREAK)
+
+/* the ops the recompiler emits as SSE2 */
+static const int NativeVectorOps[] = {
+	RSP_VECTOR_VMULF, RSP_VECTOR_VMULU, RSP_VECTOR_VMUDL, RSP_VECTOR_VMUDM, RSP_VECTOR_VMUDN,
+	RSP_VECTOR_VMUDH, RSP_VECTOR_VMACF, RSP_VECTOR_VMADL, RSP_VECTOR_VMADM, RSP_VECTOR_VMADN,
+	RSP_VECTOR_VMADH, RSP_VECTOR_VADD, RSP_VECTOR_VSUB,
+};
+#define NativeVectorOpCount (sizeof(NativeVectorOps) / sizeof(NativeVectorOps[0]))
+
+static void Emit (uint32_t OpCode) {
+	Program[ProgramLength++] = OpCode;
+}
+
+/* r1 is kept for loop counters */
+static int RandomGPR (void) {
+	int Reg;
+
+	do {
+		Reg = (int)(Random() % 32);
+	} while (Reg == 1);
+	return Reg;
+}
+
+static uint32_t RandomVectorOp (void) {
+	int Funct;
+
+	if (Random() % 4 != 0) {
+		Funct = NativeVectorOps[Random() % NativeVectorOpCount];
+	} else {
+		do {
+			Funct = (int)(Random() % 64);
+		} while (RSP_Vector[Funct] == rsp_UnknownOpcode);
+	}
+	return VECTOR_OP((int)(Random() % 16), (int)(Random() % 32), (int)(Random() % 32), (int)(Random() % 32), Funct);
+}
+
+/* Anything that is not a branch */
+static uint32_t RandomOp (void) {
+	static const int Special[] = {
+		RSP_SPECIAL_SLL, RSP_SPECIAL_SRL, RSP_SPECIAL_SRA, RSP_SPECIAL_SLLV, RSP_SPECIAL_SRLV,
+		RSP_SPECIAL_SRAV, RSP_SPECIAL_ADD, RSP_SPECIAL_ADDU, RSP_SPECIAL_SUB, RSP_SPECIAL_SUBU,
+		RSP_SPECIAL_AND, RSP_SPECIAL_OR, RSP_SPECIAL_XOR, RSP_SPECIAL_NOR, RSP_SPECIAL_SLT,
+		RSP_SPECIAL_SLTU,
+	};
+	static const int Immediate[] = { RSP_ADDI, RSP_ADDIU, RSP_SLTI, RSP_SLTIU, RSP_ANDI, RSP_ORI, RSP_XORI, RSP_LUI };
+	static const int Load[] = { RSP_LB, RSP_LH, RSP_LW, RSP_LBU, RSP_LHU };
+	static const int Store[] = { RSP_SB, RSP_SH, RSP_SW };
+	static const int Move[] = { RSP_COP2_MF, RSP_COP2_CF, RSP_COP2_MT, RSP_COP2_CT };
+	int Op, rs = (int)(Random() % 32);
+
+	switch (Random() % 10) {
+	case 0:
+	case 1:
+		return R_TYPE(rs, (int)(Random() % 32), RandomGPR(), (int)(Random() % 32), Special[Random() % 16]);
+	case 2:
+		return I_TYPE(Immediate[Random() % 8], rs, RandomGPR(), (int)Random());
+	case 3:
+		return I_TYPE(Load[Random() % 5], rs, RandomGPR(), (int)Random());
+	case 4:
+		return I_TYPE(Store[Random() % 3], rs, (int)(Random() % 32), (int)Random());
+	case 5:
+		Op = Move[Random() % 4];
+		return (RSP_CP2 << 26) | (Op << 21) | ((Op == RSP_COP2_MF || Op == RSP_COP2_CF ? RandomGPR() : rs) << 16) |
+			((int)(Random() % 32) << 11) | ((int)(Random() % 16) << 7);
+	case 6:
+		do {
+			Op = (int)(Random() % 32);
+		} while (RSP_Lc2[Op] == rsp_UnknownOpcode);
+		return (RSP_LC2 << 26) | (rs << 21) | ((int)(Random() % 32) << 16) | (Op << 11) | ((int)(Random() % 16) << 7) | (int)(Random() % 0x80);
+	case 7:
+		do {
+			Op = (int)(Random() % 32);
+		} while (RSP_Sc2[Op] == rsp_UnknownOpcode);
+		return (RSP_SC2 << 26) | (rs << 21) | ((int)(Random() % 32) << 16) | (Op << 11) | ((int)(Random() % 16) << 7) | (int)(Random() % 0x80);
+	}
+	return RandomVectorOp();
+}
+
+/* Straight code, forward branches and jumps, and short counted loops */
+static void RandomProgram (void) {
+	static const int RegImm[] = { RSP_REGIMM_BLTZ, RSP_REGIMM_BGEZ, RSP_REGIMM_BLTZAL, RSP_REGIMM_BGEZAL };
+	int Length = 40 + (int)(Random() % 400), Start, Target, Body, i;
+
+	ProgramLength = 0;
+	memset(Targeted, 0, sizeof(Targeted));
+	while (ProgramLength < Length) {
+		switch (Random() % 20) {
+		case 0:
+			if (ProgramLength + 20 > Length) {
+				Emit(RandomOp());
+				break;
+			}
+			Body = 1 + (int)(Random() % 12);
+			Emit(I_TYPE(RSP_ORI, 0, 1, 1 + (int)(Random() % 6)));
+			Start = ProgramLength;
+			for (i = 0; i < Body; i ++) {
+				Emit(RandomOp());
+			}
+			Emit(I_TYPE(RSP_ADDIU, 1, 1, -1));
+			Emit(I_TYPE(RSP_BGTZ, 1, 0, Start - (ProgramLength + 1)));
+			Emit(RandomOp());
+			break;
+		case 1:
+		case 2:
+		case 3:
+			Target = ProgramLength + 2 + (int)(Random() % 20);
+			Targeted[Target] = TRUE;
+			switch (Random() % 4) {
+			case 0: Emit(I_TYPE(RSP_BEQ + (int)(Random() % 4), (int)(Random() % 32), (int)(Random() % 32), Target - (ProgramLength + 1))); break;
+			case 1: Emit(I_TYPE(RSP_REGIMM, (int)(Random() % 32), RegImm[Random() % 4], Target - (ProgramLength + 1))); break;
+			case 2: Emit(((uint32_t)(Random() % 2 == 0 ? RSP_J : RSP_JAL) << 26) | Target); break;
+			default:
+				/* r2 is only set up if the jr is not a branch target itself */
+				if (Targeted[ProgramLength + 1]) {
+					Emit(((uint32_t)RSP_J << 26) | Target);
+					break;
+				}
+				Emit(I_TYPE(RSP_ORI, 0, 2, Target * 4));
+				Emit(R_TYPE(2, 0, 0, 0, RSP_SPECIAL_JR));
+				break;
+			}
+			Emit(RandomOp());
+			break;
+		default:
+			Emit(RandomOp());
+		}
+	}
+	while (ProgramLength < ProgramSize) {
+		Emit(BREAK_OP);
+	}
+}
+
+/*
+ * Native vector ops with one element, on a few registers so results are
+ * used again.  VADD and VSUB clear VCO, so it is loaded from a GPR now and
+ * then to get the carry in.
+ */
+static void VectorProgram (int Element) {
+	int i;
+
+	ProgramLength = 0;
+	for (i = 0; i < 64; i ++) {
+		if (Random() % 4 == 0) {
+			Emit((RSP_CP2 << 26) | (RSP_COP2_CT << 21) | ((2 + (int)(Random() % 30)) << 16));
+		}
+		Emit(VECTOR_OP(Element, (int)(Random() % 8), (int)(Random() % 8), (int)(Random() % 8), NativeVectorOps[Random() % NativeVectorOpCount]));
+	}
+	while (ProgramLength < ProgramSize) {
+		Emit(BREAK_OP);
+	}
+}
+
+static uint16_t RandomElement (void) {
+	uint64_t Value = Random();
+
+	switch (Value % 6) {
+	case 0: return 0x8000;
+	case 1: return 0x7FFF;
+	case 2: return 0;
+	case 3: return 0xFFFF;
+	}
+	return (uint16_t)(Value >> 16);
+}
+
+static void RandomState (RSP_STATE * State) {
+	int i, el;
+
+	for (i = 0; i < 32; i ++) {
+		for (el = 0; el < 8; el ++) {
+			State->Vect[i].UHW[el] = RandomElement();
+		}
+		State->GPR[i].UW = i <= 1 ? 0 : (uint32_t)Random();
+	}
+	for (i = 0; i < 4; i ++) {
+		State->Flags[i].UW = (uint32_t)Random() & 0xFFFF;
+	}
+	for (el = 0; el < 8; el ++) {
+		State->Accum[el].DW = (int64_t)(Random() << 16) >> 16;
+	}
+	for (i = 0; i < 0x1000; i ++) {
+		State->DMEM[i] = (BYTE)Random();
+	}
+	State->PC = 0;
+	State->Status = 0;
+}
+
+static void LoadState (const RSP_STATE * State) {
+	memcpy(RSP_Vect, State->Vect, sizeof(RSP_Vect));
+	memcpy(RSP_GPR, State->GPR, sizeof(RSP_GPR));
+	memcpy(RSP_Flags, State->Flags, sizeof(RSP_Flags));
+	memcpy(RSP_ACCUM, State->Accum, sizeof(RSP_ACCUM));
+	memcpy(DMEM, State->DMEM, sizeof(DMEM));
+	*PrgCount = State->PC;
+	*RSPInfo.SP_STATUS_REG = State->Status;
+	Recp.UW = RecpResult.UW = SQroot.UW = SQrootResult.UW = 0;
+	RSP_NextInstruction = NORMAL;
+	RSP_Cycles = Cycles;
+}
+
+static void SaveState (RSP_STATE * State) {
+	memcpy(State->Vect, RSP_Vect, sizeof(RSP_Vect));
+	memcpy(State->GPR, RSP_GPR, sizeof(RSP_GPR));
+	memcpy(State->Flags, RSP_Flags, sizeof(RSP_Flags));
+	memcpy(State->Accum, RSP_ACCUM, sizeof(RSP_ACCUM));
+	memcpy(State->DMEM, DMEM, sizeof(DMEM));
+	State->PC = *PrgCount;
+	State->Status = *RSPInfo.SP_STATUS_REG;
+}
+
+/*
+ * Runs IMEM from the state both ways.  A jump through a register that was
+ * not set up can make a program loop for ever, those run out of cycles
+ * and are skipped as the recompiler only stops between blocks.
+ */
+static int CompareProgram (const RSP_STATE * Start, const char * Name, int * Reported, int * Skipped) {
+	RSP_STATE Interpreter, Recompiler;
+
+	memcpy(IMEM, Program, sizeof(Program));
+	LoadState(Start);
+	RunInterpreterCPU(Cycles);
+	SaveState(&Interpreter);
+	if (RSP_Running) {
+		*Skipped += 1;
+		return 0;
+	}
+
+	LoadState(Start);
+	ClearAllx86Code();
+	RunRecompilerX64(Cycles);
+	SaveState(&Recompiler);
+
+	if (memcmp(&Interpreter, &Recompiler, sizeof(Interpreter)) == 0) {
+		return 0;
+	}
+	if ((*Reported)++ < 10) {
+		int i;
+
+		printf("%s (%s): pc %X / %X %s%s%s%s%s differ\n", Name, SimdVector ? "simd" : "scalar", Interpreter.PC, Recompiler.PC,
+			memcmp(Interpreter.GPR, Recompiler.GPR, sizeof(Interpreter.GPR)) != 0 ? "gpr " : "",
+			memcmp(Interpreter.Vect, Recompiler.Vect, sizeof(Interpreter.Vect)) != 0 ? "vector " : "",
+			memcmp(Interpreter.Accum, Recompiler.Accum, sizeof(Interpreter.Accum)) != 0 ? "accumulator " : "",
+			memcmp(Interpreter.Flags, Recompiler.Flags, sizeof(Interpreter.Flags)) != 0 ? "flags " : "",
+			memcmp(Interpreter.DMEM, Recompiler.DMEM, sizeof(Interpreter.DMEM)) != 0 ? "dmem " : "");
+		for (i = 0; i < ProgramLength && Program[i] != BREAK_OP; i ++) {
+			printf("  %03X: %08X\n", i * 4, Program[i]);
+		}
+	}
+	return 1;
+}
+
+static void SetupElements (void) {
+	static const uint64_t Elements[16] = {
+		0x0001020304050607, 0x0001020304050607, 0x0000020204040606, 0x0101030305050707,
+		0x0000000004040404, 0x0101010105050505, 0x0202020206060606, 0x0303030307070707,
+		0x0000000000000000, 0x0101010101010101, 0x0202020202020202, 0x0303030303030303,
+		0x0404040404040404, 0x0505050505050505, 0x0606060606060606, 0x0707070707070707,
+	};
+	int i, el;
+
+	/* same table as Build_RSP in Cpu.c */
+	for (i = 0; i < 16; i ++) {
+		EleSpec[i].DW = 0;
+		EleSpec[i + 16].DW = Elements[i];
+		for (el = 0; el < 8; el ++) {
+			EleSpec[i + 16].B[el] = 7 - EleSpec[i + 16].B[el];
+		}
+	}
+	InitSimdElements();
+}
+
+static void SetupRSP (void) {
+	RSPInfo.IMEM = IMEM;
+	RSPInfo.DMEM = DMEM;
+	RSPInfo.MI_INTR_REG = &Registers[0];
+	RSPInfo.SP_MEM_ADDR_REG = &Registers[1];
+	RSPInfo.SP_DRAM_ADDR_REG = &Registers[2];
+	RSPInfo.SP_RD_LEN_REG = &Registers[3];
+	RSPInfo.SP_WR_LEN_REG = &Registers[4];
+	RSPInfo.SP_STATUS_REG = &Registers[5];
+	RSPInfo.SP_DMA_FULL_REG = &Registers[6];
+	RSPInfo.SP_DMA_BUSY_REG = &Registers[7];
+	RSPInfo.SP_PC_REG = &Registers[8];
+	RSPInfo.SP_SEMAPHORE_REG = &Registers[9];
+	RSPInfo.CheckInterrupts = CheckInterrupts;
+	PrgCount = RSPInfo.SP_PC_REG;
+	Sse2Supported = TRUE;
+	Ssse3Supported = TRUE;
+	SetupElements();
+	AllocateMemory();
+}
+
+int main (int argc, char ** argv) {
+	static RSP_STATE Start;
+	int Failed = 0, Reported = 0, Skipped = 0, Iterations, Simd, i, Element;
+
+	Iterations = argc > 1 ? atoi(argv[1]) : 5000;
+	SetupRSP();
+	for (Simd = 1; Simd >= 0; Simd --) {
+		SimdVector = Simd;
+		BuildInterpreterCPU();
+		for (Element = 0; Element < 16; Element ++) {
+			for (i = 0; i < 64; i ++) {
+				RandomState(&Start);
+				VectorProgram(Element);
+				Failed += CompareProgram(&Start, "vector ops", &Reported, &Skipped);
+			}
+		}
+		for (i = 0; i < Iterations; i ++) {
+			RandomState(&Start);
+			RandomProgram();
+			Failed += CompareProgram(&Start, "random program", &Reported, &Skipped);
+		}
+	}
+	printf("RecompilerX64Test %s (%d mismatches, %d programs did not finish)\n", Failed == 0 ? "passed" : "FAILED", Failed, Skipped);
+	return Failed == 0 ? 0 : 1;
+}
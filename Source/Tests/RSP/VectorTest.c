@@ -0,0 +1,312 @@
+/*
+ * RSP Compiler plug in for Project64 (A Nintendo 64 emulator).
+ *
+ * (c) Copyright 2001 jabo (jabo@emulation64.com) and
+ * zilmar (zilmar@emulation64.com)
+ *
+ * pj64 homepage: www.pj64.net
+ * 
+ * Permission to use, copy, modify and distribute Project64 in both binary and
+ * source form, for non-commercial purposes, is hereby granted without fee,
+ * providing that this license information and copyright notice appear with
+ * all copies and any derived work.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event shall the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Project64 is freeware for PERSONAL USE only. Commercial users should
+ * seek permission of the copyright holders first. Commercial use includes
+ * charging money for Project64 or software derived from Project64.
+ *
+ * The copyright holders request that bug fixes and improvements to the code
+ * should be forwarded to them so if they want them.
+ *
+ */
+
+/*
+ * Checks the SSE2 vector ops in Interpreter Simd.c against the scalar ones
+ * in Interpreter Ops.c.  Every op is run on the same registers, accumulator
+ * and flags by both and the results have to match bit for bit, with and
+ * without the SSSE3 element shuffle.  Then times both versions of each op.
+ *
+ * Built and run by Script/Unix/tests.sh.
+ */
+
+#include <windows.h>
+#include <time.h>
+#include "Rsp.h"
+#include "CPU.h"
+#include "RSP Registers.h"
+#include "Interpreter Ops.h"
+#include "Interpreter Simd.h"
+#include "Types.h"
+
+UWORD32 RSP_GPR[32], RSP_Flags[4];
+UDWORD RSP_ACCUM[8], EleSpec[32];
+VECTOR RSP_Vect[32];
+OPCODE RSPOpC;
+p_func RSP_Vector[64];
+Boolean SimdVector;
+
+typedef struct {
+	int Op;
+	const char * Name;
+	p_func Scalar;
+	p_func Simd;
+} VECTOR_OP;
+
+static VECTOR_OP VectorOps[] = {
+	{  0, "VMULF", RSP_Vector_VMULF },
+	{  1, "VMULU", RSP_Vector_VMULU },
+	{  4, "VMUDL", RSP_Vector_VMUDL },
+	{  5, "VMUDM", RSP_Vector_VMUDM },
+	{  6, "VMUDN", RSP_Vector_VMUDN },
+	{  7, "VMUDH", RSP_Vector_VMUDH },
+	{  8, "VMACF", RSP_Vector_VMACF },
+	{ 12, "VMADL", RSP_Vector_VMADL },
+	{ 13, "VMADM", RSP_Vector_VMADM },
+	{ 14, "VMADN", RSP_Vector_VMADN },
+	{ 15, "VMADH", RSP_Vector_VMADH },
+	{ 16, "VADD",  RSP_Vector_VADD },
+	{ 17, "VSUB",  RSP_Vector_VSUB },
+	{ 20, "VADDC", RSP_Vector_VADDC },
+	{ 21, "VSUBC", RSP_Vector_VSUBC },
+	{ 40, "VAND",  RSP_Vector_VAND },
+	{ 41, "VNAND", RSP_Vector_VNAND },
+	{ 42, "VOR",   RSP_Vector_VOR },
+	{ 43, "VNOR",  RSP_Vector_VNOR },
+	{ 44, "VXOR",  RSP_Vector_VXOR },
+	{ 45, "VNXOR", RSP_Vector_VNXOR },
+};
+#define VectorOpCount (sizeof(VectorOps) / sizeof(VectorOps[0]))
+
+typedef struct {
+	UWORD32 Flags[4];
+	UDWORD Accum[8];
+	VECTOR Vect[32];
+} VECTOR_STATE;
+
+static uint64_t Seed = 88172645463325252ull;
+
+static uint64_t Random (void) {
+	Seed ^= Seed << 13;
+	Seed ^= Seed >> 7;
+	Seed ^= Seed << 17;
+	return Seed;
+}
+
+/* Mostly the values where the clamps and rounding change behaviour */
+static uint16_t RandomElement (void) {
+	uint64_t Value = Random();
+
+	switch (Value % 8) {
+	case 0: return 0x8000;
+	case 1: return 0x7FFF;
+	case 2: return 0;
+	case 3: return 0xFFFF;
+	case 4: return 1;
+	}
+	return (uint16_t)(Value >> 16);
+}
+
+static void SaveState (VECTOR_STATE * State) {
+	memcpy(State->Flags, RSP_Flags, sizeof(State->Flags));
+	memcpy(State->Accum, RSP_ACCUM, sizeof(State->Accum));
+	memcpy(State->Vect, RSP_Vect, sizeof(State->Vect));
+}
+
+static void LoadState (const VECTOR_STATE * State) {
+	memcpy(RSP_Flags, State->Flags, sizeof(State->Flags));
+	memcpy(RSP_ACCUM, State->Accum, sizeof(State->Accum));
+	memcpy(RSP_Vect, State->Vect, sizeof(State->Vect));
+}
+
+static void RandomState (void) {
+	int i, el;
+
+	for (i = 0; i < 32; i ++) {
+		for (el = 0; el < 8; el ++) {
+			RSP_Vect[i].UHW[el] = RandomElement();
+		}
+	}
+	for (el = 0; el < 8; el ++) {
+		uint64_t Value = Random();
+
+		/* accumulators that are just in or out of the clamp range */
+		switch (Value % 5) {
+		case 0: Value = (uint64_t)(int64_t)(int32_t)Random() << 16; break;
+		case 1: Value = (uint64_t)(int64_t)(int16_t)Random() << 32; break;
+		}
+		RSP_ACCUM[el].UDW = Value & 0xFFFFFFFFFFFFull;
+		RSP_ACCUM[el].HW[3] = (RSP_ACCUM[el].HW[2] < 0) ? -1 : 0;
+		if (Random() % 4 == 0) {
+			RSP_ACCUM[el].UDW = Value;
+		}
+	}
+	RSP_Flags[0].UW = (uint32_t)Random() & 0xFFFF;
+	RSP_Flags[1].UW = (uint32_t)Random() & 0xFFFF;
+}
+
+/* Runs the op both ways from the current state, leaves the scalar result */
+static int CompareOp (const VECTOR_OP * Op, const char * Mode, int * Reported) {
+	VECTOR_STATE Start, Scalar;
+
+	SaveState(&Start);
+	Op->Scalar();
+	SaveState(&Scalar);
+	LoadState(&Start);
+	Op->Simd();
+
+	if (memcmp(Scalar.Flags, RSP_Flags, sizeof(Scalar.Flags)) == 0 &&
+		memcmp(Scalar.Accum, RSP_ACCUM, sizeof(Scalar.Accum)) == 0 &&
+		memcmp(Scalar.Vect, RSP_Vect, sizeof(Scalar.Vect)) == 0)
+	{
+		return 0;
+	}
+	if ((*Reported)++ < 10) {
+		printf("%s (%s) rd %d rt %d e %d sa %d: %s%s%s differ\n", Op->Name, Mode,
+			RSPOpC.rd, RSPOpC.rt, RSPOpC.rs & 0xF, RSPOpC.sa,
+			memcmp(Scalar.Flags, RSP_Flags, sizeof(Scalar.Flags)) != 0 ? "flags " : "",
+			memcmp(Scalar.Accum, RSP_ACCUM, sizeof(Scalar.Accum)) != 0 ? "accumulator " : "",
+			memcmp(Scalar.Vect, RSP_Vect, sizeof(Scalar.Vect)) != 0 ? "vector " : "");
+	}
+	return 1;
+}
+
+static void SetOperands (int rd, int rt, int Element, int sa) {
+	RSPOpC.Hex = 0;
+	RSPOpC.rd = rd;
+	RSPOpC.rt = rt;
+	RSPOpC.rs = 16 + Element;
+	RSPOpC.sa = sa;
+}
+
+/* 0x8000 * 0x8000 is the one case VMULF and VMULU special case */
+static int DirectedTest (const char * Mode, int * Reported) {
+	int Failed = 0, op, Element, el, Lanes;
+
+	for (op = 0; op < VectorOpCount; op ++) {
+		for (Element = 0; Element < 16; Element ++) {
+			for (Lanes = 0; Lanes < 256; Lanes ++) {
+				RandomState();
+				for (el = 0; el < 8; el ++) {
+					RSP_Vect[1].UHW[el] = (Lanes & (1 << el)) != 0 ? 0x8000 : RandomElement();
+					RSP_Vect[2].UHW[el] = (Lanes & (1 << el)) != 0 ? 0x8000 : RandomElement();
+				}
+				SetOperands(1, 2, Element, 3);
+				Failed += CompareOp(&VectorOps[op], Mode, Reported);
+
+				/* destination is also a source */
+				SetOperands(1, 2, Element, (Lanes & 1) != 0 ? 1 : 2);
+				Failed += CompareOp(&VectorOps[op], Mode, Reported);
+
+				/* same register for both sources */
+				SetOperands(2, 2, Element, 4);
+				Failed += CompareOp(&VectorOps[op], Mode, Reported);
+			}
+		}
+	}
+	return Failed;
+}
+
+static int RandomTest (const char * Mode, int Iterations, int * Reported) {
+	int Failed = 0, i;
+
+	for (i = 0; i < Iterations; i ++) {
+		const VECTOR_OP * Op = &VectorOps[Random() % VectorOpCount];
+
+		RandomState();
+		SetOperands((int)(Random() % 32), (int)(Random() % 32), (int)(Random() % 16), (int)(Random() % 32));
+		if (Random() % 3 == 0) {
+			RSPOpC.sa = RSPOpC.rt;
+		}
+		Failed += CompareOp(Op, Mode, Reported);
+	}
+	return Failed;
+}
+
+static double TimeOp (p_func Func, int Iterations) {
+	clock_t Start;
+	int i;
+
+	Start = clock();
+	for (i = 0; i < Iterations; i ++) {
+		RSPOpC.sa = (i & 7) + 8;
+		Func();
+	}
+	return (double)(clock() - Start) * 1000000000.0 / CLOCKS_PER_SEC / Iterations;
+}
+
+static void Benchmark (void) {
+	const int Iterations = 2000000;
+	int op;
+
+	printf("Op      scalar ns  simd ns  speedup\n");
+	for (op = 0; op < VectorOpCount; op ++) {
+		double Scalar, Simd;
+
+		RandomState();
+		SetOperands(1, 2, 8, 8);
+		Scalar = TimeOp(VectorOps[op].Scalar, Iterations);
+		Simd = TimeOp(VectorOps[op].Simd, Iterations);
+		printf("%-6s %10.2f %8.2f %7.2fx\n", VectorOps[op].Name, Scalar, Simd, Simd > 0 ? Scalar / Simd : 0.0);
+	}
+}
+
+static void SetupElements (void) {
+	static const uint64_t Elements[16] = {
+		0x0001020304050607, 0x0001020304050607, 0x0000020204040606, 0x0101030305050707,
+		0x0000000004040404, 0x0101010105050505, 0x0202020206060606, 0x0303030307070707,
+		0x0000000000000000, 0x0101010101010101, 0x0202020202020202, 0x0303030303030303,
+		0x0404040404040404, 0x0505050505050505, 0x0606060606060606, 0x0707070707070707,
+	};
+	int i, el;
+
+	/* same table as Build_RSP in Cpu.c */
+	for (i = 0; i < 16; i ++) {
+		EleSpec[i].DW = 0;
+		EleSpec[i + 16].DW = Elements[i];
+		for (el = 0; el < 8; el ++) {
+			EleSpec[i + 16].B[el] = 7 - EleSpec[i + 16].B[el];
+		}
+	}
+	InitSimdElements();
+}
+
+static int BuildSimd (Boolean Ssse3) {
+	int op;
+
+	Sse2Supported = TRUE;
+	Ssse3Supported = Ssse3;
+	memset(RSP_Vector, 0, sizeof(RSP_Vector));
+	BuildInterpreterSimd();
+	for (op = 0; op < VectorOpCount; op ++) {
+		VectorOps[op].Simd = RSP_Vector[VectorOps[op].Op];
+		if (VectorOps[op].Simd == NULL) {
+			printf("%s has no simd version\n", VectorOps[op].Name);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int main (int argc, char ** argv) {
+	static const char * Modes[2] = { "sse2", "ssse3" };
+	int Failed = 0, Reported = 0, Mode, Iterations;
+
+	Iterations = argc > 1 ? atoi(argv[1]) : 2000000;
+	SetupElements();
+	for (Mode = 0; Mode < 2; Mode ++) {
+		if (!BuildSimd(Mode == 1)) {
+			return 1;
+		}
+		Failed += DirectedTest(Modes[Mode], &Reported);
+		Failed += RandomTest(Modes[Mode], Iterations, &Reported);
+	}
+	if (Failed == 0) {
+		Benchmark();
+	}
+	printf("VectorTest %s (%d mismatches)\n", Failed == 0 ? "passed" : "FAILED", Failed);
+	return Failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,62 @@
+/*
+ * Just enough of <windows.h> for the RSP sources used by the tests to
+ * compile on other systems.  VirtualAlloc is backed by mmap so the x64
+ * recompiler can run its code, nothing else declared here is called by
+ * a test.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+typedef uint32_t DWORD;
+typedef int BOOL;
+typedef void * HANDLE;
+typedef void * HWND;
+typedef unsigned char BYTE;
+typedef unsigned short WORD;
+typedef unsigned int UINT;
+typedef long LONG;
+typedef const char * LPCSTR;
+
+#define TRUE  1
+#define FALSE 0
+
+#define MB_OK        0x00
+#define MB_YESNO     0x04
+#define MB_ICONERROR 0x10
+#define IDYES        6
+
+#define MEM_COMMIT             0x1000
+#define MEM_RESERVE            0x2000
+#define MEM_RELEASE            0x8000
+#define PAGE_READWRITE         0x04
+#define PAGE_EXECUTE_READWRITE 0x40
+
+#define __try       if (1)
+#define __except(x) else
+#define __declspec(x)
+#define _cdecl
+
+/* Reserving and committing are the same thing here */
+static void * VirtualAlloc(void * Address, size_t Size, DWORD Type, DWORD Protect) {
+	void * Memory;
+
+	if (Address != NULL) {
+		return Address;
+	}
+	Memory = mmap(NULL, Size, PROT_READ | PROT_WRITE | (Protect == PAGE_EXECUTE_READWRITE ? PROT_EXEC : 0), MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	return Memory == MAP_FAILED ? NULL : Memory;
+}
+
+static BOOL VirtualFree(void * Address, size_t Size, DWORD Type) {
+	return TRUE;
+}
+
+static void Sleep(DWORD Milliseconds) {
+}
+
+int MessageBox(HWND hWnd, LPCSTR Text, LPCSTR Caption, UINT Type);
@@ -0,0 +1,457 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+// Checks that skipping FixTimers in CTimerSchedule (CanDeferFix) fires the same
+// events in the same order, on the same cycle, as always running it does.
+//
+// CTestTimer runs on CTimerSchedule, the scheduling code CSystemTimer uses.
+// CRebaseTimer is the reference, SetTimer/StopTimer/FixTimers as they were
+// before the deferral was added, rebasing every timer on each change.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <Project64-core/N64System/Mips/TimerSchedule.h>
+
+typedef CTimerSchedule::TimerType TimerType;
+
+struct FIRED_EVENT
+{
+    TimerType Type;
+    uint32_t Count;
+
+    bool operator != (const FIRED_EVENT & rhs) const { return Type != rhs.Type || Count != rhs.Count; }
+};
+
+// The event handlers of CSystemTimer::TimerDone that change the timers, with
+// its own count and compare registers
+class CTestTimer :
+    public CTimerSchedule
+{
+public:
+    CTestTimer() :
+        CTimerSchedule(m_Next),
+        m_Next(0),
+        m_Count(0),
+        m_Compare(0)
+    {
+    }
+
+    void Reset(uint32_t Compare)
+    {
+        ResetTimers();
+        m_Compare = Compare;
+        SetTimer(ViTimer, 50000, false);
+        SetCompareTimer();
+    }
+
+    void SetCompare(uint32_t Compare)
+    {
+        UpdateTimers();
+        m_Compare = Compare;
+        SetCompareTimer();
+    }
+
+    // The cpu running some ops
+    void Advance(int32_t Cycles) { m_Next -= Cycles; }
+    bool TimerDue(void) const { return m_Next <= 0; }
+
+    FIRED_EVENT TimerDone(void)
+    {
+        UpdateTimers();
+        FIRED_EVENT Event = { m_Current, m_Count };
+        switch (m_Current)
+        {
+        case CompareTimer:
+            SetCompareTimer();
+            break;
+        case ViTimer:
+            SetTimer(ViTimer, 50000, true);
+            break;
+        default:
+            StopTimer(m_Current);
+            break;
+        }
+        return Event;
+    }
+
+    int32_t NextTimer(void) const { return m_Next; }
+    uint32_t Count(void) const { return m_Count; }
+
+private:
+    void CyclesTaken(int32_t Cycles) { m_Count += Cycles; }
+    uint32_t CyclesToCompare() { return m_Compare - m_Count; }
+
+    int32_t  m_Next;
+    uint32_t m_Count;
+    uint32_t m_Compare;
+};
+
+class CRebaseTimer
+{
+public:
+    enum { MaxTimer = CTimerSchedule::MaxTimer };
+
+    CRebaseTimer() :
+        m_NextTimer(0),
+        m_LastUpdate(0),
+        m_Current(CTimerSchedule::UnknownTimer),
+        m_inFixTimer(false),
+        m_Count(0),
+        m_Compare(0)
+    {
+        memset(m_Active, 0, sizeof(m_Active));
+        memset(m_CyclesToTimer, 0, sizeof(m_CyclesToTimer));
+    }
+
+    void Reset(uint32_t Compare)
+    {
+        m_Compare = Compare;
+        SetTimer(CTimerSchedule::ViTimer, 50000, false);
+        SetCompareTimer();
+    }
+
+    void SetTimer(TimerType Type, uint32_t Cycles, bool bRelative)
+    {
+        UpdateTimers();
+
+        m_Active[Type] = true;
+        if (bRelative)
+        {
+            m_CyclesToTimer[Type] += Cycles;
+        }
+        else
+        {
+            m_CyclesToTimer[Type] = (int64_t)Cycles - (int64_t)m_NextTimer;
+        }
+        FixTimers();
+    }
+
+    void StopTimer(TimerType Type)
+    {
+        m_Active[Type] = false;
+        FixTimers();
+    }
+
+    void SetCompare(uint32_t Compare)
+    {
+        UpdateTimers();
+        m_Compare = Compare;
+        SetCompareTimer();
+    }
+
+    void Advance(int32_t Cycles) { m_NextTimer -= Cycles; }
+    bool TimerDue(void) const { return m_NextTimer <= 0; }
+
+    FIRED_EVENT TimerDone(void)
+    {
+        UpdateTimers();
+        FIRED_EVENT Event = { m_Current, m_Count };
+        switch (m_Current)
+        {
+        case CTimerSchedule::CompareTimer:
+            SetCompareTimer();
+            break;
+        case CTimerSchedule::ViTimer:
+            SetTimer(CTimerSchedule::ViTimer, 50000, true);
+            break;
+        default:
+            StopTimer(m_Current);
+            break;
+        }
+        return Event;
+    }
+
+    bool SameState(const CTestTimer & rhs) const
+    {
+        if (m_NextTimer != rhs.NextTimer() || m_LastUpdate != rhs.LastUpdate() || m_Current != rhs.CurrentType() || m_Count != rhs.Count())
+        {
+            return false;
+        }
+        for (int i = 0; i < MaxTimer; i++)
+        {
+            const CTimerSchedule::TIMER_DETAILS & Details = rhs.Details((TimerType)i);
+            if (m_Active[i] != Details.Active)
+            {
+                return false;
+            }
+            if (m_Active[i] && m_CyclesToTimer[i] != Details.CyclesToTimer)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    uint32_t GetTimer(TimerType Type) const
+    {
+        if (!m_Active[Type])
+        {
+            return 0;
+        }
+        int64_t CyclesToTimer = m_CyclesToTimer[Type] + m_NextTimer;
+        if (CyclesToTimer < 0)
+        {
+            return 0;
+        }
+        if (CyclesToTimer > 0x7FFFFFFF)
+        {
+            return 0x7FFFFFFF;
+        }
+        return (uint32_t)CyclesToTimer;
+    }
+
+    void SetCompareTimer(void)
+    {
+        uint32_t NextCompare = m_Compare - m_Count;
+        if ((NextCompare & 0x80000000) != 0)
+        {
+            NextCompare = 0x7FFFFFFF;
+        }
+        SetTimer(CTimerSchedule::CompareTimer, NextCompare, false);
+    }
+
+    void FixTimers(void)
+    {
+        if (m_inFixTimer)
+        {
+            return;
+        }
+        m_inFixTimer = true;
+
+        UpdateTimers();
+        if (GetTimer(CTimerSchedule::CompareTimer) > 0x60000000)
+        {
+            SetCompareTimer();
+        }
+        for (int i = 0; i < MaxTimer; i++)
+        {
+            if (m_Active[i])
+            {
+                m_CyclesToTimer[i] += m_NextTimer;
+            }
+        }
+        m_NextTimer = 0x7FFFFFFF;
+        for (int i = 0; i < MaxTimer; i++)
+        {
+            if (!m_Active[i] || m_CyclesToTimer[i] >= m_NextTimer)
+            {
+                continue;
+            }
+            m_NextTimer = (int)m_CyclesToTimer[i];
+            m_Current = (TimerType)i;
+        }
+        for (int i = 0; i < MaxTimer; i++)
+        {
+            if (m_Active[i])
+            {
+                m_CyclesToTimer[i] -= m_NextTimer;
+            }
+        }
+        m_LastUpdate = m_NextTimer;
+        m_inFixTimer = false;
+    }
+
+    void UpdateTimers(void)
+    {
+        int TimeTaken = m_LastUpdate - m_NextTimer;
+        if (TimeTaken != 0)
+        {
+            m_LastUpdate = m_NextTimer;
+            m_Count += TimeTaken;
+        }
+    }
+
+    bool      m_Active[MaxTimer];
+    int64_t   m_CyclesToTimer[MaxTimer];
+    int32_t   m_NextTimer;
+    int32_t   m_LastUpdate;
+    TimerType m_Current;
+    bool      m_inFixTimer;
+    uint32_t  m_Count;
+    uint32_t  m_Compare;
+};
+
+static uint32_t g_Seed;
+
+static uint32_t Random(uint32_t Range)
+{
+    g_Seed = g_Seed * 1103515245 + 12345;
+    return ((g_Seed >> 8) & 0xFFFFFF) % Range;
+}
+
+static int Fail(const char * Test, uint32_t Step, const char * Reason)
+{
+    printf("%s: step %u: %s\n", Test, Step, Reason);
+    return 1;
+}
+
+// Runs the cpu until either timer is due and fires it on both, the events
+// have to match and the timer state has to be identical afterwards
+static int FireDue(CRebaseTimer & Old, CTestTimer & New, std::vector<FIRED_EVENT> & Order, const char * Test, uint32_t Step)
+{
+    while (Old.TimerDue() || New.TimerDue())
+    {
+        if (Old.TimerDue() != New.TimerDue())
+        {
+            return Fail(Test, Step, "timer due on one side only");
+        }
+        FIRED_EVENT OldEvent = Old.TimerDone(), NewEvent = New.TimerDone();
+        if (OldEvent != NewEvent)
+        {
+            return Fail(Test, Step, "events fired in a different order");
+        }
+        Order.push_back(OldEvent);
+    }
+    return Old.SameState(New) ? 0 : Fail(Test, Step, "timer state differs");
+}
+
+static int DirectedTest(void)
+{
+    const char * Test = "directed";
+    CRebaseTimer Old;
+    CTestTimer New;
+    std::vector<FIRED_EVENT> Order;
+    Old.Reset(100000);
+    New.Reset(100000);
+
+    struct
+    {
+        TimerType Type;
+        uint32_t Cycles;
+        bool Stop;
+        int32_t Advance;
+    } Steps[] =
+    {
+        { CTimerSchedule::SiTimer, 60000, false, 0 },        // after vi, deferred
+        { CTimerSchedule::SoftResetTimer, 50000, false, 0 }, // same cycle as vi but a lower type, has to fire first
+        { CTimerSchedule::AiTimerBusy, 49999, false, 0 },    // before vi, becomes the next event
+        { CTimerSchedule::SiTimer, 0, true, 10000 },         // stop a later event
+        { CTimerSchedule::RspTimer, 1, false, 39999 },       // next event is overdue when another is set
+        { CTimerSchedule::DDPiTimer, 200000, false, 0 },
+        { CTimerSchedule::AiTimerInterrupt, 20000, false, 30000 },
+        { CTimerSchedule::DDPiTimer, 0, true, 0 },
+        { CTimerSchedule::RSPTimerDlist, 5, false, 60000 },
+    };
+    uint32_t Step = 0;
+    for (; Step < sizeof(Steps) / sizeof(Steps[0]); Step++)
+    {
+        if (Steps[Step].Stop)
+        {
+            Old.StopTimer(Steps[Step].Type);
+            New.StopTimer(Steps[Step].Type);
+        }
+        else
+        {
+            Old.SetTimer(Steps[Step].Type, Steps[Step].Cycles, false);
+            New.SetTimer(Steps[Step].Type, Steps[Step].Cycles, false);
+        }
+        if (!Old.SameState(New))
+        {
+            return Fail(Test, Step, "timer state differs");
+        }
+        Old.Advance(Steps[Step].Advance);
+        New.Advance(Steps[Step].Advance);
+        if (FireDue(Old, New, Order, Test, Step) != 0)
+        {
+            return 1;
+        }
+    }
+
+    // Compare far enough away that FixTimers re-arms it
+    Old.SetCompare(0xF0000000);
+    New.SetCompare(0xF0000000);
+    for (; Step < 200; Step++)
+    {
+        Old.SetTimer(CTimerSchedule::SiTimer, 70000, false);
+        New.SetTimer(CTimerSchedule::SiTimer, 70000, false);
+        Old.Advance(25000);
+        New.Advance(25000);
+        if (FireDue(Old, New, Order, Test, Step) != 0)
+        {
+            return 1;
+        }
+    }
+    if (New.DeferredReschedules() == 0)
+    {
+        return Fail(Test, Step, "nothing was deferred");
+    }
+    printf("%s: %u events, %u of %u reschedules deferred\n", Test, (uint32_t)Order.size(), New.DeferredReschedules(), New.DeferredReschedules() + New.Reschedules());
+    return 0;
+}
+
+static int RandomTest(uint32_t Seed, uint32_t Steps)
+{
+    const char * Test = "random";
+    CRebaseTimer Old;
+    CTestTimer New;
+    std::vector<FIRED_EVENT> Order;
+    g_Seed = Seed;
+    uint32_t Compare = Random(0x1000000);
+    Old.Reset(Compare);
+    New.Reset(Compare);
+
+    for (uint32_t Step = 0; Step < Steps; Step++)
+    {
+        uint32_t Op = Random(10);
+        if (Op < 3)
+        {
+            int32_t Cycles = Random(3000);
+            Old.Advance(Cycles);
+            New.Advance(Cycles);
+        }
+        else if (Op < 6)
+        {
+            TimerType Type = (TimerType)(CTimerSchedule::SoftResetTimer + Random(CTimerSchedule::MaxTimer - CTimerSchedule::SoftResetTimer));
+            uint32_t Cycles = Random(200000);
+            bool Relative = Random(4) == 0;
+            Old.SetTimer(Type, Cycles, Relative);
+            New.SetTimer(Type, Cycles, Relative);
+        }
+        else if (Op < 8)
+        {
+            TimerType Type = (TimerType)(CTimerSchedule::SoftResetTimer + Random(CTimerSchedule::MaxTimer - CTimerSchedule::SoftResetTimer));
+            if (Type != CTimerSchedule::ViTimer)
+            {
+                Old.StopTimer(Type);
+                New.StopTimer(Type);
+            }
+        }
+        else if (Op < 9)
+        {
+            uint32_t Compare = Random(0x1000000) * 0x100;
+            Old.SetCompare(Compare);
+            New.SetCompare(Compare);
+        }
+        if (!Old.SameState(New))
+        {
+            return Fail(Test, Step, "timer state differs");
+        }
+        if (FireDue(Old, New, Order, Test, Step) != 0)
+        {
+            return 1;
+        }
+    }
+    printf("%s: seed %u, %u events, %u of %u reschedules deferred\n", Test, Seed, (uint32_t)Order.size(), New.DeferredReschedules(), New.DeferredReschedules() + New.Reschedules());
+    return 0;
+}
+
+int main(void)
+{
+    int Result = DirectedTest();
+    for (uint32_t Seed = 1; Seed <= 8 && Result == 0; Seed++)
+    {
+        Result = RandomTest(Seed, 2000000);
+    }
+    printf("%s\n", Result == 0 ? "SystemTimingTest passed" : "SystemTimingTest FAILED");
+    return Result;
+}
@@ -0,0 +1,246 @@
+/****************************************************************************
+*                                                                           *
+* Project64 - A Nintendo 64 emulator.                                      *
+* http://www.pj64-emu.com/                                                  *
+* Copyright (C) 2012 Project64. All rights reserved.                        *
+*                                                                           *
+* License:                                                                  *
+* GNU/GPLv2 http://www.gnu.org/licenses/gpl-2.0.html                        *
+*                                                                           *
+****************************************************************************/
+// Checks that CTLBPageMap translates every address the same way as the flat
+// 1M entry table CMipsMemoryVM keeps on 32 bit targets, while random ranges
+// are mapped and unmapped the way TLB_Mapped/TLB_Unmaped do it.
+//
+// Then times lookups through both, on an address stream that is mostly
+// KSEG0 with some TLB mapped pages, and prints the time per lookup and the
+// memory each one takes. The timings are only reported, they do not fail
+// the test.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include <Project64-core/N64System/Mips/TLBPageMap.h>
+
+enum
+{
+    FlatEntries = 0x100000,
+    RdramSize = 0x800000,
+};
+
+static uint8_t * const g_Rdram = (uint8_t *)0x10000000;
+
+// The flat table as MemoryVirtualMem.cpp sets it up in Reset
+class CFlatMap
+{
+public:
+    CFlatMap() :
+        m_Table(new size_t[FlatEntries])
+    {
+    }
+
+    ~CFlatMap()
+    {
+        delete[] m_Table;
+    }
+
+    void Reset(uint8_t * Rdram)
+    {
+        memset(m_Table, 0, FlatEntries * sizeof(size_t));
+        for (uint32_t Address = 0x80000000; Address < 0xC0000000; Address += 0x1000)
+        {
+            m_Table[Address >> 12] = ((size_t)Rdram + (Address & 0x1FFFFFFF)) - Address;
+        }
+    }
+
+    void Set(uint32_t VAddr, size_t Value)
+    {
+        m_Table[VAddr >> 12] = Value;
+    }
+
+    inline size_t Lookup(uint32_t VAddr) const
+    {
+        return m_Table[VAddr >> 12];
+    }
+
+private:
+    size_t * m_Table;
+};
+
+static uint32_t g_Seed;
+
+static uint32_t Random(uint32_t Range)
+{
+    g_Seed = g_Seed * 1103515245 + 12345;
+    return ((g_Seed >> 8) & 0xFFFFFF) % Range;
+}
+
+static uint32_t RandomAddress(void)
+{
+    return (Random(0x10000) << 16) | Random(0x10000);
+}
+
+// A virtual address outside of KSEG0/KSEG1, where the TLB maps pages
+static uint32_t RandomTLBAddress(void)
+{
+    uint32_t VAddr = RandomAddress();
+    if ((VAddr & 0xC0000000) == 0x80000000)
+    {
+        VAddr ^= 0x40000000;
+    }
+    return VAddr;
+}
+
+static void Mapped(CFlatMap & Flat, CTLBPageMap & Pages, uint32_t VAddr, uint32_t Len, uint32_t PAddr)
+{
+    for (uint32_t count = VAddr; count - VAddr < Len; count += 0x1000)
+    {
+        size_t Value = ((size_t)g_Rdram + (count - VAddr + PAddr)) - count;
+        Flat.Set(count, Value);
+        Pages.Set(count, Value);
+    }
+}
+
+static void Unmapped(CFlatMap & Flat, CTLBPageMap & Pages, uint32_t VAddr, uint32_t Len)
+{
+    for (uint32_t count = VAddr; count - VAddr < Len; count += 0x1000)
+    {
+        Flat.Set(count, 0);
+        Pages.Set(count, 0);
+    }
+}
+
+static int Check(const CFlatMap & Flat, const CTLBPageMap & Pages, uint32_t VAddr, uint32_t Step)
+{
+    if (Flat.Lookup(VAddr) != Pages.Lookup(VAddr))
+    {
+        printf("step %u: 0x%08X translates to %p in the flat map but %p in the page map\n", Step, VAddr, (void *)Flat.Lookup(VAddr), (void *)Pages.Lookup(VAddr));
+        return 1;
+    }
+    return 0;
+}
+
+static int RandomTest(uint32_t Seed, uint32_t Steps)
+{
+    CFlatMap Flat;
+    CTLBPageMap Pages;
+    std::vector<uint32_t> Mapped;
+    g_Seed = Seed;
+    Flat.Reset(g_Rdram);
+    Pages.Reset(g_Rdram);
+
+    for (uint32_t Step = 0; Step < Steps; Step++)
+    {
+        uint32_t Op = Random(10);
+        if (Op < 3)
+        {
+            uint32_t VAddr = RandomTLBAddress() & ~0xFFF;
+            uint32_t Len = (1 + Random(64)) << 12;
+            if ((VAddr & 0xC0000000) != ((VAddr + Len - 1) & 0xC0000000))
+            {
+                continue;
+            }
+            ::Mapped(Flat, Pages, VAddr, Len, Random(RdramSize) & ~0xFFF);
+            Mapped.push_back(VAddr);
+        }
+        else if (Op < 4 && !Mapped.empty())
+        {
+            uint32_t Index = Random((uint32_t)Mapped.size());
+            Unmapped(Flat, Pages, Mapped[Index], (1 + Random(64)) << 12);
+            Mapped.erase(Mapped.begin() + Index);
+        }
+        else if (Op < 7 && !Mapped.empty())
+        {
+            uint32_t VAddr = Mapped[Random((uint32_t)Mapped.size())] + Random(64 << 12);
+            if (Check(Flat, Pages, VAddr, Step) != 0)
+            {
+                return 1;
+            }
+        }
+        else if (Check(Flat, Pages, RandomAddress(), Step) != 0)
+        {
+            return 1;
+        }
+    }
+
+    for (uint64_t VAddr = 0; VAddr < 0x100000000ull; VAddr += 0x1000)
+    {
+        if (Check(Flat, Pages, (uint32_t)VAddr + Random(0x1000), Steps) != 0)
+        {
+            return 1;
+        }
+    }
+    printf("seed %u: %u ranges mapped, every page matches\n", Seed, (uint32_t)Mapped.size());
+    return 0;
+}
+
+template <class MAP>
+static double TimeLookups(const MAP & Map, const std::vector<uint32_t> & Addresses, uint32_t Passes, size_t & Sum)
+{
+    clock_t Start = clock();
+    for (uint32_t Pass = 0; Pass < Passes; Pass++)
+    {
+        for (size_t i = 0, n = Addresses.size(); i < n; i++)
+        {
+            Sum += Map.Lookup(Addresses[i]);
+        }
+    }
+    return (double)(clock() - Start) * 1e9 / CLOCKS_PER_SEC / ((double)Passes * Addresses.size());
+}
+
+static void Benchmark(void)
+{
+    CFlatMap Flat;
+    CTLBPageMap Pages;
+    g_Seed = 1;
+    Flat.Reset(g_Rdram);
+    Pages.Reset(g_Rdram);
+
+    // A game's worth of TLB mappings, a few ranges in KUSEG and KSSEG
+    const uint32_t Ranges[] = { 0x00000000, 0x00400000, 0x7F000000, 0xC0000000, 0xC0800000 };
+    std::vector<uint32_t> Addresses;
+    for (size_t i = 0; i < sizeof(Ranges) / sizeof(Ranges[0]); i++)
+    {
+        Mapped(Flat, Pages, Ranges[i], 0x100000, (uint32_t)(i * 0x100000));
+    }
+    for (uint32_t i = 0; i < 0x10000; i++)
+    {
+        uint32_t Kind = Random(4);
+        if (Kind == 0)
+        {
+            Addresses.push_back(Ranges[Random(sizeof(Ranges) / sizeof(Ranges[0]))] + Random(0x100000));
+        }
+        else
+        {
+            Addresses.push_back((Kind == 1 ? 0xA0000000 : 0x80000000) + Random(RdramSize));
+        }
+    }
+
+    size_t Sum = 0;
+    double FlatTime = TimeLookups(Flat, Addresses, 2000, Sum);
+    double PagesTime = TimeLookups(Pages, Addresses, 2000, Sum);
+    printf("flat map: %.2f ns per lookup, %u KB\n", FlatTime, (uint32_t)(FlatEntries * sizeof(size_t) / 1024));
+    printf("page map: %.2f ns per lookup, %u KB + %u KB per mapped section (%u)\n", PagesTime, (uint32_t)(sizeof(CTLBPageMap) / 1024),
+        (uint32_t)(0x100 * sizeof(size_t) / 1024), (uint32_t)(sizeof(Ranges) / sizeof(Ranges[0])));
+    if (Sum == 1)
+    {
+        printf("\n");
+    }
+}
+
+int main(void)
+{
+    int Result = 0;
+    for (uint32_t Seed = 1; Seed <= 4 && Result == 0; Seed++)
+    {
+        Result = RandomTest(Seed, 200000);
+    }
+    if (Result == 0)
+    {
+        Benchmark();
+    }
+    printf("%s\n", Result == 0 ? "TLBLookupTest passed" : "TLBLookupTest FAILED");
+    return Result;
+}